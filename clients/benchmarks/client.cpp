@@ -196,6 +196,18 @@ try
             "                           Typically, the number of columns of a matrix on the right-hand side of a problem.\n"
             "                           ")
 
+        ("kl",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Number of sub-diagonals of a band matrix.\n"
+            "                           ")
+
+        ("ku",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Number of super-diagonals of a band matrix.\n"
+            "                           ")
+
         // increment options
         ("inca",
          value<rocblas_int>()->default_value(1),
@@ -215,6 +227,12 @@ try
             "                           Increment between values in matrices C.\n"
             "                           ")
 
+        ("incd",
+         value<rocblas_int>()->default_value(1),
+            "Matrix/vector increment parameter.\n"
+            "                           Increment between values in matrices D.\n"
+            "                           ")
+
         ("incx",
          value<rocblas_int>()->default_value(1),
             "Matrix/vector increment parameter.\n"
@@ -228,6 +246,18 @@ try
             "                           Leading dimension of matrices A.\n"
             "                           ")
 
+        ("ldab",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of band matrices AB.\n"
+            "                           ")
+
+        ("ldaf",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices AF.\n"
+            "                           ")
+
         ("ldb",
          value<rocblas_int>(),
             "Matrix size parameter.\n"
@@ -240,6 +270,42 @@ try
             "                           Leading dimension of matrices C.\n"
             "                           ")
 
+        ("ldd",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices D.\n"
+            "                           ")
+
+        ("lde",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices E.\n"
+            "                           ")
+
+        ("ldf",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices F.\n"
+            "                           ")
+
+        ("ldg",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices G.\n"
+            "                           ")
+
+        ("ldq",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices Q.\n"
+            "                           ")
+
+        ("ldr",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices R.\n"
+            "                           ")
+
         ("ldt",
          value<rocblas_int>(),
             "Matrix size parameter.\n"
@@ -289,6 +355,18 @@ try
             "                           Stride for matrices/vectors A.\n"
             "                           ")
 
+        ("strideAB",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for band matrices AB.\n"
+            "                           ")
+
+        ("strideAF",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices/vectors AF.\n"
+            "                           ")
+
         ("strideB",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -313,11 +391,17 @@ try
             "                           Stride for vectors ifail.\n"
             "                           ")
 
+        ("strideJ",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors jpvt.\n"
+            "                           ")
+
 
         ("strideQ",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
-            "                           Stride for vectors tauq.\n"
+            "                           Stride for vectors tauq or matrices Q.\n"
             "                           ")
 
         ("strideP",
@@ -326,6 +410,12 @@ try
             "                           Stride for vectors tau, taup, and ipiv.\n"
             "                           ")
 
+        ("strideR",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices R.\n"
+            "                           ")
+
         ("strideS",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -444,6 +534,13 @@ try
             "                           Only applicable to laswp.\n"
             "                           ")
 
+        // qr updating options
+        ("j",
+         value<rocblas_int>(),
+            "Index of the row or column to be inserted or deleted.\n"
+            "                           Only applicable to qrinr, qrder, qrinc, and qrdec.\n"
+            "                           ")
+
         // gesvd options
         ("left_svect",
          value<char>()->default_value('N'),
@@ -497,6 +594,12 @@ try
             "                           Only applicable to block tridiagonal matrix APIs.\n"
             "                           ")
 
+        ("nbr",
+         value<rocblas_int>(),
+            "Number of rows and columns in the border.\n"
+            "                           Only applicable to bordered block tridiagonal matrix APIs.\n"
+            "                           ")
+
         // partial eigenvalue/singular value decomposition options
         ("il",
          value<rocblas_int>(),
@@ -559,6 +662,12 @@ try
             "                           Used in iterative Jacobi and partial eigenvalue decomposition functions.\n"
             "                           ")
 
+        ("rcond",
+         value<double>(),
+            "Relative threshold used to determine the effective rank of a matrix.\n"
+            "                           Used in rank-revealing least-squares functions.\n"
+            "                           ")
+
         ("direct",
          value<char>()->default_value('F'),
             "F = forward, B = backward.\n"
@@ -584,6 +693,18 @@ try
             "                           Problem type for generalized eigenproblems.\n"
             "                           ")
 
+        ("mode",
+         value<char>()->default_value('N'),
+            "N = normal equations, Q = QR factorization.\n"
+            "                           Method used to solve least-squares problems.\n"
+            "                           ")
+
+        ("norm",
+         value<char>()->default_value('O'),
+            "O = one-norm, I = infinity-norm, M = max-abs value, F = Frobenius norm.\n"
+            "                           The norm to be computed or used by the function.\n"
+            "                           ")
+
         ("side",
          value<char>(),
             "L = left, R = right.\n"
@@ -654,6 +775,8 @@ try
     argus.validate_esort("esort");
     argus.validate_itype("itype");
     argus.validate_rfinfo_mode("rfinfo_mode");
+    argus.validate_norm("norm");
+    argus.validate_lsq_mode("mode");
 
     // prepare logging infrastructure and ignore environment variables
     rocsolver_log_begin();
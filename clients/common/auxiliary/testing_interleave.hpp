@@ -0,0 +1,383 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T>
+void interleave_checkBadArgs(const rocblas_handle handle,
+                             const rocblas_int m,
+                             const rocblas_int n,
+                             T dA,
+                             const rocblas_int lda,
+                             const rocblas_stride stA,
+                             T dB,
+                             const rocblas_int incb,
+                             const rocblas_int ldb,
+                             const rocblas_stride stB,
+                             const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_interleave(nullptr, m, n, dA, lda, stA, dB, incb, ldb, stB, bc),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_deinterleave(nullptr, m, n, dB, incb, ldb, stB, dA, lda, stA, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_interleave(handle, m, n, dA, lda, stA, dB, incb, ldb, stB, -1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_deinterleave(handle, m, n, dB, incb, ldb, stB, dA, lda, stA, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_interleave(handle, m, n, (T) nullptr, lda, stA, dB, incb, ldb, stB, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_interleave(handle, m, n, dA, lda, stA, (T) nullptr, incb, ldb, stB, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_deinterleave(handle, m, n, (T) nullptr, incb, ldb, stB, dA, lda, stA, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_deinterleave(handle, m, n, dB, incb, ldb, stB, (T) nullptr, lda, stA, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_interleave(handle, 0, n, (T) nullptr, lda, stA, (T) nullptr, incb, ldb, stB, bc),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_deinterleave(handle, m, 0, (T) nullptr, incb, ldb, stB,
+                                                 (T) nullptr, lda, stA, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_interleave(handle, m, n, (T) nullptr, lda, stA, (T) nullptr, incb, ldb, stB, 0),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_interleave_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int incb = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+
+    // check bad arguments
+    interleave_checkBadArgs(handle, m, n, dA.data(), lda, stA, dB.data(), incb, ldb, stB, bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void interleave_initData(const rocblas_handle handle, Td& dA, Td& dB, Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(hipMemset(dB.data(), 0, sizeof(T) * dB.nmemb()));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void interleave_getError(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         Td& dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         Td& dB,
+                         const rocblas_int incb,
+                         const rocblas_int ldb,
+                         const rocblas_stride stB,
+                         const rocblas_int bc,
+                         Th& hA,
+                         Th& hARes,
+                         Th& hBRes,
+                         double* max_err)
+{
+    // input data initialization
+    interleave_initData<true, true, T>(handle, dA, dB, hA);
+
+    // execute computations
+    // GPU lapack
+    // (convert to interleaved form, clear the input, and convert back)
+    CHECK_ROCBLAS_ERROR(rocsolver_interleave(handle, m, n, dA.data(), lda, stA, dB.data(), incb,
+                                             ldb, stB, bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(T) * dA.nmemb()));
+    CHECK_ROCBLAS_ERROR(rocsolver_deinterleave(handle, m, n, dB.data(), incb, ldb, stB, dA.data(),
+                                               lda, stA, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // error |hA - hRes| (elements must be identical)
+    *max_err = 0;
+    double diff;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                diff = std::abs(hBRes[0][i * incb + j * ldb + b * stB]
+                                - hA[0][i + j * lda + b * stA]);
+                *max_err = diff > *max_err ? diff : *max_err;
+                diff = std::abs(hARes[0][i + j * lda + b * stA] - hA[0][i + j * lda + b * stA]);
+                *max_err = diff > *max_err ? diff : *max_err;
+            }
+        }
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void interleave_getPerfData(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            Td& dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            Td& dB,
+                            const rocblas_int incb,
+                            const rocblas_int ldb,
+                            const rocblas_stride stB,
+                            const rocblas_int bc,
+                            Th& hA,
+                            double* gpu_time_used,
+                            double* cpu_time_used,
+                            const rocblas_int hot_calls,
+                            const int profile,
+                            const bool profile_kernels,
+                            const bool perf)
+{
+    if(!perf)
+    {
+        // there is no direct CPU/LAPACK equivalent for this function, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    interleave_initData<true, true, T>(handle, dA, dB, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_ROCBLAS_ERROR(rocsolver_interleave(handle, m, n, dA.data(), lda, stA, dB.data(),
+                                                 incb, ldb, stB, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        start = get_time_us_sync(stream);
+        rocsolver_interleave(handle, m, n, dA.data(), lda, stA, dB.data(), incb, ldb, stB, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_interleave(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_int incb = argus.get<rocblas_int>("incb", argus.batch_count);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", incb * m);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", 1);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = std::max(size_t(lda) * n, size_t(stA)) * bc;
+    size_t size_B = std::max(size_t(ldb) * n, size_t(stB)) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || incb < 1 || ldb < incb * m || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_interleave(handle, m, n, (T*)nullptr, lda, stA, (T*)nullptr,
+                                                   incb, ldb, stB, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_interleave(handle, m, n, (T*)nullptr, lda, stA, (T*)nullptr,
+                                               incb, ldb, stB, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, size_BRes, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dB(size_B, 1, size_B, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_interleave(handle, m, n, dA.data(), lda, stA, dB.data(),
+                                                   incb, ldb, stB, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        interleave_getError<T>(handle, m, n, dA, lda, stA, dB, incb, ldb, stB, bc, hA, hARes, hBRes,
+                               &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        interleave_getPerfData<T>(handle, m, n, dA, lda, stA, dB, incb, ldb, stB, bc, hA,
+                                  &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                  argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // no tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 0);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "lda", "strideA", "incb", "ldb", "strideB",
+                                   "batch_c");
+            rocsolver_bench_output(m, n, lda, stA, incb, ldb, stB, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_INTERLEAVE(...) \
+    extern template void testing_interleave<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_INTERLEAVE, FOREACH_SCALAR_TYPE, APPLY_STAMP)
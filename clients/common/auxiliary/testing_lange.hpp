@@ -0,0 +1,513 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/** Calls LANGE, or LANSY/LANHE if SYM is true (m is ignored in that case) **/
+template <bool SYM, typename T, typename S>
+rocblas_status lange_run(const bool STRIDED,
+                         const rocblas_handle handle,
+                         const rocsolver_norm_type norm,
+                         const rocblas_fill uplo,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T A,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         S anorm,
+                         const rocblas_int bc)
+{
+    if(SYM)
+        return rocsolver_lansy_lanhe(STRIDED, handle, norm, uplo, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_lange(STRIDED, handle, norm, m, n, A, lda, stA, anorm, bc);
+}
+
+template <bool STRIDED, bool SYM, typename T, typename S>
+void lange_checkBadArgs(const rocblas_handle handle,
+                        const rocsolver_norm_type norm,
+                        const rocblas_fill uplo,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        S dAnorm,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        lange_run<SYM>(STRIDED, nullptr, norm, uplo, m, n, dA, lda, stA, dAnorm, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(lange_run<SYM>(STRIDED, handle, rocsolver_norm_type(0), uplo, m, n, dA,
+                                         lda, stA, dAnorm, bc),
+                          rocblas_status_invalid_value);
+    if(SYM)
+        EXPECT_ROCBLAS_STATUS(lange_run<SYM>(STRIDED, handle, norm, rocblas_fill_full, m, n, dA,
+                                             lda, stA, dAnorm, bc),
+                              rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA, lda, stA, dAnorm, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, (T) nullptr, lda, stA, dAnorm, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA, lda, stA, (S) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        lange_run<SYM>(STRIDED, handle, norm, uplo, 0, 0, (T) nullptr, lda, stA, dAnorm, bc),
+        rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA, lda, stA, (S) nullptr, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool SYM, typename T>
+void testing_lange_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocsolver_norm_type norm = rocsolver_norm_one;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dAnorm(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAnorm.memcheck());
+
+    if(BATCHED)
+    {
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        lange_checkBadArgs<STRIDED, SYM>(handle, norm, uplo, m, n, dA.data(), lda, stA,
+                                         dAnorm.data(), bc);
+    }
+    else
+    {
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        lange_checkBadArgs<STRIDED, SYM>(handle, norm, uplo, m, n, dA.data(), lda, stA,
+                                         dAnorm.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void lange_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_int bc,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool SYM, typename T, typename S>
+S lange_host(const rocsolver_norm_type norm,
+             const rocblas_fill uplo,
+             const rocblas_int m,
+             const rocblas_int n,
+             T* A,
+             const rocblas_int lda,
+             S* work)
+{
+    char normC = rocsolver2char_norm_type(norm);
+    if(SYM)
+        return cpu_lansy(normC, uplo, n, A, lda, work);
+    else
+        return cpu_lange(normC, m, n, A, lda, work);
+}
+
+template <bool STRIDED, bool SYM, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void lange_getError(const rocblas_handle handle,
+                    const rocsolver_norm_type norm,
+                    const rocblas_fill uplo,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Sd& dAnorm,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Sh& hAnorm,
+                    Sh& hAnormRes,
+                    double* max_err)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<S> work(std::max(m, n));
+
+    // input data initialization
+    lange_initData<true, true, T>(handle, m, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA.data(), lda, stA,
+                                       dAnorm.data(), bc));
+    CHECK_HIP_ERROR(hAnormRes.transfer_from(dAnorm));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        hAnorm[b][0] = lange_host<SYM>(norm, uplo, m, n, hA[b], lda, work.data());
+
+    // error is |anorm - anormRes| / max(1, anorm)
+    // (the sums may be accumulated in a different order)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        S anorm = hAnorm[b][0];
+        err = std::abs(anorm - hAnormRes[b][0]) / std::max(S(1), anorm);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, bool SYM, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void lange_getPerfData(const rocblas_handle handle,
+                       const rocsolver_norm_type norm,
+                       const rocblas_fill uplo,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Sd& dAnorm,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Sh& hAnorm,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<S> work(std::max(m, n));
+
+    if(!perf)
+    {
+        lange_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if no perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            hAnorm[b][0] = lange_host<SYM>(norm, uplo, m, n, hA[b], lda, work.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    lange_initData<true, true, T>(handle, m, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_ROCBLAS_ERROR(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA.data(), lda, stA,
+                                           dAnorm.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        start = get_time_us_sync(stream);
+        lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA.data(), lda, stA, dAnorm.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool SYM, typename T>
+void testing_lange(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char normC = argus.get<char>("norm");
+    char uploC = SYM ? argus.get<char>("uplo") : 'U';
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int m = SYM ? n : argus.get<rocblas_int>("m", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocsolver_norm_type norm = char2rocsolver_norm_type(normC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n,
+                                                 (T* const*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, (T*)nullptr,
+                                                 lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query if necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, (T* const*)nullptr,
+                                             lda, stA, (S*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, (T*)nullptr, lda,
+                                             stA, (S*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<S> hAnorm(1, 1, 1, bc);
+    host_strided_batch_vector<S> hAnormRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dAnorm(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dAnorm.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA.data(), lda,
+                                                 stA, dAnorm.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            lange_getError<STRIDED, SYM, T>(handle, norm, uplo, m, n, dA, lda, stA, dAnorm, bc, hA,
+                                            hAnorm, hAnormRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            lange_getPerfData<STRIDED, SYM, T>(handle, norm, uplo, m, n, dA, lda, stA, dAnorm, bc,
+                                               hA, hAnorm, &gpu_time_used, &cpu_time_used,
+                                               hot_calls, argus.profile, argus.profile_kernels,
+                                               argus.perf);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(lange_run<SYM>(STRIDED, handle, norm, uplo, m, n, dA.data(), lda,
+                                                 stA, dAnorm.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            lange_getError<STRIDED, SYM, T>(handle, norm, uplo, m, n, dA, lda, stA, dAnorm, bc, hA,
+                                            hAnorm, hAnormRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            lange_getPerfData<STRIDED, SYM, T>(handle, norm, uplo, m, n, dA, lda, stA, dAnorm, bc,
+                                               hA, hAnorm, &gpu_time_used, &cpu_time_used,
+                                               hot_calls, argus.profile, argus.profile_kernels,
+                                               argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(SYM)
+            {
+                if(BATCHED)
+                {
+                    rocsolver_bench_output("norm", "uplo", "n", "lda", "batch_c");
+                    rocsolver_bench_output(normC, uploC, n, lda, bc);
+                }
+                else if(STRIDED)
+                {
+                    rocsolver_bench_output("norm", "uplo", "n", "lda", "strideA", "batch_c");
+                    rocsolver_bench_output(normC, uploC, n, lda, stA, bc);
+                }
+                else
+                {
+                    rocsolver_bench_output("norm", "uplo", "n", "lda");
+                    rocsolver_bench_output(normC, uploC, n, lda);
+                }
+            }
+            else
+            {
+                if(BATCHED)
+                {
+                    rocsolver_bench_output("norm", "m", "n", "lda", "batch_c");
+                    rocsolver_bench_output(normC, m, n, lda, bc);
+                }
+                else if(STRIDED)
+                {
+                    rocsolver_bench_output("norm", "m", "n", "lda", "strideA", "batch_c");
+                    rocsolver_bench_output(normC, m, n, lda, stA, bc);
+                }
+                else
+                {
+                    rocsolver_bench_output("norm", "m", "n", "lda");
+                    rocsolver_bench_output(normC, m, n, lda);
+                }
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_LANGE(...) extern template void testing_lange<__VA_ARGS__>(Arguments&);
+
+// (the third template argument selects LANGE or LANSY/LANHE)
+INSTANTIATE(EXTERN_TESTING_LANGE,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
@@ -0,0 +1,602 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void gbtrf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int kl,
+                        const rocblas_int ku,
+                        T dAB,
+                        const rocblas_int ldab,
+                        const rocblas_stride stAB,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        U dInfo,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gbtrf(STRIDED, nullptr, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv,
+                                              stP, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, (T) nullptr, ldab, stAB,
+                                          dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB, ldab, stAB,
+                                          (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv,
+                                          stP, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, 0, n, kl, ku, (T) nullptr, ldab, stAB,
+                                          (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, 0, kl, ku, (T) nullptr, ldab, stAB,
+                                          (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv,
+                                              stP, (U) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv,
+                                              stP, dInfo, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gbtrf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int kl = 1;
+    rocblas_int ku = 1;
+    rocblas_int ldab = 4;
+    rocblas_stride stAB = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dAB(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        gbtrf_checkBadArgs<STRIDED>(handle, m, n, kl, ku, dAB.data(), ldab, stAB, dIpiv.data(),
+                                    stP, dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dAB(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        gbtrf_checkBadArgs<STRIDED>(handle, m, n, kl, ku, dAB.data(), ldab, stAB, dIpiv.data(),
+                                    stP, dInfo.data(), bc);
+    }
+}
+
+// Initializes the band matrices in LAPACK band storage. The entries outside of the band,
+// including the first kl rows that receive the fill-in, are left with random values, as
+// they must not be referenced (or must be overwritten) by the factorization.
+template <typename T, typename Th>
+void gbtrf_initBand(const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int kl,
+                    const rocblas_int ku,
+                    const rocblas_int ldab,
+                    const rocblas_int bc,
+                    Th& hAB,
+                    const bool singular)
+{
+    rocblas_int kv = kl + ku;
+    rocblas_init<T>(hAB, true);
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // make the kl-th subdiagonal dominant to test pivoting, and
+        // the diagonal dominant where there is no kl-th subdiagonal
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = std::max(0, j - ku); i < std::min(m, j + kl + 1); i++)
+            {
+                if((i == j + kl) || (i == j && j + kl >= m))
+                    hAB[b][kv + i - j + j * ldab] += 400;
+                else
+                    hAB[b][kv + i - j + j * ldab] -= 4;
+            }
+        }
+
+        if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+        {
+            // When required, add some singularities
+            // (always the same elements for debugging purposes).
+            // The algorithm must detect the first zero pivot in those
+            // matrices in the batch that are singular
+            rocblas_int j = n / 4 + b;
+            j -= (j / n) * n;
+            for(rocblas_int i = std::max(0, j - ku); i < std::min(m, j + kl + 1); i++)
+                hAB[b][kv + i - j + j * ldab] = 0;
+            j = n / 2 + b;
+            j -= (j / n) * n;
+            for(rocblas_int i = std::max(0, j - ku); i < std::min(m, j + kl + 1); i++)
+                hAB[b][kv + i - j + j * ldab] = 0;
+        }
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th>
+void gbtrf_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int kl,
+                    const rocblas_int ku,
+                    Td& dAB,
+                    const rocblas_int ldab,
+                    const rocblas_stride stAB,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hAB,
+                    const bool singular)
+{
+    if(CPU)
+        gbtrf_initBand<T>(m, n, kl, ku, ldab, bc, hAB, singular);
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gbtrf_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int kl,
+                    const rocblas_int ku,
+                    Td& dAB,
+                    const rocblas_int ldab,
+                    const rocblas_stride stAB,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hAB,
+                    Th& hABRes,
+                    Uh& hIpiv,
+                    Uh& hIpivRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    // input data initialization
+    gbtrf_initData<true, true, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo, bc,
+                                  hAB, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB.data(), ldab, stAB,
+                                        dIpiv.data(), stP, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hABRes.transfer_from(dAB));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cpu_gbtrf(m, n, kl, ku, hAB[b], ldab, hIpiv[b], hInfo[b]);
+
+    // only the entries that correspond to elements of the matrix are compared
+    // (the rest of the band storage is not referenced)
+    rocblas_int kv = kl + ku;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int r = 0; r < ldab; r++)
+            {
+                rocblas_int i = r - kv + j;
+                if(r > kv + kl || i < 0 || i >= m)
+                {
+                    hAB[b][r + j * ldab] = 0;
+                    hABRes[b][r + j * ldab] = 0;
+                }
+            }
+        }
+    }
+
+    // expecting original matrix to be non-singular
+    // error is ||hAB - hABRes|| / ||hAB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', ldab, n, ldab, hAB[b], hABRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        err = 0;
+        for(rocblas_int i = 0; i < std::min(m, n); ++i)
+        {
+            EXPECT_EQ(hIpiv[b][i], hIpivRes[b][i]) << "where b = " << b << ", i = " << i;
+            if(hIpiv[b][i] != hIpivRes[b][i])
+                err++;
+        }
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gbtrf_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int kl,
+                       const rocblas_int ku,
+                       Td& dAB,
+                       const rocblas_int ldab,
+                       const rocblas_stride stAB,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hAB,
+                       Uh& hIpiv,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    if(!perf)
+    {
+        gbtrf_initData<true, false, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                       bc, hAB, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cpu_gbtrf(m, n, kl, ku, hAB[b], ldab, hIpiv[b], hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gbtrf_initData<true, false, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo, bc,
+                                   hAB, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gbtrf_initData<false, true, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                       bc, hAB, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB.data(), ldab, stAB,
+                                            dIpiv.data(), stP, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gbtrf_initData<false, true, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                       bc, hAB, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB.data(), ldab, stAB, dIpiv.data(), stP,
+                        dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gbtrf(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int kl = argus.get<rocblas_int>("kl");
+    rocblas_int ku = argus.get<rocblas_int>("ku", kl);
+    rocblas_int ldab = argus.get<rocblas_int>("ldab", 2 * kl + ku + 1);
+    rocblas_stride stAB = argus.get<rocblas_stride>("strideAB", ldab * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", std::min(m, n));
+
+    rocblas_int bc = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    rocblas_stride stABRes = (argus.unit_check || argus.norm_check) ? stAB : 0;
+    rocblas_stride stPRes = (argus.unit_check || argus.norm_check) ? stP : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_AB = size_t(ldab) * n;
+    size_t size_P = size_t(std::min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ABRes = (argus.unit_check || argus.norm_check) ? size_AB : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku,
+                                                  (T* const*)nullptr, ldab, stAB,
+                                                  (rocblas_int*)nullptr, stP,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, (T*)nullptr, ldab,
+                                                  stAB, (rocblas_int*)nullptr, stP,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, (T* const*)nullptr,
+                                              ldab, stAB, (rocblas_int*)nullptr, stP,
+                                              (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, (T*)nullptr, ldab,
+                                              stAB, (rocblas_int*)nullptr, stP,
+                                              (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hAB(size_AB, 1, bc);
+        host_batch_vector<T> hABRes(size_ABRes, 1, bc);
+        host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, stPRes, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T> dAB(size_AB, 1, bc);
+        device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_AB)
+            CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB.data(), ldab,
+                                                  stAB, dIpiv.data(), stP, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gbtrf_getError<STRIDED, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                       bc, hAB, hABRes, hIpiv, hIpivRes, hInfo, hInfoRes,
+                                       &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gbtrf_getPerfData<STRIDED, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                          bc, hAB, hIpiv, hInfo, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hAB(size_AB, 1, stAB, bc);
+        host_strided_batch_vector<T> hABRes(size_ABRes, 1, stABRes, bc);
+        host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, stPRes, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T> dAB(size_AB, 1, stAB, bc);
+        device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_AB)
+            CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gbtrf(STRIDED, handle, m, n, kl, ku, dAB.data(), ldab,
+                                                  stAB, dIpiv.data(), stP, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gbtrf_getError<STRIDED, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                       bc, hAB, hABRes, hIpiv, hIpivRes, hInfo, hInfoRes,
+                                       &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gbtrf_getPerfData<STRIDED, T>(handle, m, n, kl, ku, dAB, ldab, stAB, dIpiv, stP, dInfo,
+                                          bc, hAB, hIpiv, hInfo, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "kl", "ku", "ldab", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, kl, ku, ldab, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "kl", "ku", "ldab", "strideAB", "strideP",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, kl, ku, ldab, stAB, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "kl", "ku", "ldab");
+                rocsolver_bench_output(m, n, kl, ku, ldab);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GBTRF(...) extern template void testing_gbtrf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GBTRF, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,761 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void geblttrf_checkBadArgs(const rocblas_handle handle,
+                           const rocblas_int nb,
+                           const rocblas_int nblocks,
+                           T dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           T dB,
+                           const rocblas_int ldb,
+                           const rocblas_stride stB,
+                           T dC,
+                           const rocblas_int ldc,
+                           const rocblas_stride stC,
+                           T dD,
+                           const rocblas_int ldd,
+                           const rocblas_stride stD,
+                           U dIpiv,
+                           const rocblas_stride stP,
+                           U dInfo,
+                           const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, nullptr, nb, nblocks, dA, lda, stA, dB, ldb,
+                                             stB, dC, ldc, stC, dD, ldd, stD, dIpiv, stP, dInfo,
+                                             bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA, dB,
+                                                 ldb, stB, dC, ldc, stC, dD, ldd, stD, dIpiv, stP,
+                                                 dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, (T) nullptr, lda, stA,
+                                             dB, ldb, stB, dC, ldc, stC, dD, ldd, stD, dIpiv, stP,
+                                             dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA,
+                                             (T) nullptr, ldb, stB, dC, ldc, stC, dD, ldd, stD,
+                                             dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA, dB, ldb,
+                                             stB, (T) nullptr, ldc, stC, dD, ldd, stD, dIpiv, stP,
+                                             dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA, dB, ldb,
+                                             stB, dC, ldc, stC, (T) nullptr, ldd, stD, dIpiv, stP,
+                                             dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA, dB, ldb,
+                                             stB, dC, ldc, stC, dD, ldd, stD, (U) nullptr, stP,
+                                             dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA, dB, ldb,
+                                             stB, dC, ldc, stC, dD, ldd, stD, dIpiv, stP,
+                                             (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, 0, nblocks, (T) nullptr, lda, stA,
+                                             (T) nullptr, ldb, stB, (T) nullptr, ldc, stC,
+                                             (T) nullptr, ldd, stD, (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, 0, (T) nullptr, lda, stA,
+                                             (T) nullptr, ldb, stB, (T) nullptr, ldc, stC,
+                                             (T) nullptr, ldd, stD, (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA, lda, stA, dB,
+                                                 ldb, stB, dC, ldc, stC, dD, ldd, stD, dIpiv, stP,
+                                                 (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geblttrf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int nb = 1;
+    rocblas_int nblocks = 3;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_int ldc = 1;
+    rocblas_int ldd = 1;
+    rocblas_stride stA = 3;
+    rocblas_stride stB = 3;
+    rocblas_stride stC = 3;
+    rocblas_stride stD = 3;
+    rocblas_stride stP = 3;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dC(1, 1, 1);
+        device_batch_vector<T> dD(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        geblttrf_checkBadArgs<STRIDED>(handle, nb, nblocks, dA.data(), lda, stA, dB.data(), ldb,
+                                       stB, dC.data(), ldc, stC, dD.data(), ldd, stD, dIpiv.data(),
+                                       stP, dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        geblttrf_checkBadArgs<STRIDED>(handle, nb, nblocks, dA.data(), lda, stA, dB.data(), ldb,
+                                       stB, dC.data(), ldc, stC, dD.data(), ldd, stD, dIpiv.data(),
+                                       stP, dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geblttrf_initData(const rocblas_handle handle,
+                       const rocblas_int nb,
+                       const rocblas_int nblocks,
+                       Td& dA,
+                       const rocblas_int lda,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       Td& dC,
+                       const rocblas_int ldc,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hB,
+                       Th& hC,
+                       const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, false);
+        rocblas_init<T>(hC, false);
+
+        rocblas_int n = nb * nblocks;
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // shift the entries so that the diagonal blocks are not dominant
+            // and row interchanges are required
+            for(rocblas_int i = 0; i < nb; i++)
+            {
+                for(rocblas_int j = 0; j < nb; j++)
+                {
+                    for(rocblas_int k = 0; k < nblocks; k++)
+                        hB[b][i + j * ldb + k * ldb * nb] -= 4;
+
+                    for(rocblas_int k = 0; k < nblocks - 1; k++)
+                    {
+                        hA[b][i + j * lda + k * lda * nb] += 4;
+                        hC[b][i + j * ldc + k * ldc * nb] -= 4;
+                    }
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes)
+
+                for(rocblas_int jj : {n / 4 + b, n / 2 + b, n - 1 + b})
+                {
+                    jj -= (jj / n) * n;
+                    rocblas_int j = jj % nb;
+                    rocblas_int k = jj / nb;
+                    for(rocblas_int i = 0; i < nb; i++)
+                    {
+                        // zero the jj-th column
+                        hB[b][i + j * ldb + k * ldb * nb] = 0;
+                        if(k < nblocks - 1)
+                            hA[b][i + j * lda + k * lda * nb] = 0;
+                        if(k > 0)
+                            hC[b][i + j * ldc + (k - 1) * ldc * nb] = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geblttrf_getError(const rocblas_handle handle,
+                       const rocblas_int nb,
+                       const rocblas_int nblocks,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Td& dC,
+                       const rocblas_int ldc,
+                       const rocblas_stride stC,
+                       Td& dD,
+                       const rocblas_int ldd,
+                       const rocblas_stride stD,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hARes,
+                       Th& hB,
+                       Th& hBRes,
+                       Th& hC,
+                       Th& hCRes,
+                       Th& hDRes,
+                       Uh& hIpivRes,
+                       Uh& hInfoRes,
+                       double* max_err,
+                       const bool singular)
+{
+    int n = nb * nblocks;
+    std::vector<T> M(n * n);
+    std::vector<T> MRes(n * n);
+
+    // input data initialization
+    geblttrf_initData<true, true, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc, hA, hB, hC,
+                                     singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA.data(), lda, stA,
+                                           dB.data(), ldb, stB, dC.data(), ldc, stC, dD.data(), ldd,
+                                           stD, dIpiv.data(), stP, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hCRes.transfer_from(dC));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // check info for singularities
+    double err = 0;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+        {
+            EXPECT_GT(hInfoRes[b][0], 0) << "where b = " << b;
+            if(hInfoRes[b][0] <= 0)
+                err++;
+        }
+        else
+        {
+            EXPECT_EQ(hInfoRes[b][0], 0) << "where b = " << b;
+            if(hInfoRes[b][0] != 0)
+                err++;
+        }
+    }
+    *max_err += err;
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hInfoRes[b][0] == 0)
+        {
+            // move the blocks of the upper factor into full matrix MRes
+            std::fill(MRes.begin(), MRes.end(), T(0));
+            for(rocblas_int k = 0; k < nblocks; k++)
+            {
+                for(rocblas_int i = 0; i < nb; i++)
+                {
+                    for(rocblas_int j = 0; j < nb; j++)
+                    {
+                        if(i <= j)
+                            MRes[i + j * n + k * (n + 1) * nb]
+                                = hBRes[b][i + j * ldb + k * ldb * nb];
+                        if(k < nblocks - 1)
+                            MRes[i + (j + nb) * n + k * (n + 1) * nb]
+                                = hCRes[b][i + j * ldc + k * ldc * nb];
+                        if(k < nblocks - 2)
+                            MRes[i + (j + 2 * nb) * n + k * (n + 1) * nb]
+                                = hDRes[b][i + j * ldd + k * ldd * nb];
+                    }
+                }
+            }
+
+            // reconstruct input matrix from factors by applying the transformations
+            // L_k and P_k from the last block column to the first
+            for(rocblas_int k = nblocks - 1; k >= 0; k--)
+            {
+                if(k < nblocks - 1)
+                    cpu_gemm(rocblas_operation_none, rocblas_operation_none, nb, n, nb, T(1),
+                             hARes[b] + k * lda * nb, lda, MRes.data() + k * nb, n, T(1),
+                             MRes.data() + (k + 1) * nb, n);
+
+                cpu_trmm(rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                         rocblas_diagonal_unit, nb, n, T(1), hBRes[b] + k * ldb * nb, ldb,
+                         MRes.data() + k * nb, n);
+
+                for(rocblas_int i = nb - 1; i >= 0; i--)
+                {
+                    rocblas_int ii = k * nb + i;
+                    rocblas_int p = hIpivRes[b][ii] - 1;
+                    if(p != ii)
+                    {
+                        for(rocblas_int j = 0; j < n; j++)
+                            std::swap(MRes[ii + j * n], MRes[p + j * n]);
+                    }
+                }
+            }
+
+            // form original matrix from original blocks
+            std::fill(M.begin(), M.end(), T(0));
+            for(rocblas_int k = 0; k < nblocks; k++)
+            {
+                for(rocblas_int i = 0; i < nb; i++)
+                {
+                    for(rocblas_int j = 0; j < nb; j++)
+                    {
+                        M[i + j * n + k * (n + 1) * nb] = hB[b][i + j * ldb + k * ldb * nb];
+
+                        if(k < nblocks - 1)
+                        {
+                            M[(i + nb) + j * n + k * (n + 1) * nb]
+                                = hA[b][i + j * lda + k * lda * nb];
+                            M[i + (j + nb) * n + k * (n + 1) * nb]
+                                = hC[b][i + j * ldc + k * ldc * nb];
+                        }
+                    }
+                }
+            }
+
+            // error is ||M - MRes|| / ||M||
+            // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+            // IT MIGHT BE REVISITED IN THE FUTURE)
+            // using frobenius norm
+            err = norm_error('F', n, n, n, M.data(), MRes.data());
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th>
+void geblttrf_getPerfData(const rocblas_handle handle,
+                          const rocblas_int nb,
+                          const rocblas_int nblocks,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          Td& dB,
+                          const rocblas_int ldb,
+                          const rocblas_stride stB,
+                          Td& dC,
+                          const rocblas_int ldc,
+                          const rocblas_stride stC,
+                          Td& dD,
+                          const rocblas_int ldd,
+                          const rocblas_stride stD,
+                          Ud& dIpiv,
+                          const rocblas_stride stP,
+                          Ud& dInfo,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Th& hB,
+                          Th& hC,
+                          double* gpu_time_used,
+                          double* cpu_time_used,
+                          const rocblas_int hot_calls,
+                          const int profile,
+                          const bool profile_kernels,
+                          const bool perf,
+                          const bool singular)
+{
+    if(!perf)
+    {
+        // there is no direct CPU/LAPACK equivalent for this function, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    geblttrf_initData<true, false, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc, hA, hB,
+                                      hC, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geblttrf_initData<false, true, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc, hA,
+                                          hB, hC, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA.data(), lda, stA,
+                                               dB.data(), ldb, stB, dC.data(), ldc, stC, dD.data(),
+                                               ldd, stD, dIpiv.data(), stP, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geblttrf_initData<false, true, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc, hA,
+                                          hB, hC, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA.data(), lda, stA, dB.data(), ldb, stB,
+                           dC.data(), ldc, stC, dD.data(), ldd, stD, dIpiv.data(), stP,
+                           dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geblttrf(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int nb = argus.get<rocblas_int>("nb");
+    rocblas_int nblocks = argus.get<rocblas_int>("nblocks");
+    rocblas_int lda = argus.get<rocblas_int>("lda", nb);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", nb);
+    rocblas_int ldc = argus.get<rocblas_int>("ldc", nb);
+    rocblas_int ldd = argus.get<rocblas_int>("ldd", nb);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * nb * nblocks);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nb * nblocks);
+    rocblas_stride stC = argus.get<rocblas_stride>("strideC", ldc * nb * nblocks);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", ldd * nb * nblocks);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", nb * nblocks);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+    rocblas_stride stCRes = (argus.unit_check || argus.norm_check) ? stC : 0;
+    rocblas_stride stDRes = (argus.unit_check || argus.norm_check) ? stD : 0;
+    rocblas_stride stPRes = (argus.unit_check || argus.norm_check) ? stP : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * nb * nblocks;
+    size_t size_B = size_t(ldb) * nb * nblocks;
+    size_t size_C = size_t(ldc) * nb * nblocks;
+    size_t size_D = size_t(ldd) * nb * nblocks;
+    size_t size_P = size_t(nb) * nblocks;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+    size_t size_CRes = (argus.unit_check || argus.norm_check) ? size_C : 0;
+    size_t size_DRes = (argus.unit_check || argus.norm_check) ? size_D : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (nb < 0 || nblocks < 0 || lda < nb || ldb < nb || ldc < nb || ldd < nb || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks,
+                                                     (T* const*)nullptr, lda, stA,
+                                                     (T* const*)nullptr, ldb, stB,
+                                                     (T* const*)nullptr, ldc, stC,
+                                                     (T* const*)nullptr, ldd, stD,
+                                                     (rocblas_int*)nullptr, stP,
+                                                     (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, (T*)nullptr, lda,
+                                                     stA, (T*)nullptr, ldb, stB, (T*)nullptr, ldc,
+                                                     stC, (T*)nullptr, ldd, stD,
+                                                     (rocblas_int*)nullptr, stP,
+                                                     (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, (T* const*)nullptr,
+                                                 lda, stA, (T* const*)nullptr, ldb, stB,
+                                                 (T* const*)nullptr, ldc, stC, (T* const*)nullptr,
+                                                 ldd, stD, (rocblas_int*)nullptr, stP,
+                                                 (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, (T*)nullptr, lda,
+                                                 stA, (T*)nullptr, ldb, stB, (T*)nullptr, ldc, stC,
+                                                 (T*)nullptr, ldd, stD, (rocblas_int*)nullptr, stP,
+                                                 (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (pivots and info are common to all cases)
+    host_strided_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, stPRes, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hC(size_C, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        host_batch_vector<T> hBRes(size_BRes, 1, bc);
+        host_batch_vector<T> hCRes(size_CRes, 1, bc);
+        host_batch_vector<T> hDRes(size_DRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        device_batch_vector<T> dD(size_D, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+
+        // check quick return
+        if(nb == 0 || nblocks == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA.data(), lda,
+                                                     stA, dB.data(), ldb, stB, dC.data(), ldc, stC,
+                                                     dD.data(), ldd, stD, dIpiv.data(), stP,
+                                                     dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geblttrf_getError<STRIDED, T>(handle, nb, nblocks, dA, lda, stA, dB, ldb, stB, dC, ldc,
+                                          stC, dD, ldd, stD, dIpiv, stP, dInfo, bc, hA, hARes, hB,
+                                          hBRes, hC, hCRes, hDRes, hIpivRes, hInfoRes, &max_error,
+                                          argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geblttrf_getPerfData<STRIDED, T>(handle, nb, nblocks, dA, lda, stA, dB, ldb, stB, dC,
+                                             ldc, stC, dD, ldd, stD, dIpiv, stP, dInfo, bc, hA, hB,
+                                             hC, &gpu_time_used, &cpu_time_used, hot_calls,
+                                             argus.profile, argus.profile_kernels, argus.perf,
+                                             argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
+        host_strided_batch_vector<T> hCRes(size_CRes, 1, stCRes, bc);
+        host_strided_batch_vector<T> hDRes(size_DRes, 1, stDRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        device_strided_batch_vector<T> dD(size_D, 1, stD, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+
+        // check quick return
+        if(nb == 0 || nblocks == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf(STRIDED, handle, nb, nblocks, dA.data(), lda,
+                                                     stA, dB.data(), ldb, stB, dC.data(), ldc, stC,
+                                                     dD.data(), ldd, stD, dIpiv.data(), stP,
+                                                     dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geblttrf_getError<STRIDED, T>(handle, nb, nblocks, dA, lda, stA, dB, ldb, stB, dC, ldc,
+                                          stC, dD, ldd, stD, dIpiv, stP, dInfo, bc, hA, hARes, hB,
+                                          hBRes, hC, hCRes, hDRes, hIpivRes, hInfoRes, &max_error,
+                                          argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geblttrf_getPerfData<STRIDED, T>(handle, nb, nblocks, dA, lda, stA, dB, ldb, stB, dC,
+                                             ldc, stC, dD, ldd, stD, dIpiv, stP, dInfo, bc, hA, hB,
+                                             hC, &gpu_time_used, &cpu_time_used, hot_calls,
+                                             argus.profile, argus.profile_kernels, argus.perf,
+                                             argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, nb * nblocks);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("nb", "nblocks", "lda", "ldb", "ldc", "ldd", "strideP",
+                                       "batch_c");
+                rocsolver_bench_output(nb, nblocks, lda, ldb, ldc, ldd, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("nb", "nblocks", "lda", "strideA", "ldb", "strideB", "ldc",
+                                       "strideC", "ldd", "strideD", "strideP", "batch_c");
+                rocsolver_bench_output(nb, nblocks, lda, stA, ldb, stB, ldc, stC, ldd, stD, stP,
+                                       bc);
+            }
+            else
+            {
+                rocsolver_bench_output("nb", "nblocks", "lda", "ldb", "ldc", "ldd");
+                rocsolver_bench_output(nb, nblocks, lda, ldb, ldc, ldd);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEBLTTRF(...) extern template void testing_geblttrf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEBLTTRF, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,1100 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/*
+ * ===========================================================================
+ *    testing_geblttrs_bordered tests the correctness of geblttrf_bordered and
+ *    geblttrs_bordered. We use an implicit test that factorizes the bordered
+ *    matrix M on the GPU, solves M[X; Y] = [R; S] for known X and Y (with R
+ *    and S computed on the CPU), and compares the result with X and Y.
+ * ===========================================================================
+ */
+
+template <bool STRIDED, typename T, typename U>
+void geblttrf_bordered_checkBadArgs(const rocblas_handle handle,
+                                    const rocblas_int nb,
+                                    const rocblas_int nblocks,
+                                    const rocblas_int nbr,
+                                    T dA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride stA,
+                                    T dB,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride stB,
+                                    T dC,
+                                    const rocblas_int ldc,
+                                    const rocblas_stride stC,
+                                    T dD,
+                                    const rocblas_int ldd,
+                                    const rocblas_stride stD,
+                                    T dE,
+                                    const rocblas_int lde,
+                                    const rocblas_stride stE,
+                                    T dF,
+                                    const rocblas_int ldf,
+                                    const rocblas_stride stF,
+                                    T dG,
+                                    const rocblas_int ldg,
+                                    const rocblas_stride stG,
+                                    U dIpiv,
+                                    const rocblas_stride stP,
+                                    U dInfo,
+                                    const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, nullptr, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, dD, ldd,
+                                                      stD, dE, lde, stE, dF, ldf, stF, dG, ldg,
+                                                      stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA,
+                                                          lda, stA, dB, ldb, stB, dC, ldc, stC, dD,
+                                                          ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                                          ldg, stG, dIpiv, stP, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr,
+                                                      (T) nullptr, lda, stA, dB, ldb, stB, dC, ldc,
+                                                      stC, dD, ldd, stD, dE, lde, stE, dF, ldf,
+                                                      stF, dG, ldg, stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, (T) nullptr, ldb, stB, dC, ldc, stC, dD,
+                                                      ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                                      ldg, stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, (T) nullptr, ldc, stC, dD,
+                                                      ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                                      ldg, stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, (T) nullptr,
+                                                      ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                                      ldg, stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, dD, ldd, stD,
+                                                      (T) nullptr, lde, stE, dF, ldf, stF, dG, ldg,
+                                                      stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, dD, ldd, stD,
+                                                      dE, lde, stE, (T) nullptr, ldf, stF, dG, ldg,
+                                                      stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, dD, ldd, stD,
+                                                      dE, lde, stE, dF, ldf, stF, (T) nullptr, ldg,
+                                                      stG, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, dD, ldd, stD,
+                                                      dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                                                      (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA, lda,
+                                                      stA, dB, ldb, stB, dC, ldc, stC, dD, ldd, stD,
+                                                      dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                                                      dIpiv, stP, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(
+                              STRIDED, handle, 0, nblocks, 0, (T) nullptr, lda, stA, (T) nullptr,
+                              ldb, stB, (T) nullptr, ldc, stC, (T) nullptr, ldd, stD, (T) nullptr,
+                              lde, stE, (T) nullptr, ldf, stF, (T) nullptr, ldg, stG, (U) nullptr,
+                              stP, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(
+                              STRIDED, handle, nb, 0, 0, (T) nullptr, lda, stA, (T) nullptr, ldb,
+                              stB, (T) nullptr, ldc, stC, (T) nullptr, ldd, stD, (T) nullptr, lde,
+                              stE, (T) nullptr, ldf, stF, (T) nullptr, ldg, stG, (U) nullptr, stP,
+                              dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_bordered(STRIDED, handle, nb, nblocks, nbr, dA,
+                                                          lda, stA, dB, ldb, stB, dC, ldc, stC, dD,
+                                                          ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                                          ldg, stG, dIpiv, stP, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool STRIDED, typename T, typename U>
+void geblttrs_bordered_checkBadArgs(const rocblas_handle handle,
+                                    const rocblas_int nb,
+                                    const rocblas_int nblocks,
+                                    const rocblas_int nbr,
+                                    const rocblas_int nrhs,
+                                    T dA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride stA,
+                                    T dB,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride stB,
+                                    T dC,
+                                    const rocblas_int ldc,
+                                    const rocblas_stride stC,
+                                    T dD,
+                                    const rocblas_int ldd,
+                                    const rocblas_stride stD,
+                                    T dE,
+                                    const rocblas_int lde,
+                                    const rocblas_stride stE,
+                                    T dF,
+                                    const rocblas_int ldf,
+                                    const rocblas_stride stF,
+                                    T dG,
+                                    const rocblas_int ldg,
+                                    const rocblas_stride stG,
+                                    U dIpiv,
+                                    const rocblas_stride stP,
+                                    T dX,
+                                    const rocblas_int ldx,
+                                    const rocblas_stride stX,
+                                    T dY,
+                                    const rocblas_int ldy,
+                                    const rocblas_stride stY,
+                                    const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(STRIDED, nullptr, nb, nblocks, nbr, nrhs, dA,
+                                                      lda, stA, dB, ldb, stB, dC, ldc, stC, dD, ldd,
+                                                      stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                                                      dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                                  STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb,
+                                  stB, dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                  ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, (T) nullptr, lda, stA, dB,
+                              ldb, stB, dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, (T) nullptr,
+                              ldb, stB, dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              (T) nullptr, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, (T) nullptr, ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, dD, ldd, stD, (T) nullptr, lde, stE, dF, ldf, stF, dG,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, dD, ldd, stD, dE, lde, stE, (T) nullptr, ldf, stF, dG,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, (T) nullptr,
+                              ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                              (U) nullptr, stP, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                              dIpiv, stP, (T) nullptr, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB,
+                              dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                              dIpiv, stP, dX, ldx, stX, (T) nullptr, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, 0, nblocks, 0, nrhs, (T) nullptr, lda, stA,
+                              (T) nullptr, ldb, stB, (T) nullptr, ldc, stC, (T) nullptr, ldd, stD,
+                              (T) nullptr, lde, stE, (T) nullptr, ldf, stF, (T) nullptr, ldg, stG,
+                              (U) nullptr, stP, (T) nullptr, ldx, stX, (T) nullptr, ldy, stY, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                              STRIDED, handle, nb, nblocks, nbr, 0, dA, lda, stA, dB, ldb, stB, dC,
+                              ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG,
+                              dIpiv, stP, (T) nullptr, ldx, stX, (T) nullptr, ldy, stY, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                                  STRIDED, handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb,
+                                  stB, dC, ldc, stC, dD, ldd, stD, dE, lde, stE, dF, ldf, stF, dG,
+                                  ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy, stY, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geblttrs_bordered_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int nb = 1;
+    rocblas_int nblocks = 3;
+    rocblas_int nbr = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_int ldc = 1;
+    rocblas_int ldd = 1;
+    rocblas_int lde = 1;
+    rocblas_int ldf = 1;
+    rocblas_int ldg = 1;
+    rocblas_int ldx = 1;
+    rocblas_int ldy = 1;
+    rocblas_stride stA = 3;
+    rocblas_stride stB = 3;
+    rocblas_stride stC = 3;
+    rocblas_stride stD = 3;
+    rocblas_stride stE = 3;
+    rocblas_stride stF = 3;
+    rocblas_stride stG = 1;
+    rocblas_stride stP = 4;
+    rocblas_stride stX = 3;
+    rocblas_stride stY = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dC(1, 1, 1);
+        device_batch_vector<T> dD(1, 1, 1);
+        device_batch_vector<T> dE(1, 1, 1);
+        device_batch_vector<T> dF(1, 1, 1);
+        device_batch_vector<T> dG(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        device_batch_vector<T> dY(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dF.memcheck());
+        CHECK_HIP_ERROR(dG.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dY.memcheck());
+
+        // check bad arguments
+        geblttrf_bordered_checkBadArgs<STRIDED>(
+            handle, nb, nblocks, nbr, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(), ldc, stC,
+            dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg, stG,
+            dIpiv.data(), stP, dInfo.data(), bc);
+        geblttrs_bordered_checkBadArgs<STRIDED>(
+            handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(),
+            ldc, stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg,
+            stG, dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(1, 1, 1, 1);
+        device_strided_batch_vector<T> dE(1, 1, 1, 1);
+        device_strided_batch_vector<T> dF(1, 1, 1, 1);
+        device_strided_batch_vector<T> dG(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        device_strided_batch_vector<T> dY(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dF.memcheck());
+        CHECK_HIP_ERROR(dG.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dY.memcheck());
+
+        // check bad arguments
+        geblttrf_bordered_checkBadArgs<STRIDED>(
+            handle, nb, nblocks, nbr, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(), ldc, stC,
+            dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg, stG,
+            dIpiv.data(), stP, dInfo.data(), bc);
+        geblttrs_bordered_checkBadArgs<STRIDED>(
+            handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(),
+            ldc, stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg,
+            stG, dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geblttrs_bordered_initData(const rocblas_handle handle,
+                                const rocblas_int nb,
+                                const rocblas_int nblocks,
+                                const rocblas_int nbr,
+                                const rocblas_int nrhs,
+                                Td& dA,
+                                const rocblas_int lda,
+                                Td& dB,
+                                const rocblas_int ldb,
+                                Td& dC,
+                                const rocblas_int ldc,
+                                Td& dE,
+                                const rocblas_int lde,
+                                Td& dF,
+                                const rocblas_int ldf,
+                                Td& dG,
+                                const rocblas_int ldg,
+                                Td& dX,
+                                const rocblas_int ldx,
+                                Td& dY,
+                                const rocblas_int ldy,
+                                const rocblas_int bc,
+                                Th& hA,
+                                Th& hB,
+                                Th& hC,
+                                Th& hE,
+                                Th& hF,
+                                Th& hG,
+                                Th& hX,
+                                Th& hY,
+                                Th& hRHSX,
+                                Th& hRHSY)
+{
+    if(CPU)
+    {
+        int n1 = nb * nblocks;
+        int n = n1 + nbr;
+        std::vector<T> M(n * n);
+        std::vector<T> XX(n * nrhs);
+        std::vector<T> XB(n * nrhs);
+
+        // initialize blocks of the original matrix
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, false);
+        rocblas_init<T>(hC, false);
+        rocblas_init<T>(hE, false);
+        rocblas_init<T>(hF, false);
+        rocblas_init<T>(hG, false);
+
+        // initialize solution vectors
+        rocblas_init<T>(hX, false);
+        rocblas_init<T>(hY, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // shift the entries of the block tridiagonal part so that the diagonal
+            // blocks are not dominant and row interchanges are required
+            for(rocblas_int k = 0; k < nblocks; k++)
+            {
+                for(rocblas_int i = 0; i < nb; i++)
+                {
+                    for(rocblas_int j = 0; j < nb; j++)
+                    {
+                        hB[b][i + j * ldb + k * ldb * nb] -= 4;
+                        if(k < nblocks - 1)
+                        {
+                            hA[b][i + j * lda + k * lda * nb] += 4;
+                            hC[b][i + j * ldc + k * ldc * nb] -= 4;
+                        }
+                    }
+                }
+            }
+
+            // form original matrix M
+            std::fill(M.begin(), M.end(), T(0));
+            for(rocblas_int k = 0; k < nblocks; k++)
+            {
+                for(rocblas_int i = 0; i < nb; i++)
+                {
+                    for(rocblas_int j = 0; j < nb; j++)
+                    {
+                        M[i + j * n + k * (n + 1) * nb] = hB[b][i + j * ldb + k * ldb * nb];
+
+                        if(k < nblocks - 1)
+                        {
+                            M[(i + nb) + j * n + k * (n + 1) * nb]
+                                = hA[b][i + j * lda + k * lda * nb];
+                            M[i + (j + nb) * n + k * (n + 1) * nb]
+                                = hC[b][i + j * ldc + k * ldc * nb];
+                        }
+                    }
+                }
+
+                // border blocks E_k and F_k
+                for(rocblas_int i = 0; i < nb; i++)
+                    for(rocblas_int j = 0; j < nbr; j++)
+                        M[(k * nb + i) + (n1 + j) * n] = hE[b][i + j * lde + k * lde * nbr];
+                for(rocblas_int i = 0; i < nbr; i++)
+                    for(rocblas_int j = 0; j < nb; j++)
+                        M[(n1 + i) + (k * nb + j) * n] = hF[b][i + j * ldf + k * ldf * nb];
+            }
+            for(rocblas_int i = 0; i < nbr; i++)
+                for(rocblas_int j = 0; j < nbr; j++)
+                    M[(n1 + i) + (n1 + j) * n] = hG[b][i + j * ldg];
+
+            // move blocks of X and Y to full matrix XX
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                for(rocblas_int k = 0; k < nblocks; k++)
+                    for(rocblas_int i = 0; i < nb; i++)
+                        XX[i + j * n + k * nb] = hX[b][i + j * ldx + k * ldx * nrhs];
+                for(rocblas_int i = 0; i < nbr; i++)
+                    XX[n1 + i + j * n] = hY[b][i + j * ldy];
+            }
+
+            // generate the full matrix of right-hand-side vectors XB by computing M * XX
+            cpu_gemm(rocblas_operation_none, rocblas_operation_none, n, nrhs, n, T(1), M.data(), n,
+                     XX.data(), n, T(0), XB.data(), n);
+
+            // move XB to block format in hRHSX and hRHSY
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                for(rocblas_int k = 0; k < nblocks; k++)
+                    for(rocblas_int i = 0; i < nb; i++)
+                        hRHSX[b][i + j * ldx + k * ldx * nrhs] = XB[i + j * n + k * nb];
+                for(rocblas_int i = 0; i < nbr; i++)
+                    hRHSY[b][i + j * ldy] = XB[n1 + i + j * n];
+            }
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIP_ERROR(dE.transfer_from(hE));
+        CHECK_HIP_ERROR(dF.transfer_from(hF));
+        CHECK_HIP_ERROR(dG.transfer_from(hG));
+        CHECK_HIP_ERROR(dX.transfer_from(hRHSX));
+        CHECK_HIP_ERROR(dY.transfer_from(hRHSY));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th>
+void geblttrs_bordered_getError(const rocblas_handle handle,
+                                const rocblas_int nb,
+                                const rocblas_int nblocks,
+                                const rocblas_int nbr,
+                                const rocblas_int nrhs,
+                                Td& dA,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                Td& dB,
+                                const rocblas_int ldb,
+                                const rocblas_stride stB,
+                                Td& dC,
+                                const rocblas_int ldc,
+                                const rocblas_stride stC,
+                                Td& dD,
+                                const rocblas_int ldd,
+                                const rocblas_stride stD,
+                                Td& dE,
+                                const rocblas_int lde,
+                                const rocblas_stride stE,
+                                Td& dF,
+                                const rocblas_int ldf,
+                                const rocblas_stride stF,
+                                Td& dG,
+                                const rocblas_int ldg,
+                                const rocblas_stride stG,
+                                Ud& dIpiv,
+                                const rocblas_stride stP,
+                                Td& dX,
+                                const rocblas_int ldx,
+                                const rocblas_stride stX,
+                                Td& dY,
+                                const rocblas_int ldy,
+                                const rocblas_stride stY,
+                                Ud& dInfo,
+                                const rocblas_int bc,
+                                Th& hA,
+                                Th& hB,
+                                Th& hC,
+                                Th& hE,
+                                Th& hF,
+                                Th& hG,
+                                Th& hX,
+                                Th& hY,
+                                Th& hXRes,
+                                Th& hYRes,
+                                double* max_err)
+{
+    // input data initialization
+    geblttrs_bordered_initData<true, true, T>(handle, nb, nblocks, nbr, nrhs, dA, lda, dB, ldb, dC,
+                                              ldc, dE, lde, dF, ldf, dG, ldg, dX, ldx, dY, ldy, bc,
+                                              hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geblttrf_bordered(
+        STRIDED, handle, nb, nblocks, nbr, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(), ldc,
+        stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg, stG,
+        dIpiv.data(), stP, dInfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(rocsolver_geblttrs_bordered(
+        STRIDED, handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+        dC.data(), ldc, stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF,
+        dG.data(), ldg, stG, dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY, bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hYRes.transfer_from(dY));
+
+    double err = 0;
+    *max_err = 0;
+
+    // error is ||hX - hXRes|| / ||hX|| (and similarly for hY)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(nb * nblocks > 0)
+        {
+            err = norm_error('F', nb, nrhs * nblocks, ldx, hX[b], hXRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+        if(nbr > 0)
+        {
+            err = norm_error('F', nbr, nrhs, ldy, hY[b], hYRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th>
+void geblttrs_bordered_getPerfData(const rocblas_handle handle,
+                                   const rocblas_int nb,
+                                   const rocblas_int nblocks,
+                                   const rocblas_int nbr,
+                                   const rocblas_int nrhs,
+                                   Td& dA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride stA,
+                                   Td& dB,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride stB,
+                                   Td& dC,
+                                   const rocblas_int ldc,
+                                   const rocblas_stride stC,
+                                   Td& dD,
+                                   const rocblas_int ldd,
+                                   const rocblas_stride stD,
+                                   Td& dE,
+                                   const rocblas_int lde,
+                                   const rocblas_stride stE,
+                                   Td& dF,
+                                   const rocblas_int ldf,
+                                   const rocblas_stride stF,
+                                   Td& dG,
+                                   const rocblas_int ldg,
+                                   const rocblas_stride stG,
+                                   Ud& dIpiv,
+                                   const rocblas_stride stP,
+                                   Td& dX,
+                                   const rocblas_int ldx,
+                                   const rocblas_stride stX,
+                                   Td& dY,
+                                   const rocblas_int ldy,
+                                   const rocblas_stride stY,
+                                   Ud& dInfo,
+                                   const rocblas_int bc,
+                                   Th& hA,
+                                   Th& hB,
+                                   Th& hC,
+                                   Th& hE,
+                                   Th& hF,
+                                   Th& hG,
+                                   Th& hX,
+                                   Th& hY,
+                                   Th& hXRes,
+                                   Th& hYRes,
+                                   double* gpu_time_used,
+                                   double* cpu_time_used,
+                                   const rocblas_int hot_calls,
+                                   const int profile,
+                                   const bool profile_kernels,
+                                   const bool perf)
+{
+    if(!perf)
+    {
+        // there is no direct CPU/LAPACK equivalent for this function, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    geblttrs_bordered_initData<true, false, T>(handle, nb, nblocks, nbr, nrhs, dA, lda, dB, ldb, dC,
+                                               ldc, dE, lde, dF, ldf, dG, ldg, dX, ldx, dY, ldy, bc,
+                                               hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geblttrs_bordered_initData<false, true, T>(
+            handle, nb, nblocks, nbr, nrhs, dA, lda, dB, ldb, dC, ldc, dE, lde, dF, ldf, dG, ldg,
+            dX, ldx, dY, ldy, bc, hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geblttrf_bordered(
+            STRIDED, handle, nb, nblocks, nbr, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(),
+            ldc, stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg,
+            stG, dIpiv.data(), stP, dInfo.data(), bc));
+        CHECK_ROCBLAS_ERROR(rocsolver_geblttrs_bordered(
+            STRIDED, handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+            dC.data(), ldc, stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF,
+            dG.data(), ldg, stG, dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geblttrs_bordered_initData<false, true, T>(
+            handle, nb, nblocks, nbr, nrhs, dA, lda, dB, ldb, dC, ldc, dE, lde, dF, ldf, dG, ldg,
+            dX, ldx, dY, ldy, bc, hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes);
+        CHECK_ROCBLAS_ERROR(rocsolver_geblttrf_bordered(
+            STRIDED, handle, nb, nblocks, nbr, dA.data(), lda, stA, dB.data(), ldb, stB, dC.data(),
+            ldc, stC, dD.data(), ldd, stD, dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg,
+            stG, dIpiv.data(), stP, dInfo.data(), bc));
+
+        start = get_time_us_sync(stream);
+        rocsolver_geblttrs_bordered(STRIDED, handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA,
+                                    dB.data(), ldb, stB, dC.data(), ldc, stC, dD.data(), ldd, stD,
+                                    dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg, stG,
+                                    dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY,
+                                    bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geblttrs_bordered(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int nb = argus.get<rocblas_int>("nb");
+    rocblas_int nblocks = argus.get<rocblas_int>("nblocks");
+    rocblas_int nbr = argus.get<rocblas_int>("nbr");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs");
+    rocblas_int lda = argus.get<rocblas_int>("lda", nb);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", nb);
+    rocblas_int ldc = argus.get<rocblas_int>("ldc", nb);
+    rocblas_int ldd = argus.get<rocblas_int>("ldd", nb);
+    rocblas_int lde = argus.get<rocblas_int>("lde", nb);
+    rocblas_int ldf = argus.get<rocblas_int>("ldf", nbr);
+    rocblas_int ldg = argus.get<rocblas_int>("ldg", nbr);
+    rocblas_int ldx = argus.get<rocblas_int>("ldx", nb);
+    rocblas_int ldy = argus.get<rocblas_int>("ldy", nbr);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * nb * nblocks);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nb * nblocks);
+    rocblas_stride stC = argus.get<rocblas_stride>("strideC", ldc * nb * nblocks);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", ldd * nb * nblocks);
+    rocblas_stride stE = argus.get<rocblas_stride>("strideE", lde * nbr * nblocks);
+    rocblas_stride stF = argus.get<rocblas_stride>("strideF", ldf * nb * nblocks);
+    rocblas_stride stG = argus.get<rocblas_stride>("strideG", ldg * nbr);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", nb * nblocks + nbr);
+    rocblas_stride stX = argus.get<rocblas_stride>("strideX", ldx * nrhs * nblocks);
+    rocblas_stride stY = argus.get<rocblas_stride>("strideY", ldy * nrhs);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stXRes = stX;
+    rocblas_stride stYRes = stY;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * nb * nblocks;
+    size_t size_B = size_t(ldb) * nb * nblocks;
+    size_t size_C = size_t(ldc) * nb * nblocks;
+    size_t size_D = size_t(ldd) * nb * nblocks;
+    size_t size_E = size_t(lde) * nbr * nblocks;
+    size_t size_F = size_t(ldf) * nb * nblocks;
+    size_t size_G = size_t(ldg) * nbr;
+    size_t size_P = size_t(nb) * nblocks + nbr;
+    size_t size_X = size_t(ldx) * nrhs * nblocks;
+    size_t size_Y = size_t(ldy) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = size_X;
+    size_t size_YRes = size_Y;
+
+    // check invalid sizes
+    bool invalid_size = (nb < 0 || nblocks < 0 || nbr < 0 || nrhs < 0 || lda < nb || ldb < nb
+                         || ldc < nb || ldd < nb || lde < nb || ldf < nbr || ldg < nbr || ldx < nb
+                         || ldy < nbr || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_geblttrs_bordered(
+                    STRIDED, handle, nb, nblocks, nbr, nrhs, (T* const*)nullptr, lda, stA,
+                    (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldc, stC, (T* const*)nullptr,
+                    ldd, stD, (T* const*)nullptr, lde, stE, (T* const*)nullptr, ldf, stF,
+                    (T* const*)nullptr, ldg, stG, (rocblas_int*)nullptr, stP, (T* const*)nullptr,
+                    ldx, stX, (T* const*)nullptr, ldy, stY, bc),
+                rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_geblttrs_bordered(
+                    STRIDED, handle, nb, nblocks, nbr, nrhs, (T*)nullptr, lda, stA, (T*)nullptr,
+                    ldb, stB, (T*)nullptr, ldc, stC, (T*)nullptr, ldd, stD, (T*)nullptr, lde, stE,
+                    (T*)nullptr, ldf, stF, (T*)nullptr, ldg, stG, (rocblas_int*)nullptr, stP,
+                    (T*)nullptr, ldx, stX, (T*)nullptr, ldy, stY, bc),
+                rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+        {
+            CHECK_ALLOC_QUERY(rocsolver_geblttrf_bordered(
+                STRIDED, handle, nb, nblocks, nbr, (T* const*)nullptr, lda, stA, (T* const*)nullptr,
+                ldb, stB, (T* const*)nullptr, ldc, stC, (T* const*)nullptr, ldd, stD,
+                (T* const*)nullptr, lde, stE, (T* const*)nullptr, ldf, stF, (T* const*)nullptr, ldg,
+                stG, (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr, bc));
+            CHECK_ALLOC_QUERY(rocsolver_geblttrs_bordered(
+                STRIDED, handle, nb, nblocks, nbr, nrhs, (T* const*)nullptr, lda, stA,
+                (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldc, stC, (T* const*)nullptr, ldd,
+                stD, (T* const*)nullptr, lde, stE, (T* const*)nullptr, ldf, stF, (T* const*)nullptr,
+                ldg, stG, (rocblas_int*)nullptr, stP, (T* const*)nullptr, ldx, stX,
+                (T* const*)nullptr, ldy, stY, bc));
+        }
+        else
+        {
+            CHECK_ALLOC_QUERY(rocsolver_geblttrf_bordered(
+                STRIDED, handle, nb, nblocks, nbr, (T*)nullptr, lda, stA, (T*)nullptr, ldb, stB,
+                (T*)nullptr, ldc, stC, (T*)nullptr, ldd, stD, (T*)nullptr, lde, stE, (T*)nullptr,
+                ldf, stF, (T*)nullptr, ldg, stG, (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                bc));
+            CHECK_ALLOC_QUERY(rocsolver_geblttrs_bordered(
+                STRIDED, handle, nb, nblocks, nbr, nrhs, (T*)nullptr, lda, stA, (T*)nullptr, ldb,
+                stB, (T*)nullptr, ldc, stC, (T*)nullptr, ldd, stD, (T*)nullptr, lde, stE,
+                (T*)nullptr, ldf, stF, (T*)nullptr, ldg, stG, (rocblas_int*)nullptr, stP,
+                (T*)nullptr, ldx, stX, (T*)nullptr, ldy, stY, bc));
+        }
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (pivots and info are common to all cases)
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(bc)
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hC(size_C, 1, bc);
+        host_batch_vector<T> hE(size_E, 1, bc);
+        host_batch_vector<T> hF(size_F, 1, bc);
+        host_batch_vector<T> hG(size_G, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hY(size_Y, 1, bc);
+        host_batch_vector<T> hXRes(size_XRes, 1, bc);
+        host_batch_vector<T> hYRes(size_YRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        device_batch_vector<T> dD(size_D, 1, bc);
+        device_batch_vector<T> dE(size_E, 1, bc);
+        device_batch_vector<T> dF(size_F, 1, bc);
+        device_batch_vector<T> dG(size_G, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        device_batch_vector<T> dY(size_Y, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_E)
+            CHECK_HIP_ERROR(dE.memcheck());
+        if(size_F)
+            CHECK_HIP_ERROR(dF.memcheck());
+        if(size_G)
+            CHECK_HIP_ERROR(dG.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        if(size_Y)
+            CHECK_HIP_ERROR(dY.memcheck());
+
+        // check quick return
+        if((nb * nblocks == 0 && nbr == 0) || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                                      STRIDED, handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA,
+                                      dB.data(), ldb, stB, dC.data(), ldc, stC, dD.data(), ldd, stD,
+                                      dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg, stG,
+                                      dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY,
+                                      bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geblttrs_bordered_getError<STRIDED, T>(
+                handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB, dC, ldc, stC, dD, ldd,
+                stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy,
+                stY, dInfo, bc, hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geblttrs_bordered_getPerfData<STRIDED, T>(
+                handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB, dC, ldc, stC, dD, ldd,
+                stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy,
+                stY, dInfo, bc, hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes, &gpu_time_used,
+                &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T> hE(size_E, 1, stE, bc);
+        host_strided_batch_vector<T> hF(size_F, 1, stF, bc);
+        host_strided_batch_vector<T> hG(size_G, 1, stG, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hY(size_Y, 1, stY, bc);
+        host_strided_batch_vector<T> hXRes(size_XRes, 1, stXRes, bc);
+        host_strided_batch_vector<T> hYRes(size_YRes, 1, stYRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        device_strided_batch_vector<T> dD(size_D, 1, stD, bc);
+        device_strided_batch_vector<T> dE(size_E, 1, stE, bc);
+        device_strided_batch_vector<T> dF(size_F, 1, stF, bc);
+        device_strided_batch_vector<T> dG(size_G, 1, stG, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        device_strided_batch_vector<T> dY(size_Y, 1, stY, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_E)
+            CHECK_HIP_ERROR(dE.memcheck());
+        if(size_F)
+            CHECK_HIP_ERROR(dF.memcheck());
+        if(size_G)
+            CHECK_HIP_ERROR(dG.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        if(size_Y)
+            CHECK_HIP_ERROR(dY.memcheck());
+
+        // check quick return
+        if((nb * nblocks == 0 && nbr == 0) || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrs_bordered(
+                                      STRIDED, handle, nb, nblocks, nbr, nrhs, dA.data(), lda, stA,
+                                      dB.data(), ldb, stB, dC.data(), ldc, stC, dD.data(), ldd, stD,
+                                      dE.data(), lde, stE, dF.data(), ldf, stF, dG.data(), ldg, stG,
+                                      dIpiv.data(), stP, dX.data(), ldx, stX, dY.data(), ldy, stY,
+                                      bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geblttrs_bordered_getError<STRIDED, T>(
+                handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB, dC, ldc, stC, dD, ldd,
+                stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy,
+                stY, dInfo, bc, hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geblttrs_bordered_getPerfData<STRIDED, T>(
+                handle, nb, nblocks, nbr, nrhs, dA, lda, stA, dB, ldb, stB, dC, ldc, stC, dD, ldd,
+                stD, dE, lde, stE, dF, ldf, stF, dG, ldg, stG, dIpiv, stP, dX, ldx, stX, dY, ldy,
+                stY, dInfo, bc, hA, hB, hC, hE, hF, hG, hX, hY, hXRes, hYRes, &gpu_time_used,
+                &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, nb * nblocks + nbr);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("nb", "nblocks", "nbr", "nrhs", "lda", "ldb", "ldc", "ldd",
+                                       "lde", "ldf", "ldg", "strideP", "ldx", "ldy", "batch_c");
+                rocsolver_bench_output(nb, nblocks, nbr, nrhs, lda, ldb, ldc, ldd, lde, ldf, ldg,
+                                       stP, ldx, ldy, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("nb", "nblocks", "nbr", "nrhs", "lda", "strideA", "ldb",
+                                       "strideB", "ldc", "strideC", "ldd", "strideD", "lde",
+                                       "strideE", "ldf", "strideF", "ldg", "strideG", "strideP",
+                                       "ldx", "strideX", "ldy", "strideY", "batch_c");
+                rocsolver_bench_output(nb, nblocks, nbr, nrhs, lda, stA, ldb, stB, ldc, stC, ldd,
+                                       stD, lde, stE, ldf, stF, ldg, stG, stP, ldx, stX, ldy, stY,
+                                       bc);
+            }
+            else
+            {
+                rocsolver_bench_output("nb", "nblocks", "nbr", "nrhs", "lda", "ldb", "ldc", "ldd",
+                                       "lde", "ldf", "ldg", "ldx", "ldy");
+                rocsolver_bench_output(nb, nblocks, nbr, nrhs, lda, ldb, ldc, ldd, lde, ldf, ldg,
+                                       ldx, ldy);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEBLTTRS_BORDERED(...) \
+    extern template void testing_geblttrs_bordered<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEBLTTRS_BORDERED,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
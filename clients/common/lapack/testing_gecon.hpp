@@ -0,0 +1,679 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/** Calls GECON, or POCON if POSITIVE is true (norm is ignored in that case, and uplo is
+    ignored otherwise) **/
+template <bool POSITIVE, typename T, typename S>
+rocblas_status gecon_call(const bool STRIDED,
+                          const rocblas_handle handle,
+                          const rocsolver_norm_type norm,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          T A,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          const S anorm,
+                          S rcond,
+                          const rocblas_int bc)
+{
+    if(POSITIVE)
+        return rocsolver_pocon(STRIDED, handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_gecon(STRIDED, handle, norm, n, A, lda, stA, anorm, rcond, bc);
+}
+
+template <bool STRIDED, bool POSITIVE, typename T, typename S>
+void gecon_checkBadArgs(const rocblas_handle handle,
+                        const rocsolver_norm_type norm,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        S dAnorm,
+                        S dRcond,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, nullptr, norm, uplo, n, dA, lda, stA,
+                                               dAnorm, dRcond, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    if(POSITIVE)
+        EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, rocblas_fill_full, n, dA,
+                                                   lda, stA, dAnorm, dRcond, bc),
+                              rocblas_status_invalid_value);
+    else
+        EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, rocsolver_norm_max, uplo, n, dA,
+                                                   lda, stA, dAnorm, dRcond, bc),
+                              rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA, lda, stA,
+                                                   dAnorm, dRcond, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, (T) nullptr, lda,
+                                               stA, dAnorm, dRcond, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA, lda, stA,
+                                               (S) nullptr, dRcond, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA, lda, stA,
+                                               dAnorm, (S) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, 0, (T) nullptr, lda,
+                                               stA, dAnorm, dRcond, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA, lda, stA,
+                                                   (S) nullptr, (S) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool POSITIVE, typename T>
+void testing_gecon_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocsolver_norm_type norm = rocsolver_norm_one;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dAnorm(1, 1, 1, 1);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAnorm.memcheck());
+    CHECK_HIP_ERROR(dRcond.memcheck());
+
+    if(BATCHED)
+    {
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        gecon_checkBadArgs<STRIDED, POSITIVE>(handle, norm, uplo, n, dA.data(), lda, stA,
+                                              dAnorm.data(), dRcond.data(), bc);
+    }
+    else
+    {
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        gecon_checkBadArgs<STRIDED, POSITIVE>(handle, norm, uplo, n, dA.data(), lda, stA,
+                                              dAnorm.data(), dRcond.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, bool POSITIVE, typename T, typename Td, typename Th>
+void gecon_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_int bc,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            if(POSITIVE)
+            {
+                // scale to ensure positive definiteness
+                for(rocblas_int i = 0; i < n; i++)
+                    hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
+            }
+            else
+            {
+                // scale A to avoid singularities
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                    {
+                        if(i == j)
+                            hA[b][i + j * lda] += 400;
+                        else
+                            hA[b][i + j * lda] -= 4;
+                    }
+                }
+
+                // shuffle rows to test pivoting
+                // always the same permuation for debugging purposes
+                for(rocblas_int i = 0; i < n / 2; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                    {
+                        tmp = hA[b][i + j * lda];
+                        hA[b][i + j * lda] = hA[b][n - 1 - i + j * lda];
+                        hA[b][n - 1 - i + j * lda] = tmp;
+                    }
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+/** Computes the norm of A on the device and overwrites A with its factorization **/
+template <bool STRIDED, bool POSITIVE, typename T, typename Td, typename Ud, typename Sd>
+rocblas_status gecon_factorize(const rocblas_handle handle,
+                               const rocsolver_norm_type norm,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               Ud& dIpiv,
+                               const rocblas_stride stP,
+                               Sd& dAnorm,
+                               Ud& dInfo,
+                               const rocblas_int bc)
+{
+    rocblas_status status;
+    if(POSITIVE)
+    {
+        status = rocsolver_lansy_lanhe(STRIDED, handle, rocsolver_norm_one, uplo, n, dA.data(), lda,
+                                       stA, dAnorm.data(), bc);
+        if(status != rocblas_status_success)
+            return status;
+
+        return rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n, dA.data(), lda, stA,
+                                     dInfo.data(), bc);
+    }
+    else
+    {
+        status
+            = rocsolver_lange(STRIDED, handle, norm, n, n, dA.data(), lda, stA, dAnorm.data(), bc);
+        if(status != rocblas_status_success)
+            return status;
+
+        return rocsolver_getf2_getrf(STRIDED, true, handle, n, n, dA.data(), lda, stA,
+                                     dIpiv.data(), stP, dInfo.data(), bc);
+    }
+}
+
+/** Computes the norm of A, its factorization, and the reciprocal of its condition number
+    with LAPACK **/
+template <bool POSITIVE, typename T, typename S>
+S gecon_host(const rocsolver_norm_type norm,
+             const rocblas_fill uplo,
+             const rocblas_int n,
+             T* A,
+             const rocblas_int lda,
+             rocblas_int* ipiv,
+             rocblas_int* info,
+             T* work,
+             S* rwork,
+             rocblas_int* iwork)
+{
+    char normC = rocsolver2char_norm_type(norm);
+    S anorm;
+    if(POSITIVE)
+    {
+        anorm = cpu_lansy('O', uplo, n, A, lda, rwork);
+        cpu_potrf(uplo, n, A, lda, info);
+        return cpu_pocon(uplo, n, A, lda, anorm, work, rwork, iwork);
+    }
+    else
+    {
+        anorm = cpu_lange(normC, n, n, A, lda, rwork);
+        cpu_getrf(n, n, A, lda, ipiv, info);
+        return cpu_gecon(normC, n, A, lda, anorm, work, rwork, iwork);
+    }
+}
+
+template <bool STRIDED,
+          bool POSITIVE,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Sd,
+          typename Th,
+          typename Uh,
+          typename Sh>
+void gecon_getError(const rocblas_handle handle,
+                    const rocsolver_norm_type norm,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Sd& dAnorm,
+                    Sd& dRcond,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Uh& hIpiv,
+                    Uh& hInfo,
+                    Sh& hRcond,
+                    Sh& hRcondRes,
+                    double* max_err)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<T> work(4 * n);
+    std::vector<S> rwork(2 * n);
+    std::vector<rocblas_int> iwork(n);
+
+    // input data initialization
+    gecon_initData<true, true, POSITIVE, T>(handle, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR((gecon_factorize<STRIDED, POSITIVE, T>(handle, norm, uplo, n, dA, lda, stA,
+                                                               dIpiv, stP, dAnorm, dInfo, bc)));
+    CHECK_ROCBLAS_ERROR(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA.data(), lda, stA,
+                                             dAnorm.data(), dRcond.data(), bc));
+    CHECK_HIP_ERROR(hRcondRes.transfer_from(dRcond));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        hRcond[b][0] = gecon_host<POSITIVE>(norm, uplo, n, hA[b], lda, hIpiv[b], hInfo[b],
+                                            work.data(), rwork.data(), iwork.data());
+
+    // error is |rcond - rcondRes| / rcond
+    // (both estimates follow the same sequence of steps, so they only differ by rounding
+    // errors in the triangular solves)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        S rcond = hRcond[b][0];
+        err = std::abs(rcond - hRcondRes[b][0]) / rcond;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED,
+          bool POSITIVE,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Sd,
+          typename Th,
+          typename Uh,
+          typename Sh>
+void gecon_getPerfData(const rocblas_handle handle,
+                       const rocsolver_norm_type norm,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       Sd& dAnorm,
+                       Sd& dRcond,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Uh& hIpiv,
+                       Uh& hInfo,
+                       Sh& hRcond,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<T> work(4 * n);
+    std::vector<S> rwork(2 * n);
+    std::vector<rocblas_int> iwork(n);
+
+    if(!perf)
+    {
+        gecon_initData<true, false, POSITIVE, T>(handle, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if no perf mode)
+        // (this includes the norm and the factorization)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            hRcond[b][0] = gecon_host<POSITIVE>(norm, uplo, n, hA[b], lda, hIpiv[b], hInfo[b],
+                                                work.data(), rwork.data(), iwork.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    // the factorization is computed once; only the estimation is timed
+    gecon_initData<true, true, POSITIVE, T>(handle, n, dA, lda, bc, hA);
+    CHECK_ROCBLAS_ERROR((gecon_factorize<STRIDED, POSITIVE, T>(handle, norm, uplo, n, dA, lda, stA,
+                                                               dIpiv, stP, dAnorm, dInfo, bc)));
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_ROCBLAS_ERROR(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA.data(), lda,
+                                                 stA, dAnorm.data(), dRcond.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        start = get_time_us_sync(stream);
+        gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA.data(), lda, stA, dAnorm.data(),
+                             dRcond.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool POSITIVE, typename T>
+void testing_gecon(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char normC = POSITIVE ? 'O' : argus.get<char>("norm");
+    char uploC = POSITIVE ? argus.get<char>("uplo") : 'U';
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocsolver_norm_type norm = char2rocsolver_norm_type(normC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_stride stP = n;
+    rocblas_int bc = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(!POSITIVE && norm != rocsolver_norm_one && norm != rocsolver_norm_inf)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n,
+                                                       (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                       (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, (T*)nullptr,
+                                                       lda, stA, (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n,
+                                                       (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                       (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, (T*)nullptr,
+                                                       lda, stA, (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    // (the factorization is also computed by the test)
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+        {
+            CHECK_ALLOC_QUERY(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n,
+                                                   (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                   (S*)nullptr, bc));
+            if(POSITIVE)
+                CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n,
+                                                        (T* const*)nullptr, lda, stA,
+                                                        (rocblas_int*)nullptr, bc));
+            else
+                CHECK_ALLOC_QUERY(rocsolver_getf2_getrf(STRIDED, true, handle, n, n,
+                                                        (T* const*)nullptr, lda, stA,
+                                                        (rocblas_int*)nullptr, stP,
+                                                        (rocblas_int*)nullptr, bc));
+        }
+        else
+        {
+            CHECK_ALLOC_QUERY(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, (T*)nullptr, lda,
+                                                   stA, (S*)nullptr, (S*)nullptr, bc));
+            if(POSITIVE)
+                CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n, (T*)nullptr,
+                                                        lda, stA, (rocblas_int*)nullptr, bc));
+            else
+                CHECK_ALLOC_QUERY(rocsolver_getf2_getrf(STRIDED, true, handle, n, n, (T*)nullptr,
+                                                        lda, stA, (rocblas_int*)nullptr, stP,
+                                                        (rocblas_int*)nullptr, bc));
+        }
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<S> hRcond(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcondRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<S> dAnorm(1, 1, 1, bc);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dAnorm.memcheck());
+    CHECK_HIP_ERROR(dRcond.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA.data(),
+                                                       lda, stA, dAnorm.data(), dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gecon_getError<STRIDED, POSITIVE, T>(handle, norm, uplo, n, dA, lda, stA, dIpiv, stP,
+                                                 dAnorm, dRcond, dInfo, bc, hA, hIpiv, hInfo,
+                                                 hRcond, hRcondRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gecon_getPerfData<STRIDED, POSITIVE, T>(
+                handle, norm, uplo, n, dA, lda, stA, dIpiv, stP, dAnorm, dRcond, dInfo, bc, hA,
+                hIpiv, hInfo, hRcond, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(gecon_call<POSITIVE>(STRIDED, handle, norm, uplo, n, dA.data(),
+                                                       lda, stA, dAnorm.data(), dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gecon_getError<STRIDED, POSITIVE, T>(handle, norm, uplo, n, dA, lda, stA, dIpiv, stP,
+                                                 dAnorm, dRcond, dInfo, bc, hA, hIpiv, hInfo,
+                                                 hRcond, hRcondRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gecon_getPerfData<STRIDED, POSITIVE, T>(
+                handle, norm, uplo, n, dA, lda, stA, dIpiv, stP, dAnorm, dRcond, dInfo, bc, hA,
+                hIpiv, hInfo, hRcond, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            char optC = POSITIVE ? uploC : normC;
+            const char* optName = POSITIVE ? "uplo" : "norm";
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output(optName, "n", "lda", "batch_c");
+                rocsolver_bench_output(optC, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output(optName, "n", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(optC, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output(optName, "n", "lda");
+                rocsolver_bench_output(optC, n, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GECON(...) extern template void testing_gecon<__VA_ARGS__>(Arguments&);
+
+// (the third template argument selects GECON or POCON)
+INSTANTIATE(EXTERN_TESTING_GECON,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
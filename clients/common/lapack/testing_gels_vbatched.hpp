@@ -0,0 +1,599 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/lapack/testing_getrf_vbatched.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Td>
+void gels_vbatched_checkBadArgs(const rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int* dM,
+                                const rocblas_int* dN,
+                                const rocblas_int* dNrhs,
+                                Td dA,
+                                const rocblas_int* dLda,
+                                Td dB,
+                                const rocblas_int* dLdb,
+                                rocblas_int* dInfo,
+                                const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gels_vbatched(nullptr, trans, dM, dN, dNrhs, dA, dLda, dB, dLdb, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, rocblas_operation(0), dM, dN, dNrhs, dA,
+                                                  dLda, dB, dLdb, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gels_vbatched(handle, trans, dM, dN, dNrhs, dA, dLda, dB, dLdb, dInfo, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, (rocblas_int*)nullptr, dN, dNrhs,
+                                                  dA, dLda, dB, dLdb, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, (rocblas_int*)nullptr, dNrhs,
+                                                  dA, dLda, dB, dLdb, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, dN, (rocblas_int*)nullptr,
+                                                  dA, dLda, dB, dLdb, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, dN, dNrhs, dA,
+                                                  (rocblas_int*)nullptr, dB, dLdb, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, dN, dNrhs, dA, dLda, dB,
+                                                  (rocblas_int*)nullptr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, dN, dNrhs, (Td) nullptr, dLda,
+                                                  dB, dLdb, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, dN, dNrhs, dA, dLda,
+                                                  (Td) nullptr, dLdb, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM, dN, dNrhs, dA, dLda, dB, dLdb,
+                                                  (rocblas_int*)nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                                  (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                  (Td) nullptr, (rocblas_int*)nullptr, (Td) nullptr,
+                                                  (rocblas_int*)nullptr, (rocblas_int*)nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_gels_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hDims(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, bc);
+    device_batch_vector<T> dA(1, 1, 1);
+    device_batch_vector<T> dB(1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    hDims[0][0] = 1;
+    CHECK_HIP_ERROR(dM.transfer_from(hDims));
+    CHECK_HIP_ERROR(dN.transfer_from(hDims));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hDims));
+    CHECK_HIP_ERROR(dLda.transfer_from(hDims));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hDims));
+
+    // check bad arguments
+    gels_vbatched_checkBadArgs(handle, trans, dM.data(), dN.data(), dNrhs.data(), dA.data(),
+                               dLda.data(), dB.data(), dLdb.data(), dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th, typename Ih>
+void gels_vbatched_initData(const rocblas_handle handle,
+                            Ih& hM,
+                            Ih& hN,
+                            Td& dA,
+                            Ih& hLda,
+                            Td& dB,
+                            const rocblas_int bc,
+                            Th& hA,
+                            Th& hB,
+                            const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int m = hM[b][0];
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // add some singularities
+            // always the same elements for debugging purposes
+            if(singular && m > 0 && n > 0 && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                if(n <= m)
+                {
+                    // zero a column
+                    rocblas_int j = (n / 2 + b) % n;
+                    for(rocblas_int i = 0; i < m; i++)
+                        hA[b][i + j * lda] = 0;
+                }
+                else
+                {
+                    // zero a row
+                    rocblas_int i = (m / 2 + b) % m;
+                    for(rocblas_int j = 0; j < n; j++)
+                        hA[b][i + j * lda] = 0;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Th, typename Ih>
+void gels_vbatched_getError(const rocblas_handle handle,
+                            const rocblas_operation trans,
+                            Id& dM,
+                            Id& dN,
+                            Id& dNrhs,
+                            Td& dA,
+                            Id& dLda,
+                            Td& dB,
+                            Id& dLdb,
+                            Id& dInfo,
+                            const rocblas_int bc,
+                            Ih& hM,
+                            Ih& hN,
+                            Ih& hNrhs,
+                            Ih& hLda,
+                            Ih& hLdb,
+                            Th& hA,
+                            Th& hB,
+                            Th& hBRes,
+                            Ih& hInfo,
+                            Ih& hInfoRes,
+                            double* max_err,
+                            const bool singular)
+{
+    // input data initialization
+    gels_vbatched_initData<true, true, T>(handle, hM, hN, dA, hLda, dB, bc, hA, hB, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gels_vbatched(handle, trans, dM.data(), dN.data(), dNrhs.data(),
+                                                dA.data(), dLda.data(), dB.data(), dLdb.data(),
+                                                dInfo.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        rocblas_int m = hM[b][0];
+        rocblas_int n = hN[b][0];
+        rocblas_int nrhs = hNrhs[b][0];
+        rocblas_int sizeW = std::max(1, std::min(m, n) + std::max(std::min(m, n), nrhs));
+        std::vector<T> hW(sizeW);
+        cpu_gels(trans, m, n, nrhs, hA[b], hLda[b][0], hB[b], hLdb[b][0], hW.data(), sizeW,
+                 hInfo[b]);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', std::max(hM[b][0], hN[b][0]), hNrhs[b][0], hLdb[b][0], hB[b],
+                         hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <typename T, typename Td, typename Id, typename Th, typename Ih>
+void gels_vbatched_getPerfData(const rocblas_handle handle,
+                               const rocblas_operation trans,
+                               Id& dM,
+                               Id& dN,
+                               Id& dNrhs,
+                               Td& dA,
+                               Id& dLda,
+                               Td& dB,
+                               Id& dLdb,
+                               Id& dInfo,
+                               const rocblas_int bc,
+                               Ih& hM,
+                               Ih& hN,
+                               Ih& hNrhs,
+                               Ih& hLda,
+                               Ih& hLdb,
+                               Th& hA,
+                               Th& hB,
+                               Ih& hInfo,
+                               double* gpu_time_used,
+                               double* cpu_time_used,
+                               const int hot_calls,
+                               const int profile,
+                               const bool profile_kernels,
+                               const bool perf,
+                               const bool singular)
+{
+    if(!perf)
+    {
+        gels_vbatched_initData<true, false, T>(handle, hM, hN, dA, hLda, dB, bc, hA, hB, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int m = hM[b][0];
+            rocblas_int n = hN[b][0];
+            rocblas_int nrhs = hNrhs[b][0];
+            rocblas_int sizeW = std::max(1, std::min(m, n) + std::max(std::min(m, n), nrhs));
+            std::vector<T> hW(sizeW);
+            cpu_gels(trans, m, n, nrhs, hA[b], hLda[b][0], hB[b], hLdb[b][0], hW.data(), sizeW,
+                     hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gels_vbatched_initData<true, false, T>(handle, hM, hN, dA, hLda, dB, bc, hA, hB, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gels_vbatched_initData<false, true, T>(handle, hM, hN, dA, hLda, dB, bc, hA, hB, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gels_vbatched(handle, trans, dM.data(), dN.data(),
+                                                    dNrhs.data(), dA.data(), dLda.data(), dB.data(),
+                                                    dLdb.data(), dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gels_vbatched_initData<false, true, T>(handle, hM, hN, dA, hLda, dB, bc, hA, hB, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gels_vbatched(handle, trans, dM.data(), dN.data(), dNrhs.data(), dA.data(),
+                                dLda.data(), dB.data(), dLdb.data(), dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+void testing_gels_vbatched(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", std::max(m, n));
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    bool invalid_value = ((COMPLEX && trans == rocblas_operation_transpose)
+                          || (!COMPLEX && trans == rocblas_operation_conjugate_transpose));
+    if(invalid_value)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                                      (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                      (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                      (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                      (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    // (m, n, nrhs, lda and ldb are the dimensions of the largest instances; the storage of
+    // every instance is sized for them)
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    if(bc < 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                                      (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                      (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                      (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                      (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // dimensions of the batch instances
+    host_strided_batch_vector<rocblas_int> hM(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hNrhs(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLdb(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, bc);
+    if(bc)
+    {
+        CHECK_HIP_ERROR(dM.memcheck());
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dNrhs.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dLdb.memcheck());
+    }
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hM[b][0] = vbatched_dim(m, b);
+        hN[b][0] = vbatched_dim(n, b);
+        hNrhs[b][0] = vbatched_dim(nrhs, b);
+        hLda[b][0] = lda - (m - hM[b][0]);
+        hLdb[b][0] = ldb - (std::max(m, n) - std::max(hM[b][0], hN[b][0]));
+    }
+    CHECK_HIP_ERROR(dM.transfer_from(hM));
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+
+    // (the dimensions are only checked on the device; the invalid instances are
+    // reported in info)
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n);
+    if(invalid_size)
+    {
+        device_batch_vector<T> dA(1, 1, bc);
+        device_batch_vector<T> dB(1, 1, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        if(bc)
+        {
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dB.memcheck());
+            CHECK_HIP_ERROR(dInfo.memcheck());
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM.data(), dN.data(),
+                                                      dNrhs.data(), dA.data(), dLda.data(),
+                                                      dB.data(), dLdb.data(), dInfo.data(), bc),
+                              rocblas_status_success);
+
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int arg = (hM[b][0] < 0)  ? -2
+                : (hN[b][0] < 0)              ? -3
+                : (hNrhs[b][0] < 0)           ? -4
+                : (hLda[b][0] < hM[b][0])     ? -6
+                                              : -8;
+            EXPECT_EQ(hInfo[b][0], arg) << "where b = " << b;
+        }
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_gels_vbatched(handle, trans, dM.data(), dN.data(), dNrhs.data(),
+                                                  (T* const*)nullptr, dLda.data(),
+                                                  (T* const*)nullptr, dLdb.data(),
+                                                  (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hB(size_B, 1, bc);
+    host_batch_vector<T> hBRes(size_BRes, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_batch_vector<T> dB(size_B, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(bc)
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels_vbatched(handle, trans, dM.data(), dN.data(),
+                                                      dNrhs.data(), dA.data(), dLda.data(),
+                                                      dB.data(), dLdb.data(), dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gels_vbatched_getError<T>(handle, trans, dM, dN, dNrhs, dA, dLda, dB, dLdb, dInfo, bc, hM,
+                                  hN, hNrhs, hLda, hLdb, hA, hB, hBRes, hInfo, hInfoRes,
+                                  &max_error, argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        gels_vbatched_getPerfData<T>(handle, trans, dM, dN, dNrhs, dA, dLda, dB, dLdb, dInfo, bc,
+                                     hM, hN, hNrhs, hLda, hLdb, hA, hB, hInfo, &gpu_time_used,
+                                     &cpu_time_used, hot_calls, argus.profile,
+                                     argus.profile_kernels, argus.perf, argus.singular);
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("trans", "max_m", "max_n", "max_nrhs", "max_lda", "max_ldb",
+                                   "batch_c");
+            rocsolver_bench_output(transC, m, n, nrhs, lda, ldb, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GELS_VBATCHED(...) \
+    extern template void testing_gels_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GELS_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
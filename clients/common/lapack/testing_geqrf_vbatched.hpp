@@ -0,0 +1,455 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/lapack/testing_getrf_vbatched.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Td, typename Ud>
+void geqrf_vbatched_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_int* dM,
+                                 const rocblas_int* dN,
+                                 Td dA,
+                                 const rocblas_int* dLda,
+                                 Ud dIpiv,
+                                 const rocblas_stride stP,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(nullptr, dM, dN, dA, dLda, dIpiv, stP, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, stP, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, (rocblas_int*)nullptr, dN, dA, dLda,
+                                                   dIpiv, stP, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, dM, (rocblas_int*)nullptr, dA, dLda,
+                                                   dIpiv, stP, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, dM, dN, dA, (rocblas_int*)nullptr,
+                                                   dIpiv, stP, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrf_vbatched(handle, dM, dN, (Td) nullptr, dLda, dIpiv, stP, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrf_vbatched(handle, dM, dN, dA, dLda, (Ud) nullptr, stP, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, (Td) nullptr,
+                                                   (rocblas_int*)nullptr, (Ud) nullptr, stP, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_geqrf_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hDims(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_batch_vector<T> dA(1, 1, 1);
+    device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    hDims[0][0] = 1;
+    CHECK_HIP_ERROR(dM.transfer_from(hDims));
+    CHECK_HIP_ERROR(dN.transfer_from(hDims));
+    CHECK_HIP_ERROR(dLda.transfer_from(hDims));
+
+    // check bad arguments
+    geqrf_vbatched_checkBadArgs(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(),
+                                stP, bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th, typename Ih>
+void geqrf_vbatched_initData(const rocblas_handle handle,
+                             Ih& hM,
+                             Ih& hN,
+                             Td& dA,
+                             Ih& hLda,
+                             const rocblas_int bc,
+                             Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int m = hM[b][0];
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void geqrf_vbatched_getError(const rocblas_handle handle,
+                             Id& dM,
+                             Id& dN,
+                             Td& dA,
+                             Id& dLda,
+                             Ud& dIpiv,
+                             const rocblas_stride stP,
+                             const rocblas_int bc,
+                             Ih& hM,
+                             Ih& hN,
+                             Ih& hLda,
+                             Th& hA,
+                             Th& hARes,
+                             Uh& hIpiv,
+                             double* max_err)
+{
+    // input data initialization
+    geqrf_vbatched_initData<true, true, T>(handle, hM, hN, dA, hLda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                 dLda.data(), dIpiv.data(), stP, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        rocblas_int n = hN[b][0];
+        std::vector<T> hW(std::max(1, n));
+        cpu_geqrf(hM[b][0], n, hA[b], hLda[b][0], hIpiv[b], hW.data(), std::max(1, n));
+    }
+
+    // error is ||hA - hARes|| / ||hA|| (ideally ||QR - Qres Rres|| / ||QR||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', hM[b][0], hN[b][0], hLda[b][0], hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void geqrf_vbatched_getPerfData(const rocblas_handle handle,
+                                Id& dM,
+                                Id& dN,
+                                Td& dA,
+                                Id& dLda,
+                                Ud& dIpiv,
+                                const rocblas_stride stP,
+                                const rocblas_int bc,
+                                Ih& hM,
+                                Ih& hN,
+                                Ih& hLda,
+                                Th& hA,
+                                Uh& hIpiv,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf)
+{
+    if(!perf)
+    {
+        geqrf_vbatched_initData<true, false, T>(handle, hM, hN, dA, hLda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int n = hN[b][0];
+            std::vector<T> hW(std::max(1, n));
+            cpu_geqrf(hM[b][0], n, hA[b], hLda[b][0], hIpiv[b], hW.data(), std::max(1, n));
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrf_vbatched_initData<true, false, T>(handle, hM, hN, dA, hLda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqrf_vbatched_initData<false, true, T>(handle, hM, hN, dA, hLda, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geqrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                     dLda.data(), dIpiv.data(), stP, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        geqrf_vbatched_initData<false, true, T>(handle, hM, hN, dA, hLda, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geqrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(),
+                                 stP, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_geqrf_vbatched(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+
+    rocblas_int bc = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // (m, n and lda are the dimensions of the largest instances; the storage of
+    // every instance is sized for them)
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    if(bc < 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                       (rocblas_int*)nullptr, (T*)nullptr, stP, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // dimensions of the batch instances
+    host_strided_batch_vector<rocblas_int> hM(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    if(bc)
+    {
+        CHECK_HIP_ERROR(dM.memcheck());
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+    }
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hM[b][0] = vbatched_dim(m, b);
+        hN[b][0] = vbatched_dim(n, b);
+        hLda[b][0] = lda - (m - hM[b][0]);
+    }
+    CHECK_HIP_ERROR(dM.transfer_from(hM));
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+    // (the dimensions are only checked on the device; the invalid instances are skipped)
+    bool invalid_size = (m < 0 || n < 0 || lda < m);
+    if(invalid_size)
+    {
+        device_batch_vector<T> dA(1, 1, bc);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, bc);
+        if(bc)
+        {
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                       dLda.data(), dIpiv.data(), 1, bc),
+                              rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_geqrf_vbatched(handle, dM.data(), dN.data(), (T* const*)nullptr,
+                                                   dLda.data(), (T*)nullptr, stP, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hARes(size_ARes, 1, bc);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                       dLda.data(), dIpiv.data(), stP, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        geqrf_vbatched_getError<T>(handle, dM, dN, dA, dLda, dIpiv, stP, bc, hM, hN, hLda, hA,
+                                   hARes, hIpiv, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        geqrf_vbatched_getPerfData<T>(handle, dM, dN, dA, dLda, dIpiv, stP, bc, hM, hN, hLda, hA,
+                                      hIpiv, &gpu_time_used, &cpu_time_used, hot_calls,
+                                      argus.profile, argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("max_m", "max_n", "max_lda", "strideP", "batch_c");
+            rocsolver_bench_output(m, n, lda, stP, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQRF_VBATCHED(...) \
+    extern template void testing_geqrf_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQRF_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,833 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U, typename E>
+void gesvx_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        T dAF,
+                        const rocblas_int ldaf,
+                        const rocblas_stride stAF,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        E dEqued,
+                        S dR,
+                        const rocblas_stride stR,
+                        S dC,
+                        const rocblas_stride stC,
+                        T dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        T dX,
+                        const rocblas_int ldx,
+                        const rocblas_stride stX,
+                        S dRcond,
+                        S dBerr,
+                        const rocblas_stride stBerr,
+                        U dInfo,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, nullptr, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB, ldb, stB,
+                                          dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, rocblas_operation(0), n, nrhs, dA, lda,
+                                          stA, dAF, ldaf, stAF, dIpiv, stP, dEqued, dR, stR, dC,
+                                          stC, dB, ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr,
+                                          dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF,
+                                              ldaf, stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB,
+                                              ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo,
+                                              -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, (T) nullptr, lda, stA,
+                                          dAF, ldaf, stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB,
+                                          ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA,
+                                          (T) nullptr, ldaf, stAF, dIpiv, stP, dEqued, dR, stR, dC,
+                                          stC, dB, ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr,
+                                          dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, (U) nullptr, stP, dEqued, dR, stR, dC, stC, dB, ldb,
+                                          stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, (E) nullptr, dR, stR, dC, stC, dB, ldb,
+                                          stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, (S) nullptr, stR, dC, stC, dB,
+                                          ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, (S) nullptr, stC, dB,
+                                          ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, (T) nullptr,
+                                          ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB, ldb, stB,
+                                          (T) nullptr, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB, ldb, stB,
+                                          dX, ldx, stX, (S) nullptr, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB, ldb, stB,
+                                          dX, ldx, stX, dRcond, (S) nullptr, stBerr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, dB, ldb, stB,
+                                          dX, ldx, stX, dRcond, dBerr, stBerr, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, 0, nrhs, (T) nullptr, lda, stA,
+                                          (T) nullptr, ldaf, stAF, (U) nullptr, stP, dEqued,
+                                          (S) nullptr, stR, (S) nullptr, stC, (T) nullptr, ldb, stB,
+                                          (T) nullptr, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, 0, dA, lda, stA, dAF, ldaf,
+                                          stAF, dIpiv, stP, dEqued, dR, stR, dC, stC, (T) nullptr,
+                                          ldb, stB, (T) nullptr, ldx, stX, dRcond, (S) nullptr,
+                                          stBerr, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF,
+                                              ldaf, stAF, dIpiv, stP, (E) nullptr, dR, stR, dC, stC,
+                                              dB, ldb, stB, dX, ldx, stX, (S) nullptr, dBerr,
+                                              stBerr, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvx_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldaf = 1;
+    rocblas_int ldb = 1;
+    rocblas_int ldx = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stAF = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stR = 1;
+    rocblas_stride stC = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stX = 1;
+    rocblas_stride stBerr = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocsolver_equed> dEqued(1, 1, 1, 1);
+    device_strided_batch_vector<S> dR(1, 1, 1, 1);
+    device_strided_batch_vector<S> dC(1, 1, 1, 1);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+    device_strided_batch_vector<S> dBerr(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dEqued.memcheck());
+    CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+    CHECK_HIP_ERROR(dRcond.memcheck());
+    CHECK_HIP_ERROR(dBerr.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dAF(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAF.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+
+        // check bad arguments
+        gesvx_checkBadArgs<STRIDED>(handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(), ldaf,
+                                    stAF, dIpiv.data(), stP, dEqued.data(), dR.data(), stR,
+                                    dC.data(), stC, dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                    dRcond.data(), dBerr.data(), stBerr, dInfo.data(), bc);
+    }
+    else
+    {
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dAF(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAF.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+
+        // check bad arguments
+        gesvx_checkBadArgs<STRIDED>(handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(), ldaf,
+                                    stAF, dIpiv.data(), stP, dEqued.data(), dR.data(), stR,
+                                    dC.data(), stC, dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                    dRcond.data(), dBerr.data(), stBerr, dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvx_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // scale some rows and columns badly, so that the equilibration is applied
+            // (always the same rows and columns for debugging purposes)
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i % 4 == 1)
+                        hA[b][i + j * lda] *= 1000;
+                    if(j % 3 == 2)
+                        hA[b][i + j * lda] /= 100;
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                rocblas_int j = n / 4 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                    hA[b][i + j * lda] = 0;
+                j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                    hA[b][i + j * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Ed,
+          typename Sd,
+          typename Th,
+          typename Uh,
+          typename Sh>
+void gesvx_getError(const rocblas_handle handle,
+                    const rocblas_operation trans,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dAF,
+                    const rocblas_int ldaf,
+                    const rocblas_stride stAF,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Ed& dEqued,
+                    Sd& dR,
+                    const rocblas_stride stR,
+                    Sd& dC,
+                    const rocblas_stride stC,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dX,
+                    const rocblas_int ldx,
+                    const rocblas_stride stX,
+                    Sd& dRcond,
+                    Sd& dBerr,
+                    const rocblas_stride stBerr,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hAF,
+                    Uh& hIpiv,
+                    Sh& hR,
+                    Sh& hC,
+                    Th& hB,
+                    Th& hX,
+                    Th& hXRes,
+                    Sh& hRcond,
+                    Sh& hFerr,
+                    Sh& hBerr,
+                    Uh& hInfo,
+                    double* max_err,
+                    const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<T> work(4 * n);
+    std::vector<S> rwork(2 * n);
+    std::vector<rocblas_int> iwork(n);
+    std::vector<char> hEqued(bc);
+
+    host_strided_batch_vector<rocsolver_equed> hEquedRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcondRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hBerrRes(nrhs, 1, stBerr, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+
+    // input data initialization
+    gesvx_initData<true, true, T>(handle, n, nrhs, dA, lda, dB, ldb, bc, hA, hB, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA,
+                                        dAF.data(), ldaf, stAF, dIpiv.data(), stP, dEqued.data(),
+                                        dR.data(), stR, dC.data(), stC, dB.data(), ldb, stB,
+                                        dX.data(), ldx, stX, dRcond.data(), dBerr.data(), stBerr,
+                                        dInfo.data(), bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hEquedRes.transfer_from(dEqued));
+    CHECK_HIP_ERROR(hRcondRes.transfer_from(dRcond));
+    CHECK_HIP_ERROR(hBerrRes.transfer_from(dBerr));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cpu_gesvx(trans, n, nrhs, hA[b], lda, hAF[b], ldaf, hIpiv[b], &hEqued[b], hR[b], hC[b],
+                  hB[b], ldb, hX[b], ldx, hRcond[b], hFerr[b], hBerr[b], work.data(), rwork.data(),
+                  iwork.data(), hInfo[b]);
+
+    // error is ||hX - hXRes|| / ||hX||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // (the solution is not computed for singular matrices)
+        if(hInfo[b][0] > 0 && hInfo[b][0] <= n)
+            continue;
+
+        err = norm_error('I', n, nrhs, ldx, hX[b], hXRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // the refined solutions should have backward errors of the order of eps
+        for(rocblas_int j = 0; j < nrhs; j++)
+        {
+            err = hBerrRes[b][j];
+            *max_err = err > *max_err ? err : *max_err;
+        }
+
+        // error in rcond is |rcond - rcondRes| / rcond
+        err = std::abs(hRcond[b][0] - hRcondRes[b][0]) / hRcond[b][0];
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check the equilibration and info
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hEqued[b], rocsolver2char_equed(hEquedRes[b][0])) << "where b = " << b;
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hEqued[b] != rocsolver2char_equed(hEquedRes[b][0]) || hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Ed,
+          typename Sd,
+          typename Th,
+          typename Uh,
+          typename Sh>
+void gesvx_getPerfData(const rocblas_handle handle,
+                       const rocblas_operation trans,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dAF,
+                       const rocblas_int ldaf,
+                       const rocblas_stride stAF,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       Ed& dEqued,
+                       Sd& dR,
+                       const rocblas_stride stR,
+                       Sd& dC,
+                       const rocblas_stride stC,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Td& dX,
+                       const rocblas_int ldx,
+                       const rocblas_stride stX,
+                       Sd& dRcond,
+                       Sd& dBerr,
+                       const rocblas_stride stBerr,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hAF,
+                       Uh& hIpiv,
+                       Sh& hR,
+                       Sh& hC,
+                       Th& hB,
+                       Th& hX,
+                       Sh& hRcond,
+                       Sh& hFerr,
+                       Sh& hBerr,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<T> work(4 * n);
+    std::vector<S> rwork(2 * n);
+    std::vector<rocblas_int> iwork(n);
+    std::vector<char> hEqued(bc);
+
+    if(!perf)
+    {
+        gesvx_initData<true, false, T>(handle, n, nrhs, dA, lda, dB, ldb, bc, hA, hB, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cpu_gesvx(trans, n, nrhs, hA[b], lda, hAF[b], ldaf, hIpiv[b], &hEqued[b], hR[b], hC[b],
+                      hB[b], ldb, hX[b], ldx, hRcond[b], hFerr[b], hBerr[b], work.data(),
+                      rwork.data(), iwork.data(), hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesvx_initData<true, false, T>(handle, n, nrhs, dA, lda, dB, ldb, bc, hA, hB, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvx_initData<false, true, T>(handle, n, nrhs, dA, lda, dB, ldb, bc, hA, hB, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA,
+                                            dAF.data(), ldaf, stAF, dIpiv.data(), stP,
+                                            dEqued.data(), dR.data(), stR, dC.data(), stC,
+                                            dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                            dRcond.data(), dBerr.data(), stBerr, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvx_initData<false, true, T>(handle, n, nrhs, dA, lda, dB, ldb, bc, hA, hB, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(), ldaf,
+                        stAF, dIpiv.data(), stP, dEqued.data(), dR.data(), stR, dC.data(), stC,
+                        dB.data(), ldb, stB, dX.data(), ldx, stX, dRcond.data(), dBerr.data(),
+                        stBerr, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvx(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldaf = argus.get<rocblas_int>("ldaf", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_int ldx = argus.get<rocblas_int>("ldx", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stAF = argus.get<rocblas_stride>("strideAF", ldaf * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+    rocblas_stride stX = argus.get<rocblas_stride>("strideX", ldx * nrhs);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_stride stR = n;
+    rocblas_stride stC = n;
+    rocblas_stride stBerr = nrhs;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_AF = size_t(ldaf) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_X = size_t(ldx) * nrhs;
+    size_t size_P = size_t(n);
+    size_t size_Berr = size_t(nrhs);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (n < 0 || nrhs < 0 || lda < n || ldaf < n || ldb < n || ldx < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, (T* const*)nullptr, lda, stA,
+                                (T* const*)nullptr, ldaf, stAF, (rocblas_int*)nullptr, stP,
+                                (rocsolver_equed*)nullptr, (S*)nullptr, stR, (S*)nullptr, stC,
+                                (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldx, stX,
+                                (S*)nullptr, (S*)nullptr, stBerr, (rocblas_int*)nullptr, bc),
+                rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, (T*)nullptr, lda, stA, (T*)nullptr,
+                                ldaf, stAF, (rocblas_int*)nullptr, stP, (rocsolver_equed*)nullptr,
+                                (S*)nullptr, stR, (S*)nullptr, stC, (T*)nullptr, ldb, stB,
+                                (T*)nullptr, ldx, stX, (S*)nullptr, (S*)nullptr, stBerr,
+                                (rocblas_int*)nullptr, bc),
+                rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gesvx(
+                STRIDED, handle, trans, n, nrhs, (T* const*)nullptr, lda, stA, (T* const*)nullptr,
+                ldaf, stAF, (rocblas_int*)nullptr, stP, (rocsolver_equed*)nullptr, (S*)nullptr,
+                stR, (S*)nullptr, stC, (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldx, stX,
+                (S*)nullptr, (S*)nullptr, stBerr, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gesvx(
+                STRIDED, handle, trans, n, nrhs, (T*)nullptr, lda, stA, (T*)nullptr, ldaf, stAF,
+                (rocblas_int*)nullptr, stP, (rocsolver_equed*)nullptr, (S*)nullptr, stR,
+                (S*)nullptr, stC, (T*)nullptr, ldb, stB, (T*)nullptr, ldx, stX, (S*)nullptr,
+                (S*)nullptr, stBerr, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<S> hR(size_P, 1, stR, bc);
+    host_strided_batch_vector<S> hC(size_P, 1, stC, bc);
+    host_strided_batch_vector<S> hRcond(1, 1, 1, bc);
+    host_strided_batch_vector<S> hFerr(size_Berr, 1, stBerr, bc);
+    host_strided_batch_vector<S> hBerr(size_Berr, 1, stBerr, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocsolver_equed> dEqued(1, 1, 1, bc);
+    device_strided_batch_vector<S> dR(size_P, 1, stR, bc);
+    device_strided_batch_vector<S> dC(size_P, 1, stC, bc);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, bc);
+    device_strided_batch_vector<S> dBerr(size_Berr, 1, stBerr, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+    {
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+    }
+    if(size_Berr)
+        CHECK_HIP_ERROR(dBerr.memcheck());
+    CHECK_HIP_ERROR(dEqued.memcheck());
+    CHECK_HIP_ERROR(dRcond.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hAF(size_AF, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hXRes(size_X, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dAF(size_AF, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        if(size_A)
+        {
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dAF.memcheck());
+        }
+        if(size_B)
+        {
+            CHECK_HIP_ERROR(dB.memcheck());
+            CHECK_HIP_ERROR(dX.memcheck());
+        }
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA.data(), lda,
+                                                  stA, dAF.data(), ldaf, stAF, dIpiv.data(), stP,
+                                                  dEqued.data(), dR.data(), stR, dC.data(), stC,
+                                                  dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                                  dRcond.data(), dBerr.data(), stBerr,
+                                                  dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesvx_getError<STRIDED, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf, stAF, dIpiv,
+                                       stP, dEqued, dR, stR, dC, stC, dB, ldb, stB, dX, ldx, stX,
+                                       dRcond, dBerr, stBerr, dInfo, bc, hA, hAF, hIpiv, hR, hC,
+                                       hB, hX, hXRes, hRcond, hFerr, hBerr, hInfo, &max_error,
+                                       argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gesvx_getPerfData<STRIDED, T>(
+                handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf, stAF, dIpiv, stP, dEqued, dR, stR,
+                dC, stC, dB, ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc, hA, hAF,
+                hIpiv, hR, hC, hB, hX, hRcond, hFerr, hBerr, hInfo, &gpu_time_used, &cpu_time_used,
+                hot_calls, argus.profile, argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hAF(size_AF, 1, stAF, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hXRes(size_X, 1, stX, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dAF(size_AF, 1, stAF, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        if(size_A)
+        {
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dAF.memcheck());
+        }
+        if(size_B)
+        {
+            CHECK_HIP_ERROR(dB.memcheck());
+            CHECK_HIP_ERROR(dX.memcheck());
+        }
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvx(STRIDED, handle, trans, n, nrhs, dA.data(), lda,
+                                                  stA, dAF.data(), ldaf, stAF, dIpiv.data(), stP,
+                                                  dEqued.data(), dR.data(), stR, dC.data(), stC,
+                                                  dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                                  dRcond.data(), dBerr.data(), stBerr,
+                                                  dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesvx_getError<STRIDED, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf, stAF, dIpiv,
+                                       stP, dEqued, dR, stR, dC, stC, dB, ldb, stB, dX, ldx, stX,
+                                       dRcond, dBerr, stBerr, dInfo, bc, hA, hAF, hIpiv, hR, hC,
+                                       hB, hX, hXRes, hRcond, hFerr, hBerr, hInfo, &max_error,
+                                       argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gesvx_getPerfData<STRIDED, T>(
+                handle, trans, n, nrhs, dA, lda, stA, dAF, ldaf, stAF, dIpiv, stP, dEqued, dR, stR,
+                dC, stC, dB, ldb, stB, dX, ldx, stX, dRcond, dBerr, stBerr, dInfo, bc, hA, hAF,
+                hIpiv, hR, hC, hB, hX, hRcond, hFerr, hBerr, hInfo, &gpu_time_used, &cpu_time_used,
+                hot_calls, argus.profile, argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldaf", "ldb", "ldx",
+                                       "batch_c");
+                rocsolver_bench_output(transC, n, nrhs, lda, ldaf, ldb, ldx, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldaf", "ldb", "ldx",
+                                       "strideA", "strideAF", "strideB", "strideX", "batch_c");
+                rocsolver_bench_output(transC, n, nrhs, lda, ldaf, ldb, ldx, stA, stAF, stB, stX,
+                                       bc);
+            }
+            else
+            {
+                rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldaf", "ldb", "ldx");
+                rocsolver_bench_output(transC, n, nrhs, lda, ldaf, ldb, ldx);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GESVX(...) extern template void testing_gesvx<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GESVX, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,498 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool NPVT, typename T, typename U>
+void getrf_interleaved_checkBadArgs(const rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    T dA,
+                                    const rocblas_int inca,
+                                    const rocblas_int lda,
+                                    const rocblas_stride stA,
+                                    U dIpiv,
+                                    const rocblas_stride stP,
+                                    U dInfo,
+                                    const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, nullptr, m, n, dA, inca, lda, stA,
+                                                      dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA, inca, lda, stA,
+                                                      dIpiv, stP, dInfo, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, (T) nullptr, inca, lda,
+                                                      stA, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    if(!NPVT)
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA, inca, lda, stA,
+                                                          (U) nullptr, stP, dInfo, bc),
+                              rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA, inca, lda, stA,
+                                                      dIpiv, stP, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, 0, n, (T) nullptr, inca, lda,
+                                                      stA, (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, 0, (T) nullptr, inca, lda,
+                                                      stA, (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA, inca, lda, stA,
+                                                      dIpiv, stP, (U) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <bool NPVT, typename T>
+void testing_getrf_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int inca = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    getrf_interleaved_checkBadArgs<NPVT>(handle, m, n, dA.data(), inca, lda, stA, dIpiv.data(),
+                                         stP, dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, bool NPVT, typename T, typename Td, typename Th>
+void getrf_interleaved_initData(const rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                Td& dA,
+                                const rocblas_int inca,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                const rocblas_int bc,
+                                Th& hA,
+                                const bool singular)
+{
+    if(CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            T* A = hA[0] + b * stA;
+
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        A[i * inca + j * lda] += 400;
+                    else
+                        A[i * inca + j * lda] -= 4;
+                }
+            }
+
+            // shuffle rows to test pivoting
+            // always the same permuation for debugging purposes
+            if(!NPVT)
+            {
+                for(rocblas_int i = 0; i < m / 2; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                    {
+                        tmp = A[i * inca + j * lda];
+                        A[i * inca + j * lda] = A[(m - 1 - i) * inca + j * lda];
+                        A[(m - 1 - i) * inca + j * lda] = tmp;
+                    }
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                // The algorithm must detect the first zero pivot in those
+                // matrices in the batch that are singular
+                rocblas_int j = n / 4 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    A[i * inca + j * lda] = 0;
+                j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    A[i * inca + j * lda] = 0;
+                j = n - 1 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    A[i * inca + j * lda] = 0;
+            }
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool NPVT, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_interleaved_getError(const rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                Td& dA,
+                                const rocblas_int inca,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                Ud& dIpiv,
+                                const rocblas_stride stP,
+                                Ud& dInfo,
+                                const rocblas_int bc,
+                                Th& hA,
+                                Th& hARes,
+                                Uh& hIpivRes,
+                                Uh& hInfoRes,
+                                double* max_err,
+                                const bool singular)
+{
+    rocblas_int k = std::min(m, n);
+    std::vector<T> A(m * n);
+    std::vector<T> ARes(m * n);
+    std::vector<rocblas_int> ipiv(k);
+    rocblas_int info;
+
+    // input data initialization
+    getrf_interleaved_initData<true, true, NPVT, T>(handle, m, n, dA, inca, lda, stA, bc, hA,
+                                                    singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA.data(), inca, lda, stA,
+                                                    dIpiv.data(), stP, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    if(!NPVT)
+        CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (the matrices are diagonally dominant when pivoting is not used, so that the
+    // reference factorization with partial pivoting does not interchange any rows)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                A[i + j * m] = hA[0][i * inca + j * lda + b * stA];
+                ARes[i + j * m] = hARes[0][i * inca + j * lda + b * stA];
+            }
+        }
+
+        cpu_getrf(m, n, A.data(), m, ipiv.data(), &info);
+
+        // error is ||hA - hARes|| / ||hA||
+        // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+        // IT MIGHT BE REVISITED IN THE FUTURE)
+        // using frobenius norm
+        err = norm_error('F', m, n, m, A.data(), ARes.data());
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        err = 0;
+        if(!NPVT)
+        {
+            for(rocblas_int i = 0; i < k; ++i)
+            {
+                EXPECT_EQ(ipiv[i], hIpivRes[0][i + b * stP]) << "where b = " << b << ", i = " << i;
+                if(ipiv[i] != hIpivRes[0][i + b * stP])
+                    err++;
+            }
+        }
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info for singularities
+        EXPECT_EQ(info, hInfoRes[b][0]) << "where b = " << b;
+        if(info != hInfoRes[b][0])
+            *max_err += 1;
+    }
+}
+
+template <bool NPVT, typename T, typename Td, typename Ud, typename Th>
+void getrf_interleaved_getPerfData(const rocblas_handle handle,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   Td& dA,
+                                   const rocblas_int inca,
+                                   const rocblas_int lda,
+                                   const rocblas_stride stA,
+                                   Ud& dIpiv,
+                                   const rocblas_stride stP,
+                                   Ud& dInfo,
+                                   const rocblas_int bc,
+                                   Th& hA,
+                                   double* gpu_time_used,
+                                   double* cpu_time_used,
+                                   const rocblas_int hot_calls,
+                                   const int profile,
+                                   const bool profile_kernels,
+                                   const bool perf,
+                                   const bool singular)
+{
+    if(!perf)
+    {
+        // the CPU reference works on one instance at a time, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    getrf_interleaved_initData<true, false, NPVT, T>(handle, m, n, dA, inca, lda, stA, bc, hA,
+                                                     singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_interleaved_initData<false, true, NPVT, T>(handle, m, n, dA, inca, lda, stA, bc, hA,
+                                                         singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA.data(), inca, lda,
+                                                        stA, dIpiv.data(), stP, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrf_interleaved_initData<false, true, NPVT, T>(handle, m, n, dA, inca, lda, stA, bc, hA,
+                                                         singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrf_interleaved(NPVT, handle, m, n, dA.data(), inca, lda, stA, dIpiv.data(),
+                                    stP, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool NPVT, typename T>
+void testing_getrf_interleaved(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int inca = argus.get<rocblas_int>("inca", 1);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", std::min(m, n));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = std::max(size_t(lda) * n, size_t(stA)) * bc;
+    size_t size_P = NPVT ? 1 : size_t(stP) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || inca < 1 || lda < inca * m || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, (T*)nullptr, inca,
+                                                          lda, stA, (rocblas_int*)nullptr, stP,
+                                                          (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrf_interleaved(NPVT, handle, m, n, (T*)nullptr, inca, lda,
+                                                      stA, (rocblas_int*)nullptr, stP,
+                                                      (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, size_PRes, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(NPVT, handle, m, n, dA.data(), inca, lda,
+                                                          stA, dIpiv.data(), stP, dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrf_interleaved_getError<NPVT, T>(handle, m, n, dA, inca, lda, stA, dIpiv, stP, dInfo,
+                                            bc, hA, hARes, hIpivRes, hInfoRes, &max_error,
+                                            argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        getrf_interleaved_getPerfData<NPVT, T>(handle, m, n, dA, inca, lda, stA, dIpiv, stP, dInfo,
+                                               bc, hA, &gpu_time_used, &cpu_time_used, hot_calls,
+                                               argus.profile, argus.profile_kernels, argus.perf,
+                                               argus.singular);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(NPVT)
+            {
+                rocsolver_bench_output("m", "n", "inca", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(m, n, inca, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "inca", "lda", "strideA", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, inca, lda, stA, stP, bc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRF_INTERLEAVED(...) \
+    extern template void testing_getrf_interleaved<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRF_INTERLEAVED,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
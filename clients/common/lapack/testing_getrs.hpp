@@ -161,8 +161,11 @@ void getrs_initData(const rocblas_handle handle,
         rocblas_init<T>(hA, true);
         rocblas_init<T>(hB, true);
 
+        // in broadcast mode (strideA = strideP = 0) there is a single factorization
+        I bcA = (stA == 0 && stP == 0) ? 1 : bc;
+
         // scale A to avoid singularities
-        for(I b = 0; b < bc; ++b)
+        for(I b = 0; b < bcA; ++b)
         {
             for(I i = 0; i < n; i++)
             {
@@ -177,7 +180,7 @@ void getrs_initData(const rocblas_handle handle,
         }
 
         // do the LU decomposition of matrix A w/ the reference LAPACK routine
-        for(I b = 0; b < bc; ++b)
+        for(I b = 0; b < bcA; ++b)
         {
             int info;
             cpu_getrf(n, n, hA[b], lda, hIpiv_cpu[b], &info);
@@ -228,9 +231,11 @@ void getrs_getError(const rocblas_handle handle,
     CHECK_HIP_ERROR(hBRes.transfer_from(dB));
 
     // CPU lapack
+    bool bcast = (stA == 0 && stP == 0);
     for(I b = 0; b < bc; ++b)
     {
-        cpu_getrs(trans, n, nrhs, hA[b], lda, hIpiv_cpu[b], hB[b], ldb);
+        I bA = bcast ? 0 : b;
+        cpu_getrs(trans, n, nrhs, hA[bA], lda, hIpiv_cpu[bA], hB[b], ldb);
     }
 
     // error is ||hB - hBRes|| / ||hB||
@@ -278,9 +283,11 @@ void getrs_getPerfData(const rocblas_handle handle,
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
+        bool bcast = (stA == 0 && stP == 0);
         for(I b = 0; b < bc; ++b)
         {
-            cpu_getrs(trans, n, nrhs, hA[b], lda, hIpiv_cpu[b], hB[b], ldb);
+            I bA = bcast ? 0 : b;
+            cpu_getrs(trans, n, nrhs, hA[bA], lda, hIpiv_cpu[bA], hB[b], ldb);
         }
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
@@ -445,15 +452,19 @@ void testing_getrs(Arguments& argus)
 
     else
     {
+        // in broadcast mode (strideA = strideP = 0) the factorization is stored only once
+        bool bcast = (stA == 0 && stP == 0);
+        I bcA = bcast ? 1 : bc;
+
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_A, 1, bcast ? size_A : stA, bcA);
         host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
         host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
-        host_strided_batch_vector<I> hIpiv(size_P, 1, stP, bc);
-        host_strided_batch_vector<rocblas_int> hIpiv_cpu(size_P, 1, stP, bc);
-        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        host_strided_batch_vector<I> hIpiv(size_P, 1, bcast ? size_P : stP, bcA);
+        host_strided_batch_vector<rocblas_int> hIpiv_cpu(size_P, 1, bcast ? size_P : stP, bcA);
+        device_strided_batch_vector<T> dA(size_A, 1, bcast ? size_A : stA, bcA);
         device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
-        device_strided_batch_vector<I> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<I> dIpiv(size_P, 1, bcast ? size_P : stP, bcA);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
         if(size_B)
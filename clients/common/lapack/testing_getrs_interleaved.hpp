@@ -0,0 +1,475 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T, typename U>
+void getrs_interleaved_checkBadArgs(const rocblas_handle handle,
+                                    const rocblas_operation trans,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    T dA,
+                                    const rocblas_int inca,
+                                    const rocblas_int lda,
+                                    const rocblas_stride stA,
+                                    U dIpiv,
+                                    const rocblas_stride stP,
+                                    T dB,
+                                    const rocblas_int incb,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride stB,
+                                    const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(nullptr, trans, n, nrhs, dA, inca, lda, stA,
+                                                      dIpiv, stP, dB, incb, ldb, stB, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, rocblas_operation(0), n, nrhs, dA,
+                                                      inca, lda, stA, dIpiv, stP, dB, incb, ldb,
+                                                      stB, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA, inca, lda, stA,
+                                                      dIpiv, stP, dB, incb, ldb, stB, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, (T) nullptr, inca,
+                                                      lda, stA, dIpiv, stP, dB, incb, ldb, stB, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA, inca, lda, stA,
+                                                      (U) nullptr, stP, dB, incb, ldb, stB, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA, inca, lda, stA,
+                                                      dIpiv, stP, (T) nullptr, incb, ldb, stB, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, 0, nrhs, (T) nullptr, inca,
+                                                      lda, stA, (U) nullptr, stP, (T) nullptr,
+                                                      incb, ldb, stB, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, 0, dA, inca, lda, stA,
+                                                      dIpiv, stP, (T) nullptr, incb, ldb, stB, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA, inca, lda, stA,
+                                                      dIpiv, stP, dB, incb, ldb, stB, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrs_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int inca = 1;
+    rocblas_int incb = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+
+    // check bad arguments
+    getrs_interleaved_checkBadArgs(handle, trans, n, nrhs, dA.data(), inca, lda, stA, dIpiv.data(),
+                                   stP, dB.data(), incb, ldb, stB, bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_interleaved_initData(const rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                Td& dA,
+                                const rocblas_int inca,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                Ud& dIpiv,
+                                const rocblas_stride stP,
+                                Td& dB,
+                                const rocblas_int incb,
+                                const rocblas_int ldb,
+                                const rocblas_stride stB,
+                                const rocblas_int bc,
+                                Th& hA,
+                                Uh& hIpiv,
+                                Th& hB)
+{
+    if(CPU)
+    {
+        std::vector<T> A(n * n);
+        rocblas_int info;
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    A[i + j * n] = hA[0][i * inca + j * lda + b * stA];
+                    if(i == j)
+                        A[i + j * n] += 400;
+                    else
+                        A[i + j * n] -= 4;
+                }
+            }
+
+            // do the LU decomposition of matrix A w/ the reference LAPACK routine
+            cpu_getrf(n, n, A.data(), n, hIpiv[0] + b * stP, &info);
+
+            for(rocblas_int i = 0; i < n; i++)
+                for(rocblas_int j = 0; j < n; j++)
+                    hA[0][i * inca + j * lda + b * stA] = A[i + j * n];
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_interleaved_getError(const rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                Td& dA,
+                                const rocblas_int inca,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                Ud& dIpiv,
+                                const rocblas_stride stP,
+                                Td& dB,
+                                const rocblas_int incb,
+                                const rocblas_int ldb,
+                                const rocblas_stride stB,
+                                const rocblas_int bc,
+                                Th& hA,
+                                Uh& hIpiv,
+                                Th& hB,
+                                Th& hBRes,
+                                double* max_err)
+{
+    std::vector<T> A(n * n);
+    std::vector<T> B(n * nrhs);
+    std::vector<T> BRes(n * nrhs);
+
+    // input data initialization
+    getrs_interleaved_initData<true, true, T>(handle, n, nrhs, dA, inca, lda, stA, dIpiv, stP, dB,
+                                              incb, ldb, stB, bc, hA, hIpiv, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), inca, lda,
+                                                    stA, dIpiv.data(), stP, dB.data(), incb, ldb,
+                                                    stB, bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+                A[i + j * n] = hA[0][i * inca + j * lda + b * stA];
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                B[i + j * n] = hB[0][i * incb + j * ldb + b * stB];
+                BRes[i + j * n] = hBRes[0][i * incb + j * ldb + b * stB];
+            }
+        }
+
+        cpu_getrs(trans, n, nrhs, A.data(), n, hIpiv[0] + b * stP, B.data(), n);
+
+        err = norm_error('I', n, nrhs, n, B.data(), BRes.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_interleaved_getPerfData(const rocblas_handle handle,
+                                   const rocblas_operation trans,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   Td& dA,
+                                   const rocblas_int inca,
+                                   const rocblas_int lda,
+                                   const rocblas_stride stA,
+                                   Ud& dIpiv,
+                                   const rocblas_stride stP,
+                                   Td& dB,
+                                   const rocblas_int incb,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride stB,
+                                   const rocblas_int bc,
+                                   Th& hA,
+                                   Uh& hIpiv,
+                                   Th& hB,
+                                   double* gpu_time_used,
+                                   double* cpu_time_used,
+                                   const rocblas_int hot_calls,
+                                   const int profile,
+                                   const bool profile_kernels,
+                                   const bool perf)
+{
+    if(!perf)
+    {
+        // the CPU reference works on one instance at a time, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    getrs_interleaved_initData<true, false, T>(handle, n, nrhs, dA, inca, lda, stA, dIpiv, stP, dB,
+                                               incb, ldb, stB, bc, hA, hIpiv, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_interleaved_initData<false, true, T>(handle, n, nrhs, dA, inca, lda, stA, dIpiv, stP,
+                                                   dB, incb, ldb, stB, bc, hA, hIpiv, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), inca,
+                                                        lda, stA, dIpiv.data(), stP, dB.data(),
+                                                        incb, ldb, stB, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrs_interleaved_initData<false, true, T>(handle, n, nrhs, dA, inca, lda, stA, dIpiv, stP,
+                                                   dB, incb, ldb, stB, bc, hA, hIpiv, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), inca, lda, stA, dIpiv.data(),
+                                    stP, dB.data(), incb, ldb, stB, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrs_interleaved(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int inca = argus.get<rocblas_int>("inca", 1);
+    rocblas_int incb = argus.get<rocblas_int>("incb", 1);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = std::max(size_t(lda) * n, size_t(stA)) * bc;
+    size_t size_P = size_t(stP) * bc;
+    size_t size_B = std::max(size_t(ldb) * nrhs, size_t(stB)) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || inca < 1 || lda < inca * n || incb < 1
+                         || ldb < incb * n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, (T*)nullptr, inca,
+                                                          lda, stA, (rocblas_int*)nullptr, stP,
+                                                          (T*)nullptr, incb, ldb, stB, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrs_interleaved(handle, trans, n, nrhs, (T*)nullptr, inca,
+                                                      lda, stA, (rocblas_int*)nullptr, stP,
+                                                      (T*)nullptr, incb, ldb, stB, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T> hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, size_BRes, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T> dB(size_B, 1, size_B, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), inca,
+                                                          lda, stA, dIpiv.data(), stP, dB.data(),
+                                                          incb, ldb, stB, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrs_interleaved_getError<T>(handle, trans, n, nrhs, dA, inca, lda, stA, dIpiv, stP, dB,
+                                      incb, ldb, stB, bc, hA, hIpiv, hB, hBRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        getrs_interleaved_getPerfData<T>(handle, trans, n, nrhs, dA, inca, lda, stA, dIpiv, stP, dB,
+                                         incb, ldb, stB, bc, hA, hIpiv, hB, &gpu_time_used,
+                                         &cpu_time_used, hot_calls, argus.profile,
+                                         argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("trans", "n", "nrhs", "inca", "lda", "strideA", "strideP",
+                                   "incb", "ldb", "strideB", "batch_c");
+            rocsolver_bench_output(transC, n, nrhs, inca, lda, stA, stP, incb, ldb, stB, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRS_INTERLEAVED(...) \
+    extern template void testing_getrs_interleaved<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRS_INTERLEAVED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,557 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void gpsv_checkBadArgs(const rocblas_handle handle,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       T dDS,
+                       T dDL,
+                       T dD,
+                       T dDU,
+                       T dDW,
+                       const rocblas_stride stD,
+                       T dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       U dInfo,
+                       const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, nullptr, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB,
+                                         ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD,
+                                             dB, ldb, stB, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, (T) nullptr, dDL, dD, dDU, dDW,
+                                         stD, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, (T) nullptr, dD, dDU, dDW,
+                                         stD, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, (T) nullptr, dDU, dDW,
+                                         stD, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, dD, (T) nullptr, dDW,
+                                         stD, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, dD, dDU, (T) nullptr,
+                                         stD, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD,
+                                         (T) nullptr, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB,
+                                         ldb, stB, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, 0, nrhs, (T) nullptr, (T) nullptr,
+                                         (T) nullptr, (T) nullptr, (T) nullptr, stD, (T) nullptr,
+                                         ldb, stB, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, 0, dDS, dDL, dD, dDU, dDW, stD,
+                                         (T) nullptr, ldb, stB, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD,
+                                             dB, ldb, stB, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool STRIDED, typename T>
+void testing_gpsv_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stD = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dDS(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDL(1, 1, 1, 1);
+    device_strided_batch_vector<T> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDU(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDW(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dDS.memcheck());
+    CHECK_HIP_ERROR(dDL.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dDU.memcheck());
+    CHECK_HIP_ERROR(dDW.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    gpsv_checkBadArgs<STRIDED>(handle, n, nrhs, dDS.data(), dDL.data(), dD.data(), dDU.data(),
+                               dDW.data(), stD, dB.data(), ldb, stB, dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gpsv_initData(const rocblas_handle handle,
+                   const rocblas_int n,
+                   const rocblas_int nrhs,
+                   Td& dDS,
+                   Td& dDL,
+                   Td& dD,
+                   Td& dDU,
+                   Td& dDW,
+                   const rocblas_stride stD,
+                   Td& dB,
+                   const rocblas_int ldb,
+                   const rocblas_stride stB,
+                   const rocblas_int bc,
+                   Th& hDS,
+                   Th& hDL,
+                   Th& hD,
+                   Th& hDU,
+                   Th& hDW,
+                   Th& hB,
+                   const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hDS, true);
+        rocblas_init<T>(hDL, true);
+        rocblas_init<T>(hD, true);
+        rocblas_init<T>(hDU, true);
+        rocblas_init<T>(hDW, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale the diagonal to avoid singularities
+            // (no pivoting is performed)
+            for(rocblas_int i = 0; i < n; i++)
+                hD[b][i] += 400;
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                // The algorithm must detect the zero pivot of the zero column
+                rocblas_int j = n / 2 + b;
+                j -= (j / n) * n;
+                hD[b][j] = 0;
+                if(j < n - 1)
+                    hDL[b][j] = 0;
+                if(j < n - 2)
+                    hDS[b][j] = 0;
+                if(j > 0)
+                    hDU[b][j - 1] = 0;
+                if(j > 1)
+                    hDW[b][j - 2] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dDS.transfer_from(hDS));
+        CHECK_HIP_ERROR(dDL.transfer_from(hDL));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dDU.transfer_from(hDU));
+        CHECK_HIP_ERROR(dDW.transfer_from(hDW));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+/** There is no pentadiagonal solver in the reference LAPACK, thus the
+    matrices are expanded and solved with the dense GESV **/
+template <typename T>
+void gpsv_cpu_solve(const rocblas_int n,
+                    const rocblas_int nrhs,
+                    T* ds,
+                    T* dl,
+                    T* d,
+                    T* du,
+                    T* dw,
+                    T* B,
+                    const rocblas_int ldb,
+                    rocblas_int* info)
+{
+    std::vector<T> A(size_t(n) * n, T(0));
+    std::vector<rocblas_int> ipiv(n);
+    for(rocblas_int i = 0; i < n; i++)
+    {
+        A[i + i * n] = d[i];
+        if(i < n - 1)
+        {
+            A[(i + 1) + i * n] = dl[i];
+            A[i + (i + 1) * n] = du[i];
+        }
+        if(i < n - 2)
+        {
+            A[(i + 2) + i * n] = ds[i];
+            A[i + (i + 2) * n] = dw[i];
+        }
+    }
+
+    cpu_gesv(n, nrhs, A.data(), n, ipiv.data(), B, ldb, info);
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gpsv_getError(const rocblas_handle handle,
+                   const rocblas_int n,
+                   const rocblas_int nrhs,
+                   Td& dDS,
+                   Td& dDL,
+                   Td& dD,
+                   Td& dDU,
+                   Td& dDW,
+                   const rocblas_stride stD,
+                   Td& dB,
+                   const rocblas_int ldb,
+                   const rocblas_stride stB,
+                   Ud& dInfo,
+                   const rocblas_int bc,
+                   Th& hDS,
+                   Th& hDL,
+                   Th& hD,
+                   Th& hDU,
+                   Th& hDW,
+                   Th& hB,
+                   Th& hBRes,
+                   Uh& hInfo,
+                   Uh& hInfoRes,
+                   double* max_err,
+                   const bool singular)
+{
+    // input data initialization
+    gpsv_initData<true, true, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB, ldb, stB, bc,
+                                 hDS, hDL, hD, hDU, hDW, hB, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS.data(), dDL.data(), dD.data(),
+                                       dDU.data(), dDW.data(), stD, dB.data(), ldb, stB,
+                                       dInfo.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        gpsv_cpu_solve(n, nrhs, hDS[b], hDL[b], hD[b], hDU[b], hDW[b], hB[b], ldb, hInfo[b]);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    // (the solution is only compared for non-singular systems)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hInfo[b][0] == 0)
+        {
+            err = norm_error('I', n, nrhs, ldb, hB[b], hBRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gpsv_getPerfData(const rocblas_handle handle,
+                      const rocblas_int n,
+                      const rocblas_int nrhs,
+                      Td& dDS,
+                      Td& dDL,
+                      Td& dD,
+                      Td& dDU,
+                      Td& dDW,
+                      const rocblas_stride stD,
+                      Td& dB,
+                      const rocblas_int ldb,
+                      const rocblas_stride stB,
+                      Ud& dInfo,
+                      const rocblas_int bc,
+                      Th& hDS,
+                      Th& hDL,
+                      Th& hD,
+                      Th& hDU,
+                      Th& hDW,
+                      Th& hB,
+                      Uh& hInfo,
+                      double* gpu_time_used,
+                      double* cpu_time_used,
+                      const rocblas_int hot_calls,
+                      const int profile,
+                      const bool profile_kernels,
+                      const bool perf,
+                      const bool singular)
+{
+    if(!perf)
+    {
+        // there is no banded reference in LAPACK and the dense solver
+        // does not make a fair comparison, therefore we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    gpsv_initData<true, false, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB, ldb, stB, bc,
+                                  hDS, hDL, hD, hDU, hDW, hB, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gpsv_initData<false, true, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB, ldb, stB,
+                                      bc, hDS, hDL, hD, hDU, hDW, hB, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS.data(), dDL.data(),
+                                           dD.data(), dDU.data(), dDW.data(), stD, dB.data(), ldb,
+                                           stB, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gpsv_initData<false, true, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB, ldb, stB,
+                                      bc, hDS, hDL, hD, hDU, hDW, hB, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS.data(), dDL.data(), dD.data(), dDU.data(),
+                       dDW.data(), stD, dB.data(), ldb, stB, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool STRIDED, typename T>
+void testing_gpsv(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_D = size_t(n);
+    size_t size_B = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, (T*)nullptr, (T*)nullptr,
+                                             (T*)nullptr, (T*)nullptr, (T*)nullptr, stD,
+                                             (T*)nullptr, ldb, stB, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_gpsv(STRIDED, handle, n, nrhs, (T*)nullptr, (T*)nullptr,
+                                         (T*)nullptr, (T*)nullptr, (T*)nullptr, stD, (T*)nullptr,
+                                         ldb, stB, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hDS(size_D, 1, stD, bc);
+    host_strided_batch_vector<T> hDL(size_D, 1, stD, bc);
+    host_strided_batch_vector<T> hD(size_D, 1, stD, bc);
+    host_strided_batch_vector<T> hDU(size_D, 1, stD, bc);
+    host_strided_batch_vector<T> hDW(size_D, 1, stD, bc);
+    host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T> dDS(size_D, 1, stD, bc);
+    device_strided_batch_vector<T> dDL(size_D, 1, stD, bc);
+    device_strided_batch_vector<T> dD(size_D, 1, stD, bc);
+    device_strided_batch_vector<T> dDU(size_D, 1, stD, bc);
+    device_strided_batch_vector<T> dDW(size_D, 1, stD, bc);
+    device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_D)
+    {
+        CHECK_HIP_ERROR(dDS.memcheck());
+        CHECK_HIP_ERROR(dDL.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dDU.memcheck());
+        CHECK_HIP_ERROR(dDW.memcheck());
+    }
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gpsv(STRIDED, handle, n, nrhs, dDS.data(), dDL.data(),
+                                             dD.data(), dDU.data(), dDW.data(), stD, dB.data(), ldb,
+                                             stB, dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gpsv_getError<STRIDED, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB, ldb, stB, dInfo,
+                                  bc, hDS, hDL, hD, hDU, hDW, hB, hBRes, hInfo, hInfoRes,
+                                  &max_error, argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        gpsv_getPerfData<STRIDED, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, stD, dB, ldb, stB,
+                                     dInfo, bc, hDS, hDL, hD, hDU, hDW, hB, hInfo, &gpu_time_used,
+                                     &cpu_time_used, hot_calls, argus.profile,
+                                     argus.profile_kernels, argus.perf, argus.singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(STRIDED)
+            {
+                rocsolver_bench_output("n", "nrhs", "ldb", "strideD", "strideB", "batch_c");
+                rocsolver_bench_output(n, nrhs, ldb, stD, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nrhs", "ldb");
+                rocsolver_bench_output(n, nrhs, ldb);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GPSV(...) extern template void testing_gpsv<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GPSV, FOREACH_BLOCKED_VARIANT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
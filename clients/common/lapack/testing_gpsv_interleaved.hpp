@@ -0,0 +1,530 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/lapack/testing_gpsv.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T, typename U>
+void gpsv_interleaved_checkBadArgs(const rocblas_handle handle,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   T dDS,
+                                   T dDL,
+                                   T dD,
+                                   T dDU,
+                                   T dDW,
+                                   const rocblas_int incd,
+                                   const rocblas_stride stD,
+                                   T dB,
+                                   const rocblas_int incb,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride stB,
+                                   U dInfo,
+                                   const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(nullptr, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                     stD, dB, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                     stD, dB, incb, ldb, stB, dInfo, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, (T) nullptr, dDL, dD, dDU,
+                                                     dDW, incd, stD, dB, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, (T) nullptr, dD, dDU,
+                                                     dDW, incd, stD, dB, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, (T) nullptr, dDU,
+                                                     dDW, incd, stD, dB, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, dD, (T) nullptr,
+                                                     dDW, incd, stD, dB, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, dD, dDU,
+                                                     (T) nullptr, incd, stD, dB, incb, ldb, stB,
+                                                     dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                     stD, (T) nullptr, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                     stD, dB, incb, ldb, stB, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, 0, nrhs, (T) nullptr, (T) nullptr,
+                                                     (T) nullptr, (T) nullptr, (T) nullptr, incd,
+                                                     stD, (T) nullptr, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, 0, dDS, dDL, dD, dDU, dDW, incd,
+                                                     stD, (T) nullptr, incb, ldb, stB, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                     stD, dB, incb, ldb, stB, (U) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_gpsv_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int incd = 1;
+    rocblas_int incb = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stD = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dDS(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDL(1, 1, 1, 1);
+    device_strided_batch_vector<T> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDU(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDW(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dDS.memcheck());
+    CHECK_HIP_ERROR(dDL.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dDU.memcheck());
+    CHECK_HIP_ERROR(dDW.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    gpsv_interleaved_checkBadArgs(handle, n, nrhs, dDS.data(), dDL.data(), dD.data(), dDU.data(),
+                                  dDW.data(), incd, stD, dB.data(), incb, ldb, stB, dInfo.data(),
+                                  bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gpsv_interleaved_initData(const rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               Td& dDS,
+                               Td& dDL,
+                               Td& dD,
+                               Td& dDU,
+                               Td& dDW,
+                               const rocblas_int incd,
+                               const rocblas_stride stD,
+                               Td& dB,
+                               const rocblas_int incb,
+                               const rocblas_int ldb,
+                               const rocblas_stride stB,
+                               const rocblas_int bc,
+                               Th& hDS,
+                               Th& hDL,
+                               Th& hD,
+                               Th& hDU,
+                               Th& hDW,
+                               Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hDS, true);
+        rocblas_init<T>(hDL, true);
+        rocblas_init<T>(hD, true);
+        rocblas_init<T>(hDU, true);
+        rocblas_init<T>(hDW, true);
+        rocblas_init<T>(hB, true);
+
+        // scale the diagonal to avoid singularities
+        // (no pivoting is performed)
+        for(rocblas_int b = 0; b < bc; ++b)
+            for(rocblas_int i = 0; i < n; i++)
+                hD[0][i * incd + b * stD] += 400;
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dDS.transfer_from(hDS));
+        CHECK_HIP_ERROR(dDL.transfer_from(hDL));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dDU.transfer_from(hDU));
+        CHECK_HIP_ERROR(dDW.transfer_from(hDW));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gpsv_interleaved_getError(const rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               Td& dDS,
+                               Td& dDL,
+                               Td& dD,
+                               Td& dDU,
+                               Td& dDW,
+                               const rocblas_int incd,
+                               const rocblas_stride stD,
+                               Td& dB,
+                               const rocblas_int incb,
+                               const rocblas_int ldb,
+                               const rocblas_stride stB,
+                               Ud& dInfo,
+                               const rocblas_int bc,
+                               Th& hDS,
+                               Th& hDL,
+                               Th& hD,
+                               Th& hDU,
+                               Th& hDW,
+                               Th& hB,
+                               Th& hBRes,
+                               Uh& hInfo,
+                               Uh& hInfoRes,
+                               double* max_err)
+{
+    std::vector<T> DS(n);
+    std::vector<T> DL(n);
+    std::vector<T> D(n);
+    std::vector<T> DU(n);
+    std::vector<T> DW(n);
+    std::vector<T> B(n * nrhs);
+    std::vector<T> BRes(n * nrhs);
+
+    // input data initialization
+    gpsv_interleaved_initData<true, true, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd, stD, dB,
+                                             incb, ldb, stB, bc, hDS, hDL, hD, hDU, hDW, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS.data(), dDL.data(),
+                                                   dD.data(), dDU.data(), dDW.data(), incd, stD,
+                                                   dB.data(), incb, ldb, stB, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            DS[i] = hDS[0][i * incd + b * stD];
+            DL[i] = hDL[0][i * incd + b * stD];
+            D[i] = hD[0][i * incd + b * stD];
+            DU[i] = hDU[0][i * incd + b * stD];
+            DW[i] = hDW[0][i * incd + b * stD];
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                B[i + j * n] = hB[0][i * incb + j * ldb + b * stB];
+                BRes[i + j * n] = hBRes[0][i * incb + j * ldb + b * stB];
+            }
+        }
+
+        gpsv_cpu_solve(n, nrhs, DS.data(), DL.data(), D.data(), DU.data(), DW.data(), B.data(), n,
+                       hInfo[0] + b);
+
+        err = norm_error('I', n, nrhs, n, B.data(), BRes.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[0][b], hInfoRes[0][b]) << "where b = " << b;
+        if(hInfo[0][b] != hInfoRes[0][b])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <typename T, typename Td, typename Ud, typename Th>
+void gpsv_interleaved_getPerfData(const rocblas_handle handle,
+                                  const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  Td& dDS,
+                                  Td& dDL,
+                                  Td& dD,
+                                  Td& dDU,
+                                  Td& dDW,
+                                  const rocblas_int incd,
+                                  const rocblas_stride stD,
+                                  Td& dB,
+                                  const rocblas_int incb,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride stB,
+                                  Ud& dInfo,
+                                  const rocblas_int bc,
+                                  Th& hDS,
+                                  Th& hDL,
+                                  Th& hD,
+                                  Th& hDU,
+                                  Th& hDW,
+                                  Th& hB,
+                                  double* gpu_time_used,
+                                  double* cpu_time_used,
+                                  const rocblas_int hot_calls,
+                                  const int profile,
+                                  const bool profile_kernels,
+                                  const bool perf)
+{
+    if(!perf)
+    {
+        // there is no banded reference in LAPACK, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    gpsv_interleaved_initData<true, false, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd, stD,
+                                              dB, incb, ldb, stB, bc, hDS, hDL, hD, hDU, hDW, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gpsv_interleaved_initData<false, true, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                  stD, dB, incb, ldb, stB, bc, hDS, hDL, hD, hDU,
+                                                  hDW, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS.data(), dDL.data(),
+                                                       dD.data(), dDU.data(), dDW.data(), incd, stD,
+                                                       dB.data(), incb, ldb, stB, dInfo.data(),
+                                                       bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gpsv_interleaved_initData<false, true, T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd,
+                                                  stD, dB, incb, ldb, stB, bc, hDS, hDL, hD, hDU,
+                                                  hDW, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gpsv_interleaved(handle, n, nrhs, dDS.data(), dDL.data(), dD.data(), dDU.data(),
+                                   dDW.data(), incd, stD, dB.data(), incb, ldb, stB, dInfo.data(),
+                                   bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_gpsv_interleaved(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int incd = argus.get<rocblas_int>("incd", 1);
+    rocblas_int incb = argus.get<rocblas_int>("incb", 1);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_D = std::max(size_t(incd) * n, size_t(stD)) * bc;
+    size_t size_B = std::max(size_t(ldb) * nrhs, size_t(stB)) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || incd < 1 || incb < 1 || ldb < incb * n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, (T*)nullptr, (T*)nullptr,
+                                                         (T*)nullptr, (T*)nullptr, (T*)nullptr,
+                                                         incd, stD, (T*)nullptr, incb, ldb, stB,
+                                                         (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_gpsv_interleaved(handle, n, nrhs, (T*)nullptr, (T*)nullptr,
+                                                     (T*)nullptr, (T*)nullptr, (T*)nullptr, incd,
+                                                     stD, (T*)nullptr, incb, ldb, stB,
+                                                     (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hDS(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hDL(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hDU(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hDW(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, size_BRes, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(bc, 1, bc, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(bc, 1, bc, 1);
+    device_strided_batch_vector<T> dDS(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dDL(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dDU(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dDW(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(bc, 1, bc, 1);
+    if(size_D)
+    {
+        CHECK_HIP_ERROR(dDS.memcheck());
+        CHECK_HIP_ERROR(dDL.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dDU.memcheck());
+        CHECK_HIP_ERROR(dDW.memcheck());
+    }
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(bc)
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gpsv_interleaved(handle, n, nrhs, dDS.data(), dDL.data(),
+                                                         dD.data(), dDU.data(), dDW.data(), incd,
+                                                         stD, dB.data(), incb, ldb, stB,
+                                                         dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gpsv_interleaved_getError<T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd, stD, dB, incb,
+                                     ldb, stB, dInfo, bc, hDS, hDL, hD, hDU, hDW, hB, hBRes, hInfo,
+                                     hInfoRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        gpsv_interleaved_getPerfData<T>(handle, n, nrhs, dDS, dDL, dD, dDU, dDW, incd, stD, dB,
+                                        incb, ldb, stB, dInfo, bc, hDS, hDL, hD, hDU, hDW, hB,
+                                        &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                        argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("n", "nrhs", "incd", "strideD", "incb", "ldb", "strideB",
+                                   "batch_c");
+            rocsolver_bench_output(n, nrhs, incd, stD, incb, ldb, stB, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GPSV_INTERLEAVED(...) \
+    extern template void testing_gpsv_interleaved<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GPSV_INTERLEAVED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,619 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S>
+void potdet_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         S dLogdet,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, nullptr, n, dA, lda, stA, dLogdet, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, n, dA, lda, stA, dLogdet, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, n, (T) nullptr, lda, stA, dLogdet, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, n, dA, lda, stA, (S) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, 0, (T) nullptr, lda, stA, dLogdet, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, n, dA, lda, stA, (S) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool STRIDED, typename T, typename S, typename U>
+void potrf_logdet_checkBadArgs(const rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               T dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               S dLogdet,
+                               U dInfo,
+                               const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_logdet(STRIDED, nullptr, uplo, n, dA, lda, stA, dLogdet, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, handle, rocblas_fill_full, n, dA, lda,
+                                                 stA, dLogdet, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrf_logdet(STRIDED, handle, uplo, n, dA, lda, stA, dLogdet, dInfo, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, handle, uplo, n, (T) nullptr, lda, stA,
+                                                 dLogdet, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_logdet(STRIDED, handle, uplo, n, dA, lda, stA, (S) nullptr, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_logdet(STRIDED, handle, uplo, n, dA, lda, stA, dLogdet, (U) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, handle, uplo, 0, (T) nullptr, lda, stA,
+                                                 dLogdet, dInfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, handle, uplo, n, dA, lda, stA,
+                                                     (S) nullptr, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool FUSED, typename T>
+void testing_potdet_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dLogdet(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dLogdet.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        if(FUSED)
+            potrf_logdet_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA,
+                                               dLogdet.data(), dInfo.data(), bc);
+        else
+            potdet_checkBadArgs<STRIDED>(handle, n, dA.data(), lda, stA, dLogdet.data(), bc);
+    }
+    else
+    {
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        if(FUSED)
+            potrf_logdet_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA,
+                                               dLogdet.data(), dInfo.data(), bc);
+        else
+            potdet_checkBadArgs<STRIDED>(handle, n, dA.data(), lda, stA, dLogdet.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potdet_initData(const rocblas_handle handle,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_int bc,
+                     Th& hA,
+                     const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale to ensure positive definiteness
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some matrices not positive definite
+                // always the same elements for debugging purposes
+                rocblas_int i = n / 2 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+/** Computes log(det(A)) from the Cholesky factor of A **/
+template <typename T, typename S>
+void potdet_host(const rocblas_int n, T* A, const rocblas_int lda, S& logdet)
+{
+    logdet = 0;
+    for(rocblas_int i = 0; i < n; i++)
+        logdet += 2 * std::log(std::real(A[i + i * lda]));
+}
+
+template <bool STRIDED, bool FUSED, typename T, typename Td, typename Sd, typename Ud>
+rocblas_status potdet_run(const rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          Sd& dLogdet,
+                          Ud& dInfo,
+                          const rocblas_int bc)
+{
+    if(FUSED)
+        return rocsolver_potrf_logdet(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                      dLogdet.data(), dInfo.data(), bc);
+
+    rocblas_status status = rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n, dA.data(), lda,
+                                                  stA, dInfo.data(), bc);
+    if(status != rocblas_status_success)
+        return status;
+
+    return rocsolver_potdet(STRIDED, handle, n, dA.data(), lda, stA, dLogdet.data(), bc);
+}
+
+template <bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Sd,
+          typename Ud,
+          typename Th,
+          typename Sh,
+          typename Uh>
+void potdet_getError(const rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_stride stA,
+                     Sd& dLogdet,
+                     Ud& dInfo,
+                     const rocblas_int bc,
+                     Th& hA,
+                     Sh& hLogdet,
+                     Sh& hLogdetRes,
+                     Uh& hInfo,
+                     Uh& hInfoRes,
+                     double* max_err,
+                     const bool singular)
+{
+    using S = decltype(std::real(T{}));
+
+    // input data initialization
+    potdet_initData<true, true, T>(handle, n, dA, lda, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(
+        (potdet_run<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc)));
+    CHECK_HIP_ERROR(hLogdetRes.transfer_from(dLogdet));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_potrf(uplo, n, hA[b], lda, hInfo[b]);
+        potdet_host(n, hA[b], lda, hLogdet[b][0]);
+    }
+
+    // error is |logdet - logdetRes| / max(1, |logdet|)
+    // (logdet is not defined for matrices that are not positive definite)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hInfo[b][0] == 0)
+        {
+            S logdet = hLogdet[b][0];
+            err = std::abs(logdet - hLogdetRes[b][0]) / std::max(S(1), std::abs(logdet));
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Sd,
+          typename Ud,
+          typename Th,
+          typename Sh,
+          typename Uh>
+void potdet_getPerfData(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        Td& dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Sd& dLogdet,
+                        Ud& dInfo,
+                        const rocblas_int bc,
+                        Th& hA,
+                        Sh& hLogdet,
+                        Uh& hInfo,
+                        double* gpu_time_used,
+                        double* cpu_time_used,
+                        const int hot_calls,
+                        const int profile,
+                        const bool profile_kernels,
+                        const bool perf,
+                        const bool singular)
+{
+    if(!perf)
+    {
+        potdet_initData<true, false, T>(handle, n, dA, lda, bc, hA, singular);
+
+        // cpu-lapack performance (only if no perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_potrf(uplo, n, hA[b], lda, hInfo[b]);
+            potdet_host(n, hA[b], lda, hLogdet[b][0]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potdet_initData<true, false, T>(handle, n, dA, lda, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potdet_initData<false, true, T>(handle, n, dA, lda, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(
+            (potdet_run<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc)));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        potdet_initData<false, true, T>(handle, n, dA, lda, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        potdet_run<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool FUSED, typename T>
+void testing_potdet(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+        {
+            if(FUSED)
+                EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, handle, uplo, n,
+                                                             (T* const*)nullptr, lda, stA,
+                                                             (S*)nullptr, (rocblas_int*)nullptr,
+                                                             bc),
+                                      rocblas_status_invalid_size);
+            else
+                EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, n, (T* const*)nullptr, lda,
+                                                       stA, (S*)nullptr, bc),
+                                      rocblas_status_invalid_size);
+        }
+        else
+        {
+            if(FUSED)
+                EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, handle, uplo, n, (T*)nullptr,
+                                                             lda, stA, (S*)nullptr,
+                                                             (rocblas_int*)nullptr, bc),
+                                      rocblas_status_invalid_size);
+            else
+                EXPECT_ROCBLAS_STATUS(rocsolver_potdet(STRIDED, handle, n, (T*)nullptr, lda, stA,
+                                                       (S*)nullptr, bc),
+                                      rocblas_status_invalid_size);
+        }
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    // (the unfused variant also needs the workspace of POTRF)
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+        {
+            if(FUSED)
+                CHECK_ALLOC_QUERY(rocsolver_potrf_logdet(STRIDED, handle, uplo, n,
+                                                         (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                         (rocblas_int*)nullptr, bc));
+            else
+                CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n,
+                                                        (T* const*)nullptr, lda, stA,
+                                                        (rocblas_int*)nullptr, bc));
+        }
+        else
+        {
+            if(FUSED)
+                CHECK_ALLOC_QUERY(rocsolver_potrf_logdet(STRIDED, handle, uplo, n, (T*)nullptr, lda,
+                                                         stA, (S*)nullptr, (rocblas_int*)nullptr,
+                                                         bc));
+            else
+                CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n, (T*)nullptr,
+                                                        lda, stA, (rocblas_int*)nullptr, bc));
+        }
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<S> hLogdet(1, 1, 1, bc);
+    host_strided_batch_vector<S> hLogdetRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dLogdet(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dLogdet.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                (potdet_run<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc)),
+                rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potdet_getError<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc,
+                                               hA, hLogdet, hLogdetRes, hInfo, hInfoRes,
+                                               &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            potdet_getPerfData<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc,
+                                                  hA, hLogdet, hInfo, &gpu_time_used,
+                                                  &cpu_time_used, hot_calls, argus.profile,
+                                                  argus.profile_kernels, argus.perf,
+                                                  argus.singular);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                (potdet_run<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc)),
+                rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potdet_getError<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc,
+                                               hA, hLogdet, hLogdetRes, hInfo, hInfoRes,
+                                               &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            potdet_getPerfData<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc,
+                                                  hA, hLogdet, hInfo, &gpu_time_used,
+                                                  &cpu_time_used, hot_calls, argus.profile,
+                                                  argus.profile_kernels, argus.perf,
+                                                  argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda");
+                rocsolver_bench_output(uploC, n, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_POTDET(...) extern template void testing_potdet<__VA_ARGS__>(Arguments&);
+
+// (the third template argument selects POTRF + POTDET or the fused POTRF_LOGDET)
+INSTANTIATE(EXTERN_TESTING_POTDET,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
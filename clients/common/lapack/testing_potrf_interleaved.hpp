@@ -0,0 +1,433 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T, typename U>
+void potrf_interleaved_checkBadArgs(const rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    T dA,
+                                    const rocblas_int inca,
+                                    const rocblas_int lda,
+                                    const rocblas_stride stA,
+                                    U dInfo,
+                                    const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_interleaved(nullptr, uplo, n, dA, inca, lda, stA, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, rocblas_fill_full, n, dA, inca, lda,
+                                                      stA, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_interleaved(handle, uplo, n, dA, inca, lda, stA, dInfo, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_interleaved(handle, uplo, n, (T) nullptr, inca, lda, stA, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_interleaved(handle, uplo, n, dA, inca, lda, stA, (U) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_interleaved(handle, uplo, 0, (T) nullptr, inca, lda, stA, dInfo, bc),
+        rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_interleaved(handle, uplo, n, dA, inca, lda, stA, (U) nullptr, 0),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_potrf_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int inca = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    potrf_interleaved_checkBadArgs(handle, uplo, n, dA.data(), inca, lda, stA, dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potrf_interleaved_initData(const rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                Td& dA,
+                                const rocblas_int inca,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                const rocblas_int bc,
+                                Th& hA,
+                                const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            T* A = hA[0] + b * stA;
+
+            // make the matrix hermitian and scale to ensure positive definiteness
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < i; j++)
+                    A[j * inca + i * lda] = sconj(A[i * inca + j * lda]);
+                A[i * inca + i * lda] = A[i * inca + i * lda] * sconj(A[i * inca + i * lda]) * 400;
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some matrices not positive definite
+                // always the same elements for debugging purposes
+                // the algorithm must detect the lower order of the principal minors <= 0
+                // in those matrices in the batch that are non positive definite
+                rocblas_int i = n / 4 + b;
+                i -= (i / n) * n;
+                A[i * inca + i * lda] = 0;
+                i = n / 2 + b;
+                i -= (i / n) * n;
+                A[i * inca + i * lda] = 0;
+                i = n - 1 + b;
+                i -= (i / n) * n;
+                A[i * inca + i * lda] = 0;
+            }
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_interleaved_getError(const rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                Td& dA,
+                                const rocblas_int inca,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                Ud& dInfo,
+                                const rocblas_int bc,
+                                Th& hA,
+                                Th& hARes,
+                                Uh& hInfoRes,
+                                double* max_err,
+                                const bool singular)
+{
+    std::vector<T> A(n * n);
+    std::vector<T> ARes(n * n);
+    rocblas_int info, nn;
+
+    // input data initialization
+    potrf_interleaved_initData<true, true, T>(handle, uplo, n, dA, inca, lda, stA, bc, hA,
+                                              singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), inca, lda, stA,
+                                                    dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LL' - Lres Lres'|| / ||LL'||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                A[i + j * n] = hA[0][i * inca + j * lda + b * stA];
+                ARes[i + j * n] = hARes[0][i * inca + j * lda + b * stA];
+            }
+        }
+
+        cpu_potrf(uplo, n, A.data(), n, &info);
+
+        // only the principal nn-by-nn submatrix is checked when the
+        // matrix is not positive definite
+        nn = hInfoRes[b][0] == 0 ? n : hInfoRes[b][0];
+        err = (uplo == rocblas_fill_lower)
+            ? norm_error_lowerTr('F', nn, nn, n, A.data(), ARes.data())
+            : norm_error_upperTr('F', nn, nn, n, A.data(), ARes.data());
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info for non positive definite cases
+        EXPECT_EQ(info, hInfoRes[b][0]) << "where b = " << b;
+        if(info != hInfoRes[b][0])
+            *max_err += 1;
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th>
+void potrf_interleaved_getPerfData(const rocblas_handle handle,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   Td& dA,
+                                   const rocblas_int inca,
+                                   const rocblas_int lda,
+                                   const rocblas_stride stA,
+                                   Ud& dInfo,
+                                   const rocblas_int bc,
+                                   Th& hA,
+                                   double* gpu_time_used,
+                                   double* cpu_time_used,
+                                   const rocblas_int hot_calls,
+                                   const int profile,
+                                   const bool profile_kernels,
+                                   const bool perf,
+                                   const bool singular)
+{
+    if(!perf)
+    {
+        // the CPU reference works on one instance at a time, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    potrf_interleaved_initData<true, false, T>(handle, uplo, n, dA, inca, lda, stA, bc, hA,
+                                               singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrf_interleaved_initData<false, true, T>(handle, uplo, n, dA, inca, lda, stA, bc, hA,
+                                                   singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), inca, lda, stA,
+                                                        dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        potrf_interleaved_initData<false, true, T>(handle, uplo, n, dA, inca, lda, stA, bc, hA,
+                                                   singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), inca, lda, stA, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_potrf_interleaved(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int inca = argus.get<rocblas_int>("inca", 1);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, uplo, n, (T*)nullptr, inca, lda,
+                                                          stA, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = std::max(size_t(lda) * n, size_t(stA)) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || inca < 1 || lda < inca * n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, uplo, n, (T*)nullptr, inca, lda,
+                                                          stA, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_potrf_interleaved(handle, uplo, n, (T*)nullptr, inca, lda, stA,
+                                                      (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), inca, lda,
+                                                          stA, dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrf_interleaved_getError<T>(handle, uplo, n, dA, inca, lda, stA, dInfo, bc, hA, hARes,
+                                      hInfoRes, &max_error, argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        potrf_interleaved_getPerfData<T>(handle, uplo, n, dA, inca, lda, stA, dInfo, bc, hA,
+                                         &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                         argus.profile_kernels, argus.perf, argus.singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "n", "inca", "lda", "strideA", "batch_c");
+            rocsolver_bench_output(uploC, n, inca, lda, stA, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_POTRF_INTERLEAVED(...) \
+    extern template void testing_potrf_interleaved<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_POTRF_INTERLEAVED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
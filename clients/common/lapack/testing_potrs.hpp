@@ -148,7 +148,10 @@ void potrs_initData(const rocblas_handle handle,
         rocblas_init<T>(hB, true);
         int info;
 
-        for(rocblas_int b = 0; b < bc; ++b)
+        // in broadcast mode (strideA = 0) there is a single factorization
+        rocblas_int bcA = (stA == 0) ? 1 : bc;
+
+        for(rocblas_int b = 0; b < bcA; ++b)
         {
             // scale to ensure positive definiteness
             for(rocblas_int i = 0; i < n; i++)
@@ -196,7 +199,7 @@ void potrs_getError(const rocblas_handle handle,
     // CPU lapack
     for(rocblas_int b = 0; b < bc; ++b)
     {
-        cpu_potrs(uplo, n, nrhs, hA[b], lda, hB[b], ldb);
+        cpu_potrs(uplo, n, nrhs, hA[stA == 0 ? 0 : b], lda, hB[b], ldb);
     }
 
     // error is ||hB - hBRes|| / ||hB||
@@ -241,7 +244,7 @@ void potrs_getPerfData(const rocblas_handle handle,
         *cpu_time_used = get_time_us_no_sync();
         for(rocblas_int b = 0; b < bc; ++b)
         {
-            cpu_potrs(uplo, n, nrhs, hA[b], lda, hB[b], ldb);
+            cpu_potrs(uplo, n, nrhs, hA[stA == 0 ? 0 : b], lda, hB[b], ldb);
         }
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
@@ -407,11 +410,15 @@ void testing_potrs(Arguments& argus)
 
     else
     {
+        // in broadcast mode (strideA = 0) the factorization is stored only once
+        bool bcast = (stA == 0);
+        rocblas_int bcA = bcast ? 1 : bc;
+
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_A, 1, bcast ? size_A : stA, bcA);
         host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
         host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
-        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, bcast ? size_A : stA, bcA);
         device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
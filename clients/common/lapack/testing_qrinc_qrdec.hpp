@@ -0,0 +1,643 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, bool INSERT, typename T>
+void qrinc_qrdec_checkBadArgs(const rocblas_handle handle,
+                              const rocblas_int m,
+                              const rocblas_int n,
+                              T dQ,
+                              const rocblas_int ldq,
+                              const rocblas_stride stQ,
+                              T dR,
+                              const rocblas_int ldr,
+                              const rocblas_stride stR,
+                              const rocblas_int j,
+                              T dx,
+                              const rocblas_int incx,
+                              const rocblas_stride stx,
+                              const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, nullptr, m, n, dQ, ldq, stQ, dR,
+                                                ldr, stR, j, dx, incx, stx, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ, ldq, stQ,
+                                                    dR, ldr, stR, j, dx, incx, stx, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    if(INSERT)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, (T) nullptr,
+                                                    ldq, stQ, dR, ldr, stR, j, dx, incx, stx, bc),
+                              rocblas_status_invalid_pointer);
+    else
+        EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, (T) nullptr,
+                                                    ldq, stQ, dR, ldr, stR, j, dx, incx, stx, bc),
+                              rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ, ldq, stQ,
+                                                (T) nullptr, ldr, stR, j, dx, incx, stx, bc),
+                          rocblas_status_invalid_pointer);
+    if(INSERT)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ, ldq, stQ,
+                                                    dR, ldr, stR, j, (T) nullptr, incx, stx, bc),
+                              rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, 0, n, (T) nullptr, ldq,
+                                                stQ, (T) nullptr, ldr, stR, j, (T) nullptr, incx,
+                                                stx, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ, ldq, stQ,
+                                                    dR, ldr, stR, j, dx, incx, stx, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool INSERT, typename T>
+void testing_qrinc_qrdec_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int ldq = 1;
+    rocblas_int ldr = 1;
+    rocblas_int j = 1;
+    rocblas_int incx = 1;
+    rocblas_stride stQ = 1;
+    rocblas_stride stR = 2;
+    rocblas_stride stx = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dQ(1, 1, 1);
+        device_batch_vector<T> dR(2, 1, 1);
+        device_batch_vector<T> dx(1, 1, 1);
+        CHECK_HIP_ERROR(dQ.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dx.memcheck());
+
+        // check bad arguments
+        qrinc_qrdec_checkBadArgs<STRIDED, INSERT>(handle, m, n, dQ.data(), ldq, stQ, dR.data(),
+                                                  ldr, stR, j, dx.data(), incx, stx, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dQ(1, 1, 1, 1);
+        device_strided_batch_vector<T> dR(2, 1, 2, 1);
+        device_strided_batch_vector<T> dx(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dQ.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dx.memcheck());
+
+        // check bad arguments
+        qrinc_qrdec_checkBadArgs<STRIDED, INSERT>(handle, m, n, dQ.data(), ldq, stQ, dR.data(),
+                                                  ldr, stR, j, dx.data(), incx, stx, bc);
+    }
+}
+
+template <bool CPU, bool GPU, bool INSERT, typename T, typename Td, typename Th>
+void qrinc_qrdec_initData(const rocblas_handle handle,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          Td& dQ,
+                          const rocblas_int ldq,
+                          Td& dR,
+                          const rocblas_int ldr,
+                          Td& dx,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Th& hQ,
+                          Th& hR,
+                          Th& hx)
+{
+    if(CPU)
+    {
+        rocblas_int k = std::min(m, n);
+        rocblas_int sizeW = std::max(1, std::max(m, n));
+        std::vector<T> hW(size_t(ldq) * std::max(m, n));
+        std::vector<T> hIpiv(std::max(1, k));
+        std::vector<T> hWork(sizeW);
+
+        rocblas_init<T>(hA, true);
+        if(INSERT)
+            rocblas_init<T>(hx, false);
+
+        // the initial factors are computed with the cpu reference
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            if(m == 0)
+                continue;
+
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int c = 0; c < n; c++)
+                    hW[i + c * ldq] = hA[b][i + c * m];
+            }
+
+            cpu_geqrf(m, n, hW.data(), ldq, hIpiv.data(), hWork.data(), sizeW);
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int c = 0; c < n; c++)
+                    hR[b][i + c * ldr] = (i <= c) ? hW[i + c * ldq] : 0;
+            }
+
+            cpu_orgqr_ungqr(m, m, k, hW.data(), ldq, hIpiv.data(), hWork.data(), sizeW);
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int c = 0; c < m; c++)
+                    hQ[b][i + c * ldq] = hW[i + c * ldq];
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dQ.transfer_from(hQ));
+        CHECK_HIP_ERROR(dR.transfer_from(hR));
+        if(INSERT)
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+    }
+}
+
+template <bool STRIDED, bool INSERT, typename T, typename Td, typename Th>
+void qrinc_qrdec_getError(const rocblas_handle handle,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          Td& dQ,
+                          const rocblas_int ldq,
+                          const rocblas_stride stQ,
+                          Td& dR,
+                          const rocblas_int ldr,
+                          const rocblas_stride stR,
+                          const rocblas_int j,
+                          Td& dx,
+                          const rocblas_int incx,
+                          const rocblas_stride stx,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Th& hQ,
+                          Th& hQRes,
+                          Th& hR,
+                          Th& hRRes,
+                          Th& hx,
+                          double* max_err)
+{
+    // size of the updated matrix
+    rocblas_int nt = INSERT ? n + 1 : n - 1;
+    std::vector<T> hAt(size_t(m) * nt);
+    std::vector<T> hRt(size_t(m) * nt);
+    std::vector<T> hQR(size_t(m) * nt);
+    std::vector<T> hId(size_t(m) * m);
+    std::vector<T> hQQ(size_t(m) * m);
+
+    // input data initialization
+    qrinc_qrdec_initData<true, true, INSERT, T>(handle, m, n, dQ, ldq, dR, ldr, dx, bc, hA, hQ, hR,
+                                                hx);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ.data(), ldq, stQ,
+                                              dR.data(), ldr, stR, j, dx.data(), incx, stx, bc));
+    CHECK_HIP_ERROR(hQRes.transfer_from(dQ));
+    CHECK_HIP_ERROR(hRRes.transfer_from(dR));
+
+    // there is no cpu reference for the update, so the updated factors are checked directly.
+    // error is ||At - Qt Rt|| / ||At|| + ||I - Qt' Qt|| / ||I||, where At is the updated matrix
+    // and only the upper trapezoidal part of Rt is used, using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int i = 0; i < m; i++)
+    {
+        for(rocblas_int c = 0; c < m; c++)
+            hId[i + c * m] = (i == c) ? 1 : 0;
+    }
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int c = 0; c < nt; c++)
+        {
+            // column c of At is column r of A, or the inserted column
+            rocblas_int r = (c < j - 1) ? c : (INSERT ? c - 1 : c + 1);
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                hAt[i + c * m] = (INSERT && c == j - 1) ? hx[b][i * incx] : hA[b][i + r * m];
+                hRt[i + c * m] = (i <= c) ? hRRes[b][i + c * ldr] : 0;
+            }
+        }
+
+        err = 0;
+        if(nt > 0)
+        {
+            cpu_gemm(rocblas_operation_none, rocblas_operation_none, m, nt, m, T(1), hQRes[b], ldq,
+                     hRt.data(), m, T(0), hQR.data(), m);
+            err = norm_error('F', m, nt, m, hAt.data(), hQR.data());
+        }
+        cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, m, m, m, T(1),
+                 hQRes[b], ldq, hQRes[b], ldq, T(0), hQQ.data(), m);
+        err += norm_error('F', m, m, m, hId.data(), hQQ.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // when deleting a column, the update of R must not depend on Q;
+    // error is ||Rt - Rt_noQ|| / ||Rt||
+    if(!INSERT && nt > 0)
+    {
+        CHECK_HIP_ERROR(dR.transfer_from(hR));
+        CHECK_ROCBLAS_ERROR(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n,
+                                                  (decltype(dQ.data()))nullptr, ldq, stQ,
+                                                  dR.data(), ldr, stR, j, dx.data(), incx, stx,
+                                                  bc));
+        CHECK_HIP_ERROR(hR.transfer_from(dR));
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            err = norm_error('F', m, nt, ldr, hRRes[b], hR[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, bool INSERT, typename T, typename Td, typename Th>
+void qrinc_qrdec_getPerfData(const rocblas_handle handle,
+                             const rocblas_int m,
+                             const rocblas_int n,
+                             Td& dQ,
+                             const rocblas_int ldq,
+                             const rocblas_stride stQ,
+                             Td& dR,
+                             const rocblas_int ldr,
+                             const rocblas_stride stR,
+                             const rocblas_int j,
+                             Td& dx,
+                             const rocblas_int incx,
+                             const rocblas_stride stx,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Th& hQ,
+                             Th& hR,
+                             Th& hx,
+                             double* gpu_time_used,
+                             double* cpu_time_used,
+                             const rocblas_int hot_calls,
+                             const int profile,
+                             const bool profile_kernels,
+                             const bool perf)
+{
+    if(!perf)
+    {
+        // there is no direct CPU/LAPACK equivalent for this function, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    qrinc_qrdec_initData<true, false, INSERT, T>(handle, m, n, dQ, ldq, dR, ldr, dx, bc, hA, hQ,
+                                                 hR, hx);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        qrinc_qrdec_initData<false, true, INSERT, T>(handle, m, n, dQ, ldq, dR, ldr, dx, bc, hA,
+                                                     hQ, hR, hx);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ.data(), ldq,
+                                                  stQ, dR.data(), ldr, stR, j, dx.data(), incx,
+                                                  stx, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        qrinc_qrdec_initData<false, true, INSERT, T>(handle, m, n, dQ, ldq, dR, ldr, dx, bc, hA,
+                                                     hQ, hR, hx);
+
+        start = get_time_us_sync(stream);
+        rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ.data(), ldq, stQ, dR.data(), ldr,
+                              stR, j, dx.data(), incx, stx, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool INSERT, typename T>
+void testing_qrinc_qrdec(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    // number of columns of the updated matrix, or of the original matrix when deleting a column
+    rocblas_int nr = INSERT ? n + 1 : n;
+    rocblas_int ldq = argus.get<rocblas_int>("ldq", m);
+    rocblas_int ldr = argus.get<rocblas_int>("ldr", m);
+    rocblas_int j = argus.get<rocblas_int>("j", INSERT ? n / 2 + 1 : (n + 1) / 2);
+    rocblas_int incx = INSERT ? argus.get<rocblas_int>("incx", 1) : 1;
+    rocblas_stride stQ = argus.get<rocblas_stride>("strideQ", ldq * m);
+    rocblas_stride stR = argus.get<rocblas_stride>("strideR", ldr * nr);
+    rocblas_stride stx = INSERT ? argus.get<rocblas_stride>("strideX", m * incx) : 0;
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stQRes = (argus.unit_check || argus.norm_check) ? stQ : 0;
+    rocblas_stride stRRes = (argus.unit_check || argus.norm_check) ? stR : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(m) * n;
+    size_t size_Q = size_t(ldq) * m;
+    size_t size_R = size_t(ldr) * nr;
+    size_t size_x = INSERT ? size_t(m) * incx : 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_QRes = (argus.unit_check || argus.norm_check) ? size_Q : 0;
+    size_t size_RRes = (argus.unit_check || argus.norm_check) ? size_R : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || ldq < m || ldr < m || j < 1 || bc < 0)
+        || (INSERT ? (n < 0 || j > n + 1 || incx < 1) : (n < 1 || j > n));
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n,
+                                                        (T* const*)nullptr, ldq, stQ,
+                                                        (T* const*)nullptr, ldr, stR, j,
+                                                        (T* const*)nullptr, incx, stx, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, (T*)nullptr,
+                                                        ldq, stQ, (T*)nullptr, ldr, stR, j,
+                                                        (T*)nullptr, incx, stx, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n,
+                                                    (T* const*)nullptr, ldq, stQ,
+                                                    (T* const*)nullptr, ldr, stR, j,
+                                                    (T* const*)nullptr, incx, stx, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, (T*)nullptr,
+                                                    ldq, stQ, (T*)nullptr, ldr, stR, j,
+                                                    (T*)nullptr, incx, stx, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, bc);
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hQ(size_Q, 1, bc);
+        host_batch_vector<T> hQRes(size_QRes, 1, bc);
+        host_batch_vector<T> hR(size_R, 1, bc);
+        host_batch_vector<T> hRRes(size_RRes, 1, bc);
+        host_batch_vector<T> hx(size_x, 1, bc);
+        device_batch_vector<T> dQ(size_Q, 1, bc);
+        device_batch_vector<T> dR(size_R, 1, bc);
+        device_batch_vector<T> dx(size_x, 1, bc);
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+        if(size_R)
+            CHECK_HIP_ERROR(dR.memcheck());
+        if(size_x)
+            CHECK_HIP_ERROR(dx.memcheck());
+
+        // check quick return
+        if(m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ.data(),
+                                                        ldq, stQ, dR.data(), ldr, stR, j,
+                                                        dx.data(), incx, stx, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            qrinc_qrdec_getError<STRIDED, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR, j,
+                                                     dx, incx, stx, bc, hA, hQ, hQRes, hR, hRRes,
+                                                     hx, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            qrinc_qrdec_getPerfData<STRIDED, INSERT, T>(
+                handle, m, n, dQ, ldq, stQ, dR, ldr, stR, j, dx, incx, stx, bc, hA, hQ, hR, hx,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                argus.perf);
+    }
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hQ(size_Q, 1, stQ, bc);
+        host_strided_batch_vector<T> hQRes(size_QRes, 1, stQRes, bc);
+        host_strided_batch_vector<T> hR(size_R, 1, stR, bc);
+        host_strided_batch_vector<T> hRRes(size_RRes, 1, stRRes, bc);
+        host_strided_batch_vector<T> hx(size_x, 1, stx, bc);
+        device_strided_batch_vector<T> dQ(size_Q, 1, stQ, bc);
+        device_strided_batch_vector<T> dR(size_R, 1, stR, bc);
+        device_strided_batch_vector<T> dx(size_x, 1, stx, bc);
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+        if(size_R)
+            CHECK_HIP_ERROR(dR.memcheck());
+        if(size_x)
+            CHECK_HIP_ERROR(dx.memcheck());
+
+        // check quick return
+        if(m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_qrinc_qrdec(STRIDED, INSERT, handle, m, n, dQ.data(),
+                                                        ldq, stQ, dR.data(), ldr, stR, j,
+                                                        dx.data(), incx, stx, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            qrinc_qrdec_getError<STRIDED, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR, j,
+                                                     dx, incx, stx, bc, hA, hQ, hQRes, hR, hRRes,
+                                                     hx, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            qrinc_qrdec_getPerfData<STRIDED, INSERT, T>(
+                handle, m, n, dQ, ldq, stQ, dR, ldr, stR, j, dx, incx, stx, bc, hA, hQ, hR, hx,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                if(INSERT)
+                {
+                    rocsolver_bench_output("m", "n", "ldq", "ldr", "j", "incx", "batch_c");
+                    rocsolver_bench_output(m, n, ldq, ldr, j, incx, bc);
+                }
+                else
+                {
+                    rocsolver_bench_output("m", "n", "ldq", "ldr", "j", "batch_c");
+                    rocsolver_bench_output(m, n, ldq, ldr, j, bc);
+                }
+            }
+            else if(STRIDED)
+            {
+                if(INSERT)
+                {
+                    rocsolver_bench_output("m", "n", "ldq", "strideQ", "ldr", "strideR", "j",
+                                           "incx", "strideX", "batch_c");
+                    rocsolver_bench_output(m, n, ldq, stQ, ldr, stR, j, incx, stx, bc);
+                }
+                else
+                {
+                    rocsolver_bench_output("m", "n", "ldq", "strideQ", "ldr", "strideR", "j",
+                                           "batch_c");
+                    rocsolver_bench_output(m, n, ldq, stQ, ldr, stR, j, bc);
+                }
+            }
+            else
+            {
+                if(INSERT)
+                {
+                    rocsolver_bench_output("m", "n", "ldq", "ldr", "j", "incx");
+                    rocsolver_bench_output(m, n, ldq, ldr, j, incx);
+                }
+                else
+                {
+                    rocsolver_bench_output("m", "n", "ldq", "ldr", "j");
+                    rocsolver_bench_output(m, n, ldq, ldr, j);
+                }
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_QRINC_QRDEC(...) \
+    extern template void testing_qrinc_qrdec<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_QRINC_QRDEC,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
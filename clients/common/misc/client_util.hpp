@@ -65,6 +65,9 @@
 #define FOREACH_COMPLEX_TYPE(STAMP, F, ...)        \
     F(STAMP, ##__VA_ARGS__, rocblas_float_complex) \
     F(STAMP, ##__VA_ARGS__, rocblas_double_complex)
+#define FOREACH_DOUBLE_TYPE(STAMP, F, ...)          \
+    F(STAMP, ##__VA_ARGS__, double)                 \
+    F(STAMP, ##__VA_ARGS__, rocblas_double_complex)
 #define FOREACH_SCALAR_TYPE(STAMP, F, ...)         \
     F(STAMP, ##__VA_ARGS__, float)                 \
     F(STAMP, ##__VA_ARGS__, double)                \
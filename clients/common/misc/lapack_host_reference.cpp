@@ -84,6 +84,137 @@ void zgecon_(char* norm,
              double* rwork,
              int* info);
 
+float slansy_(char* norm, char* uplo, int* n, float* A, int* lda, float* work);
+double dlansy_(char* norm, char* uplo, int* n, double* A, int* lda, double* work);
+float clanhe_(char* norm, char* uplo, int* n, rocblas_float_complex* A, int* lda, float* work);
+double zlanhe_(char* norm, char* uplo, int* n, rocblas_double_complex* A, int* lda, double* work);
+
+void spocon_(char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dpocon_(char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void cpocon_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zpocon_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
+void sgesvx_(char* fact,
+             char* trans,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* AF,
+             int* ldaf,
+             int* ipiv,
+             char* equed,
+             float* R,
+             float* C,
+             float* B,
+             int* ldb,
+             float* X,
+             int* ldx,
+             float* rcond,
+             float* ferr,
+             float* berr,
+             float* work,
+             int* iwork,
+             int* info);
+void dgesvx_(char* fact,
+             char* trans,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* AF,
+             int* ldaf,
+             int* ipiv,
+             char* equed,
+             double* R,
+             double* C,
+             double* B,
+             int* ldb,
+             double* X,
+             int* ldx,
+             double* rcond,
+             double* ferr,
+             double* berr,
+             double* work,
+             int* iwork,
+             int* info);
+void cgesvx_(char* fact,
+             char* trans,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* AF,
+             int* ldaf,
+             int* ipiv,
+             char* equed,
+             float* R,
+             float* C,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* X,
+             int* ldx,
+             float* rcond,
+             float* ferr,
+             float* berr,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zgesvx_(char* fact,
+             char* trans,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* AF,
+             int* ldaf,
+             int* ipiv,
+             char* equed,
+             double* R,
+             double* C,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* X,
+             int* ldx,
+             double* rcond,
+             double* ferr,
+             double* berr,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void saxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
 void daxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
 void caxpy_(int* n,
@@ -485,6 +616,131 @@ void zgetrs_(char* trans,
              int* ldb,
              int* info);
 
+void sgbtrf_(int* m, int* n, int* kl, int* ku, float* AB, int* ldab, int* ipiv, int* info);
+void dgbtrf_(int* m, int* n, int* kl, int* ku, double* AB, int* ldab, int* ipiv, int* info);
+void cgbtrf_(int* m,
+             int* n,
+             int* kl,
+             int* ku,
+             rocblas_float_complex* AB,
+             int* ldab,
+             int* ipiv,
+             int* info);
+void zgbtrf_(int* m,
+             int* n,
+             int* kl,
+             int* ku,
+             rocblas_double_complex* AB,
+             int* ldab,
+             int* ipiv,
+             int* info);
+
+void sgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             float* AB,
+             int* ldab,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             int* info);
+void dgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             double* AB,
+             int* ldab,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             int* info);
+void cgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             rocblas_float_complex* AB,
+             int* ldab,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             rocblas_double_complex* AB,
+             int* ldab,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void sgtsv_(int* n,
+            int* nrhs,
+            float* dl,
+            float* d,
+            float* du,
+            float* B,
+            int* ldb,
+            int* info);
+void dgtsv_(int* n,
+            int* nrhs,
+            double* dl,
+            double* d,
+            double* du,
+            double* B,
+            int* ldb,
+            int* info);
+void cgtsv_(int* n,
+            int* nrhs,
+            rocblas_float_complex* dl,
+            rocblas_float_complex* d,
+            rocblas_float_complex* du,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zgtsv_(int* n,
+            int* nrhs,
+            rocblas_double_complex* dl,
+            rocblas_double_complex* d,
+            rocblas_double_complex* du,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+void sptsv_(int* n,
+            int* nrhs,
+            float* D,
+            float* E,
+            float* B,
+            int* ldb,
+            int* info);
+void dptsv_(int* n,
+            int* nrhs,
+            double* D,
+            double* E,
+            double* B,
+            int* ldb,
+            int* info);
+void cptsv_(int* n,
+            int* nrhs,
+            float* D,
+            rocblas_float_complex* E,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zptsv_(int* n,
+            int* nrhs,
+            double* D,
+            rocblas_double_complex* E,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
 void sgesv_(int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
 void dgesv_(int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
 void cgesv_(int* n,
@@ -549,6 +805,100 @@ void zgels_(char* trans,
             int* lwork,
             int* info);
 
+void sgeqp3_(int* m,
+             int* n,
+             float* A,
+             int* lda,
+             int* jpvt,
+             float* tau,
+             float* work,
+             int* lwork,
+             int* info);
+void dgeqp3_(int* m,
+             int* n,
+             double* A,
+             int* lda,
+             int* jpvt,
+             double* tau,
+             double* work,
+             int* lwork,
+             int* info);
+void cgeqp3_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_float_complex* tau,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgeqp3_(int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_double_complex* tau,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
 void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
 void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
 void cgetri_(int* n,
@@ -2673,26 +3023,268 @@ float cpu_gecon<rocblas_float_complex, float>(char norm,
                                               float* rwork,
                                               rocblas_int* iwork)
 {
-    float rcond;
-    rocblas_int info;
-    cgecon_(&norm, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
-    return rcond;
+    float rcond;
+    rocblas_int info;
+    cgecon_(&norm, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_gecon<rocblas_double_complex, double>(char norm,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 double anorm,
+                                                 rocblas_double_complex* work,
+                                                 double* rwork,
+                                                 rocblas_int* iwork)
+{
+    double rcond;
+    rocblas_int info;
+    zgecon_(&norm, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+// lansy & lanhe
+
+template <>
+float cpu_lansy<float, float>(char norm,
+                              rocblas_fill uplo,
+                              rocblas_int n,
+                              float* A,
+                              rocblas_int lda,
+                              float* work)
+{
+    char uploC = rocblas2char_fill(uplo);
+    return slansy_(&norm, &uploC, &n, A, &lda, work);
+}
+
+template <>
+double cpu_lansy<double, double>(char norm,
+                                 rocblas_fill uplo,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double* work)
+{
+    char uploC = rocblas2char_fill(uplo);
+    return dlansy_(&norm, &uploC, &n, A, &lda, work);
+}
+
+template <>
+float cpu_lansy<rocblas_float_complex, float>(char norm,
+                                              rocblas_fill uplo,
+                                              rocblas_int n,
+                                              rocblas_float_complex* A,
+                                              rocblas_int lda,
+                                              float* work)
+{
+    char uploC = rocblas2char_fill(uplo);
+    return clanhe_(&norm, &uploC, &n, A, &lda, work);
+}
+
+template <>
+double cpu_lansy<rocblas_double_complex, double>(char norm,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 double* work)
+{
+    char uploC = rocblas2char_fill(uplo);
+    return zlanhe_(&norm, &uploC, &n, A, &lda, work);
+}
+
+// pocon
+
+template <>
+float cpu_pocon<float, float>(rocblas_fill uplo,
+                              rocblas_int n,
+                              float* A,
+                              rocblas_int lda,
+                              float anorm,
+                              float* work,
+                              float* rwork,
+                              rocblas_int* iwork)
+{
+    char uploC = rocblas2char_fill(uplo);
+    float rcond;
+    rocblas_int info;
+    spocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, iwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_pocon<double, double>(rocblas_fill uplo,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double anorm,
+                                 double* work,
+                                 double* rwork,
+                                 rocblas_int* iwork)
+{
+    char uploC = rocblas2char_fill(uplo);
+    double rcond;
+    rocblas_int info;
+    dpocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, iwork, &info);
+    return rcond;
+}
+
+template <>
+float cpu_pocon<rocblas_float_complex, float>(rocblas_fill uplo,
+                                              rocblas_int n,
+                                              rocblas_float_complex* A,
+                                              rocblas_int lda,
+                                              float anorm,
+                                              rocblas_float_complex* work,
+                                              float* rwork,
+                                              rocblas_int* iwork)
+{
+    char uploC = rocblas2char_fill(uplo);
+    float rcond;
+    rocblas_int info;
+    cpocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_pocon<rocblas_double_complex, double>(rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 double anorm,
+                                                 rocblas_double_complex* work,
+                                                 double* rwork,
+                                                 rocblas_int* iwork)
+{
+    char uploC = rocblas2char_fill(uplo);
+    double rcond;
+    rocblas_int info;
+    zpocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+// gesvx
+
+template <>
+void cpu_gesvx<float, float>(rocblas_operation transR,
+                             rocblas_int n,
+                             rocblas_int nrhs,
+                             float* A,
+                             rocblas_int lda,
+                             float* AF,
+                             rocblas_int ldaf,
+                             rocblas_int* ipiv,
+                             char* equed,
+                             float* R,
+                             float* C,
+                             float* B,
+                             rocblas_int ldb,
+                             float* X,
+                             rocblas_int ldx,
+                             float* rcond,
+                             float* ferr,
+                             float* berr,
+                             float* work,
+                             float* rwork,
+                             rocblas_int* iwork,
+                             rocblas_int* info)
+{
+    char fact = 'E';
+    char trans = rocblas2char_operation(transR);
+    sgesvx_(&fact, &trans, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, equed, R, C, B, &ldb, X, &ldx,
+            rcond, ferr, berr, work, iwork, info);
+}
+
+template <>
+void cpu_gesvx<double, double>(rocblas_operation transR,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               double* A,
+                               rocblas_int lda,
+                               double* AF,
+                               rocblas_int ldaf,
+                               rocblas_int* ipiv,
+                               char* equed,
+                               double* R,
+                               double* C,
+                               double* B,
+                               rocblas_int ldb,
+                               double* X,
+                               rocblas_int ldx,
+                               double* rcond,
+                               double* ferr,
+                               double* berr,
+                               double* work,
+                               double* rwork,
+                               rocblas_int* iwork,
+                               rocblas_int* info)
+{
+    char fact = 'E';
+    char trans = rocblas2char_operation(transR);
+    dgesvx_(&fact, &trans, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, equed, R, C, B, &ldb, X, &ldx,
+            rcond, ferr, berr, work, iwork, info);
 }
 
 template <>
-double cpu_gecon<rocblas_double_complex, double>(char norm,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* A,
-                                                 rocblas_int lda,
-                                                 double anorm,
-                                                 rocblas_double_complex* work,
-                                                 double* rwork,
-                                                 rocblas_int* iwork)
+void cpu_gesvx<rocblas_float_complex, float>(rocblas_operation transR,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_float_complex* AF,
+                                             rocblas_int ldaf,
+                                             rocblas_int* ipiv,
+                                             char* equed,
+                                             float* R,
+                                             float* C,
+                                             rocblas_float_complex* B,
+                                             rocblas_int ldb,
+                                             rocblas_float_complex* X,
+                                             rocblas_int ldx,
+                                             float* rcond,
+                                             float* ferr,
+                                             float* berr,
+                                             rocblas_float_complex* work,
+                                             float* rwork,
+                                             rocblas_int* iwork,
+                                             rocblas_int* info)
 {
-    double rcond;
-    rocblas_int info;
-    zgecon_(&norm, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
-    return rcond;
+    char fact = 'E';
+    char trans = rocblas2char_operation(transR);
+    cgesvx_(&fact, &trans, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, equed, R, C, B, &ldb, X, &ldx,
+            rcond, ferr, berr, work, rwork, info);
+}
+
+template <>
+void cpu_gesvx<rocblas_double_complex, double>(rocblas_operation transR,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_double_complex* AF,
+                                               rocblas_int ldaf,
+                                               rocblas_int* ipiv,
+                                               char* equed,
+                                               double* R,
+                                               double* C,
+                                               rocblas_double_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_double_complex* X,
+                                               rocblas_int ldx,
+                                               double* rcond,
+                                               double* ferr,
+                                               double* berr,
+                                               rocblas_double_complex* work,
+                                               double* rwork,
+                                               rocblas_int* iwork,
+                                               rocblas_int* info)
+{
+    char fact = 'E';
+    char trans = rocblas2char_operation(transR);
+    zgesvx_(&fact, &trans, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, equed, R, C, B, &ldb, X, &ldx,
+            rcond, ferr, berr, work, rwork, info);
 }
 
 // axpy
@@ -5602,6 +6194,230 @@ void cpu_getrs<rocblas_double_complex>(rocblas_operation trans,
     zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
 }
 
+// gbtrf
+template <>
+void cpu_gbtrf<float>(rocblas_int m,
+                      rocblas_int n,
+                      rocblas_int kl,
+                      rocblas_int ku,
+                      float* AB,
+                      rocblas_int ldab,
+                      rocblas_int* ipiv,
+                      rocblas_int* info)
+{
+    sgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+}
+
+template <>
+void cpu_gbtrf<double>(rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int kl,
+                       rocblas_int ku,
+                       double* AB,
+                       rocblas_int ldab,
+                       rocblas_int* ipiv,
+                       rocblas_int* info)
+{
+    dgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+}
+
+template <>
+void cpu_gbtrf<rocblas_float_complex>(rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_float_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_int* ipiv,
+                                      rocblas_int* info)
+{
+    cgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+}
+
+template <>
+void cpu_gbtrf<rocblas_double_complex>(rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int kl,
+                                       rocblas_int ku,
+                                       rocblas_double_complex* AB,
+                                       rocblas_int ldab,
+                                       rocblas_int* ipiv,
+                                       rocblas_int* info)
+{
+    zgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+}
+
+// gbtrs
+template <>
+void cpu_gbtrs<float>(rocblas_operation trans,
+                      rocblas_int n,
+                      rocblas_int kl,
+                      rocblas_int ku,
+                      rocblas_int nrhs,
+                      float* AB,
+                      rocblas_int ldab,
+                      rocblas_int* ipiv,
+                      float* B,
+                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    sgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_gbtrs<double>(rocblas_operation trans,
+                       rocblas_int n,
+                       rocblas_int kl,
+                       rocblas_int ku,
+                       rocblas_int nrhs,
+                       double* AB,
+                       rocblas_int ldab,
+                       rocblas_int* ipiv,
+                       double* B,
+                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    dgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_gbtrs<rocblas_float_complex>(rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_int* ipiv,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    cgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_gbtrs<rocblas_double_complex>(rocblas_operation trans,
+                                       rocblas_int n,
+                                       rocblas_int kl,
+                                       rocblas_int ku,
+                                       rocblas_int nrhs,
+                                       rocblas_double_complex* AB,
+                                       rocblas_int ldab,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* B,
+                                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    zgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+}
+
+// gtsv
+template <>
+void cpu_gtsv<float>(rocblas_int n,
+                     rocblas_int nrhs,
+                     float* dl,
+                     float* d,
+                     float* du,
+                     float* B,
+                     rocblas_int ldb,
+                     rocblas_int* info)
+{
+    sgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cpu_gtsv<double>(rocblas_int n,
+                      rocblas_int nrhs,
+                      double* dl,
+                      double* d,
+                      double* du,
+                      double* B,
+                      rocblas_int ldb,
+                      rocblas_int* info)
+{
+    dgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cpu_gtsv<rocblas_float_complex>(rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* dl,
+                                     rocblas_float_complex* d,
+                                     rocblas_float_complex* du,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    cgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cpu_gtsv<rocblas_double_complex>(rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* dl,
+                                      rocblas_double_complex* d,
+                                      rocblas_double_complex* du,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_int* info)
+{
+    zgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+// ptsv
+template <>
+void cpu_ptsv<float, float>(rocblas_int n,
+                            rocblas_int nrhs,
+                            float* D,
+                            float* E,
+                            float* B,
+                            rocblas_int ldb,
+                            rocblas_int* info)
+{
+    sptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+template <>
+void cpu_ptsv<double, double>(rocblas_int n,
+                              rocblas_int nrhs,
+                              double* D,
+                              double* E,
+                              double* B,
+                              rocblas_int ldb,
+                              rocblas_int* info)
+{
+    dptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+template <>
+void cpu_ptsv<rocblas_float_complex, float>(rocblas_int n,
+                                            rocblas_int nrhs,
+                                            float* D,
+                                            rocblas_float_complex* E,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_int* info)
+{
+    cptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+template <>
+void cpu_ptsv<rocblas_double_complex, double>(rocblas_int n,
+                                              rocblas_int nrhs,
+                                              double* D,
+                                              rocblas_double_complex* E,
+                                              rocblas_double_complex* B,
+                                              rocblas_int ldb,
+                                              rocblas_int* info)
+{
+    zptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
 // gesv
 template <>
 void cpu_gesv<float>(rocblas_int n,
@@ -5724,6 +6540,83 @@ void cpu_gels<rocblas_double_complex>(rocblas_operation transR,
     zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
 }
 
+// gelsy
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               float* A,
+               rocblas_int lda,
+               float* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               float rcond,
+               rocblas_int* rank,
+               float* work,
+               rocblas_int lwork,
+               float* rwork,
+               rocblas_int* info)
+{
+    sgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               double* A,
+               rocblas_int lda,
+               double* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               double rcond,
+               rocblas_int* rank,
+               double* work,
+               rocblas_int lwork,
+               double* rwork,
+               rocblas_int* info)
+{
+    dgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               float rcond,
+               rocblas_int* rank,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               float* rwork,
+               rocblas_int* info)
+{
+    cgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, info);
+}
+
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               double rcond,
+               rocblas_int* rank,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               double* rwork,
+               rocblas_int* info)
+{
+    zgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, info);
+}
+
 // trtri
 template <>
 void cpu_trtri<float>(rocblas_fill uplo,
@@ -5879,6 +6772,67 @@ void cpu_geqrf<rocblas_double_complex>(rocblas_int m,
     zgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
 }
 
+// geqp3
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               float* ipiv,
+               float* work,
+               rocblas_int lwork,
+               float* rwork)
+{
+    int info;
+    sgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               double* ipiv,
+               double* work,
+               rocblas_int lwork,
+               double* rwork)
+{
+    int info;
+    dgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               rocblas_float_complex* ipiv,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               float* rwork)
+{
+    int info;
+    cgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               rocblas_double_complex* ipiv,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               double* rwork)
+{
+    int info;
+    zgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
 // geqr2
 template <>
 void cpu_geqr2<float>(rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* ipiv, float* work)
@@ -78,6 +78,43 @@ S cpu_lange(char norm, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, S* w
 template <typename T, typename S>
 S cpu_gecon(char norm, rocblas_int n, T* A, rocblas_int lda, S anorm, T* work, S* rwork, rocblas_int* iwork);
 
+template <typename T, typename S>
+S cpu_lansy(char norm, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, S* work);
+
+template <typename T, typename S>
+S cpu_pocon(rocblas_fill uplo,
+            rocblas_int n,
+            T* A,
+            rocblas_int lda,
+            S anorm,
+            T* work,
+            S* rwork,
+            rocblas_int* iwork);
+
+template <typename T, typename S>
+void cpu_gesvx(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* AF,
+               rocblas_int ldaf,
+               rocblas_int* ipiv,
+               char* equed,
+               S* R,
+               S* C,
+               T* B,
+               rocblas_int ldb,
+               T* X,
+               rocblas_int ldx,
+               S* rcond,
+               S* ferr,
+               S* berr,
+               T* work,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_axpy(rocblas_int n, T alpha, T* x, rocblas_int incx, T* y, rocblas_int incy);
 
@@ -215,6 +252,47 @@ void cpu_getrs(rocblas_operation trans,
                T* B,
                rocblas_int ldb);
 
+template <typename T>
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               T* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               T* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_gtsv(rocblas_int n,
+              rocblas_int nrhs,
+              T* dl,
+              T* d,
+              T* du,
+              T* B,
+              rocblas_int ldb,
+              rocblas_int* info);
+
+template <typename T, typename S>
+void cpu_ptsv(rocblas_int n,
+              rocblas_int nrhs,
+              S* D,
+              T* E,
+              T* B,
+              rocblas_int ldb,
+              rocblas_int* info);
+
 template <typename T>
 void cpu_gesv(rocblas_int n,
               rocblas_int nrhs,
@@ -238,6 +316,22 @@ void cpu_gels(rocblas_operation transR,
               rocblas_int lwork,
               rocblas_int* info);
 
+template <typename T, typename S>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               S rcond,
+               rocblas_int* rank,
+               T* work,
+               rocblas_int lwork,
+               S* rwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_getri(rocblas_int n,
                T* A,
@@ -346,6 +440,17 @@ void cpu_geqr2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T*
 template <typename T>
 void cpu_geqrf(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work, rocblas_int sizeW);
 
+template <typename T, typename S>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               T* ipiv,
+               T* work,
+               rocblas_int lwork,
+               S* rwork);
+
 template <typename T>
 void cpu_gerq2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work);
 
@@ -1594,6 +1594,61 @@ inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
 }
 /***************************************************************/
 
+/******************** ORGQR_UNGQR_VBATCHED ********************/
+// vbatched
+inline rocblas_status rocsolver_orgqr_ungqr_vbatched(rocblas_handle handle,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     float* const A[],
+                                                     const rocblas_int* lda,
+                                                     float* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int bc)
+{
+    return rocsolver_sorgqr_vbatched(handle, m, n, k, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_vbatched(rocblas_handle handle,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     double* const A[],
+                                                     const rocblas_int* lda,
+                                                     double* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int bc)
+{
+    return rocsolver_dorgqr_vbatched(handle, m, n, k, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_vbatched(rocblas_handle handle,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     rocblas_float_complex* const A[],
+                                                     const rocblas_int* lda,
+                                                     rocblas_float_complex* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int bc)
+{
+    return rocsolver_cungqr_vbatched(handle, m, n, k, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_vbatched(rocblas_handle handle,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     rocblas_double_complex* const A[],
+                                                     const rocblas_int* lda,
+                                                     rocblas_double_complex* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int bc)
+{
+    return rocsolver_zungqr_vbatched(handle, m, n, k, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
 /******************** ORGLx_UNGLx ********************/
 inline rocblas_status rocsolver_orglx_unglx(bool GLQ,
                                             rocblas_handle handle,
@@ -1864,6 +1919,77 @@ inline rocblas_status rocsolver_ormxr_unmxr(bool MQR,
 }
 /***************************************************************/
 
+/******************** ORMQR_UNMQR_VBATCHED ********************/
+// vbatched
+inline rocblas_status rocsolver_ormqr_unmqr_vbatched(rocblas_handle handle,
+                                                     rocblas_side side,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     float* const A[],
+                                                     const rocblas_int* lda,
+                                                     float* ipiv,
+                                                     rocblas_stride stP,
+                                                     float* const C[],
+                                                     const rocblas_int* ldc,
+                                                     rocblas_int bc)
+{
+    return rocsolver_sormqr_vbatched(handle, side, trans, m, n, k, A, lda, ipiv, stP, C, ldc, bc);
+}
+
+inline rocblas_status rocsolver_ormqr_unmqr_vbatched(rocblas_handle handle,
+                                                     rocblas_side side,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     double* const A[],
+                                                     const rocblas_int* lda,
+                                                     double* ipiv,
+                                                     rocblas_stride stP,
+                                                     double* const C[],
+                                                     const rocblas_int* ldc,
+                                                     rocblas_int bc)
+{
+    return rocsolver_dormqr_vbatched(handle, side, trans, m, n, k, A, lda, ipiv, stP, C, ldc, bc);
+}
+
+inline rocblas_status rocsolver_ormqr_unmqr_vbatched(rocblas_handle handle,
+                                                     rocblas_side side,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     rocblas_float_complex* const A[],
+                                                     const rocblas_int* lda,
+                                                     rocblas_float_complex* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_float_complex* const C[],
+                                                     const rocblas_int* ldc,
+                                                     rocblas_int bc)
+{
+    return rocsolver_cunmqr_vbatched(handle, side, trans, m, n, k, A, lda, ipiv, stP, C, ldc, bc);
+}
+
+inline rocblas_status rocsolver_ormqr_unmqr_vbatched(rocblas_handle handle,
+                                                     rocblas_side side,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int* m,
+                                                     const rocblas_int* n,
+                                                     const rocblas_int* k,
+                                                     rocblas_double_complex* const A[],
+                                                     const rocblas_int* lda,
+                                                     rocblas_double_complex* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_double_complex* const C[],
+                                                     const rocblas_int* ldc,
+                                                     rocblas_int bc)
+{
+    return rocsolver_zunmqr_vbatched(handle, side, trans, m, n, k, A, lda, ipiv, stP, C, ldc, bc);
+}
+/********************************************************/
+
 /******************** ORMLx_UNMLx ********************/
 inline rocblas_status rocsolver_ormlx_unmlx(bool MLQ,
                                             rocblas_handle handle,
@@ -2146,6 +2272,388 @@ inline rocblas_status
 }
 /********************************************************/
 
+/******************** INTERLEAVE ********************/
+// strided to interleaved
+inline rocblas_status rocsolver_interleave(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           float* A,
+                                           const rocblas_int lda,
+                                           const rocblas_stride stA,
+                                           float* B,
+                                           const rocblas_int incb,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride stB,
+                                           const rocblas_int bc)
+{
+    return rocsolver_sinterleave_batched(handle, m, n, A, lda, stA, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_interleave(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           const rocblas_stride stA,
+                                           double* B,
+                                           const rocblas_int incb,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride stB,
+                                           const rocblas_int bc)
+{
+    return rocsolver_dinterleave_batched(handle, m, n, A, lda, stA, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_interleave(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           const rocblas_int lda,
+                                           const rocblas_stride stA,
+                                           rocblas_float_complex* B,
+                                           const rocblas_int incb,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride stB,
+                                           const rocblas_int bc)
+{
+    return rocsolver_cinterleave_batched(handle, m, n, A, lda, stA, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_interleave(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           const rocblas_stride stA,
+                                           rocblas_double_complex* B,
+                                           const rocblas_int incb,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride stB,
+                                           const rocblas_int bc)
+{
+    return rocsolver_zinterleave_batched(handle, m, n, A, lda, stA, B, incb, ldb, stB, bc);
+}
+/********************************************************/
+
+/******************** DEINTERLEAVE ********************/
+// interleaved to strided
+inline rocblas_status rocsolver_deinterleave(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             float* A,
+                                             const rocblas_int inca,
+                                             const rocblas_int lda,
+                                             const rocblas_stride stA,
+                                             float* B,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride stB,
+                                             const rocblas_int bc)
+{
+    return rocsolver_sdeinterleave_batched(handle, m, n, A, inca, lda, stA, B, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_deinterleave(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             double* A,
+                                             const rocblas_int inca,
+                                             const rocblas_int lda,
+                                             const rocblas_stride stA,
+                                             double* B,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride stB,
+                                             const rocblas_int bc)
+{
+    return rocsolver_ddeinterleave_batched(handle, m, n, A, inca, lda, stA, B, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_deinterleave(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             const rocblas_int inca,
+                                             const rocblas_int lda,
+                                             const rocblas_stride stA,
+                                             rocblas_float_complex* B,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride stB,
+                                             const rocblas_int bc)
+{
+    return rocsolver_cdeinterleave_batched(handle, m, n, A, inca, lda, stA, B, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_deinterleave(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             const rocblas_int inca,
+                                             const rocblas_int lda,
+                                             const rocblas_stride stA,
+                                             rocblas_double_complex* B,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride stB,
+                                             const rocblas_int bc)
+{
+    return rocsolver_zdeinterleave_batched(handle, m, n, A, inca, lda, stA, B, ldb, stB, bc);
+}
+/********************************************************/
+
+/******************** LANGE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_slange_strided_batched(handle, norm, m, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_slange(handle, norm, m, n, A, lda, anorm);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dlange_strided_batched(handle, norm, m, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_dlange(handle, norm, m, n, A, lda, anorm);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_clange_strided_batched(handle, norm, m, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_clange(handle, norm, m, n, A, lda, anorm);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zlange_strided_batched(handle, norm, m, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_zlange(handle, norm, m, n, A, lda, anorm);
+}
+
+// batched
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      rocblas_int bc)
+{
+    return rocsolver_slange_batched(handle, norm, m, n, A, lda, anorm, bc);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      rocblas_int bc)
+{
+    return rocsolver_dlange_batched(handle, norm, m, n, A, lda, anorm, bc);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      rocblas_int bc)
+{
+    return rocsolver_clange_batched(handle, norm, m, n, A, lda, anorm, bc);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      rocblas_int bc)
+{
+    return rocsolver_zlange_batched(handle, norm, m, n, A, lda, anorm, bc);
+}
+/********************************************************/
+
+/******************** LANSY_LANHE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* anorm,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_slansy_strided_batched(handle, norm, uplo, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_slansy(handle, norm, uplo, n, A, lda, anorm);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* anorm,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dlansy_strided_batched(handle, norm, uplo, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_dlansy(handle, norm, uplo, n, A, lda, anorm);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* anorm,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_clanhe_strided_batched(handle, norm, uplo, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_clanhe(handle, norm, uplo, n, A, lda, anorm);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* anorm,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zlanhe_strided_batched(handle, norm, uplo, n, A, lda, stA, anorm, bc);
+    else
+        return rocsolver_zlanhe(handle, norm, uplo, n, A, lda, anorm);
+}
+
+// batched
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* anorm,
+                                            rocblas_int bc)
+{
+    return rocsolver_slansy_batched(handle, norm, uplo, n, A, lda, anorm, bc);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* anorm,
+                                            rocblas_int bc)
+{
+    return rocsolver_dlansy_batched(handle, norm, uplo, n, A, lda, anorm, bc);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* anorm,
+                                            rocblas_int bc)
+{
+    return rocsolver_clanhe_batched(handle, norm, uplo, n, A, lda, anorm, bc);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocsolver_norm_type norm,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* anorm,
+                                            rocblas_int bc)
+{
+    return rocsolver_zlanhe_batched(handle, norm, uplo, n, A, lda, anorm, bc);
+}
+/********************************************************/
+
 /******************** STEBZ ********************/
 inline rocblas_status rocsolver_stebz(rocblas_handle handle,
                                       rocblas_erange erange,
@@ -2730,63 +3238,490 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
 }
 /********************************************************/
 
-/******************** POTRS ********************/
+/******************** POTRF_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  float* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_spotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  double* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_dpotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  rocblas_float_complex* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_cpotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  rocblas_double_complex* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_zpotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+/********************************************************/
+
+/******************** POTRF_LOGDET ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_potrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      float* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int batch_count)
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_spotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                                batch_count);
+        return rocsolver_spotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                       bc);
     else
-        return rocsolver_spotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
+        return rocsolver_spotrf_logdet(handle, uplo, n, A, lda, logdet, info);
 }
 
-inline rocblas_status rocsolver_potrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      double* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int batch_count)
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_dpotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                                batch_count);
+        return rocsolver_dpotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                       bc);
     else
-        return rocsolver_dpotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
+        return rocsolver_dpotrf_logdet(handle, uplo, n, A, lda, logdet, info);
 }
 
-inline rocblas_status rocsolver_potrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_float_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int batch_count)
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_cpotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+        return rocsolver_cpotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                       bc);
+    else
+        return rocsolver_cpotrf_logdet(handle, uplo, n, A, lda, logdet, info);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                       bc);
+    else
+        return rocsolver_zpotrf_logdet(handle, uplo, n, A, lda, logdet, info);
+}
+
+// batched
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_spotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dpotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cpotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zpotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc);
+}
+/********************************************************/
+
+/******************** POTDET ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* logdet,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spotdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return rocsolver_spotdet(handle, n, A, lda, logdet);
+}
+
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* logdet,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpotdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return rocsolver_dpotdet(handle, n, A, lda, logdet);
+}
+
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* logdet,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpotdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return rocsolver_cpotdet(handle, n, A, lda, logdet);
+}
+
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* logdet,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpotdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return rocsolver_zpotdet(handle, n, A, lda, logdet);
+}
+
+// batched
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* logdet,
+                                       rocblas_int bc)
+{
+    return rocsolver_spotdet_batched(handle, n, A, lda, logdet, bc);
+}
+
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* logdet,
+                                       rocblas_int bc)
+{
+    return rocsolver_dpotdet_batched(handle, n, A, lda, logdet, bc);
+}
+
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* logdet,
+                                       rocblas_int bc)
+{
+    return rocsolver_cpotdet_batched(handle, n, A, lda, logdet, bc);
+}
+
+inline rocblas_status rocsolver_potdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* logdet,
+                                       rocblas_int bc)
+{
+    return rocsolver_zpotdet_batched(handle, n, A, lda, logdet, bc);
+}
+/********************************************************/
+
+/******************** POCON ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_spocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_dpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_cpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_zpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+// batched
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_spocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_dpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_cpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_zpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+/********************************************************/
+
+/******************** POTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_spotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                batch_count);
+    else
+        return rocsolver_spotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_dpotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                batch_count);
+    else
+        return rocsolver_dpotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_cpotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
                                                 batch_count);
     else
         return rocsolver_cpotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
@@ -2878,6 +3813,81 @@ inline rocblas_status rocsolver_potrs(bool STRIDED,
 }
 /********************************************************/
 
+/******************** POTRS_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  float* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  float* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_spotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  double* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  double* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_dpotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  rocblas_float_complex* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  rocblas_float_complex* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_cpotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  rocblas_double_complex* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  rocblas_double_complex* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_zpotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+/********************************************************/
+
 /******************** POSV ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_posv(bool STRIDED,
@@ -3034,16 +4044,102 @@ inline rocblas_status rocsolver_posv(bool STRIDED,
 }
 /********************************************************/
 
-/******************** POTRI ********************/
+/******************** POSV_IRS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_potri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
+inline rocblas_status rocsolver_posv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_dposv_irs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                   iter, info, batch_count);
+    else
+        return rocsolver_dposv_irs(handle, uplo, n, nrhs, A, lda, B, ldb, iter, info);
+}
+
+inline rocblas_status rocsolver_posv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_zposv_irs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                   iter, info, batch_count);
+    else
+        return rocsolver_zposv_irs(handle, uplo, n, nrhs, A, lda, B, ldb, iter, info);
+}
+
+// batched
+inline rocblas_status rocsolver_posv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int batch_count)
+{
+    return rocsolver_dposv_irs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, iter, info,
+                                       batch_count);
+}
+
+inline rocblas_status rocsolver_posv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int batch_count)
+{
+    return rocsolver_zposv_irs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, iter, info,
+                                       batch_count);
+}
+/********************************************************/
+
+/******************** POTRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
                                       rocblas_int batch_count)
 {
     if(STRIDED)
@@ -3745,809 +4841,1072 @@ inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GESVD ********************/
+/******************** GBTRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      float* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      float* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_sgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_sgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    return STRIDED ? rocsolver_sgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP,
+                                                      info, bc)
+                   : rocsolver_sgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      double* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      double* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_dgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_dgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    return STRIDED ? rocsolver_dgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP,
+                                                      info, bc)
+                   : rocsolver_dgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      rocblas_float_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_float_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_cgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_cgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    return STRIDED ? rocsolver_cgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP,
+                                                      info, bc)
+                   : rocsolver_cgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      rocblas_double_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_double_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_zgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_zgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    return STRIDED ? rocsolver_zgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP,
+                                                      info, bc)
+                   : rocsolver_zgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      float* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      float* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_sgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_sgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      double* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      double* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_dgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_dgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      rocblas_float_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_float_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_cgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_cgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
                                       rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
                                       rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      rocblas_double_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_double_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_zgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_zgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** GESVDJ ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
-{
-    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+/******************** GETRF_VBATCHED ********************/
+// vbatched
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+/******************** GETRF_TPVT ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrf_tpvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_sgetrf_tpvt_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                     bc);
+    else
+        return rocsolver_sgetrf_tpvt(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
+inline rocblas_status rocsolver_getrf_tpvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgetrf_tpvt_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                     bc);
+    else
+        return rocsolver_dgetrf_tpvt(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_tpvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgetrf_tpvt_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                     bc);
+    else
+        return rocsolver_cgetrf_tpvt(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_tpvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgetrf_tpvt_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                     bc);
+    else
+        return rocsolver_zgetrf_tpvt(handle, m, n, A, lda, ipiv, info);
+}
+/********************************************************/
+
+/******************** GETRF_INTERLEAVED ********************/
+// interleaved_batched (with and without pivoting)
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  float* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_sgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_sgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  double* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_dgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_dgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_cgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_cgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_zgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_zgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+/********************************************************/
+
+/******************** GETRF_LOGDET ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             float* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgetrf_logdet_strided_batched(handle, n, A, lda, stA, logdet, sign, info,
+                                                       bc);
+    else
+        return rocsolver_sgetrf_logdet(handle, n, A, lda, logdet, sign, info);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             double* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgetrf_logdet_strided_batched(handle, n, A, lda, stA, logdet, sign, info,
+                                                       bc);
+    else
+        return rocsolver_dgetrf_logdet(handle, n, A, lda, logdet, sign, info);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_float_complex* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgetrf_logdet_strided_batched(handle, n, A, lda, stA, logdet, sign, info,
+                                                       bc);
+    else
+        return rocsolver_cgetrf_logdet(handle, n, A, lda, logdet, sign, info);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_double_complex* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgetrf_logdet_strided_batched(handle, n, A, lda, stA, logdet, sign, info,
+                                                       bc);
+    else
+        return rocsolver_zgetrf_logdet(handle, n, A, lda, logdet, sign, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             float* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_sgetrf_logdet_batched(handle, n, A, lda, logdet, sign, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             double* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dgetrf_logdet_batched(handle, n, A, lda, logdet, sign, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_float_complex* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cgetrf_logdet_batched(handle, n, A, lda, logdet, sign, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_double_complex* sign,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zgetrf_logdet_batched(handle, n, A, lda, logdet, sign, info, bc);
+}
+/********************************************************/
+
+/******************** GETDET ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       float* logdet,
+                                       float* sign,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgetdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, logdet, sign,
+                                                 bc);
+    else
+        return rocsolver_sgetdet(handle, n, A, lda, ipiv, logdet, sign);
+}
+
+inline rocblas_status rocsolver_getdet(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       double* logdet,
+                                       double* sign,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgetdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, logdet, sign,
+                                                 bc);
+    else
+        return rocsolver_dgetdet(handle, n, A, lda, ipiv, logdet, sign);
+}
+
+inline rocblas_status rocsolver_getdet(bool STRIDED,
+                                       rocblas_handle handle,
                                        rocblas_int n,
                                        rocblas_float_complex* A,
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       float* logdet,
+                                       rocblas_float_complex* sign,
                                        rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_cgetdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, logdet, sign,
+                                                 bc);
+    else
+        return rocsolver_cgetdet(handle, n, A, lda, ipiv, logdet, sign);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+inline rocblas_status rocsolver_getdet(bool STRIDED,
                                        rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
                                        rocblas_int n,
                                        rocblas_double_complex* A,
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       double* logdet,
+                                       rocblas_double_complex* sign,
                                        rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_zgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_zgetdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, logdet, sign,
+                                                 bc);
+    else
+        return rocsolver_zgetdet(handle, n, A, lda, ipiv, logdet, sign);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+inline rocblas_status rocsolver_getdet(bool STRIDED,
                                        rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
                                        rocblas_int n,
                                        float* const A[],
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       float* logdet,
+                                       float* sign,
                                        rocblas_int bc)
 {
-    return rocsolver_sgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    return rocsolver_sgetdet_batched(handle, n, A, lda, ipiv, stP, logdet, sign, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+inline rocblas_status rocsolver_getdet(bool STRIDED,
                                        rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
                                        rocblas_int n,
                                        double* const A[],
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       double* logdet,
+                                       double* sign,
                                        rocblas_int bc)
 {
-    return rocsolver_dgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    return rocsolver_dgetdet_batched(handle, n, A, lda, ipiv, stP, logdet, sign, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+inline rocblas_status rocsolver_getdet(bool STRIDED,
                                        rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
                                        rocblas_int n,
                                        rocblas_float_complex* const A[],
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       float* logdet,
+                                       rocblas_float_complex* sign,
                                        rocblas_int bc)
 {
-    return rocsolver_cgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    return rocsolver_cgetdet_batched(handle, n, A, lda, ipiv, stP, logdet, sign, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+inline rocblas_status rocsolver_getdet(bool STRIDED,
                                        rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
                                        rocblas_int n,
                                        rocblas_double_complex* const A[],
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
+                                       rocblas_int* ipiv,
+                                       rocblas_stride stP,
+                                       double* logdet,
+                                       rocblas_double_complex* sign,
                                        rocblas_int bc)
 {
-    return rocsolver_zgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    return rocsolver_zgetdet_batched(handle, n, A, lda, ipiv, stP, logdet, sign, bc);
 }
 /********************************************************/
 
-/******************** GESVDJ_NOTRANSV ********************/
+/******************** GECON ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_sgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_sgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_sgecon_strided_batched(handle, norm, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_sgecon(handle, norm, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_dgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_dgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_dgecon_strided_batched(handle, norm, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_dgecon(handle, norm, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_cgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_cgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_cgecon_strided_batched(handle, norm, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_cgecon(handle, norm, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_zgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_zgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_zgecon_strided_batched(handle, norm, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_zgecon(handle, norm, n, A, lda, anorm, rcond);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                float* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocsolver_sgecon_batched(handle, norm, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                double* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocsolver_dgecon_batched(handle, norm, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_float_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocsolver_cgecon_batched(handle, norm, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_double_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocsolver_zgecon_batched(handle, norm, n, A, lda, anorm, rcond, bc);
 }
 /********************************************************/
 
-/******************** GESVDX ********************/
+/******************** GESVD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_sgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED
+        ? rocsolver_sgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_sgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_dgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_cgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_zgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
                                        rocblas_handle handle,
                                        rocblas_svect leftv,
                                        rocblas_svect rightv,
-                                       rocblas_srange srange,
                                        rocblas_int m,
                                        rocblas_int n,
-                                       double* A,
+                                       float* A,
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
                                        rocblas_stride stS,
-                                       double* U,
+                                       float* U,
                                        rocblas_int ldu,
                                        rocblas_stride stU,
-                                       double* V,
+                                       float* V,
                                        rocblas_int ldv,
                                        rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
                                        rocblas_int* info,
                                        rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_dgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
                                        rocblas_handle handle,
                                        rocblas_svect leftv,
                                        rocblas_svect rightv,
-                                       rocblas_srange srange,
                                        rocblas_int m,
                                        rocblas_int n,
                                        rocblas_float_complex* A,
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
                                        float* S,
                                        rocblas_stride stS,
                                        rocblas_float_complex* U,
@@ -4556,33 +5915,148 @@ inline rocblas_status rocsolver_gesvdx(bool STRIDED,
                                        rocblas_float_complex* V,
                                        rocblas_int ldv,
                                        rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
                                        rocblas_int* info,
                                        rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_cgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
                                        rocblas_handle handle,
                                        rocblas_svect leftv,
                                        rocblas_svect rightv,
-                                       rocblas_srange srange,
                                        rocblas_int m,
                                        rocblas_int n,
                                        rocblas_double_complex* A,
                                        rocblas_int lda,
                                        rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_zgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
                                        double* S,
                                        rocblas_stride stS,
                                        rocblas_double_complex* U,
@@ -4591,2049 +6065,4247 @@ inline rocblas_status rocsolver_gesvdx(bool STRIDED,
                                        rocblas_double_complex* V,
                                        rocblas_int ldv,
                                        rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
                                        rocblas_int* info,
                                        rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_zgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return rocsolver_zgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+/********************************************************/
+
+/******************** GESVDJ_NOTRANSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_sgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_dgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_cgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_zgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_sgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_cgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDX ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_sgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_dgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_cgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_zgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDX_NOTRANSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+/********************************************************/
+
+/******************** GETRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_sgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_sgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_dgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_dgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_cgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_cgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_zgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_zgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_sgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_dgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_cgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_zgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GETRS_VBATCHED ********************/
+// vbatched
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               float* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               double* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_float_complex* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_double_complex* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GETRS_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_operation trans,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  float* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  const rocblas_int* ipiv,
+                                                  const rocblas_stride stP,
+                                                  float* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_sgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_operation trans,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  double* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  const rocblas_int* ipiv,
+                                                  const rocblas_stride stP,
+                                                  double* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_dgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_operation trans,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  rocblas_float_complex* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  const rocblas_int* ipiv,
+                                                  const rocblas_stride stP,
+                                                  rocblas_float_complex* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_cgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  const rocblas_operation trans,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  rocblas_double_complex* A,
+                                                  const rocblas_int inca,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride stA,
+                                                  const rocblas_int* ipiv,
+                                                  const rocblas_stride stP,
+                                                  rocblas_double_complex* B,
+                                                  const rocblas_int incb,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride stB,
+                                                  const rocblas_int bc)
+{
+    return rocsolver_zgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+/********************************************************/
+
+/******************** GBTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA,
+                                                      ipiv, stP, B, ldb, stB, bc)
+                   : rocsolver_sgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA,
+                                                      ipiv, stP, B, ldb, stB, bc)
+                   : rocsolver_dgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA,
+                                                      ipiv, stP, B, ldb, stB, bc)
+                   : rocsolver_cgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA,
+                                                      ipiv, stP, B, ldb, stB, bc)
+                   : rocsolver_zgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GTSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gtsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* dl,
+                                     float* d,
+                                     float* du,
+                                     rocblas_stride stD,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgtsv_strided_batched(handle, n, nrhs, dl, d, du, stD, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_sgtsv(handle, n, nrhs, dl, d, du, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gtsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* dl,
+                                     double* d,
+                                     double* du,
+                                     rocblas_stride stD,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgtsv_strided_batched(handle, n, nrhs, dl, d, du, stD, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_dgtsv(handle, n, nrhs, dl, d, du, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gtsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* dl,
+                                     rocblas_float_complex* d,
+                                     rocblas_float_complex* du,
+                                     rocblas_stride stD,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgtsv_strided_batched(handle, n, nrhs, dl, d, du, stD, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_cgtsv(handle, n, nrhs, dl, d, du, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gtsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* dl,
+                                     rocblas_double_complex* d,
+                                     rocblas_double_complex* du,
+                                     rocblas_stride stD,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgtsv_strided_batched(handle, n, nrhs, dl, d, du, stD, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_zgtsv(handle, n, nrhs, dl, d, du, B, ldb, info);
+}
+
+// interleaved_batched
+inline rocblas_status rocsolver_gtsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 float* dl,
+                                                 float* d,
+                                                 float* du,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 float* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgtsv_interleaved_batched(handle, n, nrhs, dl, d, du, incd, stD, B, incb, ldb,
+                                               stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 double* dl,
+                                                 double* d,
+                                                 double* du,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 double* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgtsv_interleaved_batched(handle, n, nrhs, dl, d, du, incd, stD, B, incb, ldb,
+                                               stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_float_complex* dl,
+                                                 rocblas_float_complex* d,
+                                                 rocblas_float_complex* du,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 rocblas_float_complex* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgtsv_interleaved_batched(handle, n, nrhs, dl, d, du, incd, stD, B, incb, ldb,
+                                               stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* dl,
+                                                 rocblas_double_complex* d,
+                                                 rocblas_double_complex* du,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zgtsv_interleaved_batched(handle, n, nrhs, dl, d, du, incd, stD, B, incb, ldb,
+                                               stB, info, bc);
+}
+/********************************************************/
+
+/******************** PTSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_ptsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* D,
+                                     rocblas_stride stD,
+                                     float* E,
+                                     rocblas_stride stE,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_sptsv(handle, n, nrhs, D, E, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_ptsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* D,
+                                     rocblas_stride stD,
+                                     double* E,
+                                     rocblas_stride stE,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_dptsv(handle, n, nrhs, D, E, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_ptsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* D,
+                                     rocblas_stride stD,
+                                     rocblas_float_complex* E,
+                                     rocblas_stride stE,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_cptsv(handle, n, nrhs, D, E, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_ptsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* D,
+                                     rocblas_stride stD,
+                                     rocblas_double_complex* E,
+                                     rocblas_stride stE,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+    else
+        return rocsolver_zptsv(handle, n, nrhs, D, E, B, ldb, info);
+}
+
+// interleaved_batched
+inline rocblas_status rocsolver_ptsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 float* D,
+                                                 float* E,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 float* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sptsv_interleaved_batched(handle, n, nrhs, D, E, incd, stD, B, incb, ldb, stB,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_ptsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 double* D,
+                                                 double* E,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 double* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dptsv_interleaved_batched(handle, n, nrhs, D, E, incd, stD, B, incb, ldb, stB,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_ptsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 float* D,
+                                                 rocblas_float_complex* E,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 rocblas_float_complex* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cptsv_interleaved_batched(handle, n, nrhs, D, E, incd, stD, B, incb, ldb, stB,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_ptsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 double* D,
+                                                 rocblas_double_complex* E,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zptsv_interleaved_batched(handle, n, nrhs, D, E, incd, stD, B, incb, ldb, stB,
+                                               info, bc);
+}
+/********************************************************/
+
+/******************** GPSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gpsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* ds,
+                                     float* dl,
+                                     float* d,
+                                     float* du,
+                                     float* dw,
+                                     rocblas_stride stD,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgpsv_strided_batched(handle, n, nrhs, ds, dl, d, du, dw, stD, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_sgpsv(handle, n, nrhs, ds, dl, d, du, dw, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gpsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* ds,
+                                     double* dl,
+                                     double* d,
+                                     double* du,
+                                     double* dw,
+                                     rocblas_stride stD,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgpsv_strided_batched(handle, n, nrhs, ds, dl, d, du, dw, stD, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_dgpsv(handle, n, nrhs, ds, dl, d, du, dw, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gpsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* ds,
+                                     rocblas_float_complex* dl,
+                                     rocblas_float_complex* d,
+                                     rocblas_float_complex* du,
+                                     rocblas_float_complex* dw,
+                                     rocblas_stride stD,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgpsv_strided_batched(handle, n, nrhs, ds, dl, d, du, dw, stD, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_cgpsv(handle, n, nrhs, ds, dl, d, du, dw, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gpsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* ds,
+                                     rocblas_double_complex* dl,
+                                     rocblas_double_complex* d,
+                                     rocblas_double_complex* du,
+                                     rocblas_double_complex* dw,
+                                     rocblas_stride stD,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgpsv_strided_batched(handle, n, nrhs, ds, dl, d, du, dw, stD, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_zgpsv(handle, n, nrhs, ds, dl, d, du, dw, B, ldb, info);
+}
+
+// interleaved_batched
+inline rocblas_status rocsolver_gpsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 float* ds,
+                                                 float* dl,
+                                                 float* d,
+                                                 float* du,
+                                                 float* dw,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 float* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgpsv_interleaved_batched(handle, n, nrhs, ds, dl, d, du, dw, incd, stD, B,
+                                               incb, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 double* ds,
+                                                 double* dl,
+                                                 double* d,
+                                                 double* du,
+                                                 double* dw,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 double* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgpsv_interleaved_batched(handle, n, nrhs, ds, dl, d, du, dw, incd, stD, B,
+                                               incb, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_float_complex* ds,
+                                                 rocblas_float_complex* dl,
+                                                 rocblas_float_complex* d,
+                                                 rocblas_float_complex* du,
+                                                 rocblas_float_complex* dw,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 rocblas_float_complex* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgpsv_interleaved_batched(handle, n, nrhs, ds, dl, d, du, dw, incd, stD, B,
+                                               incb, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv_interleaved(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* ds,
+                                                 rocblas_double_complex* dl,
+                                                 rocblas_double_complex* d,
+                                                 rocblas_double_complex* du,
+                                                 rocblas_double_complex* dw,
+                                                 rocblas_int incd,
+                                                 rocblas_stride stD,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int incb,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zgpsv_interleaved_batched(handle, n, nrhs, ds, dl, d, du, dw, incd, stD, B,
+                                               incb, ldb, stB, info, bc);
+}
+/********************************************************/
+
+/******************** GESV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_cgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_zgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-// batched
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocsolver_sgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+/******************** GESV_IRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         double* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
 {
-    return rocsolver_dgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return STRIDED ? rocsolver_dgesv_irs_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                         ldb, stB, iter, info, bc)
+                   : rocsolver_dgesv_irs(handle, n, nrhs, A, lda, ipiv, B, ldb, iter, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_float_complex* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
 {
-    return rocsolver_cgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return STRIDED ? rocsolver_zgesv_irs_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                         ldb, stB, iter, info, bc)
+                   : rocsolver_zgesv_irs(handle, n, nrhs, A, lda, ipiv, B, ldb, iter, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_double_complex* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
-{
-    return rocsolver_zgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+// batched
+inline rocblas_status rocsolver_gesv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         double* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_dgesv_irs_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, iter, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_irs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_double_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* iter,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_zgesv_irs_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, iter, info, bc);
 }
 /********************************************************/
 
-/******************** GESVDX_NOTRANSV ********************/
+/******************** GESV_OUTOFPLACE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 float* A,
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                float* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_sgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+        ? rocblas_status_not_implemented // rocsolver_sgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_sgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 double* A,
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                double* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_dgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+        ? rocblas_status_not_implemented // rocsolver_dgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_float_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_cgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+        ? rocblas_status_not_implemented // rocsolver_cgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_cgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 rocblas_double_complex* A,
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_double_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_zgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+        ? rocblas_status_not_implemented // rocsolver_zgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_zgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 float* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                float* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_sgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 double* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                double* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_dgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 rocblas_float_complex* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_float_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_cgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 rocblas_double_complex* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_double_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_zgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GESVX ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocsolver_equed* equed,
+                                      float* R,
+                                      rocblas_stride stR,
+                                      float* C,
+                                      rocblas_stride stC,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* rcond,
+                                      float* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgesvx_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, equed, R, stR, C, stC, B, ldb, stB, X,
+                                                ldx, stX, rcond, berr, stBerr, info, bc);
+    else
+        return rocsolver_sgesvx(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, equed, R, C, B, ldb,
+                                X, ldx, rcond, berr, info);
+}
+
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocsolver_equed* equed,
+                                      double* R,
+                                      rocblas_stride stR,
+                                      double* C,
+                                      rocblas_stride stC,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* rcond,
+                                      double* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgesvx_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, equed, R, stR, C, stC, B, ldb, stB, X,
+                                                ldx, stX, rcond, berr, stBerr, info, bc);
+    else
+        return rocsolver_dgesvx(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, equed, R, C, B, ldb,
+                                X, ldx, rcond, berr, info);
+}
+
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocsolver_equed* equed,
+                                      float* R,
+                                      rocblas_stride stR,
+                                      float* C,
+                                      rocblas_stride stC,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* rcond,
+                                      float* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgesvx_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, equed, R, stR, C, stC, B, ldb, stB, X,
+                                                ldx, stX, rcond, berr, stBerr, info, bc);
+    else
+        return rocsolver_cgesvx(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, equed, R, C, B, ldb,
+                                X, ldx, rcond, berr, info);
 }
-/********************************************************/
 
-/******************** GETRS ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_operation trans,
                                       rocblas_int n,
                                       rocblas_int nrhs,
-                                      float* A,
+                                      rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_double_complex* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      float* B,
+                                      rocsolver_equed* equed,
+                                      double* R,
+                                      rocblas_stride stR,
+                                      double* C,
+                                      rocblas_stride stC,
+                                      rocblas_double_complex* B,
                                       rocblas_int ldb,
                                       rocblas_stride stB,
+                                      rocblas_double_complex* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* rcond,
+                                      double* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    if(STRIDED)
+        return rocsolver_zgesvx_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, equed, R, stR, C, stC, B, ldb, stB, X,
+                                                ldx, stX, rcond, berr, stBerr, info, bc);
+    else
+        return rocsolver_zgesvx(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, equed, R, C, B, ldb,
+                                X, ldx, rcond, berr, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+// batched
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_operation trans,
                                       rocblas_int n,
                                       rocblas_int nrhs,
-                                      double* A,
+                                      float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      float* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      double* B,
+                                      rocsolver_equed* equed,
+                                      float* R,
+                                      rocblas_stride stR,
+                                      float* C,
+                                      rocblas_stride stC,
+                                      float* const B[],
                                       rocblas_int ldb,
                                       rocblas_stride stB,
+                                      float* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* rcond,
+                                      float* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_sgesvx_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, equed, R,
+                                    stR, C, stC, B, ldb, X, ldx, rcond, berr, stBerr, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_operation trans,
                                       rocblas_int n,
                                       rocblas_int nrhs,
-                                      rocblas_float_complex* A,
+                                      double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      double* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      rocblas_float_complex* B,
+                                      rocsolver_equed* equed,
+                                      double* R,
+                                      rocblas_stride stR,
+                                      double* C,
+                                      rocblas_stride stC,
+                                      double* const B[],
                                       rocblas_int ldb,
                                       rocblas_stride stB,
+                                      double* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* rcond,
+                                      double* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_dgesvx_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, equed, R,
+                                    stR, C, stC, B, ldb, X, ldx, rcond, berr, stBerr, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_operation trans,
                                       rocblas_int n,
                                       rocblas_int nrhs,
-                                      rocblas_double_complex* A,
+                                      rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
+                                      rocblas_float_complex* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      rocblas_double_complex* B,
+                                      rocsolver_equed* equed,
+                                      float* R,
+                                      rocblas_stride stR,
+                                      float* C,
+                                      rocblas_stride stC,
+                                      rocblas_float_complex* const B[],
                                       rocblas_int ldb,
                                       rocblas_stride stB,
+                                      rocblas_float_complex* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* rcond,
+                                      float* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_cgesvx_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, equed, R,
+                                    stR, C, stC, B, ldb, X, ldx, rcond, berr, stBerr, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_gesvx(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      float* A,
-                                      int64_t lda,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
                                       rocblas_stride stA,
-                                      int64_t* ipiv,
+                                      rocblas_double_complex* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      float* B,
-                                      int64_t ldb,
+                                      rocsolver_equed* equed,
+                                      double* R,
+                                      rocblas_stride stR,
+                                      double* C,
+                                      rocblas_stride stC,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
                                       rocblas_stride stB,
-                                      int64_t bc)
+                                      rocblas_double_complex* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* rcond,
+                                      double* berr,
+                                      rocblas_stride stBerr,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_sgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_zgesvx_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, equed, R,
+                                    stR, C, stC, B, ldb, X, ldx, rcond, berr, stBerr, info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      double* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      double* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+/******************** GETRI_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_dgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      rocblas_float_complex* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_cgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      rocblas_double_complex* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_float_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_cgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_zgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_float_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_double_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_zgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_zgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
 }
+/********************************************************/
 
-// batched
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      float* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      float* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+/******************** GETRI_NPVT_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      float* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      float* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_sgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_sgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_sgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      double* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      double* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      double* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      double* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_dgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_dgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_dgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_float_complex* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_float_complex* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_cgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_cgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_cgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_double_complex* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_double_complex* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_zgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_zgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_zgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      float* const A[],
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      float* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+// batched
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      float* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      float* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_sgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_sgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      double* const A[],
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      double* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      double* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      double* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_dgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_dgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      rocblas_float_complex* const A[],
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_float_complex* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_float_complex* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_cgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_cgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      rocblas_double_complex* const A[],
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_double_complex* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_double_complex* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_zgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_zgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 /********************************************************/
 
-/******************** GESV ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+/******************** GETRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_cgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_zgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** GESV_OUTOFPLACE ********************/
+/******************** GETRI_NPVT ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                float* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_sgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_sgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
-}
-
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                double* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+    return STRIDED ? rocsolver_sgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_sgetri_npvt(handle, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_dgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return STRIDED ? rocsolver_dgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_dgetri_npvt(handle, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_float_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_cgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_cgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return STRIDED ? rocsolver_cgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_cgetri_npvt(handle, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_double_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_zgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_zgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return STRIDED ? rocsolver_zgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_zgetri_npvt(handle, n, A, lda, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                float* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           float* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_sgetri_npvt_batched(handle, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                double* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_dgetri_npvt_batched(handle, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_float_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_float_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_cgetri_npvt_batched(handle, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_double_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_zgetri_npvt_batched(handle, n, A, lda, info, bc);
 }
 /********************************************************/
 
-/******************** GETRI_OUTOFPLACE ********************/
+/******************** TRTRI ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
-{
-    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
-}
-
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_float_complex* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_cgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_double_complex* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_zgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
 }
 
 // batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_sgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_float_complex* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_double_complex* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
 /********************************************************/
 
-/******************** GETRI_NPVT_OUTOFPLACE ********************/
+/******************** GEQR2_GEQRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      float* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      float* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_sgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    if(STRIDED)
+        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      double* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      double* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_dgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    if(STRIDED)
+        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_float_complex* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_float_complex* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_cgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
-}
-
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_double_complex* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_double_complex* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+    if(STRIDED)
+        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_zgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    if(STRIDED)
+        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
 }
 
 // batched
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      float* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      float* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_sgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return GEQRF ? rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      double* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      double* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_dgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return GEQRF ? rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_float_complex* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_float_complex* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_cgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return GEQRF ? rocsolver_cgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_double_complex* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_double_complex* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_zgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return GEQRF ? rocsolver_zgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
-/********************************************************/
 
-/******************** GETRI ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+// ptr_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
+    return GEQRF ? rocsolver_sgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
+    return GEQRF ? rocsolver_dgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
+    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
+    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 
-// batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      float* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+// normal and strided_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            float* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return GEQRF ? rocsolver_sgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_sgeqrf_64(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeqr2_64(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      double* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            double* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return GEQRF ? rocsolver_dgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_dgeqrf_64(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeqr2_64(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return GEQRF ? rocsolver_cgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_cgeqrf_64(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeqr2_64(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_double_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return GEQRF ? rocsolver_zgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_zgeqrf_64(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeqr2_64(handle, m, n, A, lda, ipiv);
 }
-/********************************************************/
 
-/******************** GETRI_NPVT ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           float* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            float* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return STRIDED ? rocsolver_sgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_sgetri_npvt(handle, n, A, lda, info);
+    return GEQRF ? rocsolver_sgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           double* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            double* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return STRIDED ? rocsolver_dgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_dgetri_npvt(handle, n, A, lda, info);
+    return GEQRF ? rocsolver_dgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_float_complex* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_float_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return STRIDED ? rocsolver_cgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_cgetri_npvt(handle, n, A, lda, info);
+    return GEQRF ? rocsolver_cgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_double_complex* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_double_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
 {
-    return STRIDED ? rocsolver_zgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_zgetri_npvt(handle, n, A, lda, info);
+    return GEQRF ? rocsolver_zgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
 }
+/********************************************************/
 
-// batched
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           float* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+/******************** GEQRF_VBATCHED ********************/
+// vbatched
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               float* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
 {
-    return rocsolver_sgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return rocsolver_sgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           double* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               double* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
 {
-    return rocsolver_dgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return rocsolver_dgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_float_complex* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_float_complex* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
 {
-    return rocsolver_cgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return rocsolver_cgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_double_complex* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_double_complex* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
 {
-    return rocsolver_zgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return rocsolver_zgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 /********************************************************/
 
-/******************** TRTRI ********************/
+/******************** GEQP3 ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
+    if(STRIDED)
+        return rocsolver_sgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
+    if(STRIDED)
+        return rocsolver_dgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
+    if(STRIDED)
+        return rocsolver_cgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_cgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
+    if(STRIDED)
+        return rocsolver_zgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_zgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
 // batched
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_sgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_dgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_cgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
+                                      rocblas_int m,
                                       rocblas_int n,
                                       rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
                                       rocblas_int bc)
 {
-    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_zgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
-/********************************************************/
-
-/******************** GEQR2_GEQRF ********************/
+/******************** QRINR_QRDER ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
+                                            float* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            float* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            float* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    if(STRIDED && INSERT)
+        return rocsolver_sqrinr_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_sqrder_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_sqrinr(handle, m, n, Q, ldq, R, ldr, j, x, incx);
     else
-        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_sqrder(handle, m, n, Q, ldq, R, ldr, j);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
+                                            double* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            double* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            double* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    if(STRIDED && INSERT)
+        return rocsolver_dqrinr_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_dqrder_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_dqrinr(handle, m, n, Q, ldq, R, ldr, j, x, incx);
     else
-        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_dqrder(handle, m, n, Q, ldq, R, ldr, j);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_float_complex* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_float_complex* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    if(STRIDED && INSERT)
+        return rocsolver_cqrinr_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_cqrder_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_cqrinr(handle, m, n, Q, ldq, R, ldr, j, x, incx);
     else
-        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_cqrder(handle, m, n, Q, ldq, R, ldr, j);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_double_complex* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_double_complex* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    if(STRIDED && INSERT)
+        return rocsolver_zqrinr_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_zqrder_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_zqrinr(handle, m, n, Q, ldq, R, ldr, j, x, incx);
     else
-        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_zqrder(handle, m, n, Q, ldq, R, ldr, j);
 }
 
 // batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
+                                            float* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            float* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            float* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_sqrinr_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_sqrder_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
+                                            double* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            double* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            double* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_dqrinr_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_dqrder_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_float_complex* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_float_complex* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_cgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_cqrinr_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_cqrder_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinr_qrder(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_double_complex* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_double_complex* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_zqrinr_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_zqrder_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-// ptr_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+/******************** QRINC_QRDEC ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* const ipiv[],
-                                            rocblas_stride stP,
+                                            float* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            float* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            float* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_sgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    if(STRIDED && INSERT)
+        return rocsolver_sqrinc_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_sqrdec_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_sqrinc(handle, m, n, Q, ldq, R, ldr, j, x, incx);
+    else
+        return rocsolver_sqrdec(handle, m, n, Q, ldq, R, ldr, j);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* const ipiv[],
-                                            rocblas_stride stP,
+                                            double* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            double* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            double* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_dgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    if(STRIDED && INSERT)
+        return rocsolver_dqrinc_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_dqrdec_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_dqrinc(handle, m, n, Q, ldq, R, ldr, j, x, incx);
+    else
+        return rocsolver_dqrdec(handle, m, n, Q, ldq, R, ldr, j);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* const ipiv[],
-                                            rocblas_stride stP,
+                                            rocblas_float_complex* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_float_complex* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    if(STRIDED && INSERT)
+        return rocsolver_cqrinc_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_cqrdec_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_cqrinc(handle, m, n, Q, ldq, R, ldr, j, x, incx);
+    else
+        return rocsolver_cqrdec(handle, m, n, Q, ldq, R, ldr, j);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* const ipiv[],
-                                            rocblas_stride stP,
+                                            rocblas_double_complex* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* R,
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_double_complex* x,
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
-}
-
-// normal and strided_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            float* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
-{
-    if(STRIDED)
-        return GEQRF ? rocsolver_sgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GEQRF ? rocsolver_sgeqrf_64(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeqr2_64(handle, m, n, A, lda, ipiv);
-}
-
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            double* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
-{
-    if(STRIDED)
-        return GEQRF ? rocsolver_dgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GEQRF ? rocsolver_dgeqrf_64(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeqr2_64(handle, m, n, A, lda, ipiv);
-}
-
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_float_complex* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
-{
-    if(STRIDED)
-        return GEQRF ? rocsolver_cgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GEQRF ? rocsolver_cgeqrf_64(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeqr2_64(handle, m, n, A, lda, ipiv);
-}
-
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_double_complex* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
-{
-    if(STRIDED)
-        return GEQRF ? rocsolver_zgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeqr2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    if(STRIDED && INSERT)
+        return rocsolver_zqrinc_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, x, incx,
+                                                stx, bc);
+    else if(STRIDED)
+        return rocsolver_zqrdec_strided_batched(handle, m, n, Q, ldq, stQ, R, ldr, stR, j, bc);
+    else if(INSERT)
+        return rocsolver_zqrinc(handle, m, n, Q, ldq, R, ldr, j, x, incx);
     else
-        return GEQRF ? rocsolver_zgeqrf_64(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeqr2_64(handle, m, n, A, lda, ipiv);
+        return rocsolver_zqrdec(handle, m, n, Q, ldq, R, ldr, j);
 }
 
 // batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            float* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            float* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            float* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
+                                            rocblas_int bc)
 {
-    return GEQRF ? rocsolver_sgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_sqrinc_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_sqrdec_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            double* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            double* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            double* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
+                                            rocblas_int bc)
 {
-    return GEQRF ? rocsolver_dgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_dqrinc_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_dqrdec_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_float_complex* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_float_complex* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
+                                            rocblas_int bc)
 {
-    return GEQRF ? rocsolver_cgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_cqrinc_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_cqrdec_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_qrinc_qrdec(bool STRIDED,
+                                            bool INSERT,
                                             rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_double_complex* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t bc)
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* const R[],
+                                            rocblas_int ldr,
+                                            rocblas_stride stR,
+                                            rocblas_int j,
+                                            rocblas_double_complex* const x[],
+                                            rocblas_int incx,
+                                            rocblas_stride stx,
+                                            rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeqr2_batched_64(handle, m, n, A, lda, ipiv, stP, bc);
+    if(INSERT)
+        return rocsolver_zqrinc_batched(handle, m, n, Q, ldq, R, ldr, j, x, incx, bc);
+    else
+        return rocsolver_zqrdec_batched(handle, m, n, Q, ldq, R, ldr, j, bc);
 }
+
 /********************************************************/
 
 /******************** GERQ2_GERQF ********************/
@@ -7141,106 +10813,341 @@ inline rocblas_status rocsolver_gels(bool STRIDED,
                                      rocblas_int* info,
                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    if(STRIDED)
+        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GELS_MODE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgels_mode_strided_batched(handle, mode, trans, m, n, nrhs, A, lda, stA, B,
+                                                    ldb, stB, info, bc);
+    else
+        return rocsolver_sgels_mode(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgels_mode_strided_batched(handle, mode, trans, m, n, nrhs, A, lda, stA, B,
+                                                    ldb, stB, info, bc);
+    else
+        return rocsolver_dgels_mode(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_float_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgels_mode_strided_batched(handle, mode, trans, m, n, nrhs, A, lda, stA, B,
+                                                    ldb, stB, info, bc);
+    else
+        return rocsolver_cgels_mode(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_double_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_mode_strided_batched(handle, mode, trans, m, n, nrhs, A, lda, stA, B,
+                                                    ldb, stB, info, bc);
+    else
+        return rocsolver_zgels_mode(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_sgels_mode_batched(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_dgels_mode_batched(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_float_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    return rocsolver_cgels_mode_batched(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-// batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gels_mode(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocsolver_lsq_mode mode,
+                                          rocblas_operation trans,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_double_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_zgels_mode_batched(handle, mode, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+/******************** GELS_VBATCHED ********************/
+// vbatched
+inline rocblas_status rocsolver_gels_vbatched(rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const rocblas_int* nrhs,
+                                              float* const A[],
+                                              const rocblas_int* lda,
+                                              float* const B[],
+                                              const rocblas_int* ldb,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_sgels_vbatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gels_vbatched(rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const rocblas_int* nrhs,
+                                              double* const A[],
+                                              const rocblas_int* lda,
+                                              double* const B[],
+                                              const rocblas_int* ldb,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_dgels_vbatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gels_vbatched(rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const rocblas_int* nrhs,
+                                              rocblas_float_complex* const A[],
+                                              const rocblas_int* lda,
+                                              rocblas_float_complex* const B[],
+                                              const rocblas_int* ldb,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_cgels_vbatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_vbatched(rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const rocblas_int* nrhs,
+                                              rocblas_double_complex* const A[],
+                                              const rocblas_int* lda,
+                                              rocblas_double_complex* const B[],
+                                              const rocblas_int* ldb,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    return rocsolver_zgels_vbatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 /********************************************************/
 
@@ -7361,70 +11268,250 @@ inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_sgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_float_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_cgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_double_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+/********************************************************/
+
+/******************** GELSY ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_sgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_dgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_cgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_zgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return rocsolver_sgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_float_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return rocsolver_dgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_double_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return rocsolver_cgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 /********************************************************/
 
@@ -11602,6 +15689,1918 @@ inline rocblas_status rocsolver_geblttrs_npvt_interleaved(rocblas_handle handle,
 }
 /********************************************************/
 
+/******************** GEBLTTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         float* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         float* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         float* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeblttrf_strided_batched(handle, nb, nblocks, A, lda, stA, B, ldb, stB, C,
+                                                   ldc, stC, D, ldd, stD, ipiv, stP, info, bc);
+    else
+        return rocsolver_sgeblttrf(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         double* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         double* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         double* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeblttrf_strided_batched(handle, nb, nblocks, A, lda, stA, B, ldb, stB, C,
+                                                   ldc, stC, D, ldd, stD, ipiv, stP, info, bc);
+    else
+        return rocsolver_dgeblttrf(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_float_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_float_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_float_complex* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_float_complex* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeblttrf_strided_batched(handle, nb, nblocks, A, lda, stA, B, ldb, stB, C,
+                                                   ldc, stC, D, ldd, stD, ipiv, stP, info, bc);
+    else
+        return rocsolver_cgeblttrf(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_double_complex* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_double_complex* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeblttrf_strided_batched(handle, nb, nblocks, A, lda, stA, B, ldb, stB, C,
+                                                   ldc, stC, D, ldd, stD, ipiv, stP, info, bc);
+    else
+        return rocsolver_zgeblttrf(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         float* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         float* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         float* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_sgeblttrf_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                       stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         double* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         double* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         double* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_dgeblttrf_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                       stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_float_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_float_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_float_complex* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_float_complex* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_cgeblttrf_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                       stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_double_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_double_complex* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_double_complex* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_zgeblttrf_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                       stP, info, bc);
+}
+
+/******************** GEBLTTRF_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_geblttrf_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     float* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     float* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     float* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_sgeblttrf_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA, B, incb,
+                                                   ldb, stB, C, incc, ldc, stC, D, incd, ldd, stD,
+                                                   ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     double* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     double* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     double* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_dgeblttrf_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA, B, incb,
+                                                   ldb, stB, C, incc, ldc, stC, D, incd, ldd, stD,
+                                                   ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_float_complex* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     rocblas_float_complex* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     rocblas_float_complex* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_cgeblttrf_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA, B, incb,
+                                                   ldb, stB, C, incc, ldc, stC, D, incd, ldd, stD,
+                                                   ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_double_complex* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     rocblas_double_complex* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     rocblas_double_complex* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_zgeblttrf_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA, B, incb,
+                                                   ldb, stB, C, incc, ldc, stC, D, incd, ldd, stD,
+                                                   ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         float* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         float* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         float* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         float* X,
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeblttrs_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA, B, ldb,
+                                                   stB, C, ldc, stC, D, ldd, stD, ipiv, stP, X, ldx,
+                                                   stX, bc);
+    else
+        return rocsolver_sgeblttrs(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                   X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         double* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         double* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         double* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         double* X,
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeblttrs_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA, B, ldb,
+                                                   stB, C, ldc, stC, D, ldd, stD, ipiv, stP, X, ldx,
+                                                   stX, bc);
+    else
+        return rocsolver_dgeblttrs(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                   X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         rocblas_float_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_float_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_float_complex* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_float_complex* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_float_complex* X,
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeblttrs_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA, B, ldb,
+                                                   stB, C, ldc, stC, D, ldd, stD, ipiv, stP, X, ldx,
+                                                   stX, bc);
+    else
+        return rocsolver_cgeblttrs(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                   X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_double_complex* C,
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_double_complex* D,
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_double_complex* X,
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeblttrs_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA, B, ldb,
+                                                   stB, C, ldc, stC, D, ldd, stD, ipiv, stP, X, ldx,
+                                                   stX, bc);
+    else
+        return rocsolver_zgeblttrs(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd, ipiv,
+                                   X, ldx);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         float* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         float* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         float* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         float* const X[],
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    return rocsolver_sgeblttrs_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd,
+                                       ipiv, stP, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         double* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         double* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         double* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         double* const X[],
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    return rocsolver_dgeblttrs_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd,
+                                       ipiv, stP, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         rocblas_float_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_float_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_float_complex* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_float_complex* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_float_complex* const X[],
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    return rocsolver_cgeblttrs_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd,
+                                       ipiv, stP, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int nb,
+                                         rocblas_int nblocks,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_double_complex* const C[],
+                                         rocblas_int ldc,
+                                         rocblas_stride stC,
+                                         rocblas_double_complex* const D[],
+                                         rocblas_int ldd,
+                                         rocblas_stride stD,
+                                         const rocblas_int* ipiv,
+                                         rocblas_stride stP,
+                                         rocblas_double_complex* const X[],
+                                         rocblas_int ldx,
+                                         rocblas_stride stX,
+                                         rocblas_int bc)
+{
+    return rocsolver_zgeblttrs_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D, ldd,
+                                       ipiv, stP, X, ldx, bc);
+}
+
+/******************** GEBLTTRS_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_geblttrs_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     rocblas_int nrhs,
+                                                     float* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     float* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     float* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     const rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     float* X,
+                                                     rocblas_int incx,
+                                                     rocblas_int ldx,
+                                                     rocblas_stride stX,
+                                                     rocblas_int bc)
+{
+    return rocsolver_sgeblttrs_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda, stA, B,
+                                                   incb, ldb, stB, C, incc, ldc, stC, D, incd, ldd,
+                                                   stD, ipiv, stP, X, incx, ldx, stX, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     rocblas_int nrhs,
+                                                     double* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     double* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     double* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     const rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     double* X,
+                                                     rocblas_int incx,
+                                                     rocblas_int ldx,
+                                                     rocblas_stride stX,
+                                                     rocblas_int bc)
+{
+    return rocsolver_dgeblttrs_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda, stA, B,
+                                                   incb, ldb, stB, C, incc, ldc, stC, D, incd, ldd,
+                                                   stD, ipiv, stP, X, incx, ldx, stX, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     rocblas_int nrhs,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_float_complex* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     rocblas_float_complex* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     rocblas_float_complex* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     const rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_float_complex* X,
+                                                     rocblas_int incx,
+                                                     rocblas_int ldx,
+                                                     rocblas_stride stX,
+                                                     rocblas_int bc)
+{
+    return rocsolver_cgeblttrs_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda, stA, B,
+                                                   incb, ldb, stB, C, incc, ldc, stC, D, incd, ldd,
+                                                   stD, ipiv, stP, X, incx, ldx, stX, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_interleaved(rocblas_handle handle,
+                                                     rocblas_int nb,
+                                                     rocblas_int nblocks,
+                                                     rocblas_int nrhs,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int inca,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_double_complex* B,
+                                                     rocblas_int incb,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     rocblas_double_complex* C,
+                                                     rocblas_int incc,
+                                                     rocblas_int ldc,
+                                                     rocblas_stride stC,
+                                                     rocblas_double_complex* D,
+                                                     rocblas_int incd,
+                                                     rocblas_int ldd,
+                                                     rocblas_stride stD,
+                                                     const rocblas_int* ipiv,
+                                                     rocblas_stride stP,
+                                                     rocblas_double_complex* X,
+                                                     rocblas_int incx,
+                                                     rocblas_int ldx,
+                                                     rocblas_stride stX,
+                                                     rocblas_int bc)
+{
+    return rocsolver_zgeblttrs_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda, stA, B,
+                                                   incb, ldb, stB, C, incc, ldc, stC, D, incd, ldd,
+                                                   stD, ipiv, stP, X, incx, ldx, stX, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRF_PERIODIC ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeblttrf_periodic_strided_batched(handle, nb, nblocks, A, lda, stA, B,
+                                                            ldb, stB, C, ldc, stC, D, ldd, stD, E,
+                                                            lde, stE, ipiv, stP, info, bc);
+    else
+        return rocsolver_sgeblttrf_periodic(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E,
+                                            lde, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  double* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeblttrf_periodic_strided_batched(handle, nb, nblocks, A, lda, stA, B,
+                                                            ldb, stB, C, ldc, stC, D, ldd, stD, E,
+                                                            lde, stE, ipiv, stP, info, bc);
+    else
+        return rocsolver_dgeblttrf_periodic(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E,
+                                            lde, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeblttrf_periodic_strided_batched(handle, nb, nblocks, A, lda, stA, B,
+                                                            ldb, stB, C, ldc, stC, D, ldd, stD, E,
+                                                            lde, stE, ipiv, stP, info, bc);
+    else
+        return rocsolver_cgeblttrf_periodic(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E,
+                                            lde, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeblttrf_periodic_strided_batched(handle, nb, nblocks, A, lda, stA, B,
+                                                            ldb, stB, C, ldc, stC, D, ldd, stD, E,
+                                                            lde, stE, ipiv, stP, info, bc);
+    else
+        return rocsolver_zgeblttrf_periodic(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E,
+                                            lde, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  float* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_sgeblttrf_periodic_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd,
+                                                E, lde, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  double* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dgeblttrf_periodic_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd,
+                                                E, lde, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_float_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cgeblttrf_periodic_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd,
+                                                E, lde, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_double_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zgeblttrf_periodic_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd,
+                                                E, lde, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRS_PERIODIC ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  float* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeblttrs_periodic_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, ipiv, stP, X, ldx, stX,
+                                                            bc);
+    else
+        return rocsolver_sgeblttrs_periodic(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, ipiv, X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  double* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  double* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeblttrs_periodic_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, ipiv, stP, X, ldx, stX,
+                                                            bc);
+    else
+        return rocsolver_dgeblttrs_periodic(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, ipiv, X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_float_complex* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeblttrs_periodic_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, ipiv, stP, X, ldx, stX,
+                                                            bc);
+    else
+        return rocsolver_cgeblttrs_periodic(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, ipiv, X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_double_complex* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeblttrs_periodic_strided_batched(handle, nb, nblocks, nrhs, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, ipiv, stP, X, ldx, stX,
+                                                            bc);
+    else
+        return rocsolver_zgeblttrs_periodic(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, ipiv, X, ldx);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  float* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  float* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    return rocsolver_sgeblttrs_periodic_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                D, ldd, E, lde, ipiv, stP, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  double* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  double* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dgeblttrs_periodic_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                D, ldd, E, lde, ipiv, stP, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  rocblas_float_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_float_complex* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cgeblttrs_periodic_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                D, ldd, E, lde, ipiv, stP, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_periodic(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nrhs,
+                                                  rocblas_double_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_double_complex* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zgeblttrs_periodic_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                D, ldd, E, lde, ipiv, stP, X, ldx, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRF_BORDERED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  float* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  float* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeblttrf_bordered_strided_batched(handle, nb, nblocks, nbr, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, F, ldf, stF, G, ldg, stG,
+                                                            ipiv, stP, info, bc);
+    else
+        return rocsolver_sgeblttrf_bordered(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, F, ldf, G, ldg, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  double* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  double* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  double* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeblttrf_bordered_strided_batched(handle, nb, nblocks, nbr, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, F, ldf, stF, G, ldg, stG,
+                                                            ipiv, stP, info, bc);
+    else
+        return rocsolver_dgeblttrf_bordered(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, F, ldf, G, ldg, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_float_complex* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_float_complex* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeblttrf_bordered_strided_batched(handle, nb, nblocks, nbr, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, F, ldf, stF, G, ldg, stG,
+                                                            ipiv, stP, info, bc);
+    else
+        return rocsolver_cgeblttrf_bordered(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, F, ldf, G, ldg, ipiv, info);
+}
+
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_double_complex* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_double_complex* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeblttrf_bordered_strided_batched(handle, nb, nblocks, nbr, A, lda, stA,
+                                                            B, ldb, stB, C, ldc, stC, D, ldd, stD,
+                                                            E, lde, stE, F, ldf, stF, G, ldg, stG,
+                                                            ipiv, stP, info, bc);
+    else
+        return rocsolver_zgeblttrf_bordered(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                            ldd, E, lde, F, ldf, G, ldg, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  float* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  float* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  float* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_sgeblttrf_bordered_batched(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                                ldd, E, lde, F, ldf, G, ldg, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  double* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  double* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  double* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dgeblttrf_bordered_batched(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                                ldd, E, lde, F, ldf, G, ldg, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_float_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_float_complex* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_float_complex* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cgeblttrf_bordered_batched(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                                ldd, E, lde, F, ldf, G, ldg, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_double_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_double_complex* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_double_complex* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zgeblttrf_bordered_batched(handle, nb, nblocks, nbr, A, lda, B, ldb, C, ldc, D,
+                                                ldd, E, lde, F, ldf, G, ldg, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRS_BORDERED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  float* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  float* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  float* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  float* Y,
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeblttrs_bordered_strided_batched(handle, nb, nblocks, nbr, nrhs, A, lda,
+                                                            stA, B, ldb, stB, C, ldc, stC, D, ldd,
+                                                            stD, E, lde, stE, F, ldf, stF, G, ldg,
+                                                            stG, ipiv, stP, X, ldx, stX, Y, ldy,
+                                                            stY, bc);
+    else
+        return rocsolver_sgeblttrs_bordered(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C, ldc,
+                                            D, ldd, E, lde, F, ldf, G, ldg, ipiv, X, ldx, Y, ldy);
+}
+
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  double* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  double* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  double* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  double* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  double* Y,
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeblttrs_bordered_strided_batched(handle, nb, nblocks, nbr, nrhs, A, lda,
+                                                            stA, B, ldb, stB, C, ldc, stC, D, ldd,
+                                                            stD, E, lde, stE, F, ldf, stF, G, ldg,
+                                                            stG, ipiv, stP, X, ldx, stX, Y, ldy,
+                                                            stY, bc);
+    else
+        return rocsolver_dgeblttrs_bordered(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C, ldc,
+                                            D, ldd, E, lde, F, ldf, G, ldg, ipiv, X, ldx, Y, ldy);
+}
+
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_float_complex* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_float_complex* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_float_complex* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_float_complex* Y,
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeblttrs_bordered_strided_batched(handle, nb, nblocks, nbr, nrhs, A, lda,
+                                                            stA, B, ldb, stB, C, ldc, stC, D, ldd,
+                                                            stD, E, lde, stE, F, ldf, stF, G, ldg,
+                                                            stG, ipiv, stP, X, ldx, stX, Y, ldy,
+                                                            stY, bc);
+    else
+        return rocsolver_cgeblttrs_bordered(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C, ldc,
+                                            D, ldd, E, lde, F, ldf, G, ldg, ipiv, X, ldx, Y, ldy);
+}
+
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* B,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* C,
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* D,
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* E,
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_double_complex* F,
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_double_complex* G,
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_double_complex* X,
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_double_complex* Y,
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeblttrs_bordered_strided_batched(handle, nb, nblocks, nbr, nrhs, A, lda,
+                                                            stA, B, ldb, stB, C, ldc, stC, D, ldd,
+                                                            stD, E, lde, stE, F, ldf, stF, G, ldg,
+                                                            stG, ipiv, stP, X, ldx, stX, Y, ldy,
+                                                            stY, bc);
+    else
+        return rocsolver_zgeblttrs_bordered(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C, ldc,
+                                            D, ldd, E, lde, F, ldf, G, ldg, ipiv, X, ldx, Y, ldy);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  float* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  float* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  float* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  float* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  float* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  float* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  float* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  float* const Y[],
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    return rocsolver_sgeblttrs_bordered_batched(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C,
+                                                ldc, D, ldd, E, lde, F, ldf, G, ldg, ipiv, stP, X,
+                                                ldx, Y, ldy, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  double* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  double* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  double* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  double* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  double* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  double* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  double* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  double* const Y[],
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dgeblttrs_bordered_batched(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C,
+                                                ldc, D, ldd, E, lde, F, ldf, G, ldg, ipiv, stP, X,
+                                                ldx, Y, ldy, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  rocblas_float_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_float_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_float_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_float_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_float_complex* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_float_complex* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_float_complex* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_float_complex* const Y[],
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cgeblttrs_bordered_batched(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C,
+                                                ldc, D, ldd, E, lde, F, ldf, G, ldg, ipiv, stP, X,
+                                                ldx, Y, ldy, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_bordered(bool STRIDED,
+                                                  rocblas_handle handle,
+                                                  rocblas_int nb,
+                                                  rocblas_int nblocks,
+                                                  rocblas_int nbr,
+                                                  rocblas_int nrhs,
+                                                  rocblas_double_complex* const A[],
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* const B[],
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_double_complex* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_stride stC,
+                                                  rocblas_double_complex* const D[],
+                                                  rocblas_int ldd,
+                                                  rocblas_stride stD,
+                                                  rocblas_double_complex* const E[],
+                                                  rocblas_int lde,
+                                                  rocblas_stride stE,
+                                                  rocblas_double_complex* const F[],
+                                                  rocblas_int ldf,
+                                                  rocblas_stride stF,
+                                                  rocblas_double_complex* const G[],
+                                                  rocblas_int ldg,
+                                                  rocblas_stride stG,
+                                                  const rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_double_complex* const X[],
+                                                  rocblas_int ldx,
+                                                  rocblas_stride stX,
+                                                  rocblas_double_complex* const Y[],
+                                                  rocblas_int ldy,
+                                                  rocblas_stride stY,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zgeblttrs_bordered_batched(handle, nb, nblocks, nbr, nrhs, A, lda, B, ldb, C,
+                                                ldc, D, ldd, E, lde, F, ldf, G, ldg, ipiv, stP, X,
+                                                ldx, Y, ldy, bc);
+}
+/********************************************************/
+
 /*************** CREATE_ DESTROY_ RFINFO ****************/
 // local rocsolver_rfinfo; automatically created and destroyed
 class rocsolver_local_rfinfo
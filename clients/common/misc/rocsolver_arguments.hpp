@@ -303,6 +303,28 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_norm(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char norm = val->second.as<char>();
+        if(norm != 'O' && norm != '1' && norm != 'I' && norm != 'M' && norm != 'F' && norm != 'E')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
+    void validate_lsq_mode(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char mode = val->second.as<char>();
+        if(mode != 'N' && mode != 'Q')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_consumed() const
     {
         if(!to_consume.empty())
@@ -64,18 +64,29 @@
 #include "common/auxiliary/testing_sterf.hpp"
 
 // lapack
+#include "common/lapack/testing_gbtrf.hpp"
+#include "common/lapack/testing_gbtrs.hpp"
 #include "common/lapack/testing_gebd2_gebrd.hpp"
+#include "common/lapack/testing_geblttrf.hpp"
 #include "common/lapack/testing_geblttrf_npvt.hpp"
+#include "common/lapack/testing_geblttrs.hpp"
+#include "common/lapack/testing_geblttrs_bordered.hpp"
 #include "common/lapack/testing_geblttrs_npvt.hpp"
+#include "common/lapack/testing_geblttrs_periodic.hpp"
 #include "common/lapack/testing_gelq2_gelqf.hpp"
 #include "common/lapack/testing_gels.hpp"
+#include "common/lapack/testing_gels_mode.hpp"
+#include "common/lapack/testing_gelsy.hpp"
+#include "common/lapack/testing_geqp3.hpp"
 #include "common/lapack/testing_geql2_geqlf.hpp"
 #include "common/lapack/testing_geqr2_geqrf.hpp"
 #include "common/lapack/testing_gerq2_gerqf.hpp"
 #include "common/lapack/testing_gesv.hpp"
+#include "common/lapack/testing_gesv_irs.hpp"
 #include "common/lapack/testing_gesvd.hpp"
 #include "common/lapack/testing_gesvdj.hpp"
 #include "common/lapack/testing_gesvdx.hpp"
+#include "common/lapack/testing_gesvx.hpp"
 #include "common/lapack/testing_getf2_getrf.hpp"
 #include "common/lapack/testing_getf2_getrf_npvt.hpp"
 #include "common/lapack/testing_getri.hpp"
@@ -83,10 +94,16 @@
 #include "common/lapack/testing_getri_npvt_outofplace.hpp"
 #include "common/lapack/testing_getri_outofplace.hpp"
 #include "common/lapack/testing_getrs.hpp"
+#include "common/lapack/testing_gpsv.hpp"
+#include "common/lapack/testing_gtsv.hpp"
 #include "common/lapack/testing_posv.hpp"
+#include "common/lapack/testing_posv_irs.hpp"
 #include "common/lapack/testing_potf2_potrf.hpp"
 #include "common/lapack/testing_potri.hpp"
 #include "common/lapack/testing_potrs.hpp"
+#include "common/lapack/testing_ptsv.hpp"
+#include "common/lapack/testing_qrinc_qrdec.hpp"
+#include "common/lapack/testing_qrinr_qrder.hpp"
 #include "common/lapack/testing_syev_heev.hpp"
 #include "common/lapack/testing_syevd_heevd.hpp"
 #include "common/lapack/testing_syevdj_heevdj.hpp"
@@ -187,6 +204,10 @@ class rocsolver_dispatcher
             {"getf2_64", testing_getf2_getrf<false, false, 0, T, int64_t>},
             {"getf2_batched_64", testing_getf2_getrf<true, true, 0, T, int64_t>},
             {"getf2_strided_batched_64", testing_getf2_getrf<false, true, 0, T, int64_t>},
+            // gbtrf
+            {"gbtrf", testing_gbtrf<false, false, T>},
+            {"gbtrf_batched", testing_gbtrf<true, true, T>},
+            {"gbtrf_strided_batched", testing_gbtrf<false, true, T>},
             // geqrf
             {"geqr2", testing_geqr2_geqrf<false, false, 0, T, rocblas_int>},
             {"geqr2_batched", testing_geqr2_geqrf<true, true, 0, T, rocblas_int>},
@@ -202,6 +223,23 @@ class rocsolver_dispatcher
             {"geqrf_batched_64", testing_geqr2_geqrf<true, true, 1, T, int64_t>},
             {"geqrf_strided_batched_64", testing_geqr2_geqrf<false, true, 1, T, int64_t>},
             {"geqrf_ptr_batched_64", testing_geqr2_geqrf<true, false, 1, T, int64_t>},
+            // geqp3
+            {"geqp3", testing_geqp3<false, false, T>},
+            {"geqp3_batched", testing_geqp3<true, true, T>},
+            {"geqp3_strided_batched", testing_geqp3<false, true, T>},
+            // qr updating
+            {"qrinr", testing_qrinr_qrder<false, false, 1, T>},
+            {"qrinr_batched", testing_qrinr_qrder<true, true, 1, T>},
+            {"qrinr_strided_batched", testing_qrinr_qrder<false, true, 1, T>},
+            {"qrder", testing_qrinr_qrder<false, false, 0, T>},
+            {"qrder_batched", testing_qrinr_qrder<true, true, 0, T>},
+            {"qrder_strided_batched", testing_qrinr_qrder<false, true, 0, T>},
+            {"qrinc", testing_qrinc_qrdec<false, false, 1, T>},
+            {"qrinc_batched", testing_qrinc_qrdec<true, true, 1, T>},
+            {"qrinc_strided_batched", testing_qrinc_qrdec<false, true, 1, T>},
+            {"qrdec", testing_qrinc_qrdec<false, false, 0, T>},
+            {"qrdec_batched", testing_qrinc_qrdec<true, true, 0, T>},
+            {"qrdec_strided_batched", testing_qrinc_qrdec<false, true, 0, T>},
             // gerqf
             {"gerq2", testing_gerq2_gerqf<false, false, 0, T>},
             {"gerq2_batched", testing_gerq2_gerqf<true, true, 0, T>},
@@ -230,10 +268,23 @@ class rocsolver_dispatcher
             {"getrs_64", testing_getrs<false, false, T, int64_t>},
             {"getrs_batched_64", testing_getrs<true, true, T, int64_t>},
             {"getrs_strided_batched_64", testing_getrs<false, true, T, int64_t>},
+            // gbtrs
+            {"gbtrs", testing_gbtrs<false, false, T>},
+            {"gbtrs_batched", testing_gbtrs<true, true, T>},
+            {"gbtrs_strided_batched", testing_gbtrs<false, true, T>},
             // gesv
             {"gesv", testing_gesv<false, false, T>},
             {"gesv_batched", testing_gesv<true, true, T>},
             {"gesv_strided_batched", testing_gesv<false, true, T>},
+            // gtsv
+            {"gtsv", testing_gtsv<false, T>},
+            {"gtsv_strided_batched", testing_gtsv<true, T>},
+            // ptsv
+            {"ptsv", testing_ptsv<false, T>},
+            {"ptsv_strided_batched", testing_ptsv<true, T>},
+            // gpsv
+            {"gpsv", testing_gpsv<false, T>},
+            {"gpsv_strided_batched", testing_gpsv<true, T>},
             // gesvd
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
@@ -246,6 +297,10 @@ class rocsolver_dispatcher
             {"gesvdx", testing_gesvdx<false, false, T>},
             {"gesvdx_batched", testing_gesvdx<true, true, T>},
             {"gesvdx_strided_batched", testing_gesvdx<false, true, T>},
+            // gesvx
+            {"gesvx", testing_gesvx<false, false, T>},
+            {"gesvx_batched", testing_gesvx<true, true, T>},
+            {"gesvx_strided_batched", testing_gesvx<false, true, T>},
             // trtri
             {"trtri", testing_trtri<false, false, T>},
             {"trtri_batched", testing_trtri<true, true, T>},
@@ -270,6 +325,14 @@ class rocsolver_dispatcher
             {"gels", testing_gels<false, false, T>},
             {"gels_batched", testing_gels<true, true, T>},
             {"gels_strided_batched", testing_gels<false, true, T>},
+            // gels_mode
+            {"gels_mode", testing_gels_mode<false, false, T>},
+            {"gels_mode_batched", testing_gels_mode<true, true, T>},
+            {"gels_mode_strided_batched", testing_gels_mode<false, true, T>},
+            // gelsy
+            {"gelsy", testing_gelsy<false, false, T>},
+            {"gelsy_batched", testing_gelsy<true, true, T>},
+            {"gelsy_strided_batched", testing_gelsy<false, true, T>},
             // gebrd
             {"gebd2", testing_gebd2_gebrd<false, false, 0, T>},
             {"gebd2_batched", testing_gebd2_gebrd<true, true, 0, T>},
@@ -292,6 +355,22 @@ class rocsolver_dispatcher
             {"geblttrs_npvt", testing_geblttrs_npvt<false, false, T>},
             {"geblttrs_npvt_batched", testing_geblttrs_npvt<true, true, T>},
             {"geblttrs_npvt_strided_batched", testing_geblttrs_npvt<false, true, T>},
+            // geblttrf
+            {"geblttrf", testing_geblttrf<false, false, T>},
+            {"geblttrf_batched", testing_geblttrf<true, true, T>},
+            {"geblttrf_strided_batched", testing_geblttrf<false, true, T>},
+            // geblttrs
+            {"geblttrs", testing_geblttrs<false, false, T>},
+            {"geblttrs_batched", testing_geblttrs<true, true, T>},
+            {"geblttrs_strided_batched", testing_geblttrs<false, true, T>},
+            // geblttrs_periodic
+            {"geblttrs_periodic", testing_geblttrs_periodic<false, false, T>},
+            {"geblttrs_periodic_batched", testing_geblttrs_periodic<true, true, T>},
+            {"geblttrs_periodic_strided_batched", testing_geblttrs_periodic<false, true, T>},
+            // geblttrs_bordered
+            {"geblttrs_bordered", testing_geblttrs_bordered<false, false, T>},
+            {"geblttrs_bordered_batched", testing_geblttrs_bordered<true, true, T>},
+            {"geblttrs_bordered_strided_batched", testing_geblttrs_bordered<false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -513,6 +592,33 @@ class rocsolver_dispatcher
             return rocblas_status_invalid_value;
     }
 
+    template <typename T,
+              std::enable_if_t<std::is_same<decltype(std::real(T{})), double>{}, int> = 0>
+    static rocblas_status run_function_double_precision(const char* name, Arguments& argus)
+    {
+        // Map for functions that support only double and double-complex precisions
+        static const func_map map_double = {
+            // gesv_irs
+            {"gesv_irs", testing_gesv_irs<false, false, T>},
+            {"gesv_irs_batched", testing_gesv_irs<true, true, T>},
+            {"gesv_irs_strided_batched", testing_gesv_irs<false, true, T>},
+            // posv_irs
+            {"posv_irs", testing_posv_irs<false, false, T>},
+            {"posv_irs_batched", testing_posv_irs<true, true, T>},
+            {"posv_irs_strided_batched", testing_posv_irs<false, true, T>},
+        };
+
+        // Grab function from the map and execute
+        auto match = map_double.find(name);
+        if(match != map_double.end())
+        {
+            match->second(argus);
+            return rocblas_status_success;
+        }
+        else
+            return rocblas_status_invalid_value;
+    }
+
 public:
     static void invoke(const std::string& name, char precision, Arguments& argus)
     {
@@ -541,6 +647,14 @@ public:
                 status = run_function_limited_precision<rocblas_double_complex>(name.c_str(), argus);
         }
 
+        if(status == rocblas_status_invalid_value)
+        {
+            if(precision == 'd')
+                status = run_function_double_precision<double>(name.c_str(), argus);
+            else if(precision == 'z')
+                status = run_function_double_precision<rocblas_double_complex>(name.c_str(), argus);
+        }
+
         if(status == rocblas_status_invalid_value)
         {
             std::string msg = "Invalid combination --function ";
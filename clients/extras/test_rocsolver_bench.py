@@ -518,6 +518,43 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'posv_irs',
+        '-f posv_irs -r d -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+        }
+    ),
+    (
+        'posv_irs_batched',
+        '-f posv_irs_batched -r d -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'posv_irs_strided_batched',
+        '-f posv_irs_strided_batched -r d -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideA': '100',
+            'strideB': '100',
+            'batch_c': '1',
+        }
+    ),
     (
         'potri',
         '-f potri -n 10',
@@ -1014,6 +1051,42 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'gesv_irs',
+        '-f gesv_irs -r d -n 10',
+        {
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+        }
+    ),
+    (
+        'gesv_irs_batched',
+        '-f gesv_irs_batched -r d -n 10',
+        {
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideP': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gesv_irs_strided_batched',
+        '-f gesv_irs_strided_batched -r d -n 10',
+        {
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'strideB': '100',
+            'batch_c': '1',
+        }
+    ),
     (
         'gesvd',
         '-f gesvd -n 10 -m 15',
@@ -0,0 +1,133 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/auxiliary/testing_interleave.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> interleave_tuple;
+
+// each size_range is a {m, n, lda}
+
+// each bc_range is a {batch_count}
+// (the batch is transposed in tiles of 32 instances, so that some
+// batch counts are not multiples of the tile size)
+
+// case when m = 0 and batch_count = 1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {10, 10, 5},
+    // normal (valid) samples
+    {1, 1, 1},
+    {10, 10, 10},
+    {20, 10, 30},
+    {15, 40, 20}};
+const vector<int> bc_range = {1, 5, 40};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{64, 64, 64}, {100, 150, 120}};
+const vector<int> large_bc_range = {100, 1000};
+
+Arguments interleave_setup_arguments(interleave_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    int bc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", size[0]);
+    arg.set<rocblas_int>("n", size[1]);
+    arg.set<rocblas_int>("lda", size[2]);
+
+    // only testing standard use case/defaults for strides
+    // (the interleaved matrices use incb = batch_count and strideB = 1)
+
+    arg.batch_count = bc;
+    arg.timing = 0;
+
+    return arg;
+}
+
+class INTERLEAVE : public ::TestWithParam<interleave_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = interleave_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.batch_count == 1)
+            testing_interleave_bad_arg<T>();
+
+        testing_interleave<T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(INTERLEAVE, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(INTERLEAVE, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(INTERLEAVE, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(INTERLEAVE, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         INTERLEAVE,
+                         Combine(ValuesIn(large_size_range), ValuesIn(large_bc_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         INTERLEAVE,
+                         Combine(ValuesIn(size_range), ValuesIn(bc_range)));
@@ -0,0 +1,276 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#include "common/auxiliary/testing_lange.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char, printable_char> lange_tuple;
+
+// each size_range vector is a {m, n, lda}
+// (LANSY/LANHE use the first entry as the order n of the matrix)
+
+// each norm_range is a {norm}
+
+// each uplo_range is a {uplo} (only used by LANSY/LANHE)
+
+// case when m = 0, norm = O and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> norm_range = {'O', 'I', 'M', 'F'};
+
+const vector<printable_char> uplo_range = {'U', 'L'};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {10, 10, 5},
+    // normal (valid) samples
+    {1, 1, 1},
+    {10, 10, 10},
+    {20, 10, 30},
+    {15, 40, 20},
+    {50, 70, 50}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{192, 192, 192}, {640, 300, 700}, {1000, 1500, 1000}};
+
+Arguments lange_setup_arguments(lange_tuple tup, const bool sym)
+{
+    vector<int> size = std::get<0>(tup);
+    char norm = std::get<1>(tup);
+    char uplo = std::get<2>(tup);
+
+    Arguments arg;
+
+    if(sym)
+    {
+        arg.set<rocblas_int>("n", size[0]);
+        arg.set<char>("uplo", uplo);
+    }
+    else
+    {
+        arg.set<rocblas_int>("m", size[0]);
+        arg.set<rocblas_int>("n", size[1]);
+    }
+    arg.set<rocblas_int>("lda", size[2]);
+
+    arg.set<char>("norm", norm);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool SYM>
+class LANGE_LANSY : public ::TestWithParam<lange_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = lange_setup_arguments(GetParam(), SYM);
+
+        if(std::get<0>(GetParam())[0] == 0 && arg.peek<char>("norm") == 'O'
+           && std::get<2>(GetParam()) == 'U')
+            testing_lange_bad_arg<BATCHED, STRIDED, SYM, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_lange<BATCHED, STRIDED, SYM, T>(arg);
+    }
+};
+
+class LANGE : public LANGE_LANSY<false>
+{
+};
+
+class LANSY : public LANGE_LANSY<true>
+{
+};
+
+// non-batch tests
+
+TEST_P(LANGE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(LANGE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(LANGE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(LANGE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(LANSY, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(LANSY, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(LANSY, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(LANSY, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(LANGE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(LANGE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(LANGE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(LANGE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(LANSY, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(LANSY, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(LANSY, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(LANSY, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(LANGE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(LANGE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(LANGE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(LANGE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(LANSY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(LANSY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(LANSY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(LANSY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LANGE,
+                         Combine(ValuesIn(large_size_range),
+                                 ValuesIn(norm_range),
+                                 Values(printable_char('U'))));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LANGE,
+                         Combine(ValuesIn(size_range),
+                                 ValuesIn(norm_range),
+                                 Values(printable_char('U'))));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LANSY,
+                         Combine(ValuesIn(large_size_range),
+                                 ValuesIn(norm_range),
+                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LANSY,
+                         Combine(ValuesIn(size_range), ValuesIn(norm_range), ValuesIn(uplo_range)));
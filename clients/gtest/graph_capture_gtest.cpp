@@ -0,0 +1,837 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
+
+/*************************************************************************
+ * Every routine is executed once directly and once inside a stream capture.
+ * The capture must succeed without host synchronization, and the replayed
+ * graph must produce exactly the same outputs as the direct execution.
+ *
+ * One variant of every dense routine is captured (the strided_batched version
+ * when available). Routines whose results depend on a previous factorization
+ * are captured together with it. The sparse refactorization functions and the
+ * in-place eigensolvers used by hipSOLVER (which return the number of
+ * eigenvalues in host memory) are not capturable and are not tested here.
+ *************************************************************************/
+class checkin_misc_GRAPH_CAPTURE : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(rocblas_create_handle(&handle), rocblas_status_success);
+        ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+        ASSERT_EQ(rocblas_set_stream(handle, stream), rocblas_status_success);
+
+        // symmetric positive definite (and diagonally dominant) test matrices
+        hA.resize(size_A);
+        hB.resize(size_A);
+        for(rocblas_int b = 0; b < bc; ++b)
+            for(rocblas_int j = 0; j < n; ++j)
+                for(rocblas_int i = 0; i < n; ++i)
+                {
+                    double v = (i == j) ? 2.0 * n : 1.0 / (1 + ((i * 7 + j * 7 + b) % 13));
+                    hA[b * stA + i + j * lda] = v;
+                    hB[b * stA + i + j * lda] = (i == j) ? v + 1 : v;
+                }
+
+        // diagonally dominant tridiagonal/pentadiagonal data and identity pivots
+        hD.resize(size_V);
+        hE.resize(size_V);
+        hP.resize(size_V);
+        for(rocblas_int b = 0; b < bc; ++b)
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                hD[b * stV + i] = 4.0 + 0.25 * (i % 5);
+                hE[b * stV + i] = 1.0 / (2 + ((i + b) % 3));
+                hP[b * stV + i] = i + 1;
+            }
+
+        ASSERT_EQ(hipMalloc(&dA, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dB, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dC, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dX, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dD, sizeof(double) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dE, sizeof(double) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dF, sizeof(double) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dG, sizeof(double) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dH, sizeof(double) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dP, sizeof(rocblas_int) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dQ, sizeof(rocblas_int) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dR, sizeof(rocblas_int) * size_V), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dinfo, sizeof(rocblas_int) * bc), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dequed, sizeof(rocsolver_equed) * bc), hipSuccess);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(hipFree(dA), hipSuccess);
+        EXPECT_EQ(hipFree(dB), hipSuccess);
+        EXPECT_EQ(hipFree(dC), hipSuccess);
+        EXPECT_EQ(hipFree(dX), hipSuccess);
+        EXPECT_EQ(hipFree(dD), hipSuccess);
+        EXPECT_EQ(hipFree(dE), hipSuccess);
+        EXPECT_EQ(hipFree(dF), hipSuccess);
+        EXPECT_EQ(hipFree(dG), hipSuccess);
+        EXPECT_EQ(hipFree(dH), hipSuccess);
+        EXPECT_EQ(hipFree(dP), hipSuccess);
+        EXPECT_EQ(hipFree(dQ), hipSuccess);
+        EXPECT_EQ(hipFree(dR), hipSuccess);
+        EXPECT_EQ(hipFree(dinfo), hipSuccess);
+        EXPECT_EQ(hipFree(dequed), hipSuccess);
+        EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
+        EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+    }
+
+    // restores the inputs and clears all the outputs
+    void reset()
+    {
+        auto set = [&](void* d, const void* h, size_t bytes) {
+            ASSERT_EQ(hipMemcpy(d, h, bytes, hipMemcpyHostToDevice), hipSuccess);
+        };
+        set(dA, hA.data(), sizeof(double) * size_A);
+        set(dB, hB.data(), sizeof(double) * size_A);
+        set(dD, hD.data(), sizeof(double) * size_V);
+        set(dE, hE.data(), sizeof(double) * size_V);
+        set(dF, hE.data(), sizeof(double) * size_V);
+        set(dG, hE.data(), sizeof(double) * size_V);
+        set(dH, hE.data(), sizeof(double) * size_V);
+        set(dP, hP.data(), sizeof(rocblas_int) * size_V);
+        ASSERT_EQ(hipMemset(dC, 0, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMemset(dX, 0, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMemset(dQ, 0, sizeof(rocblas_int) * size_V), hipSuccess);
+        ASSERT_EQ(hipMemset(dR, 0, sizeof(rocblas_int) * size_V), hipSuccess);
+        ASSERT_EQ(hipMemset(dinfo, 0, sizeof(rocblas_int) * bc), hipSuccess);
+        ASSERT_EQ(hipMemset(dequed, 0, sizeof(rocsolver_equed) * bc), hipSuccess);
+    }
+
+    // copies all the device arrays to host
+    std::vector<char> results()
+    {
+        std::vector<char> res(sizeof(double) * (4 * size_A + 5 * size_V)
+                              + sizeof(rocblas_int) * (3 * size_V + bc)
+                              + sizeof(rocsolver_equed) * bc);
+        char* ptr = res.data();
+        auto get = [&](void* d, size_t bytes) {
+            EXPECT_EQ(hipMemcpy(ptr, d, bytes, hipMemcpyDeviceToHost), hipSuccess);
+            ptr += bytes;
+        };
+        get(dA, sizeof(double) * size_A);
+        get(dB, sizeof(double) * size_A);
+        get(dC, sizeof(double) * size_A);
+        get(dX, sizeof(double) * size_A);
+        get(dD, sizeof(double) * size_V);
+        get(dE, sizeof(double) * size_V);
+        get(dF, sizeof(double) * size_V);
+        get(dG, sizeof(double) * size_V);
+        get(dH, sizeof(double) * size_V);
+        get(dP, sizeof(rocblas_int) * size_V);
+        get(dQ, sizeof(rocblas_int) * size_V);
+        get(dR, sizeof(rocblas_int) * size_V);
+        get(dinfo, sizeof(rocblas_int) * bc);
+        get(dequed, sizeof(rocsolver_equed) * bc);
+        return res;
+    }
+
+    void check_capture(const std::function<rocblas_status()>& routine)
+    {
+        // direct execution (this also sets up the workspace of the handle)
+        reset();
+        ASSERT_EQ(routine(), rocblas_status_success);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+        std::vector<char> expected = results();
+
+        // captured execution
+        reset();
+        hipGraph_t graph;
+        hipGraphExec_t exec;
+        ASSERT_EQ(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal), hipSuccess);
+        rocblas_status status = routine();
+        ASSERT_EQ(hipStreamEndCapture(stream, &graph), hipSuccess);
+        ASSERT_EQ(status, rocblas_status_success);
+        ASSERT_EQ(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0), hipSuccess);
+        ASSERT_EQ(hipGraphLaunch(exec, stream), hipSuccess);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+        EXPECT_EQ(hipGraphExecDestroy(exec), hipSuccess);
+        EXPECT_EQ(hipGraphDestroy(graph), hipSuccess);
+
+        std::vector<char> captured = results();
+        EXPECT_EQ(std::memcmp(expected.data(), captured.data(), expected.size()), 0);
+    }
+
+    rocblas_handle handle;
+    hipStream_t stream;
+    std::vector<double> hA, hB, hD, hE;
+    std::vector<rocblas_int> hP;
+    double *dA, *dB, *dC, *dX, *dD, *dE, *dF, *dG, *dH;
+    rocblas_int *dP, *dQ, *dR, *dinfo;
+    rocsolver_equed* dequed;
+
+    const rocblas_int n = 96;
+    const rocblas_int nrhs = 8;
+    const rocblas_int lda = n;
+    const rocblas_stride stA = lda * n;
+    const rocblas_stride stV = n;
+    const rocblas_int bc = 3;
+    const size_t size_A = stA * bc;
+    const size_t size_V = stV * bc;
+    const rocblas_fill uplo = rocblas_fill_upper;
+    const rocblas_operation trans = rocblas_operation_none;
+    const rocblas_side side = rocblas_side_left;
+
+    // interleaved layout of the n-by-n matrices of the batch
+    const rocblas_int ldi = n * bc;
+
+    // block tridiagonal matrices with nblk blocks of size nb; the blocks of each
+    // instance are stored in chunks of nb*nb*nblk elements of dA
+    const rocblas_int nb = 8;
+    const rocblas_int nblk = n / nb;
+    const rocblas_int nbr = 4;
+    const size_t chunk = 1024;
+};
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, auxiliary)
+{
+    check_capture([&] { return rocsolver_dlaswp(handle, n, dA, lda, 1, n, dP, 1); });
+    check_capture([&] { return rocsolver_dlarfg(handle, n, dD, dD + 1, 1, dF); });
+    check_capture([&] { return rocsolver_dlarf(handle, side, n, n, dD, 1, dF, dA, lda); });
+    check_capture([&] {
+        return rocsolver_dlarft(handle, rocblas_forward_direction, rocblas_column_wise, n, nrhs, dA,
+                                lda, dD, dC, n);
+    });
+    check_capture([&] {
+        return rocsolver_dlarfb(handle, side, trans, rocblas_forward_direction, rocblas_column_wise,
+                                n, n, nrhs, dA, lda, dC, n, dB, lda);
+    });
+    check_capture([&] {
+        return rocsolver_dlabrd(handle, n, n, nrhs, dA, lda, dD, dE, dF, dG, dB, n, dC, n);
+    });
+    check_capture(
+        [&] { return rocsolver_dlatrd(handle, uplo, n, nrhs, dA, lda, dE, dF, dC, n); });
+    check_capture(
+        [&] { return rocsolver_dlasyf(handle, uplo, n, nrhs, dR, dA, lda, dP, dinfo); });
+    check_capture([&] { return rocsolver_dlauum(handle, uplo, n, dA, lda); });
+    check_capture([&] {
+        return rocsolver_dlange_strided_batched(handle, rocsolver_norm_one, n, n, dA, lda, stA, dF,
+                                                bc);
+    });
+    check_capture([&] {
+        return rocsolver_dlansy_strided_batched(handle, rocsolver_norm_one, uplo, n, dA, lda, stA,
+                                                dF, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, orthogonal_matrices)
+{
+    check_capture([&] { return rocsolver_dorg2r(handle, n, n, n, dA, lda, dD); });
+    check_capture([&] { return rocsolver_dorgqr(handle, n, n, n, dA, lda, dD); });
+    check_capture([&] { return rocsolver_dorgl2(handle, n, n, n, dA, lda, dD); });
+    check_capture([&] { return rocsolver_dorglq(handle, n, n, n, dA, lda, dD); });
+    check_capture([&] { return rocsolver_dorg2l(handle, n, n, n, dA, lda, dD); });
+    check_capture([&] { return rocsolver_dorgql(handle, n, n, n, dA, lda, dD); });
+    check_capture(
+        [&] { return rocsolver_dorgbr(handle, rocblas_column_wise, n, n, n, dA, lda, dD); });
+    check_capture([&] { return rocsolver_dorgtr(handle, uplo, n, dA, lda, dD); });
+    check_capture(
+        [&] { return rocsolver_dorm2r(handle, side, trans, n, n, n, dA, lda, dD, dB, lda); });
+    check_capture(
+        [&] { return rocsolver_dormqr(handle, side, trans, n, n, n, dA, lda, dD, dB, lda); });
+    check_capture(
+        [&] { return rocsolver_dorml2(handle, side, trans, n, n, n, dA, lda, dD, dB, lda); });
+    check_capture(
+        [&] { return rocsolver_dormlq(handle, side, trans, n, n, n, dA, lda, dD, dB, lda); });
+    check_capture(
+        [&] { return rocsolver_dorm2l(handle, side, trans, n, n, n, dA, lda, dD, dB, lda); });
+    check_capture(
+        [&] { return rocsolver_dormql(handle, side, trans, n, n, n, dA, lda, dD, dB, lda); });
+    check_capture([&] {
+        return rocsolver_dormbr(handle, rocblas_column_wise, side, trans, n, n, n, dA, lda, dD, dB,
+                                lda);
+    });
+    check_capture(
+        [&] { return rocsolver_dormtr(handle, side, uplo, trans, n, n, dA, lda, dD, dB, lda); });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, tridiagonal_and_bidiagonal)
+{
+    check_capture([&] { return rocsolver_dsterf(handle, n, dD, dE, dinfo); });
+    check_capture([&] {
+        return rocsolver_dsteqr(handle, rocblas_evect_tridiagonal, n, dD, dE, dC, n, dinfo);
+    });
+    check_capture([&] {
+        return rocsolver_dstedc(handle, rocblas_evect_tridiagonal, n, dD, dE, dC, n, dinfo);
+    });
+    check_capture([&] {
+        rocblas_status st
+            = rocsolver_dstebz(handle, rocblas_erange_all, rocblas_eorder_blocks, n, 0, 0, 0, 0, 0,
+                               dD, dE, dR, dR + 1, dF, dP, dQ, dinfo);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dstein(handle, n, dD, dE, dR, dF, dP, dQ, dC, n, dR + stV, dinfo);
+    });
+    check_capture([&] {
+        return rocsolver_dbdsqr(handle, uplo, n, n, n, 0, dD, dE, dA, lda, dB, lda, dC, lda, dinfo);
+    });
+    check_capture([&] {
+        return rocsolver_dbdsvdx(handle, uplo, rocblas_svect_singular, rocblas_srange_all, n, dD,
+                                 dE, 0, 0, 0, 0, dR, dF, dC, 2 * n, dQ, dinfo);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, linear_systems)
+{
+    check_capture([&] {
+        return rocsolver_dgetf2_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetf2_npvt_strided_batched(handle, n, n, dA, lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetrf_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetrf_npvt_strided_batched(handle, n, n, dA, lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetrf_tpvt_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dinfo,
+                                                     bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, dA, lda, stA, dP, stV, dB,
+                                                lda, stA, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesv_strided_batched(handle, n, nrhs, dA, lda, stA, dP, stV, dB, lda, stA,
+                                               dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesv_irs_strided_batched(handle, n, nrhs, dA, lda, stA, dP, stV, dB, lda,
+                                                   stA, dR, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesvx_strided_batched(handle, trans, n, nrhs, dA, lda, stA, dC, lda, stA,
+                                                dP, stV, dequed, dD, stV, dE, stV, dB, lda, stA,
+                                                dX, lda, stA, dF, dG, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetri_strided_batched(handle, n, dA, lda, stA, dP, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetri_npvt_strided_batched(handle, n, dA, lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetri_outofplace_strided_batched(handle, n, dA, lda, stA, dP, stV, dC,
+                                                           lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetri_npvt_outofplace_strided_batched(handle, n, dA, lda, stA, dC, lda,
+                                                                stA, dinfo, bc);
+    });
+    check_capture(
+        [&] { return rocsolver_dpotf2_strided_batched(handle, uplo, n, dA, lda, stA, dinfo, bc); });
+    check_capture(
+        [&] { return rocsolver_dpotrf_strided_batched(handle, uplo, n, dA, lda, stA, dinfo, bc); });
+    check_capture([&] {
+        return rocsolver_dpotrs_strided_batched(handle, uplo, n, nrhs, dA, lda, stA, dB, lda, stA,
+                                                bc);
+    });
+    check_capture([&] {
+        return rocsolver_dposv_strided_batched(handle, uplo, n, nrhs, dA, lda, stA, dB, lda, stA,
+                                               dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dposv_irs_strided_batched(handle, uplo, n, nrhs, dA, lda, stA, dB, lda,
+                                                   stA, dR, dinfo, bc);
+    });
+    check_capture(
+        [&] { return rocsolver_dpotri_strided_batched(handle, uplo, n, dA, lda, stA, dinfo, bc); });
+    check_capture([&] {
+        return rocsolver_dtrtri_strided_batched(handle, uplo, rocblas_diagonal_non_unit, n, dA, lda,
+                                                stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsytf2_strided_batched(handle, uplo, n, dA, lda, stA, dP, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsytrf_strided_batched(handle, uplo, n, dA, lda, stA, dP, stV, dinfo, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, condition_numbers_and_determinants)
+{
+    check_capture([&] {
+        return rocsolver_dgecon_strided_batched(handle, rocsolver_norm_one, n, dA, lda, stA, dF, dE,
+                                                bc);
+    });
+    check_capture([&] {
+        return rocsolver_dpocon_strided_batched(handle, uplo, n, dA, lda, stA, dF, dE, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgetdet_strided_batched(handle, n, dA, lda, stA, dP, stV, dD, dE, bc);
+    });
+    check_capture(
+        [&] { return rocsolver_dpotdet_strided_batched(handle, n, dA, lda, stA, dD, bc); });
+    check_capture([&] {
+        return rocsolver_dgetrf_logdet_strided_batched(handle, n, dA, lda, stA, dD, dE, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dpotrf_logdet_strided_batched(handle, uplo, n, dA, lda, stA, dD, dinfo,
+                                                       bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, banded_and_block_tridiagonal_systems)
+{
+    const rocblas_int kl = 4, ku = 4, ldab = 2 * kl + ku + 1;
+    const rocblas_int ldx = nb * nblk;
+    double* M[9];
+    for(int i = 0; i < 9; ++i)
+        M[i] = dA + i * chunk;
+
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgbtrf_strided_batched(handle, n, n, kl, ku, dA, ldab, stA,
+                                                             dP, stV, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, dA, ldab, stA, dP,
+                                                stV, dB, lda, stA, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgtsv_strided_batched(handle, n, nrhs, dE, dD, dF, stV, dB, lda, stA,
+                                               dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dptsv_strided_batched(handle, n, nrhs, dD, stV, dE, stV, dB, lda, stA,
+                                               dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgpsv_strided_batched(handle, n, nrhs, dG, dE, dD, dF, dH, stV, dB, lda,
+                                               stA, dinfo, bc);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeblttrf_npvt_strided_batched(
+            handle, nb, nblk, M[0], nb, stA, M[1], nb, stA, M[2], nb, stA, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgeblttrs_npvt_strided_batched(handle, nb, nblk, nrhs, M[0], nb, stA, M[1],
+                                                        nb, stA, M[2], nb, stA, M[3], ldx, stA,
+                                                        bc);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeblttrf_strided_batched(handle, nb, nblk, M[0], nb, stA,
+                                                                M[1], nb, stA, M[2], nb, stA, M[3],
+                                                                nb, stA, dP, stV, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgeblttrs_strided_batched(handle, nb, nblk, nrhs, M[0], nb, stA, M[1], nb,
+                                                   stA, M[2], nb, stA, M[3], nb, stA, dP, stV, M[4],
+                                                   ldx, stA, bc);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeblttrf_periodic_strided_batched(
+            handle, nb, nblk, M[0], nb, stA, M[1], nb, stA, M[2], nb, stA, M[3], nb, stA, M[4], nb,
+            stA, dP, stV, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgeblttrs_periodic_strided_batched(
+            handle, nb, nblk, nrhs, M[0], nb, stA, M[1], nb, stA, M[2], nb, stA, M[3], nb, stA,
+            M[4], nb, stA, dP, stV, M[5], ldx, stA, bc);
+    });
+    check_capture([&] {
+        // (the pivots of the border must also fit in stV)
+        const rocblas_int nblkb = nblk - 1;
+        rocblas_status st = rocsolver_dgeblttrf_bordered_strided_batched(
+            handle, nb, nblkb, nbr, M[0], nb, stA, M[1], nb, stA, M[2], nb, stA, M[3], nb, stA,
+            M[4], nb, stA, M[5], nbr, stA, M[6], nbr, stA, dP, stV, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgeblttrs_bordered_strided_batched(
+            handle, nb, nblkb, nbr, nrhs, M[0], nb, stA, M[1], nb, stA, M[2], nb, stA, M[3], nb,
+            stA, M[4], nb, stA, M[5], nbr, stA, M[6], nbr, stA, dP, stV, M[7], nb * nblkb, stA,
+            M[8], nbr, stA, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, interleaved_batched)
+{
+    // interleaved blocks of the block tridiagonal matrices
+    const size_t ichunk = size_t(nb) * nb * nblk * bc;
+    const rocblas_int ldb = nb * bc;
+    const rocblas_int ldx = nb * nblk * bc;
+    double* M[5];
+    for(int i = 0; i < 5; ++i)
+        M[i] = dA + i * ichunk;
+
+    check_capture([&] {
+        rocblas_status st = rocsolver_dinterleave_batched(handle, n, n, dB, lda, stA, dX, bc, ldi,
+                                                          1, bc);
+        if(st == rocblas_status_success)
+            st = rocsolver_dinterleave_batched(handle, n, nrhs, dA, lda, stA, dC, bc, ldi, 1, bc);
+        if(st == rocblas_status_success)
+            st = rocsolver_dpotrf_interleaved_batched(handle, uplo, n, dX, bc, ldi, 1, dinfo, bc);
+        if(st == rocblas_status_success)
+            st = rocsolver_dpotrs_interleaved_batched(handle, uplo, n, nrhs, dX, bc, ldi, 1, dC,
+                                                      bc, ldi, 1, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_ddeinterleave_batched(handle, n, nrhs, dC, bc, ldi, 1, dA, lda, stA, bc);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgetrf_interleaved_batched(handle, n, n, dA, bc, ldi, 1, dP,
+                                                                 stV, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgetrs_interleaved_batched(handle, trans, n, nrhs, dA, bc, ldi, 1, dP, stV,
+                                                    dB, bc, ldi, 1, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgtsv_interleaved_batched(handle, n, nrhs, dE, dD, dF, bc, 1, dB, bc, ldi,
+                                                   1, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dptsv_interleaved_batched(handle, n, nrhs, dD, dE, bc, 1, dB, bc, ldi, 1,
+                                                   dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgpsv_interleaved_batched(handle, n, nrhs, dG, dE, dD, dF, dH, bc, 1, dB,
+                                                   bc, ldi, 1, dinfo, bc);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeblttrf_npvt_interleaved_batched(
+            handle, nb, nblk, M[0], bc, ldb, 1, M[1], bc, ldb, 1, M[2], bc, ldb, 1, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgeblttrs_npvt_interleaved_batched(handle, nb, nblk, nrhs, M[0], bc, ldb,
+                                                            1, M[1], bc, ldb, 1, M[2], bc, ldb, 1,
+                                                            M[3], bc, ldx, 1, bc);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeblttrf_interleaved_batched(
+            handle, nb, nblk, M[0], bc, ldb, 1, M[1], bc, ldb, 1, M[2], bc, ldb, 1, M[3], bc, ldb,
+            1, dP, stV, dinfo, bc);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgeblttrs_interleaved_batched(handle, nb, nblk, nrhs, M[0], bc, ldb, 1,
+                                                       M[1], bc, ldb, 1, M[2], bc, ldb, 1, M[3], bc,
+                                                       ldb, 1, dP, stV, M[4], bc, ldx, 1, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, variable_size_batched)
+{
+    // instances of different size classes, stored as the strided batch in dA and dB
+    const rocblas_int bc_v = 3;
+    rocblas_int hM[bc_v] = {n, n / 2 - 8, n / 8};
+    rocblas_int hNrhs[bc_v] = {nrhs, nrhs, nrhs};
+    rocblas_int hLd[bc_v] = {lda, lda, lda};
+    double* hAarr[bc_v];
+    double* hBarr[bc_v];
+    for(rocblas_int b = 0; b < bc_v; ++b)
+    {
+        hAarr[b] = dA + b * stA;
+        hBarr[b] = dB + b * stA;
+    }
+
+    rocblas_int *dM, *dNrhs, *dLd;
+    double **dAarr, **dBarr;
+    ASSERT_EQ(hipMalloc(&dM, sizeof(hM)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dNrhs, sizeof(hNrhs)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dLd, sizeof(hLd)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dAarr, sizeof(hAarr)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dBarr, sizeof(hBarr)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dM, hM, sizeof(hM), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dNrhs, hNrhs, sizeof(hNrhs), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dLd, hLd, sizeof(hLd), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dAarr, hAarr, sizeof(hAarr), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dBarr, hBarr, sizeof(hBarr), hipMemcpyHostToDevice), hipSuccess);
+
+    check_capture([&] {
+        rocblas_status st
+            = rocsolver_dgetrf_vbatched(handle, dM, dM, dAarr, dLd, dP, stV, dinfo, bc_v);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dgetrs_vbatched(handle, trans, dM, dNrhs, dAarr, dLd, dP, stV, dBarr, dLd,
+                                         bc_v);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeqrf_vbatched(handle, dM, dM, dAarr, dLd, dD, stV, bc_v);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dormqr_vbatched(handle, side, trans, dM, dNrhs, dM, dAarr, dLd, dD, stV,
+                                         dBarr, dLd, bc_v);
+    });
+    check_capture([&] {
+        rocblas_status st = rocsolver_dgeqrf_vbatched(handle, dM, dM, dAarr, dLd, dD, stV, bc_v);
+        if(st != rocblas_status_success)
+            return st;
+        return rocsolver_dorgqr_vbatched(handle, dM, dM, dM, dAarr, dLd, dD, stV, bc_v);
+    });
+    check_capture([&] {
+        return rocsolver_dgels_vbatched(handle, trans, dM, dM, dNrhs, dAarr, dLd, dBarr, dLd, dinfo,
+                                        bc_v);
+    });
+
+    EXPECT_EQ(hipFree(dM), hipSuccess);
+    EXPECT_EQ(hipFree(dNrhs), hipSuccess);
+    EXPECT_EQ(hipFree(dLd), hipSuccess);
+    EXPECT_EQ(hipFree(dAarr), hipSuccess);
+    EXPECT_EQ(hipFree(dBarr), hipSuccess);
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, orthogonal_factorizations)
+{
+    check_capture(
+        [&] { return rocsolver_dgeqr2_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgeqrf_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgelq2_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgelqf_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgeql2_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgeqlf_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgerq2_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture(
+        [&] { return rocsolver_dgerqf_strided_batched(handle, n, n, dA, lda, stA, dD, stV, bc); });
+    check_capture([&] {
+        return rocsolver_dgeqp3_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dD, stV, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgels_strided_batched(handle, trans, n, n, nrhs, dA, lda, stA, dB, lda,
+                                               stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgels_mode_strided_batched(handle, rocsolver_lsq_mode_normal, trans, n, n,
+                                                    nrhs, dA, lda, stA, dB, lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgels_mode_strided_batched(handle, rocsolver_lsq_mode_normal,
+                                                    rocblas_operation_transpose, n / 2, n, nrhs, dA,
+                                                    lda, stA, dB, lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgelsy_strided_batched(handle, n, n, nrhs, dA, lda, stA, dB, lda, stA, dP,
+                                                stV, 1e-8, dR, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgebd2_strided_batched(handle, n, n, dA, lda, stA, dD, stV, dE, stV, dF,
+                                                stV, dG, stV, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgebrd_strided_batched(handle, n, n, dA, lda, stA, dD, stV, dE, stV, dF,
+                                                stV, dC, stV, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsytd2_strided_batched(handle, uplo, n, dA, lda, stA, dD, stV, dE, stV, dF,
+                                                stV, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsytrd_strided_batched(handle, uplo, n, dA, lda, stA, dD, stV, dE, stV, dF,
+                                                stV, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, qr_updating)
+{
+    check_capture([&] {
+        return rocsolver_dqrinr_strided_batched(handle, n - 1, n - 1, dA, lda, stA, dB, lda, stA, 1,
+                                                dD, 1, stV, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dqrder_strided_batched(handle, n, n, dA, lda, stA, dB, lda, stA, 1, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dqrinc_strided_batched(handle, n, n - 1, dA, lda, stA, dB, lda, stA, 1, dD,
+                                                1, stV, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dqrdec_strided_batched(handle, n, n, dA, lda, stA, dB, lda, stA, 1, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, eigensolvers_and_svd)
+{
+    const rocblas_evect evect = rocblas_evect_original;
+    const rocblas_eform itype = rocblas_eform_ax;
+    const rocblas_erange erange = rocblas_erange_all;
+    const rocblas_svect svect = rocblas_svect_singular;
+
+    check_capture([&] {
+        return rocsolver_dsyev_strided_batched(handle, evect, uplo, n, dA, lda, stA, dD, stV, dE,
+                                               stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsyevd_strided_batched(handle, evect, uplo, n, dA, lda, stA, dD, stV, dE,
+                                                stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsyevj_strided_batched(handle, rocblas_esort_ascending, evect, uplo, n, dA,
+                                                lda, stA, 0, dE, 100, dP, dD, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsyevdj_strided_batched(handle, evect, uplo, n, dA, lda, stA, dD, stV,
+                                                 dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsyevx_strided_batched(handle, evect, erange, uplo, n, dA, lda, stA, 0, 0,
+                                                0, 0, 0, dR, dD, stV, dB, lda, stA, dQ, stV, dinfo,
+                                                bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsyevdx_strided_batched(handle, evect, erange, uplo, n, dA, lda, stA, 0, 0,
+                                                 0, 0, dR, dD, stV, dB, lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, dA, lda, stA, dB, lda, stA,
+                                                bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygst_strided_batched(handle, itype, uplo, n, dA, lda, stA, dB, lda, stA,
+                                                bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygv_strided_batched(handle, itype, evect, uplo, n, dA, lda, stA, dB, lda,
+                                               stA, dD, stV, dE, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygvd_strided_batched(handle, itype, evect, uplo, n, dA, lda, stA, dB,
+                                                lda, stA, dD, stV, dE, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygvj_strided_batched(handle, itype, evect, uplo, n, dA, lda, stA, dB,
+                                                lda, stA, 0, dE, 100, dR, dD, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygvdj_strided_batched(handle, itype, evect, uplo, n, dA, lda, stA, dB,
+                                                 lda, stA, dD, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygvx_strided_batched(handle, itype, evect, erange, uplo, n, dA, lda, stA,
+                                                dB, lda, stA, 0, 0, 0, 0, 0, dR, dD, stV, dC, lda,
+                                                stA, dQ, stV, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dsygvdx_strided_batched(handle, itype, evect, erange, uplo, n, dA, lda,
+                                                 stA, dB, lda, stA, 0, 0, 0, 0, dR, dD, stV, dC,
+                                                 lda, stA, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesvd_strided_batched(handle, rocblas_svect_none, rocblas_svect_none, n,
+                                                n, dA, lda, stA, dD, stV, dB, lda, stA, dC, lda,
+                                                stA, dE, stV, rocblas_outofplace, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesvd_strided_batched(handle, svect, svect, n, n, dA, lda, stA, dD, stV,
+                                                dB, lda, stA, dC, lda, stA, dE, stV,
+                                                rocblas_outofplace, dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesvdj_strided_batched(handle, svect, svect, n, n, dA, lda, stA, 0, dE,
+                                                 100, dR, dD, stV, dB, lda, stA, dC, lda, stA,
+                                                 dinfo, bc);
+    });
+    check_capture([&] {
+        return rocsolver_dgesvdx_strided_batched(handle, svect, svect, rocblas_srange_all, n, n, dA,
+                                                 lda, stA, 0, 0, 0, 0, dR, dD, stV, dB, lda, stA,
+                                                 dC, lda, stA, dQ, stV, dinfo, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, graph_cache)
+{
+    // with the graph cache enabled, repeated calls replay the captured graph
+    reset();
+    ASSERT_EQ(rocsolver_dgetrf_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dinfo, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+    std::vector<char> expected = results();
+
+    ASSERT_EQ(rocsolver_graph_cache_begin(), rocblas_status_success);
+    EXPECT_EQ(rocsolver_graph_cache_begin(), rocblas_status_internal_error);
+    for(int iter = 0; iter < 3; ++iter)
+    {
+        reset();
+        ASSERT_EQ(rocsolver_dgetrf_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dinfo, bc),
+                  rocblas_status_success);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+        std::vector<char> cached = results();
+        EXPECT_EQ(std::memcmp(expected.data(), cached.data(), expected.size()), 0);
+    }
+    ASSERT_EQ(rocsolver_graph_cache_end(), rocblas_status_success);
+    EXPECT_EQ(rocsolver_graph_cache_end(), rocblas_status_internal_error);
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, graph_cache_default_stream)
+{
+    // the default stream cannot be captured; with the graph cache enabled,
+    // the calls are executed directly
+    ASSERT_EQ(rocblas_set_stream(handle, nullptr), rocblas_status_success);
+
+    std::vector<std::function<rocblas_status()>> routines = {
+        [&] {
+            return rocsolver_dgetrf_strided_batched(handle, n, n, dA, lda, stA, dP, stV, dinfo, bc);
+        },
+        [&] {
+            return rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, dA, lda, stA, dP, stV,
+                                                    dB, lda, stA, bc);
+        },
+        [&] { return rocsolver_dpotrf_strided_batched(handle, uplo, n, dA, lda, stA, dinfo, bc); },
+        [&] {
+            return rocsolver_dpotrs_strided_batched(handle, uplo, n, nrhs, dA, lda, stA, dB, lda,
+                                                    stA, bc);
+        },
+    };
+
+    for(auto& routine : routines)
+    {
+        reset();
+        ASSERT_EQ(routine(), rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        std::vector<char> expected = results();
+
+        ASSERT_EQ(rocsolver_graph_cache_begin(), rocblas_status_success);
+        for(int iter = 0; iter < 2; ++iter)
+        {
+            reset();
+            EXPECT_EQ(routine(), rocblas_status_success);
+            ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+            std::vector<char> cached = results();
+            EXPECT_EQ(std::memcmp(expected.data(), cached.data(), expected.size()), 0);
+        }
+        ASSERT_EQ(rocsolver_graph_cache_end(), rocblas_status_success);
+    }
+}
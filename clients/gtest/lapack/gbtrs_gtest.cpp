@@ -0,0 +1,207 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gbtrs.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gbtrs_tuple;
+
+// each A_range vector is a {N, kl, ku, ldab_extra, ldb};
+// where ldab = 2 * kl + ku + 1 + ldab_extra
+
+// each B_range vector is a {nrhs, trans};
+// if trans = 0 then no transpose
+// if trans = 1 then transpose
+// if trans = 2 then conjugate transpose
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 1, 0, 1},
+    // invalid
+    {-1, 1, 1, 0, 1},
+    {10, -1, 1, 0, 10},
+    {10, 1, -1, 0, 10},
+    {10, 2, 2, -1, 10},
+    {10, 2, 2, 0, 2},
+    /// normal (valid) samples
+    {20, 0, 0, 0, 20},
+    {20, 1, 1, 0, 20},
+    {30, 5, 2, 3, 30},
+    {30, 3, 7, 0, 50},
+    {50, 40, 40, 0, 60}};
+const vector<vector<int>> matrix_sizeB_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {10, 0},
+    {20, 1},
+    {30, 2},
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range = {{192, 3, 3, 0, 192},
+                                                      {600, 32, 16, 0, 645},
+                                                      {1000, 64, 64, 5, 1000},
+                                                      {2000, 150, 100, 0, 2000}};
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100, 0}, {150, 0}, {200, 1}, {524, 2},
+};
+
+Arguments gbtrs_setup_arguments(gbtrs_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_sizeA[0]);
+    arg.set<rocblas_int>("kl", matrix_sizeA[1]);
+    arg.set<rocblas_int>("ku", matrix_sizeA[2]);
+    arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
+    arg.set<rocblas_int>("ldab", 2 * matrix_sizeA[1] + matrix_sizeA[2] + 1 + matrix_sizeA[3]);
+    arg.set<rocblas_int>("ldb", matrix_sizeA[4]);
+
+    if(matrix_sizeB[1] == 0)
+        arg.set<char>("trans", 'N');
+    else if(matrix_sizeB[1] == 1)
+        arg.set<char>("trans", 'T');
+    else
+        arg.set<char>("trans", 'C');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GBTRS : public ::TestWithParam<gbtrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gbtrs_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gbtrs_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gbtrs<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GBTRS, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GBTRS, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GBTRS, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GBTRS, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GBTRS, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GBTRS, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GBTRS, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GBTRS, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GBTRS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GBTRS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GBTRS, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GBTRS, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GBTRS,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GBTRS,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
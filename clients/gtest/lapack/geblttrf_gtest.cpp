@@ -25,6 +25,8 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+#include "common/lapack/testing_geblttrf.hpp"
+#include "common/lapack/testing_geblttrf_interleaved.hpp"
 #include "common/lapack/testing_geblttrf_npvt.hpp"
 #include "common/lapack/testing_geblttrf_npvt_interleaved.hpp"
 
@@ -62,9 +64,11 @@ const vector<vector<int>> matrix_size_range = {
 const vector<vector<int>> large_matrix_size_range = {{32, 6, 32, 32, 32, 0},
                                                      {50, 10, 60, 50, 50, 1},
                                                      {32, 10, 32, 40, 32, 0},
-                                                     {32, 20, 32, 32, 40, 0}};
+                                                     {32, 20, 32, 32, 40, 0},
+                                                     {4, 150, 4, 4, 4, 0},
+                                                     {4, 150, 6, 4, 5, 1}};
 
-Arguments geblttrf_setup_arguments(geblttrf_tuple tup, bool interleaved)
+Arguments geblttrf_setup_arguments(geblttrf_tuple tup, bool interleaved, bool pivot)
 {
     Arguments arg;
 
@@ -76,6 +80,8 @@ Arguments geblttrf_setup_arguments(geblttrf_tuple tup, bool interleaved)
         arg.set<rocblas_int>("lda", tup[2]);
         arg.set<rocblas_int>("ldb", tup[3]);
         arg.set<rocblas_int>("ldc", tup[4]);
+        if(pivot)
+            arg.set<rocblas_int>("ldd", tup[4]);
 
         // only testing standard use case/defaults for strides
     }
@@ -87,14 +93,20 @@ Arguments geblttrf_setup_arguments(geblttrf_tuple tup, bool interleaved)
         arg.set<rocblas_int>("inca", bc);
         arg.set<rocblas_int>("incb", bc);
         arg.set<rocblas_int>("incc", bc);
+        if(pivot)
+            arg.set<rocblas_int>("incd", bc);
 
         arg.set<rocblas_int>("lda", bc * tup[2]);
         arg.set<rocblas_int>("ldb", bc * tup[3]);
         arg.set<rocblas_int>("ldc", bc * tup[4]);
+        if(pivot)
+            arg.set<rocblas_int>("ldd", bc * tup[4]);
 
         arg.set<rocblas_stride>("strideA", 1);
         arg.set<rocblas_stride>("strideB", 1);
         arg.set<rocblas_stride>("strideC", 1);
+        if(pivot)
+            arg.set<rocblas_stride>("strideD", 1);
     }
 
     arg.timing = 0;
@@ -114,7 +126,7 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = geblttrf_setup_arguments(GetParam(), false);
+        Arguments arg = geblttrf_setup_arguments(GetParam(), false, false);
 
         if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0)
             testing_geblttrf_npvt_bad_arg<BATCHED, STRIDED, T>();
@@ -139,7 +151,7 @@ protected:
     template <typename T>
     void run_tests()
     {
-        Arguments arg = geblttrf_setup_arguments(GetParam(), true);
+        Arguments arg = geblttrf_setup_arguments(GetParam(), true, false);
 
         if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0)
             testing_geblttrf_npvt_interleaved_bad_arg<T>();
@@ -153,6 +165,56 @@ protected:
     }
 };
 
+class GEBLTTRF : public ::TestWithParam<geblttrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = geblttrf_setup_arguments(GetParam(), false, true);
+
+        if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0)
+            testing_geblttrf_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_geblttrf<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_geblttrf<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GEBLTTRF_INTERLEAVED : public ::TestWithParam<geblttrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geblttrf_setup_arguments(GetParam(), true, true);
+
+        if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0)
+            testing_geblttrf_interleaved_bad_arg<T>();
+
+        arg.batch_count = 3;
+        if(arg.singular == 1)
+            testing_geblttrf_interleaved<T>(arg);
+
+        arg.singular = 0;
+        testing_geblttrf_interleaved<T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GEBLTTRF_NPVT, __float)
@@ -241,6 +303,94 @@ TEST_P(GEBLTTRF_NPVT_INTERLEAVED, interleaved_batched__double_complex)
     run_tests<rocblas_double_complex>();
 }
 
+// non-batch tests
+
+TEST_P(GEBLTTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEBLTTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEBLTTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEBLTTRF, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEBLTTRF, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEBLTTRF, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRF, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEBLTTRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEBLTTRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEBLTTRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// interleaved_batched tests
+
+TEST_P(GEBLTTRF_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEBLTTRF_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEBLTTRF_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRF_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRF_NPVT, ValuesIn(large_matrix_size_range));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRF_NPVT, ValuesIn(matrix_size_range));
@@ -248,3 +398,11 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRF_NPVT, ValuesIn(matrix_size_ran
 INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRF_NPVT_INTERLEAVED, ValuesIn(large_matrix_size_range));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRF_NPVT_INTERLEAVED, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRF, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRF, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRF_INTERLEAVED, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRF_INTERLEAVED, ValuesIn(matrix_size_range));
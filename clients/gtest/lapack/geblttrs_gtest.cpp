@@ -25,8 +25,12 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+#include "common/lapack/testing_geblttrs.hpp"
+#include "common/lapack/testing_geblttrs_bordered.hpp"
+#include "common/lapack/testing_geblttrs_interleaved.hpp"
 #include "common/lapack/testing_geblttrs_npvt.hpp"
 #include "common/lapack/testing_geblttrs_npvt_interleaved.hpp"
+#include "common/lapack/testing_geblttrs_periodic.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -65,7 +69,7 @@ const vector<vector<int>> large_matrix_size_range = {{32, 6, 10, 32, 32, 32, 32}
                                                      {32, 10, 20, 32, 40, 32, 40},
                                                      {32, 20, 20, 32, 32, 40, 32}};
 
-Arguments geblttrs_setup_arguments(geblttrs_tuple tup, bool interleaved)
+Arguments geblttrs_setup_arguments(geblttrs_tuple tup, bool interleaved, bool pivot)
 {
     Arguments arg;
 
@@ -78,6 +82,8 @@ Arguments geblttrs_setup_arguments(geblttrs_tuple tup, bool interleaved)
         arg.set<rocblas_int>("lda", tup[3]);
         arg.set<rocblas_int>("ldb", tup[4]);
         arg.set<rocblas_int>("ldc", tup[5]);
+        if(pivot)
+            arg.set<rocblas_int>("ldd", tup[5]);
         arg.set<rocblas_int>("ldx", tup[6]);
     }
     else
@@ -88,16 +94,22 @@ Arguments geblttrs_setup_arguments(geblttrs_tuple tup, bool interleaved)
         arg.set<rocblas_int>("inca", bc);
         arg.set<rocblas_int>("incb", bc);
         arg.set<rocblas_int>("incc", bc);
+        if(pivot)
+            arg.set<rocblas_int>("incd", bc);
         arg.set<rocblas_int>("incx", bc);
 
         arg.set<rocblas_int>("lda", bc * tup[3]);
         arg.set<rocblas_int>("ldb", bc * tup[4]);
         arg.set<rocblas_int>("ldc", bc * tup[5]);
+        if(pivot)
+            arg.set<rocblas_int>("ldd", bc * tup[5]);
         arg.set<rocblas_int>("ldx", bc * tup[6]);
 
         arg.set<rocblas_stride>("strideA", 1);
         arg.set<rocblas_stride>("strideB", 1);
         arg.set<rocblas_stride>("strideC", 1);
+        if(pivot)
+            arg.set<rocblas_stride>("strideD", 1);
         arg.set<rocblas_stride>("strideX", 1);
     }
 
@@ -119,7 +131,7 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = geblttrs_setup_arguments(GetParam(), false);
+        Arguments arg = geblttrs_setup_arguments(GetParam(), false, false);
 
         if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0
            && arg.peek<rocblas_int>("nrhs") == 0)
@@ -141,7 +153,7 @@ protected:
     template <typename T>
     void run_tests()
     {
-        Arguments arg = geblttrs_setup_arguments(GetParam(), true);
+        Arguments arg = geblttrs_setup_arguments(GetParam(), true, false);
 
         if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0
            && arg.peek<rocblas_int>("nrhs") == 0)
@@ -152,6 +164,100 @@ protected:
     }
 };
 
+class GEBLTTRS : public ::TestWithParam<geblttrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = geblttrs_setup_arguments(GetParam(), false, true);
+
+        if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0
+           && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_geblttrs_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_geblttrs<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GEBLTTRS_INTERLEAVED : public ::TestWithParam<geblttrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geblttrs_setup_arguments(GetParam(), true, true);
+
+        if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0
+           && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_geblttrs_interleaved_bad_arg<T>();
+
+        arg.batch_count = 3;
+        testing_geblttrs_interleaved<T>(arg);
+    }
+};
+
+class GEBLTTRS_PERIODIC : public ::TestWithParam<geblttrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        geblttrs_tuple tup = GetParam();
+        Arguments arg = geblttrs_setup_arguments(tup, false, true);
+        arg.set<rocblas_int>("lde", tup[5]);
+
+        if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0
+           && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_geblttrs_periodic_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_geblttrs_periodic<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GEBLTTRS_BORDERED : public ::TestWithParam<geblttrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        // the border width is taken as half the block size
+        geblttrs_tuple tup = GetParam();
+        Arguments arg = geblttrs_setup_arguments(tup, false, true);
+        arg.set<rocblas_int>("nbr", tup[0] / 2);
+        arg.set<rocblas_int>("lde", tup[5]);
+
+        if(arg.peek<rocblas_int>("nb") == 0 && arg.peek<rocblas_int>("nblocks") == 0
+           && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_geblttrs_bordered_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_geblttrs_bordered<BATCHED, STRIDED, T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GEBLTTRS_NPVT, __float)
@@ -240,6 +346,226 @@ TEST_P(GEBLTTRS_NPVT_INTERLEAVED, interleaved_batched__double_complex)
     run_tests<rocblas_double_complex>();
 }
 
+// non-batch tests
+
+TEST_P(GEBLTTRS, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEBLTTRS, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEBLTTRS, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEBLTTRS, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEBLTTRS, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEBLTTRS, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEBLTTRS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEBLTTRS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEBLTTRS, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEBLTTRS_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEBLTTRS_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEBLTTRS_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// non-batch tests
+
+TEST_P(GEBLTTRS_PERIODIC, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEBLTTRS_PERIODIC, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEBLTTRS_PERIODIC, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_PERIODIC, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// non-batch tests
+
+TEST_P(GEBLTTRS_BORDERED, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEBLTTRS_BORDERED, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEBLTTRS_BORDERED, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEBLTTRS_BORDERED, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRS_NPVT, ValuesIn(large_matrix_size_range));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS_NPVT, ValuesIn(matrix_size_range));
@@ -247,3 +573,19 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS_NPVT, ValuesIn(matrix_size_ran
 INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRS_NPVT_INTERLEAVED, ValuesIn(large_matrix_size_range));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS_NPVT_INTERLEAVED, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRS, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRS_INTERLEAVED, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS_INTERLEAVED, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRS_PERIODIC, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS_PERIODIC, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GEBLTTRS_BORDERED, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEBLTTRS_BORDERED, ValuesIn(matrix_size_range));
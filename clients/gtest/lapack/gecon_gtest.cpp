@@ -0,0 +1,264 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#include "common/lapack/testing_gecon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char> gecon_tuple;
+
+// each size_range vector is a {N, lda}
+
+// each norm_range is a {norm} (GECON)
+// each uplo_range is a {uplo} (POCON)
+
+// case when n = 0 and norm = O (or uplo = L) will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> norm_range = {'O', 'I'};
+
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {10, 2},
+    // normal (valid) samples
+    {1, 1},
+    {6, 8},
+    {16, 16},
+    {20, 30},
+    {50, 50},
+    {70, 80}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192}, {640, 960}, {1000, 1000}, {2000, 2000},
+};
+
+Arguments gecon_setup_arguments(gecon_tuple tup, const bool positive)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char opt = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    if(positive)
+        arg.set<char>("uplo", opt);
+    else
+        arg.set<char>("norm", opt);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool POSITIVE>
+class GECON_POCON : public ::TestWithParam<gecon_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gecon_setup_arguments(GetParam(), POSITIVE);
+
+        char opt = std::get<1>(GetParam());
+        if(arg.peek<rocblas_int>("n") == 0 && (opt == 'O' || opt == 'L'))
+            testing_gecon_bad_arg<BATCHED, STRIDED, POSITIVE, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gecon<BATCHED, STRIDED, POSITIVE, T>(arg);
+    }
+};
+
+class GECON : public GECON_POCON<false>
+{
+};
+
+class POCON : public GECON_POCON<true>
+{
+};
+
+// non-batch tests
+
+TEST_P(GECON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GECON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GECON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GECON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(POCON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POCON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POCON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POCON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GECON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GECON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GECON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GECON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(POCON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POCON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POCON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POCON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GECON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GECON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GECON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GECON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(POCON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POCON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POCON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POCON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GECON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GECON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POCON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POCON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
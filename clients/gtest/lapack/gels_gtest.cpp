@@ -27,6 +27,7 @@
 
 #include "common/lapack/testing_gels.hpp"
 #include "common/lapack/testing_gels_outofplace.hpp"
+#include "common/lapack/testing_gels_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -83,6 +84,8 @@ const vector<gels_params_B> matrix_sizeB_range = {
 const vector<gels_params_A> large_matrix_sizeA_range = {
     {75, 25, 75, 75, 1},    {25, 75, 75, 75, 1},    {150, 150, 150, 150, 1},
     {500, 50, 600, 600, 0}, {50, 500, 600, 600, 0},
+    // tall and skinny samples (tiled QR factorization)
+    {20000, 64, 20000, 20000, 0}, {17000, 40, 17000, 17000, 1},
 };
 const vector<gels_params_B> large_matrix_sizeB_range = {
     {100, 'N'},
@@ -167,6 +170,32 @@ protected:
     }
 };
 
+class GELS_VBATCHED : public ::TestWithParam<gels_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gels_vbatched_bad_arg<T>();
+
+        // more instances than size classes, so that some classes hold several instances
+        arg.batch_count = 5;
+        if(arg.singular == 1)
+            testing_gels_vbatched<T>(arg);
+
+        arg.singular = 0;
+        testing_gels_vbatched<T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GELS, __float)
@@ -253,6 +282,28 @@ TEST_P(GELS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// vbatched tests
+
+TEST_P(GELS_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GELS_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GELS_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GELS_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GELS,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -270,3 +321,12 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS_OUTOFPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELS_VBATCHED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_VBATCHED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -0,0 +1,199 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gelsy.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<int, int, int, int, int> gelsy_params_A;
+
+typedef std::tuple<gelsy_params_A, int> gelsy_tuple;
+
+// each A_range tuple is a {M, N, lda, ldb, singular};
+// if singular = 1, then the used matrix for the tests is rank deficient
+
+// each B_range is a {nrhs}
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<gelsy_params_A> matrix_sizeA_range = {
+    // quick return
+    {0, 0, 0, 0, 0},
+    // invalid
+    {-1, 1, 1, 1, 0},
+    {1, -1, 1, 1, 0},
+    {10, 10, 10, 1, 0},
+    {10, 10, 1, 10, 0},
+    // normal (valid) samples
+    {20, 20, 20, 20, 1},
+    {30, 20, 40, 30, 0},
+    {20, 30, 30, 40, 0},
+    {40, 20, 40, 40, 1},
+    {20, 40, 40, 40, 1},
+};
+const vector<int> matrix_sizeB_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    10, 20, 30};
+
+// for daily_lapack tests
+const vector<gelsy_params_A> large_matrix_sizeA_range = {
+    {75, 25, 75, 75, 1},    {25, 75, 75, 75, 1},    {150, 150, 150, 150, 1},
+    {500, 50, 600, 600, 0}, {50, 500, 600, 600, 0},
+};
+const vector<int> large_matrix_sizeB_range = {100, 200, 500};
+
+Arguments gelsy_setup_arguments(gelsy_tuple tup)
+{
+    gelsy_params_A matrix_sizeA = std::get<0>(tup);
+    int nrhs = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", std::get<0>(matrix_sizeA));
+    arg.set<rocblas_int>("n", std::get<1>(matrix_sizeA));
+    arg.set<rocblas_int>("lda", std::get<2>(matrix_sizeA));
+    arg.set<rocblas_int>("ldb", std::get<3>(matrix_sizeA));
+
+    arg.set<rocblas_int>("nrhs", nrhs);
+
+    // only testing standard use case/defaults for strides and rcond
+
+    arg.timing = 0;
+    arg.singular = std::get<4>(matrix_sizeA);
+
+    return arg;
+}
+
+class GELSY : public ::TestWithParam<gelsy_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gelsy_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gelsy_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gelsy<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gelsy<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GELSY, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELSY, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELSY, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELSY, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GELSY, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELSY, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELSY, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSY, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GELSY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELSY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELSY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELSY,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELSY,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
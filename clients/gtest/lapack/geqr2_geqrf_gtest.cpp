@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_geqr2_geqrf.hpp"
+#include "common/lapack/testing_geqrf_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -156,6 +157,28 @@ class GEQRF_64 : public GEQR2_GEQRF<true, int64_t>
 {
 };
 
+class GEQRF_VBATCHED : public ::TestWithParam<geqrf_tuple<rocblas_int>>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_geqrf_vbatched_bad_arg<T>();
+
+        // more instances than size classes, so that some classes hold several instances
+        arg.batch_count = 5;
+        testing_geqrf_vbatched<T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GEQR2, __float)
@@ -454,6 +477,28 @@ TEST_P(GEQRF_64, ptr_batched__double_complex)
     run_tests<true, false, rocblas_double_complex>();
 }
 
+// vbatched tests
+
+TEST_P(GEQRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GEQR2,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -487,3 +532,11 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GEQRF_64,
                          Combine(ValuesIn(matrix_size_range_64), ValuesIn(n_size_range_64)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
@@ -0,0 +1,249 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_getdet.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> getdet_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// case when n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    // (the smallest sizes use the fused factorization in registers)
+    {3, 3, 0},
+    {6, 8, 1},
+    {12, 12, 0},
+    {32, 32, 1},
+    {50, 60, 0},
+    {100, 100, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 0},
+    {500, 600, 1},
+    {1000, 1000, 0},
+    {2000, 2000, 1},
+};
+
+Arguments getdet_setup_arguments(getdet_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("lda", tup[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = tup[2];
+
+    return arg;
+}
+
+template <bool FUSED>
+class GETDET_LOGDET : public ::TestWithParam<getdet_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getdet_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0)
+            testing_getdet_bad_arg<BATCHED, STRIDED, FUSED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_getdet<BATCHED, STRIDED, FUSED, T>(arg);
+
+        arg.singular = 0;
+        testing_getdet<BATCHED, STRIDED, FUSED, T>(arg);
+    }
+};
+
+class GETDET : public GETDET_LOGDET<false>
+{
+};
+
+class GETRF_LOGDET : public GETDET_LOGDET<true>
+{
+};
+
+// non-batch tests
+
+TEST_P(GETDET, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETDET, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETDET, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETDET, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_LOGDET, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_LOGDET, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_LOGDET, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_LOGDET, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GETDET, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETDET, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETDET, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETDET, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_LOGDET, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_LOGDET, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_LOGDET, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_LOGDET, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETDET, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETDET, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETDET, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETDET, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETDET, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETDET, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF_LOGDET, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF_LOGDET, ValuesIn(matrix_size_range));
@@ -27,6 +27,9 @@
 
 #include "common/lapack/testing_getf2_getrf.hpp"
 #include "common/lapack/testing_getf2_getrf_npvt.hpp"
+#include "common/lapack/testing_getrf_interleaved.hpp"
+#include "common/lapack/testing_getrf_tpvt.hpp"
+#include "common/lapack/testing_getrf_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -50,6 +53,8 @@ const vector<vector<int>> matrix_size_range = {
     {-1, 1, 0},
     {20, 5, 0},
     // normal (valid) samples
+    {3, 3, 0},
+    {6, 6, 1},
     {32, 32, 0},
     {50, 50, 1},
     {70, 100, 0}};
@@ -60,6 +65,8 @@ const vector<int> n_size_range = {
     // invalid
     -1,
     // normal (valid) samples
+    3,
+    6,
     16,
     20,
     40,
@@ -71,12 +78,28 @@ const vector<vector<int>> large_matrix_size_range = {
     {192, 192, 0},
     {640, 640, 1},
     {1000, 1024, 0},
+    // tall matrices (recursive panel factorization)
+    {4500, 4500, 0},
 };
 
 const vector<int> large_n_size_range = {
     45, 64, 520, 1024, 2000,
 };
 
+// for checkin_lapack tests of tournament pivoting
+// (tall matrices, so that the panels are split into several row blocks)
+const vector<vector<int>> tpvt_matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {50, 50, 1},
+    {1100, 1100, 0},
+    {2100, 2100, 1},
+    {3000, 3000, 0}};
+
 Arguments getrf_setup_arguments(getrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -148,6 +171,88 @@ protected:
     }
 };
 
+class GETRF_VBATCHED : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_vbatched_bad_arg<T>();
+
+        // more instances than size classes, so that some classes hold several instances
+        arg.batch_count = 5;
+        if(arg.singular == 1)
+            testing_getrf_vbatched<T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_vbatched<T>(arg);
+    }
+};
+
+class GETRF_TPVT : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_tpvt_bad_arg<STRIDED, T>();
+
+        arg.batch_count = (STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_getrf_tpvt<STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_tpvt<STRIDED, T>(arg);
+    }
+};
+
+class GETRF_INTERLEAVED : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool NPVT, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam());
+
+        // normal use case is covered by the strided_batched tests
+        rocblas_int bc = 3;
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("lda", bc * arg.peek<rocblas_int>("lda"));
+        arg.set<rocblas_stride>("strideA", 1);
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_interleaved_bad_arg<NPVT, T>();
+
+        arg.batch_count = bc;
+        if(arg.singular == 1)
+            testing_getrf_interleaved<NPVT, T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_interleaved<NPVT, T>(arg);
+    }
+};
+
 class GETF2 : public GETF2_GETRF<false, rocblas_int>
 {
 };
@@ -663,6 +768,109 @@ TEST_P(GETRF_64, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// tournament pivoting tests
+TEST_P(GETRF_TPVT, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GETRF_TPVT, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GETRF_TPVT, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_TPVT, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_TPVT, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GETRF_TPVT, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GETRF_TPVT, strided_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_TPVT, strided_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+// interleaved_batched tests
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_INTERLEAVED, npvt_interleaved_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GETRF_INTERLEAVED, npvt_interleaved_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GETRF_INTERLEAVED, npvt_interleaved_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_INTERLEAVED, npvt_interleaved_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+// vbatched tests
+TEST_P(GETRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GETF2_NPVT,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -726,3 +934,23 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRF_64,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_TPVT,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_TPVT,
+                         Combine(ValuesIn(tpvt_matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
@@ -26,6 +26,8 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_getrs.hpp"
+#include "common/lapack/testing_getrs_interleaved.hpp"
+#include "common/lapack/testing_getrs_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -132,6 +134,81 @@ class GETRS_64 : public GETRS_BASE<int64_t>
 {
 };
 
+class GETRS_VBATCHED : public ::TestWithParam<getrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrs_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_getrs_vbatched_bad_arg<T>();
+
+        // more instances than size classes, so that some classes hold several instances
+        arg.batch_count = 5;
+        testing_getrs_vbatched<T>(arg);
+    }
+};
+
+class GETRS_INTERLEAVED : public ::TestWithParam<getrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrs_setup_arguments(GetParam());
+
+        // normal use case is covered by the strided_batched tests
+        rocblas_int bc = 3;
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("lda", bc * arg.peek<rocblas_int>("lda"));
+        arg.set<rocblas_int>("ldb", bc * arg.peek<rocblas_int>("ldb"));
+        arg.set<rocblas_stride>("strideA", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_getrs_interleaved_bad_arg<T>();
+
+        arg.batch_count = bc;
+        testing_getrs_interleaved<T>(arg);
+    }
+};
+
+class GETRS_BROADCAST : public ::TestWithParam<getrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrs_setup_arguments(GetParam());
+
+        // all the instances share the same factorization
+        // (bad arguments are covered by the strided_batched tests)
+        arg.set<rocblas_stride>("strideA", 0);
+        arg.set<rocblas_stride>("strideP", 0);
+
+        arg.batch_count = 3;
+        testing_getrs<false, true, T, rocblas_int>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GETRS, __float)
@@ -258,6 +335,70 @@ TEST_P(GETRS_64, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// interleaved_batched tests
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// vbatched tests
+
+TEST_P(GETRS_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRS_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRS_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRS_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(GETRS_BROADCAST, strided_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRS_BROADCAST, strided_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRS_BROADCAST, strided_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRS_BROADCAST, strided_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GETRS,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -275,3 +416,25 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRS_64,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRS_VBATCHED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRS_VBATCHED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRS_INTERLEAVED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRS_BROADCAST,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRS_BROADCAST,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -0,0 +1,233 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gpsv.hpp"
+#include "common/lapack/testing_gpsv_interleaved.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> gpsv_tuple;
+
+// each A_range vector is a {N, ldb, singular};
+// if singular = 1, then the used matrix for the tests is singular
+
+// each B_range vector is a {nrhs};
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {10, 2, 0},
+    /// normal (valid) samples
+    {1, 1, 0},
+    {20, 20, 0},
+    {30, 50, 1},
+    {50, 60, 1}};
+const vector<int> matrix_sizeB_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    10,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range = {{70, 70, 0},
+                                                      {192, 192, 1},
+                                                      {600, 645, 0},
+                                                      {1000, 1000, 1}};
+const vector<int> large_matrix_sizeB_range = {
+    1, 16, 64,
+};
+
+Arguments gpsv_setup_arguments(gpsv_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    int matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_sizeA[0]);
+    arg.set<rocblas_int>("nrhs", matrix_sizeB);
+    arg.set<rocblas_int>("ldb", matrix_sizeA[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_sizeA[2];
+
+    return arg;
+}
+
+class GPSV : public ::TestWithParam<gpsv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gpsv_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gpsv_bad_arg<STRIDED, T>();
+
+        arg.batch_count = (STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gpsv<STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gpsv<STRIDED, T>(arg);
+    }
+};
+
+class GPSV_INTERLEAVED : public ::TestWithParam<gpsv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = gpsv_setup_arguments(GetParam());
+
+        // normal use case is covered by the strided_batched tests
+        rocblas_int bc = 3;
+        arg.set<rocblas_int>("incd", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("ldb", bc * arg.peek<rocblas_int>("ldb"));
+        arg.set<rocblas_stride>("strideD", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gpsv_interleaved_bad_arg<T>();
+
+        arg.batch_count = bc;
+        testing_gpsv_interleaved<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GPSV, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GPSV, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GPSV, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GPSV, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GPSV, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GPSV, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GPSV, strided_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GPSV, strided_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+// interleaved_batched tests
+
+TEST_P(GPSV_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GPSV_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GPSV_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GPSV_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GPSV,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GPSV,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GPSV_INTERLEAVED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GPSV_INTERLEAVED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_potf2_potrf.hpp"
+#include "common/lapack/testing_potrf_interleaved.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -53,6 +54,8 @@ const vector<vector<int>> matrix_size_range = {
     {-1, 1, 0},
     {10, 2, 0},
     // normal (valid) samples
+    {4, 4, 0},
+    {6, 8, 1},
     {10, 10, 1},
     {20, 30, 0},
     {50, 50, 1},
@@ -109,6 +112,37 @@ protected:
     }
 };
 
+class POTRF_INTERLEAVED : public ::TestWithParam<potrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_setup_arguments(GetParam());
+
+        // normal use case is covered by the strided_batched tests
+        rocblas_int bc = 3;
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("lda", bc * arg.peek<rocblas_int>("lda"));
+        arg.set<rocblas_stride>("strideA", 1);
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
+            testing_potrf_interleaved_bad_arg<T>();
+
+        arg.batch_count = bc;
+        if(arg.singular == 1)
+            testing_potrf_interleaved<T>(arg);
+
+        arg.singular = 0;
+        testing_potrf_interleaved<T>(arg);
+    }
+};
+
 class POTF2 : public POTF2_POTRF<false>
 {
 };
@@ -243,6 +277,28 @@ TEST_P(POTRF, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// interleaved_batched tests
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTF2,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
@@ -258,3 +314,7 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
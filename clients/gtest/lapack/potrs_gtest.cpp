@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_potrs.hpp"
+#include "common/lapack/testing_potrs_interleaved.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -120,6 +121,58 @@ protected:
     }
 };
 
+class POTRS_INTERLEAVED : public ::TestWithParam<potrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrs_setup_arguments(GetParam());
+
+        // normal use case is covered by the strided_batched tests
+        rocblas_int bc = 3;
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("lda", bc * arg.peek<rocblas_int>("lda"));
+        arg.set<rocblas_int>("ldb", bc * arg.peek<rocblas_int>("ldb"));
+        arg.set<rocblas_stride>("strideA", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_potrs_interleaved_bad_arg<T>();
+
+        arg.batch_count = bc;
+        testing_potrs_interleaved<T>(arg);
+    }
+};
+
+class POTRS_BROADCAST : public ::TestWithParam<potrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrs_setup_arguments(GetParam());
+
+        // all the instances share the same factorization
+        // (bad arguments are covered by the strided_batched tests)
+        arg.set<rocblas_stride>("strideA", 0);
+
+        arg.batch_count = 3;
+        testing_potrs<false, true, T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(POTRS, __float)
@@ -186,6 +239,48 @@ TEST_P(POTRS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// interleaved_batched tests
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(POTRS_BROADCAST, strided_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_BROADCAST, strided_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_BROADCAST, strided_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRS_BROADCAST, strided_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 // daily_lapack tests normal execution with medium to large sizes
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTRS,
@@ -197,3 +292,16 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRS,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_INTERLEAVED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRS_BROADCAST,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_BROADCAST,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
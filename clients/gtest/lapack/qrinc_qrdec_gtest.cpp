@@ -0,0 +1,275 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#include "common/lapack/testing_qrinc_qrdec.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> qrinc_qrdec_tuple;
+
+// each matrix_size_range is a {m, n}
+
+// each position_range value selects the column to be inserted or deleted:
+// 0 = first, 1 = middle (default), 2 = last, 3 = out of range (invalid)
+
+// case when m = n = 0 and the position is the default will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 1},
+    {1, -1},
+    // normal (valid) samples
+    {1, 1},
+    {10, 10},
+    {20, 10},
+    {10, 20},
+    {35, 35},
+    {70, 50},
+    {50, 70}};
+
+const vector<int> position_range = {0, 1, 2, 3};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192},
+    {400, 250},
+    {250, 400},
+    {640, 640},
+};
+
+const vector<int> large_position_range = {0, 1, 2};
+
+Arguments qrinc_qrdec_setup_arguments(qrinc_qrdec_tuple tup, bool insert)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int position = std::get<1>(tup);
+
+    Arguments arg;
+
+    rocblas_int m = matrix_size[0];
+    rocblas_int n = matrix_size[1];
+    arg.set<rocblas_int>("m", m);
+    arg.set<rocblas_int>("n", n);
+
+    rocblas_int last = insert ? n + 1 : n;
+    if(position == 0)
+        arg.set<rocblas_int>("j", 1);
+    else if(position == 2)
+        arg.set<rocblas_int>("j", last);
+    else if(position == 3)
+        arg.set<rocblas_int>("j", last + 1);
+
+    // only testing standard use case/defaults for leading dimensions, increments and strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool INSERT>
+class QRINC_QRDEC : public ::TestWithParam<qrinc_qrdec_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = qrinc_qrdec_setup_arguments(this->GetParam(), INSERT);
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && std::get<1>(this->GetParam()) == 1)
+            testing_qrinc_qrdec_bad_arg<BATCHED, STRIDED, INSERT, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_qrinc_qrdec<BATCHED, STRIDED, INSERT, T>(arg);
+    }
+};
+
+class QRINC : public QRINC_QRDEC<true>
+{
+};
+
+class QRDEC : public QRINC_QRDEC<false>
+{
+};
+
+// non-batch tests
+
+TEST_P(QRINC, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QRINC, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QRINC, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QRINC, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(QRDEC, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QRDEC, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QRDEC, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QRDEC, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(QRINC, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QRINC, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QRINC, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QRINC, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(QRDEC, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QRDEC, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QRDEC, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QRDEC, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(QRINC, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QRINC, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QRINC, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QRINC, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(QRDEC, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QRDEC, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QRDEC, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QRDEC, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QRINC,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_position_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QRINC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(position_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QRDEC,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_position_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QRDEC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(position_range)));
@@ -0,0 +1,170 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
+
+/*************************************************************************
+ * Above GETRF_LOOKAHEAD_MIN_SIZE and POTRF_LOOKAHEAD_MIN_SIZE, the non-batched
+ * GETRF and POTRF update part of the trailing matrix in a secondary stream.
+ * The batched versions never use look-ahead, so the strided_batched routines
+ * with batch_count = 1 are used as reference. Both executions must find the
+ * same pivots and info, and factors equal up to rounding.
+ *************************************************************************/
+class checkin_misc_LOOKAHEAD : public ::testing::Test
+{
+protected:
+    static constexpr rocblas_int n = 1100;
+    static constexpr rocblas_int lda = n;
+    static constexpr size_t size_A = size_t(lda) * n;
+
+    rocblas_handle handle;
+    hipStream_t stream;
+    std::vector<double> hA;
+    double* dA;
+    double* dB;
+    rocblas_int* dP;
+    rocblas_int* dQ;
+    rocblas_int* dinfo;
+
+    void SetUp() override
+    {
+        ASSERT_EQ(rocblas_create_handle(&handle), rocblas_status_success);
+        ASSERT_EQ(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking), hipSuccess);
+        ASSERT_EQ(rocblas_set_stream(handle, stream), rocblas_status_success);
+
+        ASSERT_EQ(hipMalloc(&dA, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dB, sizeof(double) * size_A), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dP, sizeof(rocblas_int) * n), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dQ, sizeof(rocblas_int) * n), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dinfo, sizeof(rocblas_int) * 2), hipSuccess);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(hipFree(dA), hipSuccess);
+        EXPECT_EQ(hipFree(dB), hipSuccess);
+        EXPECT_EQ(hipFree(dP), hipSuccess);
+        EXPECT_EQ(hipFree(dQ), hipSuccess);
+        EXPECT_EQ(hipFree(dinfo), hipSuccess);
+        EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
+        EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+    }
+
+    // general matrix with entries in [-1, 1); if spd, it is made symmetric and
+    // diagonally dominant
+    void init(bool spd)
+    {
+        hA.resize(size_A);
+        unsigned s = 12345;
+        for(rocblas_int j = 0; j < n; ++j)
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                s = s * 1103515245u + 12345u;
+                hA[i + j * lda] = double((s >> 8) & 0xFFFF) / 32768.0 - 1.0;
+            }
+        if(spd)
+        {
+            for(rocblas_int j = 0; j < n; ++j)
+                for(rocblas_int i = 0; i < j; ++i)
+                    hA[j + i * lda] = hA[i + j * lda];
+            for(rocblas_int i = 0; i < n; ++i)
+                hA[i + i * lda] = n;
+        }
+
+        ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(double) * size_A, hipMemcpyHostToDevice),
+                  hipSuccess);
+        ASSERT_EQ(hipMemcpy(dB, hA.data(), sizeof(double) * size_A, hipMemcpyHostToDevice),
+                  hipSuccess);
+    }
+
+    // relative difference between the factors in dA (look-ahead) and dB (reference)
+    double factor_error()
+    {
+        std::vector<double> hB(size_A);
+        EXPECT_EQ(hipMemcpy(hA.data(), dA, sizeof(double) * size_A, hipMemcpyDeviceToHost),
+                  hipSuccess);
+        EXPECT_EQ(hipMemcpy(hB.data(), dB, sizeof(double) * size_A, hipMemcpyDeviceToHost),
+                  hipSuccess);
+
+        double diff = 0, nrm = 0;
+        for(size_t e = 0; e < size_A; ++e)
+        {
+            diff = std::max(diff, std::abs(hA[e] - hB[e]));
+            nrm = std::max(nrm, std::abs(hB[e]));
+        }
+        return diff / nrm;
+    }
+
+    std::vector<rocblas_int> to_host(const rocblas_int* d, rocblas_int count)
+    {
+        std::vector<rocblas_int> h(count);
+        EXPECT_EQ(hipMemcpy(h.data(), d, sizeof(rocblas_int) * count, hipMemcpyDeviceToHost),
+                  hipSuccess);
+        return h;
+    }
+};
+
+TEST_F(checkin_misc_LOOKAHEAD, getrf)
+{
+    init(false);
+
+    ASSERT_EQ(rocsolver_dgetrf(handle, n, n, dA, lda, dP, dinfo), rocblas_status_success);
+    ASSERT_EQ(rocsolver_dgetrf_strided_batched(handle, n, n, dB, lda, size_A, dQ, n, dinfo + 1, 1),
+              rocblas_status_success);
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+
+    EXPECT_EQ(to_host(dP, n), to_host(dQ, n));
+    std::vector<rocblas_int> hinfo = to_host(dinfo, 2);
+    EXPECT_EQ(hinfo[0], 0);
+    EXPECT_EQ(hinfo[1], 0);
+    EXPECT_LE(factor_error(), 1e-10);
+}
+
+TEST_F(checkin_misc_LOOKAHEAD, potrf)
+{
+    for(rocblas_fill uplo : {rocblas_fill_upper, rocblas_fill_lower})
+    {
+        init(true);
+
+        ASSERT_EQ(rocsolver_dpotrf(handle, uplo, n, dA, lda, dinfo), rocblas_status_success);
+        ASSERT_EQ(rocsolver_dpotrf_strided_batched(handle, uplo, n, dB, lda, size_A, dinfo + 1, 1),
+                  rocblas_status_success);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+
+        std::vector<rocblas_int> hinfo = to_host(dinfo, 2);
+        EXPECT_EQ(hinfo[0], 0);
+        EXPECT_EQ(hinfo[1], 0);
+        EXPECT_LE(factor_error(), 1e-10);
+    }
+}
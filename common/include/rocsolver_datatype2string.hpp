@@ -242,6 +242,40 @@ constexpr auto rocsolver2char_rfinfo_mode(rocsolver_rfinfo_mode value)
     return '\0';
 }
 
+constexpr auto rocsolver2char_norm_type(rocsolver_norm_type value)
+{
+    switch(value)
+    {
+    case rocsolver_norm_one: return 'O';
+    case rocsolver_norm_inf: return 'I';
+    case rocsolver_norm_max: return 'M';
+    case rocsolver_norm_frobenius: return 'F';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_equed(rocsolver_equed value)
+{
+    switch(value)
+    {
+    case rocsolver_equed_none: return 'N';
+    case rocsolver_equed_row: return 'R';
+    case rocsolver_equed_col: return 'C';
+    case rocsolver_equed_both: return 'B';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_lsq_mode(rocsolver_lsq_mode value)
+{
+    switch(value)
+    {
+    case rocsolver_lsq_mode_qr: return 'Q';
+    case rocsolver_lsq_mode_normal: return 'N';
+    }
+    return '\0';
+}
+
 /* ============================================================================================
  */
 /*  Convert lapack char constants to rocblas type. */
@@ -441,6 +475,42 @@ constexpr rocsolver_rfinfo_mode char2rocsolver_rfinfo_mode(char value)
     }
 }
 
+constexpr rocsolver_norm_type char2rocsolver_norm_type(char value)
+{
+    switch(value)
+    {
+    case 'O':
+    case '1': return rocsolver_norm_one;
+    case 'I': return rocsolver_norm_inf;
+    case 'M': return rocsolver_norm_max;
+    case 'F':
+    case 'E': return rocsolver_norm_frobenius;
+    default: return static_cast<rocsolver_norm_type>(0);
+    }
+}
+
+constexpr rocsolver_equed char2rocsolver_equed(char value)
+{
+    switch(value)
+    {
+    case 'N': return rocsolver_equed_none;
+    case 'R': return rocsolver_equed_row;
+    case 'C': return rocsolver_equed_col;
+    case 'B': return rocsolver_equed_both;
+    default: return static_cast<rocsolver_equed>(0);
+    }
+}
+
+constexpr rocsolver_lsq_mode char2rocsolver_lsq_mode(char value)
+{
+    switch(value)
+    {
+    case 'Q': return rocsolver_lsq_mode_qr;
+    case 'N': return rocsolver_lsq_mode_normal;
+    default: return static_cast<rocsolver_lsq_mode>(0);
+    }
+}
+
 #undef ROCSOLVER_ROCBLAS_HAS_F8_DATATYPES
 
 #ifdef ROCSOLVER_LIBRARY
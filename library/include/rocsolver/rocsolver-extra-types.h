@@ -164,4 +164,35 @@ typedef enum rocsolver_rfinfo_mode_
     = 272, /**< To work with Cholesky factorization (for symmetric positive definite sparse matrices). */
 } rocsolver_rfinfo_mode;
 
+/*! \brief Used to specify the matrix norm computed by the norm functions, or the norm
+ *in which a condition number is estimated.
+ ********************************************************************************/
+typedef enum rocsolver_norm_type_
+{
+    rocsolver_norm_one = 281, /**< One-norm (maximum absolute column sum). */
+    rocsolver_norm_inf = 282, /**< Infinity-norm (maximum absolute row sum). */
+    rocsolver_norm_max = 283, /**< Largest absolute value of the entries. */
+    rocsolver_norm_frobenius = 284, /**< Frobenius norm (square root of the sum of squares). */
+} rocsolver_norm_type;
+
+/*! \brief Used to specify (or report) the form of equilibration that was applied to a
+ *matrix before its factorization.
+ ********************************************************************************/
+typedef enum rocsolver_equed_
+{
+    rocsolver_equed_none = 291, /**< No equilibration. */
+    rocsolver_equed_row = 292, /**< Row equilibration, i.e., A was replaced by diag(R)*A. */
+    rocsolver_equed_col = 293, /**< Column equilibration, i.e., A was replaced by A*diag(C). */
+    rocsolver_equed_both
+    = 294, /**< Row and column equilibration, i.e., A was replaced by diag(R)*A*diag(C). */
+} rocsolver_equed;
+
+/*! \brief Used to specify the method used to solve least-squares problems.
+ ********************************************************************************/
+typedef enum rocsolver_lsq_mode_
+{
+    rocsolver_lsq_mode_qr = 301, /**< QR (or LQ) factorization of A, as in GELS. */
+    rocsolver_lsq_mode_normal = 302, /**< Normal equations solved with a Cholesky factorization. */
+} rocsolver_lsq_mode;
+
 #endif /* ROCSOLVER_EXTRA_TYPES_H */
@@ -0,0 +1,144 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** INTERLEAVE_KERNEL copies a batch of matrices between the strided and the interleaved
+    layouts. Each thread-block works on a tile of BS2 elements x BS2 instances that is
+    transposed through shared memory, so that both the reads and the writes are coalesced
+    (consecutive threads access consecutive elements of the matrix in the strided layout,
+    and consecutive instances of the batch in the interleaved layout) **/
+template <bool TO_INTERLEAVED, typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2* BS2) interleave_kernel(const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    T* A,
+                                                                    const rocblas_int inca,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    T* B,
+                                                                    const rocblas_int incb,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_stride strideB,
+                                                                    const rocblas_int batch_count)
+{
+    __shared__ T tile[BS2][BS2 + 1];
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+    rocblas_int b0 = hipBlockIdx_x * BS2;
+    rocblas_int e0 = hipBlockIdx_y * BS2;
+    rocblas_int mn = m * n;
+    rocblas_int e, b;
+
+    // read tile from A
+    e = e0 + (TO_INTERLEAVED ? tx : ty);
+    b = b0 + (TO_INTERLEAVED ? ty : tx);
+    if(e < mn && b < batch_count)
+        tile[e - e0][b - b0] = A[b * strideA + (e % m) * inca + (e / m) * lda];
+    __syncthreads();
+
+    // write tile to B
+    e = e0 + (TO_INTERLEAVED ? ty : tx);
+    b = b0 + (TO_INTERLEAVED ? tx : ty);
+    if(e < mn && b < batch_count)
+        B[b * strideB + (e % m) * incb + (e / m) * ldb] = tile[e - e0][b - b0];
+}
+
+template <typename T>
+rocblas_status rocsolver_interleave_argCheck(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int inca,
+                                             const rocblas_int lda,
+                                             const rocblas_int incb,
+                                             const rocblas_int ldb,
+                                             T A,
+                                             T B,
+                                             const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || inca < 1 || lda < inca * m || incb < 1 || ldb < incb * m
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && batch_count && !A) || (m && n && batch_count && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool TO_INTERLEAVED, typename T>
+rocblas_status rocsolver_interleave_template(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             T* A,
+                                             const rocblas_int inca,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             T* B,
+                                             const rocblas_int incb,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("interleave", "to_interleaved:", TO_INTERLEAVED, "m:", m, "n:", n,
+                    "inca:", inca, "lda:", lda, "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksb = (batch_count - 1) / BS2 + 1;
+    rocblas_int blockse = (m * n - 1) / BS2 + 1;
+    dim3 grid(blocksb, blockse, 1);
+    dim3 threads(BS2, BS2, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL((interleave_kernel<TO_INTERLEAVED, T>), grid, threads, 0, stream, m, n,
+                            A, inca, lda, strideA, B, incb, ldb, strideB, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,191 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** NORM_BLOCK_REDUCE reduces the values held by the BS1 threads of a block to their sum
+    (or their maximum if MAX = true). The result is returned to all the threads.
+    Array sval must be a shared-memory array of dimension BS1. **/
+template <bool MAX, typename S>
+__device__ S norm_block_reduce(S val, S* sval)
+{
+    rocblas_int tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] = MAX ? std::max(sval[tid], sval[tid + i]) : sval[tid] + sval[tid + i];
+        __syncthreads();
+    }
+
+    S res = sval[0];
+    __syncthreads();
+    return res;
+}
+
+/** LANGE_KERNEL computes the one, infinity, max or Frobenius norm of a general m-by-n
+    matrix. Each instance of the batch is processed by a thread block. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) lange_kernel(const rocsolver_norm_type norm,
+                                                          const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          U AA,
+                                                          const rocblas_stride shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          S* normA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    __shared__ S sval[BS1];
+    S res = 0;
+
+    if(norm == rocsolver_norm_one)
+    {
+        // each column sum is reduced by the whole block
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            S sum = 0;
+            for(rocblas_int i = tid; i < m; i += BS1)
+                sum += std::abs(A[i + j * static_cast<int64_t>(lda)]);
+            sum = norm_block_reduce<false>(sum, sval);
+            res = std::max(res, sum);
+        }
+    }
+    else if(norm == rocsolver_norm_inf)
+    {
+        // each thread computes the sums of its rows
+        for(rocblas_int i = tid; i < m; i += BS1)
+        {
+            S sum = 0;
+            for(rocblas_int j = 0; j < n; j++)
+                sum += std::abs(A[i + j * static_cast<int64_t>(lda)]);
+            res = std::max(res, sum);
+        }
+        res = norm_block_reduce<true>(res, sval);
+    }
+    else
+    {
+        for(rocblas_int j = 0; j < n; j++)
+            for(rocblas_int i = tid; i < m; i += BS1)
+                res = std::max(res, std::abs(A[i + j * static_cast<int64_t>(lda)]));
+        res = norm_block_reduce<true>(res, sval);
+
+        // the sum of squares is scaled by the largest entry to avoid overflow
+        if(norm == rocsolver_norm_frobenius && res > 0)
+        {
+            S sum = 0;
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = tid; i < m; i += BS1)
+                {
+                    S a = std::abs(A[i + j * static_cast<int64_t>(lda)]) / res;
+                    sum += a * a;
+                }
+            }
+            res *= std::sqrt(norm_block_reduce<false>(sum, sval));
+        }
+    }
+
+    if(tid == 0)
+        normA[bid] = res;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_lange_argCheck(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        S* anorm,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm != rocsolver_norm_one && norm != rocsolver_norm_inf && norm != rocsolver_norm_max
+       && norm != rocsolver_norm_frobenius)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (batch_count && !anorm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lange_template(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* anorm,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lange", "norm:", norm, "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // (if m = 0 or n = 0, anorm = 0)
+    ROCSOLVER_LAUNCH_KERNEL((lange_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                            norm, m, n, A, shiftA, lda, strideA, anorm);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
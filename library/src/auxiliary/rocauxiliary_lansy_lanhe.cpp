@@ -0,0 +1,239 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_lansy_lanhe.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_lansy_impl(rocblas_handle handle,
+                                    const rocsolver_norm_type norm,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    S* anorm,
+                                    const rocblas_int batch_count)
+{
+    constexpr bool COMPLEX = rocblas_is_complex<T>;
+    const char* name;
+    if(BATCHED)
+        name = (COMPLEX ? "lanhe_batched" : "lansy_batched");
+    else if(STRIDED)
+        name = (COMPLEX ? "lanhe_strided_batched" : "lansy_strided_batched");
+    else
+        name = (COMPLEX ? "lanhe" : "lansy");
+    ROCSOLVER_ENTER_TOP(name, "--norm", norm, "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_lansy_argCheck(handle, norm, uplo, n, lda, A, anorm, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_lansy_template<T>(handle, norm, uplo, n, A, shiftA, lda, strideA, anorm,
+                                       batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_slansy(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                float* anorm)
+{
+    return rocsolver::rocsolver_lansy_impl<false, false, float>(handle, norm, uplo, n, A, lda, 0,
+                                                                anorm, 1);
+}
+
+rocblas_status rocsolver_dlansy(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                double* anorm)
+{
+    return rocsolver::rocsolver_lansy_impl<false, false, double>(handle, norm, uplo, n, A, lda, 0,
+                                                                 anorm, 1);
+}
+
+rocblas_status rocsolver_slansy_batched(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        float* anorm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<true, false, float>(handle, norm, uplo, n, A, lda, 0,
+                                                               anorm, batch_count);
+}
+
+rocblas_status rocsolver_dlansy_batched(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        double* anorm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<true, false, double>(handle, norm, uplo, n, A, lda, 0,
+                                                                anorm, batch_count);
+}
+
+rocblas_status rocsolver_slansy_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* anorm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<false, true, float>(handle, norm, uplo, n, A, lda,
+                                                               strideA, anorm, batch_count);
+}
+
+rocblas_status rocsolver_dlansy_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* anorm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<false, true, double>(handle, norm, uplo, n, A, lda,
+                                                                strideA, anorm, batch_count);
+}
+
+rocblas_status rocsolver_clanhe(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                float* anorm)
+{
+    return rocsolver::rocsolver_lansy_impl<false, false, rocblas_float_complex>(
+        handle, norm, uplo, n, A, lda, 0, anorm, 1);
+}
+
+rocblas_status rocsolver_zlanhe(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                double* anorm)
+{
+    return rocsolver::rocsolver_lansy_impl<false, false, rocblas_double_complex>(
+        handle, norm, uplo, n, A, lda, 0, anorm, 1);
+}
+
+rocblas_status rocsolver_clanhe_batched(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        float* anorm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<true, false, rocblas_float_complex>(
+        handle, norm, uplo, n, A, lda, 0, anorm, batch_count);
+}
+
+rocblas_status rocsolver_zlanhe_batched(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        double* anorm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<true, false, rocblas_double_complex>(
+        handle, norm, uplo, n, A, lda, 0, anorm, batch_count);
+}
+
+rocblas_status rocsolver_clanhe_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* anorm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<false, true, rocblas_float_complex>(
+        handle, norm, uplo, n, A, lda, strideA, anorm, batch_count);
+}
+
+rocblas_status rocsolver_zlanhe_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* anorm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_lansy_impl<false, true, rocblas_double_complex>(
+        handle, norm, uplo, n, A, lda, strideA, anorm, batch_count);
+}
+}
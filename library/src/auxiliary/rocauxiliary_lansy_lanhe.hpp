@@ -0,0 +1,183 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_lange.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** LANSY_KERNEL computes the one, infinity, max or Frobenius norm of a symmetric (or
+    Hermitian) n-by-n matrix, of which only the triangular part indicated by uplo is
+    referenced. In the Hermitian case the imaginary parts of the diagonal are assumed to be
+    zero. Each instance of the batch is processed by a thread block. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) lansy_kernel(const rocsolver_norm_type norm,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          U AA,
+                                                          const rocblas_stride shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          S* normA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    bool upper = (uplo == rocblas_fill_upper);
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    __shared__ S sval[BS1];
+    S res = 0;
+
+    if(norm == rocsolver_norm_one || norm == rocsolver_norm_inf)
+    {
+        // (one-norm and infinity-norm coincide)
+        // each thread computes the sums of its rows, reading the referenced triangle
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            S sum = std::abs(std::real(A[i + i * static_cast<int64_t>(lda)]));
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(j == i)
+                    continue;
+                bool stored = (upper ? i < j : i > j);
+                sum += std::abs(stored ? A[i + j * static_cast<int64_t>(lda)]
+                                       : A[j + i * static_cast<int64_t>(lda)]);
+            }
+            res = std::max(res, sum);
+        }
+        res = norm_block_reduce<true>(res, sval);
+    }
+    else
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            rocblas_int i0 = (upper ? 0 : j + 1);
+            rocblas_int i1 = (upper ? j : n);
+            for(rocblas_int i = i0 + tid; i < i1; i += BS1)
+                res = std::max(res, std::abs(A[i + j * static_cast<int64_t>(lda)]));
+        }
+        for(rocblas_int i = tid; i < n; i += BS1)
+            res = std::max(res, std::abs(std::real(A[i + i * static_cast<int64_t>(lda)])));
+        res = norm_block_reduce<true>(res, sval);
+
+        // the sum of squares is scaled by the largest entry to avoid overflow
+        // (off-diagonal entries are counted twice)
+        if(norm == rocsolver_norm_frobenius && res > 0)
+        {
+            S sum = 0;
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                rocblas_int i0 = (upper ? 0 : j + 1);
+                rocblas_int i1 = (upper ? j : n);
+                for(rocblas_int i = i0 + tid; i < i1; i += BS1)
+                {
+                    S a = std::abs(A[i + j * static_cast<int64_t>(lda)]) / res;
+                    sum += 2 * a * a;
+                }
+            }
+            for(rocblas_int i = tid; i < n; i += BS1)
+            {
+                S a = std::abs(std::real(A[i + i * static_cast<int64_t>(lda)])) / res;
+                sum += a * a;
+            }
+            res *= std::sqrt(norm_block_reduce<false>(sum, sval));
+        }
+    }
+
+    if(tid == 0)
+        normA[bid] = res;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_lansy_argCheck(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        S* anorm,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm != rocsolver_norm_one && norm != rocsolver_norm_inf && norm != rocsolver_norm_max
+       && norm != rocsolver_norm_frobenius)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lansy_template(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* anorm,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lansy", "norm:", norm, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // (if n = 0, anorm = 0)
+    ROCSOLVER_LAUNCH_KERNEL((lansy_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                            norm, uplo, n, A, shiftA, lda, strideA, anorm);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
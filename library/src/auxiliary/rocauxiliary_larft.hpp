@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include "ideal_sizes.hpp"
+#include "lib_host_helpers.hpp"
 #include "rocauxiliary_lacgv.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
@@ -161,6 +163,155 @@ ROCSOLVER_KERNEL void set_tau(const rocblas_int k, T* tau, const rocblas_stride
     }
 }
 
+/** LARFT_GRAM_KERNEL sets the diagonal of T to tau, zeros the not used triangular part,
+    and completes the products G = V' * V of the Householder vectors in the used triangular part,
+    accounting for the non-stored 1's and zeros of the vectors. If add is true, F already
+    contains the contribution of the dense part of V (computed with GEMM). **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void larft_gram_kernel(const rocblas_int n,
+                                        const rocblas_int k,
+                                        U V,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        T* tau,
+                                        const rocblas_stride strideT,
+                                        T* F,
+                                        const rocblas_int ldf,
+                                        const rocblas_stride strideF,
+                                        const rocblas_direct direct,
+                                        const rocblas_storev storev,
+                                        const bool add)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto i = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < k && j < k)
+    {
+        T *tp, *Vp, *Fp;
+        tp = tau + b * strideT;
+        Vp = load_ptr_batch<T>(V, b, shiftV, strideV);
+        Fp = F + b * strideF;
+
+        const bool forward = (direct == rocblas_forward_direction);
+        const bool colwise = (storev == rocblas_column_wise);
+
+        // element (r,c) of the matrix whose columns are the Householder vectors
+        auto vs = [&](rocblas_int r, rocblas_int c) -> T {
+            return colwise ? Vp[r + c * ldv] : conj(Vp[c + r * ldv]);
+        };
+
+        if(j == i)
+            Fp[j + i * ldf] = tp[i];
+        else if((forward && j < i) || (!forward && j > i))
+        {
+            // the unit element of vector i is in row p, and its zeros are
+            // outside the rows [r0, r1) and p
+            rocblas_int p, r0, r1;
+            if(forward)
+            {
+                p = i;
+                r0 = i + 1;
+                r1 = k;
+            }
+            else
+            {
+                p = n - k + i;
+                r0 = n - k;
+                r1 = p;
+            }
+
+            T g = add ? Fp[j + i * ldf] : T(0);
+            g += conj(vs(p, j));
+            for(rocblas_int r = r0; r < r1; ++r)
+                g += conj(vs(r, j)) * vs(r, i);
+
+            Fp[j + i * ldf] = g;
+        }
+        else
+            Fp[j + i * ldf] = 0;
+    }
+}
+
+/** LARFT_LEAF_KERNEL computes the diagonal blocks of size LARFT_SMALL_MAX_K of the
+    triangular factor T from the products G stored in F (as set by larft_gram_kernel).
+    There is one work-group per diagonal block and matrix in the batch, and the columns
+    of each block are resolved in shared memory. **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(LARFT_SMALL_MAX_K)
+    larft_leaf_kernel(const rocblas_int k,
+                      T* tau,
+                      const rocblas_stride strideT,
+                      T* F,
+                      const rocblas_int ldf,
+                      const rocblas_stride strideF,
+                      const rocblas_direct direct)
+{
+    const auto b = hipBlockIdx_y;
+    const rocblas_int s = hipBlockIdx_x * LARFT_SMALL_MAX_K;
+    const rocblas_int j = hipThreadIdx_x;
+    const rocblas_int kb = std::min(k - s, LARFT_SMALL_MAX_K);
+
+    T *tp, *Fp;
+    tp = tau + b * strideT + s;
+    Fp = F + b * strideF + idx2D(s, s, ldf);
+
+    // shared memory for the column of G being processed
+    __shared__ T sg[LARFT_SMALL_MAX_K];
+
+    if(direct == rocblas_forward_direction)
+    {
+        // T(0:i-1,i) = -tau(i) * T(0:i-1,0:i-1) * G(0:i-1,i)
+        for(rocblas_int i = 1; i < kb; ++i)
+        {
+            if(j < i)
+                sg[j] = Fp[j + i * ldf];
+            __syncthreads();
+
+            if(j < i)
+            {
+                T t = 0;
+                for(rocblas_int l = j; l < i; ++l)
+                    t += Fp[j + l * ldf] * sg[l];
+                Fp[j + i * ldf] = -tp[i] * t;
+            }
+            __syncthreads();
+        }
+    }
+    else
+    {
+        // T(i+1:kb-1,i) = -tau(i) * T(i+1:kb-1,i+1:kb-1) * G(i+1:kb-1,i)
+        for(rocblas_int i = kb - 2; i >= 0; --i)
+        {
+            if(j > i && j < kb)
+                sg[j] = Fp[j + i * ldf];
+            __syncthreads();
+
+            if(j > i && j < kb)
+            {
+                T t = 0;
+                for(rocblas_int l = i + 1; l <= j; ++l)
+                    t += Fp[j + l * ldf] * sg[l];
+                Fp[j + i * ldf] = -tp[i] * t;
+            }
+            __syncthreads();
+        }
+    }
+}
+
+/** LARFT_USE_GEMM returns true if the triangular factor T of k Householder vectors
+    of order n is built from the products of the vectors (computed with GEMM) and
+    recursive TRMM merges, and false if it is built one column at a time with
+    GEMV and TRMV **/
+inline bool larft_use_gemm(const rocblas_int n, const rocblas_int k)
+{
+    rocblas_int mink[] = {LARFT_GEMM_MIN_K};
+    rocblas_int intervals[] = {LARFT_GEMM_INTERVALS};
+    rocblas_int max = LARFT_GEMM_NUM_INTERVALS;
+    return k >= mink[get_index(intervals, max, n)];
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_larft_getMemorySize(const rocblas_int n,
                                    const rocblas_int k,
@@ -182,6 +333,7 @@ void rocsolver_larft_getMemorySize(const rocblas_int n,
     *size_scalars = sizeof(T) * 3;
 
     // size of re-usable workspace
+    // (only used when T is built one column at a time)
     *size_work = sizeof(T) * k * batch_count;
 
     // size of array of pointers to workspace
@@ -229,41 +381,31 @@ rocblas_status rocsolver_larft_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
-rocblas_status rocsolver_larft_template(rocblas_handle handle,
-                                        const rocblas_direct direct,
-                                        const rocblas_storev storev,
-                                        const rocblas_int n,
-                                        const rocblas_int k,
-                                        U V,
-                                        const rocblas_int shiftV,
-                                        const rocblas_int ldv,
-                                        const rocblas_stride strideV,
-                                        T* tau,
-                                        const rocblas_stride strideT,
-                                        T* F,
-                                        const rocblas_int ldf,
-                                        const rocblas_stride strideF,
-                                        const rocblas_int batch_count,
-                                        T* scalars,
-                                        T* work,
-                                        T** workArr)
+/** LARFT_BY_COLUMNS computes the triangular factor T one column at a time,
+    with a GEMV and a TRMV per column (pointer mode must be device) **/
+template <typename T, typename U, bool COMPLEX>
+void larft_by_columns(rocblas_handle handle,
+                      const rocblas_direct direct,
+                      const rocblas_storev storev,
+                      const rocblas_int n,
+                      const rocblas_int k,
+                      U V,
+                      const rocblas_int shiftV,
+                      const rocblas_int ldv,
+                      const rocblas_stride strideV,
+                      T* tau,
+                      const rocblas_stride strideT,
+                      T* F,
+                      const rocblas_int ldf,
+                      const rocblas_stride strideF,
+                      const rocblas_int batch_count,
+                      T* scalars,
+                      T* work,
+                      T** workArr)
 {
-    ROCSOLVER_ENTER("larft", "direct:", direct, "storev:", storev, "n:", n, "k:", k,
-                    "shiftV:", shiftV, "ldv:", ldv, "ldf:", ldf, "bc:", batch_count);
-
-    // quick return
-    if(n == 0 || batch_count == 0)
-        return rocblas_status_success;
-
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // everything must be executed with scalars on the device
-    rocblas_pointer_mode old_mode;
-    rocblas_get_pointer_mode(handle, &old_mode);
-    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
-
     rocblas_stride stridew = rocblas_stride(k);
     rocblas_diagonal diag = rocblas_diagonal_non_unit;
     rocblas_fill uplo;
@@ -370,6 +512,128 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     // restore tau
     ROCSOLVER_LAUNCH_KERNEL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau,
                             strideT);
+}
+
+template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_larft_template(rocblas_handle handle,
+                                        const rocblas_direct direct,
+                                        const rocblas_storev storev,
+                                        const rocblas_int n,
+                                        const rocblas_int k,
+                                        U V,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        T* tau,
+                                        const rocblas_stride strideT,
+                                        T* F,
+                                        const rocblas_int ldf,
+                                        const rocblas_stride strideF,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        T* work,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("larft", "direct:", direct, "storev:", storev, "n:", n, "k:", k,
+                    "shiftV:", shiftV, "ldv:", ldv, "ldf:", ldf, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the device
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    // few Householder vectors: build T one column at a time
+    if(!larft_use_gemm(n, k))
+    {
+        larft_by_columns<T, U, COMPLEX>(handle, direct, storev, n, k, V, shiftV, ldv, strideV, tau,
+                                        strideT, F, ldf, strideF, batch_count, scalars, work,
+                                        workArr);
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
+    const bool forward = (direct == rocblas_forward_direction);
+    const rocblas_int nb = LARFT_SMALL_MAX_K;
+
+    // **** FOR NOW, IT DOES NOT LOOK FOR TRAILING ZEROS
+    //      AS THIS WOULD REQUIRE SYNCHRONIZATION WITH GPU.
+    //      IT WILL WORK ON THE ENTIRE MATRIX/VECTOR REGARDLESS OF
+    //      ZERO ENTRIES ****
+
+    // compute the products of the householder vectors over the rows (or columns)
+    // where they are dense: G = V2' * V2
+    bool add = (n > k);
+    if(add)
+    {
+        rocblas_int offV = 0;
+        if(forward)
+            offV = (storev == rocblas_column_wise) ? idx2D(k, 0, ldv) : idx2D(0, k, ldv);
+
+        if(storev == rocblas_column_wise)
+            rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none,
+                             k, k, n - k, scalars + 2, V, shiftV + offV, ldv, strideV, V,
+                             shiftV + offV, ldv, strideV, scalars + 1, F, 0, ldf, strideF,
+                             batch_count, workArr);
+        else
+            rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                             k, k, n - k, scalars + 2, V, shiftV + offV, ldv, strideV, V,
+                             shiftV + offV, ldv, strideV, scalars + 1, F, 0, ldf, strideF,
+                             batch_count, workArr);
+    }
+
+    // Fix diagonal of T, make zero the not used triangular part, and
+    // account for the non-stored 1's and zeros on the householder vectors
+    rocblas_int blocks = (k - 1) / 32 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(larft_gram_kernel<T>, dim3(blocks, blocks, batch_count), dim3(32, 32),
+                            0, stream, n, k, V, shiftV, ldv, strideV, tau, strideT, F, ldf,
+                            strideF, direct, storev, add);
+
+    // compute the diagonal blocks of T
+    blocks = (k - 1) / nb + 1;
+    ROCSOLVER_LAUNCH_KERNEL(larft_leaf_kernel<T>, dim3(blocks, batch_count), dim3(nb), 0, stream,
+                            k, tau, strideT, F, ldf, strideF, direct);
+
+    // recursively merge the diagonal blocks:
+    //    T12 = -T1 * G12 * T2 (forward direction)
+    // or T21 = -T2 * G21 * T1 (backward direction)
+    for(rocblas_int w = nb; w < k; w *= 2)
+    {
+        for(rocblas_int s = 0; s + w < k; s += 2 * w)
+        {
+            rocblas_int k1 = w;
+            rocblas_int k2 = std::min(w, k - s - w);
+
+            if(forward)
+            {
+                rocblasCall_trmm(handle, rocblas_side_left, rocblas_fill_upper,
+                                 rocblas_operation_none, rocblas_diagonal_non_unit, k1, k2, scalars,
+                                 0, F, idx2D(s, s, ldf), ldf, strideF, F, idx2D(s, s + k1, ldf),
+                                 ldf, strideF, batch_count);
+                rocblasCall_trmm(handle, rocblas_side_right, rocblas_fill_upper,
+                                 rocblas_operation_none, rocblas_diagonal_non_unit, k1, k2,
+                                 scalars + 2, 0, F, idx2D(s + k1, s + k1, ldf), ldf, strideF, F,
+                                 idx2D(s, s + k1, ldf), ldf, strideF, batch_count);
+            }
+            else
+            {
+                rocblasCall_trmm(handle, rocblas_side_left, rocblas_fill_lower,
+                                 rocblas_operation_none, rocblas_diagonal_non_unit, k2, k1, scalars,
+                                 0, F, idx2D(s + k1, s + k1, ldf), ldf, strideF, F,
+                                 idx2D(s + k1, s, ldf), ldf, strideF, batch_count);
+                rocblasCall_trmm(handle, rocblas_side_right, rocblas_fill_lower,
+                                 rocblas_operation_none, rocblas_diagonal_non_unit, k2, k1,
+                                 scalars + 2, 0, F, idx2D(s, s, ldf), ldf, strideF, F,
+                                 idx2D(s + k1, s, ldf), ldf, strideF, batch_count);
+            }
+        }
+    }
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
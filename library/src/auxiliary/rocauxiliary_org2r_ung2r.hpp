@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "ideal_sizes.hpp"
 #include "rocauxiliary_larf.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
@@ -69,6 +70,99 @@ ROCSOLVER_KERNEL void org2r_init_ident(const rocblas_int m,
     }
 }
 
+/** ORG2R_SMALL_GENERATE applies, in shared memory, the first k Householder reflectors stored
+    below the diagonal of sA (with leading dimension m) to the columns of the identity, as in
+    org2r_init_ident. sw must have room for n elements. **/
+template <typename T>
+__device__ void org2r_small_generate(const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int k,
+                                     T* sA,
+                                     T* sw,
+                                     const T* tau,
+                                     const rocblas_int tid)
+{
+    for(rocblas_int j = k - 1; j >= 0; --j)
+    {
+        // v is the j-th column of A from the diagonal down
+        T* v = sA + j + j * m;
+        const rocblas_int mj = m - j;
+        const rocblas_int nj = n - j - 1;
+        const T t = tau[j];
+
+        // apply H(j) = I - tau * v * v' to Q(j:m-1,j+1:n-1)
+        for(rocblas_int c = tid; c < nj; c += GEQR2_SMALL_THREADS)
+        {
+            T* a = v + (c + 1) * m;
+            T w = 0;
+            for(rocblas_int i = 0; i < mj; ++i)
+                w += conj(v[i]) * a[i];
+            sw[c] = t * w;
+        }
+        __syncthreads();
+        for(rocblas_int e = tid; e < mj * nj; e += GEQR2_SMALL_THREADS)
+        {
+            rocblas_int i = e % mj;
+            rocblas_int c = e / mj;
+            v[i + (c + 1) * m] -= v[i] * sw[c];
+        }
+        __syncthreads();
+
+        // update j-th column -corresponding to H(j)-
+        for(rocblas_int i = tid + 1; i < mj; i += GEQR2_SMALL_THREADS)
+            v[i] *= -t;
+        if(tid == 0)
+            v[0] = T(1) - t;
+        __syncthreads();
+    }
+}
+
+/** ORG2R_SMALL_KERNEL generates the matrices Q of small problems with one work-group
+    per matrix in the batch. The Householder vectors are loaded into shared memory, where
+    the reflectors are applied to the identity, and Q is written back only once at the end.
+
+    Call this kernel with GEQR2_SMALL_THREADS threads and shared memory for
+    m * n + n elements of type T. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GEQR2_SMALL_THREADS)
+    org2r_small_kernel(const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int k,
+                       U A,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       T* ipiv,
+                       const rocblas_stride strideP)
+{
+    const auto b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* tau = ipiv + b * strideP;
+
+    // shared memory for the matrix (with leading dimension m) and the products of the
+    // reflector with the trailing columns
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    T* sw = sA + m * n;
+
+    // keep the k Householder vectors below the diagonal and initialize the rest
+    // to the identity (as in org2r_init_ident)
+    for(rocblas_int e = tid; e < m * n; e += GEQR2_SMALL_THREADS)
+    {
+        rocblas_int i = e % m;
+        rocblas_int j = e / m;
+        sA[e] = (i == j) ? T(1) : (i > j && j < k) ? Ap[i + j * lda] : T(0);
+    }
+    __syncthreads();
+
+    org2r_small_generate(m, n, k, sA, sw, tau, tid);
+
+    for(rocblas_int e = tid; e < m * n; e += GEQR2_SMALL_THREADS)
+        Ap[(e % m) + (e / m) * lda] = sA[e];
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_org2r_ung2r_getMemorySize(const rocblas_int m,
                                          const rocblas_int n,
@@ -146,6 +240,16 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // if the matrix is small, generate it in shared memory with a single kernel launch
+    if(m <= ORG2R_MAX_SMALL_SIZE(T))
+    {
+        size_t lmemsize = sizeof(T) * (m * n + n);
+        ROCSOLVER_LAUNCH_KERNEL((org2r_small_kernel<T>), dim3(batch_count),
+                                dim3(GEQR2_SMALL_THREADS), lmemsize, stream, m, n, k, A, shiftA,
+                                lda, strideA, ipiv, strideP);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
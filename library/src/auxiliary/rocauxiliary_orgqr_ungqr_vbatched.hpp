@@ -0,0 +1,197 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** ORGQR_VBATCHED_ORG2R generates the m-by-n matrix Q with orthonormal columns defined by the
+    first k Householder reflectors stored in A (with leading dimension lda) and the scalars
+    tau, using all the threads of the work-group. sw must have room for one element per
+    thread. **/
+template <typename T>
+__device__ void orgqr_vbatched_org2r(const rocblas_int tid,
+                                     const rocblas_int nt,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int k,
+                                     T* A,
+                                     const rocblas_int lda,
+                                     const T* tau,
+                                     T* sw)
+{
+    // initialize columns k:n-1 to the columns of the identity
+    for(rocblas_int e = tid; e < m * (n - k); e += nt)
+    {
+        rocblas_int i = e % m;
+        rocblas_int j = k + e / m;
+        A[i + j * lda] = (i == j) ? 1 : 0;
+    }
+    __syncthreads();
+
+    for(rocblas_int j = k - 1; j >= 0; --j)
+    {
+        T* v = A + j + j * lda;
+        const T t = tau[j];
+
+        // apply H(j) to A(j:m-1,j+1:n-1)
+        vbatched_larf_left(tid, nt, m - j, n - j - 1, v, 1, t, v + lda, 1, lda, sw);
+
+        // update the j-th column
+        for(rocblas_int i = tid; i < m; i += nt)
+        {
+            if(i < j)
+                A[i + j * lda] = 0;
+            else if(i == j)
+                A[i + j * lda] = T(1) - t;
+            else
+                A[i + j * lda] *= -t;
+        }
+        __syncthreads();
+    }
+}
+
+/** ORGQR_VBATCHED_KERNEL generates the matrices Q of the batch instances in the size class
+    with bounds lo and hi, with one work-group per instance. The instances with invalid
+    dimensions are skipped. **/
+template <typename T>
+ROCSOLVER_KERNEL void orgqr_vbatched_kernel(const rocblas_int lo,
+                                            const rocblas_int hi,
+                                            const bool lds,
+                                            const rocblas_int* mm,
+                                            const rocblas_int* nn,
+                                            const rocblas_int* kk,
+                                            T* const A[],
+                                            const rocblas_int* ldaa,
+                                            T* ipiv,
+                                            const rocblas_stride strideP)
+{
+    using S = decltype(std::real(T{}));
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nt = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int k = kk[b];
+    const rocblas_int lda = ldaa[b];
+
+    if(m < 0 || n < 0 || n > m || k < 0 || k > n || lda < m)
+        return;
+    if(!vbatched_in_class(m, lo, hi) || n == 0)
+        return;
+
+    extern __shared__ double lmem[];
+    T *sA, *sw, *sp;
+    S* sval;
+    rocblas_int* sidx;
+    vbatched_lmem(lmem, lds ? m * n : 0, &sA, &sw, &sp, &sval, &sidx);
+
+    T* Ap = A[b];
+    if(lds)
+        vbatched_load(tid, nt, m, n, Ap, lda, sA);
+
+    orgqr_vbatched_org2r(tid, nt, m, n, k, lds ? sA : Ap, lds ? m : lda, ipiv + b * strideP, sw);
+
+    if(lds)
+        vbatched_store(tid, nt, m, n, sA, Ap, lda);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_orgqr_ungqr_vbatched_argCheck(rocblas_handle handle,
+                                                       const rocblas_int* m,
+                                                       const rocblas_int* n,
+                                                       const rocblas_int* k,
+                                                       T A,
+                                                       const rocblas_int* lda,
+                                                       U ipiv,
+                                                       const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the dimensions of the batch instances are only read on the device; instances with
+    // invalid dimensions are skipped)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !k || !A || !lda || !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_orgqr_ungqr_vbatched_template(rocblas_handle handle,
+                                                       const rocblas_int* m,
+                                                       const rocblas_int* n,
+                                                       const rocblas_int* k,
+                                                       T* const A[],
+                                                       const rocblas_int* lda,
+                                                       T* ipiv,
+                                                       const rocblas_stride strideP,
+                                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("orgqr_ungqr_vbatched", "strideP:", strideP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // generate the matrices of each size class
+    // (the matrices of the small classes are kept in LDS)
+    for(rocblas_int c = 0; c <= VBATCHED_NUM_INTERVALS; ++c)
+    {
+        rocblas_int lo, hi, threads;
+        bool lds;
+        rocsolver_vbatched_class<T>(c, &lo, &hi, &threads, &lds);
+        size_t lmemsize = rocsolver_vbatched_lmem_size<T>(threads, lds ? hi * hi : 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(orgqr_vbatched_kernel<T>, dim3(batch_count), dim3(threads),
+                                lmemsize, stream, lo, hi, lds, m, n, k, A, lda, ipiv, strideP);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
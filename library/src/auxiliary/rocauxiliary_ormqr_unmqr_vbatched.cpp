@@ -0,0 +1,153 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+
+#include "rocauxiliary_ormqr_unmqr_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_ormqr_unmqr_vbatched_impl(rocblas_handle handle,
+                                                   const rocblas_side side,
+                                                   const rocblas_operation trans,
+                                                   const rocblas_int* m,
+                                                   const rocblas_int* n,
+                                                   const rocblas_int* k,
+                                                   T* const A[],
+                                                   const rocblas_int* lda,
+                                                   T* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   T* const C[],
+                                                   const rocblas_int* ldc,
+                                                   const rocblas_int batch_count)
+{
+    const char* name = (!rocblas_is_complex<T> ? "ormqr_vbatched" : "unmqr_vbatched");
+    ROCSOLVER_ENTER_TOP(name, "--side", side, "--trans", trans, "--strideP", strideP,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_ormqr_unmqr_vbatched_argCheck<COMPLEX>(
+        handle, side, trans, m, n, k, A, lda, ipiv, C, ldc, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_ormqr_unmqr_vbatched_template<T>(handle, side, trans, m, n, k, A, lda, ipiv,
+                                                      strideP, C, ldc, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sormqr_vbatched(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         const rocblas_int* k,
+                                         float* const A[],
+                                         const rocblas_int* lda,
+                                         float* ipiv,
+                                         const rocblas_stride strideP,
+                                         float* const C[],
+                                         const rocblas_int* ldc,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_ormqr_unmqr_vbatched_impl<float>(
+        handle, side, trans, m, n, k, A, lda, ipiv, strideP, C, ldc, batch_count);
+}
+
+rocblas_status rocsolver_dormqr_vbatched(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         const rocblas_int* k,
+                                         double* const A[],
+                                         const rocblas_int* lda,
+                                         double* ipiv,
+                                         const rocblas_stride strideP,
+                                         double* const C[],
+                                         const rocblas_int* ldc,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_ormqr_unmqr_vbatched_impl<double>(
+        handle, side, trans, m, n, k, A, lda, ipiv, strideP, C, ldc, batch_count);
+}
+
+rocblas_status rocsolver_cunmqr_vbatched(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         const rocblas_int* k,
+                                         rocblas_float_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_float_complex* ipiv,
+                                         const rocblas_stride strideP,
+                                         rocblas_float_complex* const C[],
+                                         const rocblas_int* ldc,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_ormqr_unmqr_vbatched_impl<rocblas_float_complex>(
+        handle, side, trans, m, n, k, A, lda, ipiv, strideP, C, ldc, batch_count);
+}
+
+rocblas_status rocsolver_zunmqr_vbatched(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         const rocblas_int* k,
+                                         rocblas_double_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_double_complex* ipiv,
+                                         const rocblas_stride strideP,
+                                         rocblas_double_complex* const C[],
+                                         const rocblas_int* ldc,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_ormqr_unmqr_vbatched_impl<rocblas_double_complex>(
+        handle, side, trans, m, n, k, A, lda, ipiv, strideP, C, ldc, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,214 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** ORMQR_VBATCHED_ORM2R multiplies the m-by-n matrix C (with leading dimension ldc) by the
+    matrix Q defined by the first k Householder reflectors stored in A (with leading dimension
+    lda) and the scalars tau, using all the threads of the work-group. sw must have room for
+    one element per thread. **/
+template <typename T>
+__device__ void ormqr_vbatched_orm2r(const rocblas_int tid,
+                                     const rocblas_int nt,
+                                     const rocblas_side side,
+                                     const rocblas_operation trans,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int k,
+                                     const T* A,
+                                     const rocblas_int lda,
+                                     const T* tau,
+                                     T* C,
+                                     const rocblas_int ldc,
+                                     T* sw)
+{
+    const bool left = (side == rocblas_side_left);
+    const bool notrans = (trans == rocblas_operation_none);
+
+    // Q = H(0) * H(1) * ... * H(k-1); the reflectors are applied in reverse order
+    // to compute Q * C and C * Q'
+    const bool backward = (left && notrans) || (!left && !notrans);
+
+    for(rocblas_int s = 0; s < k; ++s)
+    {
+        const rocblas_int i = backward ? k - 1 - s : s;
+        const T* v = A + i + i * lda;
+        const T t = notrans ? tau[i] : conj(tau[i]);
+
+        if(left)
+            vbatched_larf_left(tid, nt, m - i, n, v, 1, t, C + i, 1, ldc, sw);
+        else
+            vbatched_larf_right(tid, nt, m, n - i, v, 1, t, C + i * ldc, 1, ldc, sw);
+    }
+}
+
+/** ORMQR_VBATCHED_KERNEL applies the matrices Q to the batch instances in the size class with
+    bounds lo and hi, with one work-group per instance. The matrices C are kept in LDS when
+    lds is true. The instances with invalid dimensions are skipped. **/
+template <typename T>
+ROCSOLVER_KERNEL void ormqr_vbatched_kernel(const rocblas_int lo,
+                                            const rocblas_int hi,
+                                            const bool lds,
+                                            const rocblas_side side,
+                                            const rocblas_operation trans,
+                                            const rocblas_int* mm,
+                                            const rocblas_int* nn,
+                                            const rocblas_int* kk,
+                                            T* const A[],
+                                            const rocblas_int* ldaa,
+                                            T* ipiv,
+                                            const rocblas_stride strideP,
+                                            T* const C[],
+                                            const rocblas_int* ldcc)
+{
+    using S = decltype(std::real(T{}));
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nt = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int k = kk[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int ldc = ldcc[b];
+    const rocblas_int nq = (side == rocblas_side_left) ? m : n;
+
+    if(m < 0 || n < 0 || k < 0 || k > nq || lda < nq || ldc < m)
+        return;
+    if(!vbatched_in_class(std::max(m, n), lo, hi) || m == 0 || n == 0 || k == 0)
+        return;
+
+    extern __shared__ double lmem[];
+    T *sA, *sw, *sp;
+    S* sval;
+    rocblas_int* sidx;
+    vbatched_lmem(lmem, lds ? m * n : 0, &sA, &sw, &sp, &sval, &sidx);
+
+    T* Cp = C[b];
+    if(lds)
+        vbatched_load(tid, nt, m, n, Cp, ldc, sA);
+
+    ormqr_vbatched_orm2r(tid, nt, side, trans, m, n, k, A[b], lda, ipiv + b * strideP,
+                         lds ? sA : Cp, lds ? m : ldc, sw);
+
+    if(lds)
+        vbatched_store(tid, nt, m, n, sA, Cp, ldc);
+}
+
+template <bool COMPLEX, typename T, typename U>
+rocblas_status rocsolver_ormqr_unmqr_vbatched_argCheck(rocblas_handle handle,
+                                                       const rocblas_side side,
+                                                       const rocblas_operation trans,
+                                                       const rocblas_int* m,
+                                                       const rocblas_int* n,
+                                                       const rocblas_int* k,
+                                                       T A,
+                                                       const rocblas_int* lda,
+                                                       U ipiv,
+                                                       T C,
+                                                       const rocblas_int* ldc,
+                                                       const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(side != rocblas_side_left && side != rocblas_side_right)
+        return rocblas_status_invalid_value;
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the dimensions of the batch instances are only read on the device; instances with
+    // invalid dimensions are skipped)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !k || !A || !lda || !ipiv || !C || !ldc))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_ormqr_unmqr_vbatched_template(rocblas_handle handle,
+                                                       const rocblas_side side,
+                                                       const rocblas_operation trans,
+                                                       const rocblas_int* m,
+                                                       const rocblas_int* n,
+                                                       const rocblas_int* k,
+                                                       T* const A[],
+                                                       const rocblas_int* lda,
+                                                       T* ipiv,
+                                                       const rocblas_stride strideP,
+                                                       T* const C[],
+                                                       const rocblas_int* ldc,
+                                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("ormqr_unmqr_vbatched", "side:", side, "trans:", trans, "strideP:", strideP,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // apply the reflectors to the matrices of each size class
+    // (the matrices C of the small classes are kept in LDS)
+    for(rocblas_int c = 0; c <= VBATCHED_NUM_INTERVALS; ++c)
+    {
+        rocblas_int lo, hi, threads;
+        bool lds;
+        rocsolver_vbatched_class<T>(c, &lo, &hi, &threads, &lds);
+        size_t lmemsize = rocsolver_vbatched_lmem_size<T>(threads, lds ? hi * hi : 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(ormqr_vbatched_kernel<T>, dim3(batch_count), dim3(threads),
+                                lmemsize, stream, lo, hi, lds, side, trans, m, n, k, A, lda, ipiv,
+                                strideP, C, ldc);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
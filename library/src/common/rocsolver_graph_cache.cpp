@@ -0,0 +1,113 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+
+#include "rocblas_utility.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+#define ROCSOLVER_GRAPH_CACHE_DEFAULT_SIZE 64
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// initialize the static variables
+rocsolver_graph_cache* rocsolver_graph_cache::_instance = nullptr;
+std::mutex rocsolver_graph_cache::_mutex;
+
+/***************************************************************************
+ * Graph cache set-up and tear-down
+ ***************************************************************************/
+
+rocblas_status rocsolver_graph_cache_begin_impl()
+{
+    const std::lock_guard<std::mutex> lock(rocsolver_graph_cache::_mutex);
+
+    // only one graph cache can be active at a time
+    if(rocsolver_graph_cache::_instance != nullptr)
+        return rocblas_status_internal_error;
+
+    // set max_graphs from environment variable ROCSOLVER_GRAPH_CACHE_SIZE or to default
+    size_t max_graphs = ROCSOLVER_GRAPH_CACHE_DEFAULT_SIZE;
+    if(const char* str_size = std::getenv("ROCSOLVER_GRAPH_CACHE_SIZE"))
+    {
+        errno = 0;
+        long value = strtol(str_size, 0, 0);
+        if(errno || value < 1 || size_t(value) > size_t(INT_MAX))
+            return rocblas_status_internal_error;
+        max_graphs = static_cast<size_t>(value);
+    }
+
+    rocsolver_graph_cache::_instance = new rocsolver_graph_cache(max_graphs);
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_graph_cache_end_impl()
+{
+    const std::lock_guard<std::mutex> lock(rocsolver_graph_cache::_mutex);
+
+    // there must be an active graph cache
+    if(rocsolver_graph_cache::_instance == nullptr)
+        return rocblas_status_internal_error;
+
+    // delete the cache and all the stored graphs
+    delete rocsolver_graph_cache::_instance;
+    rocsolver_graph_cache::_instance = nullptr;
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/***************************************************************************
+ * Graph cache API functions
+ ***************************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_graph_cache_begin()
+try
+{
+    return rocsolver::rocsolver_graph_cache_begin_impl();
+}
+catch(...)
+{
+    return rocsolver::exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_graph_cache_end()
+try
+{
+    return rocsolver::rocsolver_graph_cache_end_impl();
+}
+catch(...)
+{
+    return rocsolver::exception_to_rocblas_status();
+}
+}
@@ -31,6 +31,36 @@
     \brief ideal_sizes.hpp gathers all constants that can be tuned for performance.
  *********************************************************************************/
 
+/***************************** larft ******************************************
+*******************************************************************************/
+/*! \brief Determines the largest number of Householder vectors for which LARFT computes the
+    triangular factor T with a single kernel launch (after the GEMM). It applies to all the
+    blocked Householder routines (GEQRF, GELQF, GEQLF, GERQF, ORGxx/UNGxx and ORMxx/UNMxx).
+
+    \details LARFT first forms the products of the Householder vectors with one GEMM. If
+    k <= LARFT_SMALL_MAX_K, the recurrence for T is then resolved by one work-group per matrix
+    in the batch. Otherwise, the diagonal blocks of T of size LARFT_SMALL_MAX_K are computed in
+    this way, and are recursively merged into T with TRMM (must be <= 1024).*/
+#ifndef LARFT_SMALL_MAX_K
+#define LARFT_SMALL_MAX_K 64
+#endif
+
+/*! \brief Determines the minimum number of Householder vectors k for which LARFT builds
+    the triangular factor T with GEMM and TRMM (as described above).
+
+    \details With fewer vectors, T is built one column at a time with a GEMV and a TRMV per
+    column. The threshold LARFT_GEMM_MIN_K depends on the order n of the vectors: if n is in
+    the i-th interval of LARFT_GEMM_INTERVALS, the i-th value of LARFT_GEMM_MIN_K is used.*/
+#ifndef LARFT_GEMM_NUM_INTERVALS
+#define LARFT_GEMM_NUM_INTERVALS 2
+#endif
+#ifndef LARFT_GEMM_INTERVALS
+#define LARFT_GEMM_INTERVALS 64, 512
+#endif
+#ifndef LARFT_GEMM_MIN_K
+#define LARFT_GEMM_MIN_K 16, 8, 4
+#endif
+
 /***************** geqr2/geqrf and geql2/geqlf ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the block column factorized at each step
@@ -51,6 +81,58 @@
 #define GEQxF_GEQx2_SWITCHSIZE 128
 #endif
 
+/*! \brief Determines the maximum size at which GEQR2 factorizes the matrix with a single kernel
+    launch. It also applies to the corresponding batched and strided-batched routines, and to
+    GEQRF when the matrix is small enough to be factorized with GEQR2.
+
+    \details If m <= GEQR2_MAX_SMALL_SIZE(T) and n <= GEQR2_MAX_SMALL_SIZE(T), the whole matrix
+    is kept in LDS shared memory while the Householder reflectors are generated and applied.
+    The amount of LDS shared memory is assumed to be at least (64 * 1024) bytes. */
+#ifndef GEQR2_MAX_SMALL_SIZE
+#define GEQR2_MAX_SMALL_SIZE(T) ((sizeof(T) == 16) ? 56 : 64)
+#endif
+
+/*! \brief Determines the number of threads of the work-group that processes each matrix in the
+    single-launch GEQR2 and ORG2R/UNG2R kernels (must be a power of 2 and <= 1024). */
+#ifndef GEQR2_SMALL_THREADS
+#define GEQR2_SMALL_THREADS 256
+#endif
+
+/*! \brief Determines when the tiled QR factorization (TSQR) is used to solve tall least-squares
+    problems with GELS. It also applies to the corresponding batched and strided-batched routines.
+
+    \details TSQR is used when m >= GEQRF_TSQR_MIN_ROWS, m >= GEQRF_TSQR_MIN_RATIO * n and
+    n <= GEQRF_TSQR_MAX_COLS. The rows are split in tiles of max(GEQRF_TSQR_TILE_ROWS, 2n) rows
+    that are factorized independently, and the resulting R factors are reduced in a tree where
+    groups of GEQRF_TSQR_FANIN stacked factors are factorized at each level.*/
+#ifndef GEQRF_TSQR_MIN_ROWS
+#define GEQRF_TSQR_MIN_ROWS 16384
+#endif
+#ifndef GEQRF_TSQR_MIN_RATIO
+#define GEQRF_TSQR_MIN_RATIO 32
+#endif
+#ifndef GEQRF_TSQR_MAX_COLS
+#define GEQRF_TSQR_MAX_COLS 256
+#endif
+#ifndef GEQRF_TSQR_TILE_ROWS
+#define GEQRF_TSQR_TILE_ROWS 2048
+#endif
+#ifndef GEQRF_TSQR_FANIN
+#define GEQRF_TSQR_FANIN 8
+#endif
+
+/***************** geqp3 ******************************************************
+*******************************************************************************/
+/*! \brief Determines the size of the block column factorized at each step
+    in the blocked QR algorithm with column pivoting (GEQP3). It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details The updates of the trailing matrix are deferred while a panel of GEQP3_BLOCKSIZE
+    columns is factorized, and then applied at once with a matrix-matrix product.*/
+#ifndef GEQP3_BLOCKSIZE
+#define GEQP3_BLOCKSIZE 32
+#endif
+
 /***************** gerq2/gerqf and gelq2/gelqf ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the block row factorized at each step
@@ -89,6 +171,17 @@
 #define xxGQx_xxGQx2_SWITCHSIZE 128
 #endif
 
+/*! \brief Determines the maximum size at which ORG2R/UNG2R generates the matrix Q with a single
+    kernel launch. It also applies to ORGQR/UNGQR when the matrix is small enough to be
+    generated with ORG2R/UNG2R.
+
+    \details If m <= ORG2R_MAX_SMALL_SIZE(T), the whole matrix is kept in LDS shared memory while
+    the Householder reflectors are applied (in this case n <= m also holds).
+    The amount of LDS shared memory is assumed to be at least (64 * 1024) bytes. */
+#ifndef ORG2R_MAX_SMALL_SIZE
+#define ORG2R_MAX_SMALL_SIZE(T) GEQR2_MAX_SMALL_SIZE(T)
+#endif
+
 /******** orgr2/orgrq, orgl2/orglq, ungr2/ungrq and ungl2/unglq **************
 *******************************************************************************/
 /*! \brief Determines the size of the block reflector that is applied at each step when
@@ -253,6 +346,22 @@
 #define POTF2_MAX_SMALL_SIZE(T) ((sizeof(T) == 4) ? 180 : (sizeof(T) == 8) ? 127 : 90)
 #endif
 
+/*! \brief Determines the maximum size at which POTF2 keeps the whole matrix in registers
+    \details
+    Small matrices with n <= POTF2_REG_MAX_SIZE are factorized by a size-specialized
+    kernel that assigns one matrix per thread and stores its lower triangle in registers.
+    The threshold keeps register usage bounded for wider types. (Always <= 16). */
+#ifndef POTF2_REG_MAX_SIZE
+#define POTF2_REG_MAX_SIZE(T) ((sizeof(T) == 4) ? 16 : (sizeof(T) == 8) ? 12 : 8)
+#endif
+
+/*! \brief Determines the minimum size at which the blocked POTRF factorizes the next
+    diagonal block and panel while the rest of the trailing matrix is being updated
+    (look-ahead). It applies only to the non-batched routine. */
+#ifndef POTRF_LOOKAHEAD_MIN_SIZE
+#define POTRF_LOOKAHEAD_MIN_SIZE 1024
+#endif
+
 /************************** syevj/heevj ***************************************
 *******************************************************************************/
 /*! \brief Determines the size at which rocSOLVER switches from
@@ -319,6 +428,10 @@
 #ifndef GETF2_SSKER_MAX_N
 #define GETF2_SSKER_MAX_N 64 //always <= wavefront and <= GETF2_SPKER_MAX_N
 #endif
+#ifndef GETF2_REG_MAX_SIZE
+#define GETF2_REG_MAX_SIZE(T) \
+    ((sizeof(T) == 4) ? 12 : (sizeof(T) == 8) ? 8 : 6) //always <= 16 and <= GETF2_SSKER_MAX_N
+#endif
 #ifndef GETF2_OPTIM_NGRP
 #define GETF2_OPTIM_NGRP \
     16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
@@ -396,6 +509,116 @@
 #ifndef GETRF_NPVT_BATCH_BLKSIZES_COMPLEX
 #define GETRF_NPVT_BATCH_BLKSIZES_COMPLEX 0, -16, -32, -48, 64, 128
 #endif
+/*! \brief Determines the minimum size, min(m,n), at which the blocked GETRF factorizes the
+    next block panel while the rest of the trailing matrix is being updated (look-ahead).
+    It applies only to the non-batched routine with partial pivoting. */
+#ifndef GETRF_LOOKAHEAD_MIN_SIZE
+#define GETRF_LOOKAHEAD_MIN_SIZE 1024
+#endif
+/*! \brief Determine when a block panel of GETRF is factorized with the recursive
+    algorithm instead of the inner blocked loop.
+
+    \details The recursive algorithm splits the panel by columns and casts most of the work
+    as TRSM and GEMM calls. It is used for (non-batched) panels with at least
+    GETRF_RECURSIVE_MIN_ROWS rows and at least GETRF_RECURSIVE_MIN_RATIO times more rows
+    than columns. It can also be selected explicitly with a negative entry in the
+    tables of inner block sizes; the absolute value of the entry is then the width of the
+    sub-panels factorized with GETF2. */
+#ifndef GETRF_RECURSIVE_MIN_ROWS
+#define GETRF_RECURSIVE_MIN_ROWS 4096
+#endif
+#ifndef GETRF_RECURSIVE_MIN_RATIO
+#define GETRF_RECURSIVE_MIN_RATIO 16
+#endif
+/*! \brief Determines the number of rows of the row blocks (leaves) in which the block
+    panels are split when executing GETRF_TPVT (tournament pivoting). It also applies to
+    the corresponding strided-batched routine.
+
+    \details The leaves are factorized independently to select candidate pivot rows, which
+    are then reduced in a binary tree. The leaves have at least max(GETRF_TPVT_LEAF_ROWS, jb)
+    rows, where jb is the width of the panel. */
+#ifndef GETRF_TPVT_LEAF_ROWS
+#define GETRF_TPVT_LEAF_ROWS 512
+#endif
+
+/****************************** gbtrf *****************************************
+*******************************************************************************/
+/*! \brief Determines the number of columns of the block panels in GBTRF, and the number
+    of rows of the block rows in GBTRS.
+
+    \details Each block panel of GBTRF is copied, together with the part of the band that
+    it updates, to a dense workspace of size (GBTRF_BLOCKSIZE + kl)-by-(GBTRF_BLOCKSIZE + kl + ku),
+    where it is factorized with GETF2 and the trailing block is updated with TRSM and GEMM. */
+#ifndef GBTRF_BLOCKSIZE
+#define GBTRF_BLOCKSIZE 32
+#endif
+
+/****************************** ptsv ******************************************
+*******************************************************************************/
+/*! \brief Determines when PTSV switches from the Thomas algorithm (with one thread per
+    system) to parallel cyclic reduction (PCR).
+
+    \details PCR is used when n >= PTSV_PCR_MIN_SIZE and batch_count <= PTSV_PCR_MAX_BATCH,
+    that is, when there are too few systems to fill the device with one thread per system.
+    PCR does O(n log n) work instead of O(n), but all the equations of a system are reduced
+    in parallel. */
+#ifndef PTSV_PCR_MIN_SIZE
+#define PTSV_PCR_MIN_SIZE 512
+#endif
+#ifndef PTSV_PCR_MAX_BATCH
+#define PTSV_PCR_MAX_BATCH 2048
+#endif
+
+/************************* geblttrf_npvt **************************************
+*******************************************************************************/
+/*! \brief Determines when GEBLTTRF_NPVT switches from the sequential elimination of the
+    block rows to block cyclic reduction.
+
+    \details Cyclic reduction is used when nblocks >= GEBLTTRF_CR_MIN_BLOCKS,
+    nb <= GEBLTTRF_CR_MAX_NB and batch_count <= GEBLTTRF_CR_MAX_BATCH. It computes the Schur
+    complements of all the block rows with a parallel prefix scan of O(log nblocks) depth,
+    doing O(nb^3 nblocks log nblocks) work with one thread per block row and instance, and
+    needs a workspace of 11 * nb * nb * nblocks elements per instance. */
+#ifndef GEBLTTRF_CR_MIN_BLOCKS
+#define GEBLTTRF_CR_MIN_BLOCKS 128
+#endif
+#ifndef GEBLTTRF_CR_MAX_NB
+#define GEBLTTRF_CR_MAX_NB 16
+#endif
+#ifndef GEBLTTRF_CR_MAX_BATCH
+#define GEBLTTRF_CR_MAX_BATCH 32
+#endif
+
+/****************************** vbatched **************************************
+*******************************************************************************/
+/*! \brief Determines the size classes in which the variable-size batched routines
+    (GETRF_VBATCHED, GETRS_VBATCHED, GEQRF_VBATCHED, ORGQR_VBATCHED, ORMQR_VBATCHED and
+    GELS_VBATCHED) process the batch instances.
+
+    \details Instance l belongs to the i-th class if VBATCHED_INTERVALS[i-1] < dim_l <=
+    VBATCHED_INTERVALS[i], where dim_l is the largest dimension of its matrix (the last class
+    holds the instances with dim_l > VBATCHED_INTERVALS[VBATCHED_NUM_INTERVALS-1]). Every class
+    is processed with a single kernel launch over the whole batch, with one work-group of
+    VBATCHED_THREADS[i] threads (a power of 2, <= 1024) per instance. The matrices of the
+    classes with VBATCHED_INTERVALS[i]^2 elements that fit in VBATCHED_LDS_MAX_BYTES are kept
+    in LDS shared memory; the others are processed directly in global memory.
+    As the dimensions are only read on the device, the class of an instance cannot be used
+    to select host-side algorithms (such as the blocked or the size-specialized kernels of
+    the batched routines), and the last class has no upper bound: its instances are processed
+    with the same one-work-group unblocked algorithms, which are meant for sizes of up to a
+    few hundred. */
+#ifndef VBATCHED_NUM_INTERVALS
+#define VBATCHED_NUM_INTERVALS 3
+#endif
+#ifndef VBATCHED_INTERVALS
+#define VBATCHED_INTERVALS 16, 32, 64
+#endif
+#ifndef VBATCHED_THREADS
+#define VBATCHED_THREADS 64, 128, 256, 256
+#endif
+#ifndef VBATCHED_LDS_MAX_BYTES
+#define VBATCHED_LDS_MAX_BYTES (32 * 1024)
+#endif
 
 /****************************** getri *****************************************
 *******************************************************************************/
@@ -31,6 +31,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <hip/hip_runtime.h>
+#include <limits>
 #include <rocblas/rocblas.h>
 
 ROCSOLVER_BEGIN_NAMESPACE
@@ -91,6 +92,35 @@ I get_index(I* intervals, I max, I dim)
     return i;
 }
 
+/** fold_broadcast_rhs rewrites a strided batched solve whose factorization is shared by all
+    the instances (broadcast mode) as a single solve with nrhs*batch_count right hand sides.
+    This is possible when the blocks B_l are contiguous in memory, or when each of them is a
+    single column. Returns false, leaving the arguments unchanged, if B cannot be folded. **/
+template <typename I>
+bool fold_broadcast_rhs(const I n, I& nrhs, I& ldb, rocblas_stride& strideB, I& batch_count)
+{
+    if(batch_count < 2 || nrhs == 0)
+        return false;
+
+    // the total number of right hand sides must be representable
+    if(int64_t(nrhs) * batch_count > std::numeric_limits<I>::max())
+        return false;
+
+    I new_ldb;
+    if(strideB == rocblas_stride(ldb) * nrhs)
+        new_ldb = ldb;
+    else if(nrhs == 1 && strideB >= n && strideB <= std::numeric_limits<I>::max())
+        new_ldb = I(strideB);
+    else
+        return false;
+
+    nrhs *= batch_count;
+    ldb = new_ldb;
+    strideB = rocblas_stride(ldb) * nrhs;
+    batch_count = 1;
+    return true;
+}
+
 #ifdef ROCSOLVER_VERIFY_ASSUMPTIONS
 // Ensure __assert_fail is declared.
 #if !__is_identifier(__assert_fail)
@@ -2131,7 +2131,8 @@ rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
                                      rocblas_stride offsetC,
                                      rocblas_int ldc,
                                      rocblas_stride strideC,
-                                     rocblas_int batch_count)
+                                     rocblas_int batch_count,
+                                     T** work = nullptr)
 {
     constexpr auto name = rocblas_is_complex<T> ? "hemm" : "symm";
     // TODO: How to get alpha and beta for trace logging
@@ -2188,6 +2189,57 @@ rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
                                                       C, offsetC, ldc, strideC, batch_count);
 }
 
+// symm/hemm overload - batched with strided B and C
+template <typename T>
+rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
+                                     rocblas_side side,
+                                     rocblas_fill uplo,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* const* A,
+                                     rocblas_stride offsetA,
+                                     rocblas_int lda,
+                                     rocblas_stride strideA,
+                                     T* B,
+                                     rocblas_stride offsetB,
+                                     rocblas_int ldb,
+                                     rocblas_stride strideB,
+                                     const T* beta,
+                                     T* C,
+                                     rocblas_stride offsetC,
+                                     rocblas_int ldc,
+                                     rocblas_stride strideC,
+                                     rocblas_int batch_count,
+                                     T** work)
+{
+    constexpr auto name = rocblas_is_complex<T> ? "hemm" : "symm";
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER(name, "side:", side, "uplo:", uplo, "m:", m, "n:", n, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, strideB,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, C,
+                            strideC, batch_count);
+
+    if constexpr(!rocblas_is_complex<T>)
+        return rocblas_internal_symm_batched_template(
+            handle, side, uplo, m, n, alpha, A, offsetA, lda, strideA, cast2constType<T>(work),
+            offsetB, ldb, strideB, beta, cast2constPointer(work + batch_count), offsetC, ldc,
+            strideC, batch_count);
+    else
+        return rocblas_internal_hemm_batched_template(
+            handle, side, uplo, m, n, alpha, A, offsetA, lda, strideA, cast2constType<T>(work),
+            offsetB, ldb, strideB, beta, cast2constPointer(work + batch_count), offsetC, ldc,
+            strideC, batch_count);
+}
+
 // trsv
 template <typename T>
 rocblas_status rocblasCall_trsv(rocblas_handle handle,
@@ -0,0 +1,213 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "rocblas.hpp"
+#include "rocsolver_logger.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * The rocsolver_graph_cache class keeps a bounded set of executable graphs
+ * keyed by the signature of a top-level call (routine name, handle, stream,
+ * arguments and workspace pointers). When enabled with
+ * rocsolver_graph_cache_begin, the first call with a given signature is
+ * captured into a graph; subsequent identical calls are replayed with a single
+ * graph launch.
+ ***************************************************************************/
+class rocsolver_graph_cache
+{
+private:
+    // static singleton instance
+    static rocsolver_graph_cache* _instance;
+    // static mutex for multithreading
+    static std::mutex _mutex;
+    // maximum number of cached graphs
+    size_t max_graphs;
+    // executable graphs keyed by call signature
+    std::unordered_map<std::string, hipGraphExec_t> graphs;
+    // keys in insertion order (used for eviction)
+    std::list<std::string> order;
+
+    rocsolver_graph_cache(size_t max_graphs)
+        : max_graphs(max_graphs)
+    {
+    }
+
+    ~rocsolver_graph_cache()
+    {
+        for(auto& entry : graphs)
+            (void)hipGraphExecDestroy(entry.second);
+    }
+
+    // appends the raw bytes of the arguments to the key
+    static void append_key(std::string& key) {}
+    template <typename T, typename... Ts>
+    static void append_key(std::string& key, const T& arg, const Ts&... args)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "graph cache keys must be trivially copyable");
+        key.append(reinterpret_cast<const char*>(&arg), sizeof(T));
+        append_key(key, args...);
+    }
+
+    // returns the cached graph for key, or nullptr
+    hipGraphExec_t find(const std::string& key)
+    {
+        auto it = graphs.find(key);
+        return (it != graphs.end()) ? it->second : nullptr;
+    }
+
+    // stores a new graph, evicting the oldest one if the cache is full
+    void insert(std::string&& key, hipGraphExec_t exec)
+    {
+        if(graphs.size() >= max_graphs && !order.empty())
+        {
+            auto it = graphs.find(order.front());
+            (void)hipGraphExecDestroy(it->second);
+            graphs.erase(it);
+            order.pop_front();
+        }
+        order.push_back(key);
+        graphs.emplace(std::move(key), exec);
+    }
+
+    friend rocblas_status rocsolver_graph_cache_begin_impl();
+    friend rocblas_status rocsolver_graph_cache_end_impl();
+
+public:
+    // returns true if graph caching is enabled
+    static __forceinline__ bool is_enabled()
+    {
+        return rocsolver_graph_cache::_instance != nullptr;
+    }
+
+    /** Executes launch() on the handle's stream. If graph caching is enabled, the
+        stream is not already being captured, and logging is disabled, the
+        launch sequence of launch() is captured once per signature (name, precision,
+        handle, stream, args...) and replayed afterwards. Streams that cannot be
+        captured (e.g. the default null stream) always execute launch() directly.
+
+        All values that determine the launch sequence (sizes, pointers, strides,
+        workspace pointers, etc.) must be passed in args. **/
+    template <typename T, typename F, typename... Ts>
+    static rocblas_status run(rocblas_handle handle,
+                              const char* name,
+                              F&& launch,
+                              const Ts&... args)
+    {
+        if(!is_enabled() || rocsolver_logger::is_logging_enabled())
+            return launch();
+
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        // the default (null) stream cannot be captured
+        if(stream == nullptr)
+            return launch();
+
+        // calls made inside a user capture are recorded in the user graph
+        hipStreamCaptureStatus capture_status;
+        HIP_CHECK(hipStreamIsCapturing(stream, &capture_status));
+        if(capture_status != hipStreamCaptureStatusNone)
+            return launch();
+
+        std::string key(name);
+        key.push_back(rocblas2char_precision<T>);
+        append_key(key, handle, stream, args...);
+
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            if(!_instance)
+                return launch();
+
+            hipGraphExec_t exec = _instance->find(key);
+            if(exec)
+            {
+                HIP_CHECK(hipGraphLaunch(exec, stream));
+                return rocblas_status_success;
+            }
+        }
+
+        // capture a new graph
+        hipGraph_t graph = nullptr;
+        // streams that cannot be captured fall back to direct execution
+        if(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return launch();
+        }
+        rocblas_status status;
+        try
+        {
+            status = launch();
+        }
+        catch(...)
+        {
+            if(hipStreamEndCapture(stream, &graph) == hipSuccess && graph)
+                (void)hipGraphDestroy(graph);
+            throw;
+        }
+        HIP_CHECK(hipStreamEndCapture(stream, &graph));
+
+        // nothing was executed while capturing; on failure, fall back to direct execution
+        if(status != rocblas_status_success)
+        {
+            (void)hipGraphDestroy(graph);
+            return launch();
+        }
+
+        hipGraphExec_t exec;
+        hipError_t hip_status = hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0);
+        (void)hipGraphDestroy(graph);
+        if(hip_status != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return launch();
+        }
+
+        HIP_CHECK(hipGraphLaunch(exec, stream));
+
+        const std::lock_guard<std::mutex> lock(_mutex);
+        if(_instance && !_instance->find(key))
+            _instance->insert(std::move(key), exec);
+        else
+            (void)hipGraphExecDestroy(exec);
+
+        return rocblas_status_success;
+    }
+};
+
+ROCSOLVER_END_NAMESPACE
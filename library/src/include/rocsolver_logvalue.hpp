@@ -219,6 +219,27 @@ struct formatter<rocsolver_logvalue<rocblas_esort>> : formatter<char>
     }
 };
 
+template <>
+struct formatter<rocsolver_logvalue<rocsolver_norm_type>> : formatter<char>
+{
+    template <typename FormatCtx>
+    auto format(rocsolver_logvalue<rocsolver_norm_type> wrapper,
+                FormatCtx& ctx) ROCSOLVER_FMT_CONST
+    {
+        return formatter<char>::format(rocsolver::rocsolver2char_norm_type(wrapper.value), ctx);
+    }
+};
+
+template <>
+struct formatter<rocsolver_logvalue<rocsolver_lsq_mode>> : formatter<char>
+{
+    template <typename FormatCtx>
+    auto format(rocsolver_logvalue<rocsolver_lsq_mode> wrapper, FormatCtx& ctx) ROCSOLVER_FMT_CONST
+    {
+        return formatter<char>::format(rocsolver::rocsolver2char_lsq_mode(wrapper.value), ctx);
+    }
+};
+
 template <>
 struct formatter<rocsolver_logvalue<rocblas_datatype>> : formatter<string_view>
 {
@@ -258,6 +258,18 @@ rocblas_status potf2_run_small(rocblas_handle handle,
                                rocblas_int* info,
                                const rocblas_int batch_count);
 
+template <typename T, typename S, typename U>
+rocblas_status potrf_logdet_run_reg(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    S* logdet,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count);
+
 #ifdef OPTIMAL
 
 template <typename T, typename I, typename INFO, typename U>
@@ -309,6 +321,18 @@ rocblas_status getf2_run_small(rocblas_handle handle,
                                I* permut_idx,
                                const rocblas_stride stride);
 
+template <typename T, typename S, typename U>
+rocblas_status getrf_logdet_run_reg(rocblas_handle handle,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    S* logdet,
+                                    T* sign,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count);
+
 template <typename T, typename U>
 rocblas_status getri_run_small(rocblas_handle handle,
                                const rocblas_int n,
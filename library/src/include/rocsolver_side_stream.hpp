@@ -0,0 +1,182 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * The rocsolver_side_stream class lets a routine queue part of its work on a
+ * secondary stream, so that it can run concurrently with the work queued in
+ * the handle's stream. Dependencies between both streams are expressed with
+ * events only (no host synchronization).
+ *
+ * The work in the secondary stream is queued through a separate rocblas_handle
+ * bound to that stream, so the rocBLAS calls in both streams never share
+ * workspace memory or handle state. The workspace of the secondary handle is
+ * sized with a rocBLAS memory size query when the object is initialized, and
+ * allocated in stream order on the handle's stream (it is never allocated
+ * lazily by rocBLAS).
+ *
+ * All the resources (stream, events, handle and workspace) belong to the
+ * calling routine: they are created by init and released by release (or by the
+ * destructor, if the routine returns early). If the handle's stream is being
+ * captured into a HIP graph, nothing is created and the object stays inactive;
+ * the caller must then queue all its work in the handle's stream.
+ ***************************************************************************/
+class rocsolver_side_stream
+{
+private:
+    rocblas_handle main_handle;
+    hipStream_t main_stream = nullptr;
+    hipStream_t stream = nullptr;
+    rocblas_handle handle = nullptr;
+    hipEvent_t fork_event = nullptr;
+    hipEvent_t join_event = nullptr;
+    void* workspace = nullptr;
+
+public:
+    rocsolver_side_stream(rocblas_handle handle)
+        : main_handle(handle)
+    {
+    }
+
+    rocsolver_side_stream(const rocsolver_side_stream&) = delete;
+    rocsolver_side_stream& operator=(const rocsolver_side_stream&) = delete;
+
+    ~rocsolver_side_stream()
+    {
+        (void)release();
+    }
+
+    /** Creates the secondary stream, its handle and the events, unless the handle's
+        stream is being captured. query(h) must queue, through the handle h, the largest
+        work that will be queued in the secondary stream; it is only used to query the
+        size of the workspace of the secondary handle. **/
+    template <typename F>
+    rocblas_status init(F&& query)
+    {
+        rocblas_get_stream(main_handle, &main_stream);
+
+        hipStreamCaptureStatus capture_status;
+        HIP_CHECK(hipStreamIsCapturing(main_stream, &capture_status));
+        if(capture_status != hipStreamCaptureStatusNone)
+            return rocblas_status_success;
+
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        HIP_CHECK(hipEventCreateWithFlags(&fork_event, hipEventDisableTiming));
+        HIP_CHECK(hipEventCreateWithFlags(&join_event, hipEventDisableTiming));
+        ROCBLAS_CHECK(rocblas_create_handle(&handle));
+        ROCBLAS_CHECK(rocblas_set_stream(handle, stream));
+
+        size_t size = 0;
+        ROCBLAS_CHECK(rocblas_start_device_memory_size_query(handle));
+        (void)query(handle);
+        ROCBLAS_CHECK(rocblas_stop_device_memory_size_query(handle, &size));
+        if(size > 0)
+        {
+            HIP_CHECK(hipMallocAsync(&workspace, size, main_stream));
+            ROCBLAS_CHECK(rocblas_set_workspace(handle, workspace, size));
+        }
+
+        return rocblas_status_success;
+    }
+
+    /** Returns true if the secondary stream can be used (between init and release). **/
+    bool active() const
+    {
+        return handle != nullptr;
+    }
+
+    /** Makes the secondary stream wait for the work queued so far in the handle's
+        stream, and copies the pointer and atomics modes of the handle to the
+        secondary handle. **/
+    rocblas_status begin()
+    {
+        rocblas_pointer_mode pmode;
+        rocblas_atomics_mode amode;
+        ROCBLAS_CHECK(rocblas_get_pointer_mode(main_handle, &pmode));
+        ROCBLAS_CHECK(rocblas_get_atomics_mode(main_handle, &amode));
+        ROCBLAS_CHECK(rocblas_set_pointer_mode(handle, pmode));
+        ROCBLAS_CHECK(rocblas_set_atomics_mode(handle, amode));
+
+        HIP_CHECK(hipEventRecord(fork_event, main_stream));
+        HIP_CHECK(hipStreamWaitEvent(stream, fork_event, 0));
+
+        return rocblas_status_success;
+    }
+
+    /** Returns the handle through which the work is queued in the secondary stream
+        (between begin and join). **/
+    rocblas_handle get_handle() const
+    {
+        return handle;
+    }
+
+    /** Makes the work queued afterwards in the handle's stream wait for the work
+        queued in the secondary stream. **/
+    rocblas_status join()
+    {
+        HIP_CHECK(hipEventRecord(join_event, stream));
+        HIP_CHECK(hipStreamWaitEvent(main_stream, join_event, 0));
+
+        return rocblas_status_success;
+    }
+
+    /** Releases all the resources. The workspace is freed in stream order on the
+        handle's stream, after all the work queued in the secondary stream. **/
+    rocblas_status release()
+    {
+        rocblas_status status = rocblas_status_success;
+        if(stream && join_event && join() != rocblas_status_success)
+            status = rocblas_status_internal_error;
+        if(handle && rocblas_destroy_handle(handle) != rocblas_status_success)
+            status = rocblas_status_internal_error;
+        if(workspace && hipFreeAsync(workspace, main_stream) != hipSuccess)
+            status = rocblas_status_internal_error;
+        if(fork_event && hipEventDestroy(fork_event) != hipSuccess)
+            status = rocblas_status_internal_error;
+        if(join_event && hipEventDestroy(join_event) != hipSuccess)
+            status = rocblas_status_internal_error;
+        if(stream && hipStreamDestroy(stream) != hipSuccess)
+            status = rocblas_status_internal_error;
+
+        handle = nullptr;
+        workspace = nullptr;
+        fork_event = nullptr;
+        join_event = nullptr;
+        stream = nullptr;
+
+        return status;
+    }
+};
+
+ROCSOLVER_END_NAMESPACE
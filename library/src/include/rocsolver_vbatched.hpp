@@ -0,0 +1,348 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include <limits>
+
+#include "ideal_sizes.hpp"
+#include "lib_device_helpers.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Helpers for the variable-size batched (vbatched) routines. The dimensions
+ * of the batch instances are only read on the device: the instances are
+ * assigned to a fixed set of size classes (see VBATCHED_INTERVALS), and each
+ * class is processed with one kernel launch over the whole batch, with one
+ * work-group per instance. Work-groups whose instance belongs to another class
+ * return immediately, and the others work up to the dimensions of their own
+ * instance.
+ ***************************************************************************/
+
+/** Return the bounds lo < dim <= hi of the largest dimension of the instances in the c-th
+    size class (0 <= c <= VBATCHED_NUM_INTERVALS), the number of threads of the work-group
+    that processes each instance, and whether the matrices are kept in LDS shared memory **/
+template <typename T>
+void rocsolver_vbatched_class(const rocblas_int c,
+                              rocblas_int* lo,
+                              rocblas_int* hi,
+                              rocblas_int* threads,
+                              bool* lds)
+{
+    rocblas_int intervals[] = {VBATCHED_INTERVALS};
+    rocblas_int nthreads[] = {VBATCHED_THREADS};
+
+    *lo = (c == 0) ? 0 : intervals[c - 1];
+    *hi = (c < VBATCHED_NUM_INTERVALS) ? intervals[c] : std::numeric_limits<rocblas_int>::max();
+    *threads = nthreads[c];
+    *lds = (c < VBATCHED_NUM_INTERVALS)
+        && sizeof(T) * size_t(*hi) * size_t(*hi) <= VBATCHED_LDS_MAX_BYTES;
+}
+
+/** Return the size of the LDS shared memory of a vbatched kernel: room for a matrix of
+    size elements, and for the scratch arrays partitioned by vbatched_lmem **/
+template <typename T>
+size_t rocsolver_vbatched_lmem_size(const rocblas_int threads, const size_t size)
+{
+    using S = decltype(std::real(T{}));
+    return sizeof(T) * (size + threads + 4) + (sizeof(S) + sizeof(rocblas_int)) * threads;
+}
+
+/** Return true if the batch instance with largest dimension dim is processed by the size
+    class with bounds lo and hi. Empty instances are assigned to the first class. **/
+__device__ inline bool vbatched_in_class(const rocblas_int dim,
+                                         const rocblas_int lo,
+                                         const rocblas_int hi)
+{
+    return (dim > lo || lo == 0) && dim <= hi;
+}
+
+/** Partition the LDS shared memory of a vbatched kernel: sA has room for a matrix of size
+    elements, sw, sval and sidx for one element per thread, and sp for 4 scalars **/
+template <typename T, typename S>
+__device__ void vbatched_lmem(void* lmem,
+                              const rocblas_int size,
+                              T** sA,
+                              T** sw,
+                              T** sp,
+                              S** sval,
+                              rocblas_int** sidx)
+{
+    *sA = reinterpret_cast<T*>(lmem);
+    *sw = *sA + size;
+    *sp = *sw + hipBlockDim_x;
+    *sval = reinterpret_cast<S*>(*sp + 4);
+    *sidx = reinterpret_cast<rocblas_int*>(*sval + hipBlockDim_x);
+}
+
+/** Copy the m-by-n matrix A (with leading dimension lda) to sA (with leading dimension m) **/
+template <typename T>
+__device__ void vbatched_load(const rocblas_int tid,
+                              const rocblas_int nt,
+                              const rocblas_int m,
+                              const rocblas_int n,
+                              const T* A,
+                              const rocblas_int lda,
+                              T* sA)
+{
+    for(rocblas_int e = tid; e < m * n; e += nt)
+        sA[e] = A[(e % m) + (e / m) * lda];
+    __syncthreads();
+}
+
+/** Copy the m-by-n matrix in sA (with leading dimension m) back to A **/
+template <typename T>
+__device__ void vbatched_store(const rocblas_int tid,
+                               const rocblas_int nt,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const T* sA,
+                               T* A,
+                               const rocblas_int lda)
+{
+    __syncthreads();
+    for(rocblas_int e = tid; e < m * n; e += nt)
+        A[(e % m) + (e / m) * lda] = sA[e];
+}
+
+/** Return the sum over the work-group of the values val. s must have room for one
+    element per thread. **/
+template <typename S>
+__device__ S vbatched_sum(const rocblas_int tid, const rocblas_int nt, S val, S* s)
+{
+    s[tid] = val;
+    __syncthreads();
+    for(rocblas_int r = nt / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            s[tid] += s[tid + r];
+        __syncthreads();
+    }
+    val = s[0];
+    __syncthreads();
+    return val;
+}
+
+/** Return the maximum over the work-group of the values val **/
+template <typename S>
+__device__ S vbatched_max(const rocblas_int tid, const rocblas_int nt, S val, S* s)
+{
+    s[tid] = val;
+    __syncthreads();
+    for(rocblas_int r = nt / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            s[tid] = std::max(s[tid], s[tid + r]);
+        __syncthreads();
+    }
+    val = s[0];
+    __syncthreads();
+    return val;
+}
+
+/** Find the maximum over the work-group of the values val and the corresponding index idx
+    (ties are resolved in favour of the smallest index). On exit, all the threads hold the
+    result in val and idx. **/
+template <typename S>
+__device__ void vbatched_iamax(const rocblas_int tid,
+                               const rocblas_int nt,
+                               S& val,
+                               rocblas_int& idx,
+                               S* sval,
+                               rocblas_int* sidx)
+{
+    sval[tid] = val;
+    sidx[tid] = idx;
+    __syncthreads();
+    for(rocblas_int r = nt / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            S v = sval[tid + r];
+            rocblas_int i = sidx[tid + r];
+            if(v > sval[tid] || (v == sval[tid] && i < sidx[tid]))
+            {
+                sval[tid] = v;
+                sidx[tid] = i;
+            }
+        }
+        __syncthreads();
+    }
+    val = sval[0];
+    idx = sidx[0];
+    __syncthreads();
+}
+
+/** Return the element (i,j) of op(A), where the element (i,j) of A is A[i * inca + j * lda] **/
+template <typename T>
+__device__ T vbatched_elem(const rocblas_operation trans,
+                           const T* A,
+                           const rocblas_int inca,
+                           const rocblas_int lda,
+                           const rocblas_int i,
+                           const rocblas_int j)
+{
+    if(trans == rocblas_operation_none)
+        return A[i * inca + j * lda];
+    else if(trans == rocblas_operation_transpose)
+        return A[j * inca + i * lda];
+    else
+        return conj(A[j * inca + i * lda]);
+}
+
+/** Solve op(A) * X = B, where A is an n-by-n triangular matrix with elements
+    A[i * inca + j * lda], and B is an n-by-nrhs matrix with leading dimension ldb that is
+    overwritten with X. If real_diag is true, only the real part of the diagonal is used. **/
+template <typename T>
+__device__ void vbatched_trsm(const rocblas_int tid,
+                              const rocblas_int nt,
+                              const rocblas_fill uplo,
+                              const rocblas_operation trans,
+                              const rocblas_diagonal diag,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              const T* A,
+                              const rocblas_int inca,
+                              const rocblas_int lda,
+                              T* B,
+                              const rocblas_int ldb,
+                              const bool real_diag = false)
+{
+    // op(A) is lower triangular if A is lower and not transposed, or upper and transposed
+    const bool lower = (uplo == rocblas_fill_lower) == (trans == rocblas_operation_none);
+
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        // solve for the i-th row of X (forward if op(A) is lower, backward otherwise)
+        const rocblas_int i = lower ? k : n - 1 - k;
+        if(diag == rocblas_diagonal_non_unit)
+        {
+            T d = vbatched_elem(trans, A, inca, lda, i, i);
+            if(real_diag)
+                d = std::real(d);
+            for(rocblas_int c = tid; c < nrhs; c += nt)
+                B[i + c * ldb] = B[i + c * ldb] / d;
+        }
+        __syncthreads();
+
+        // update the rows of B that are still to be solved
+        const rocblas_int r0 = lower ? i + 1 : 0;
+        const rocblas_int nr = lower ? n - i - 1 : i;
+        for(int64_t e = tid; e < int64_t(nr) * nrhs; e += nt)
+        {
+            rocblas_int r = r0 + rocblas_int(e % nr);
+            rocblas_int c = rocblas_int(e / nr);
+            B[r + c * ldb] -= vbatched_elem(trans, A, inca, lda, r, i) * B[i + c * ldb];
+        }
+        __syncthreads();
+    }
+}
+
+/** Apply the Householder reflector H = I - t * v * v' from the left to the m-by-n matrix C
+    with elements C[i * incc + j * ldc]. v is the vector of length m with elements v[i * incv]
+    and an implicit leading 1. sw must have room for one element per thread. **/
+template <typename T>
+__device__ void vbatched_larf_left(const rocblas_int tid,
+                                   const rocblas_int nt,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const T* v,
+                                   const rocblas_int incv,
+                                   const T t,
+                                   T* C,
+                                   const rocblas_int incc,
+                                   const rocblas_int ldc,
+                                   T* sw)
+{
+    // the columns of C are processed in chunks of nt columns
+    for(rocblas_int j0 = 0; j0 < n; j0 += nt)
+    {
+        const rocblas_int nj = std::min(nt, n - j0);
+        if(tid < nj)
+        {
+            const T* c = C + (j0 + tid) * ldc;
+            T w = c[0];
+            for(rocblas_int i = 1; i < m; ++i)
+                w += conj(v[i * incv]) * c[i * incc];
+            sw[tid] = t * w;
+        }
+        __syncthreads();
+        for(rocblas_int e = tid; e < m * nj; e += nt)
+        {
+            rocblas_int i = e % m;
+            rocblas_int j = e / m;
+            T vi = (i == 0) ? T(1) : v[i * incv];
+            C[i * incc + (j0 + j) * ldc] -= vi * sw[j];
+        }
+        __syncthreads();
+    }
+}
+
+/** Apply the Householder reflector H = I - t * v * v' from the right to the m-by-n matrix C.
+    v is the vector of length n with elements v[i * incv] and an implicit leading 1. **/
+template <typename T>
+__device__ void vbatched_larf_right(const rocblas_int tid,
+                                    const rocblas_int nt,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const T* v,
+                                    const rocblas_int incv,
+                                    const T t,
+                                    T* C,
+                                    const rocblas_int incc,
+                                    const rocblas_int ldc,
+                                    T* sw)
+{
+    // the rows of C are processed in chunks of nt rows
+    for(rocblas_int i0 = 0; i0 < m; i0 += nt)
+    {
+        const rocblas_int ni = std::min(nt, m - i0);
+        if(tid < ni)
+        {
+            const T* c = C + (i0 + tid) * incc;
+            T w = c[0];
+            for(rocblas_int j = 1; j < n; ++j)
+                w += c[j * ldc] * v[j * incv];
+            sw[tid] = t * w;
+        }
+        __syncthreads();
+        for(rocblas_int e = tid; e < ni * n; e += nt)
+        {
+            rocblas_int i = e % ni;
+            rocblas_int j = e / ni;
+            T vj = (j == 0) ? T(1) : v[j * incv];
+            C[(i0 + i) * incc + j * ldc] -= sw[i] * conj(vj);
+        }
+        __syncthreads();
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
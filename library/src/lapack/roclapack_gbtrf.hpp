@@ -0,0 +1,388 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_laswp.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getf2.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    A band matrix with kl subdiagonals and ku superdiagonals is stored as in
+ *    LAPACK: element A(i,k) is located at AB(kv + i - k, k), where kv = kl + ku.
+ *    The first kl rows of AB hold the fill-in created by the row interchanges.
+ *    As the band moves down one row when moving one column to the right, any
+ *    block of A that lies within the band can be addressed as a general
+ *    matrix with leading dimension ldab - 1. The routines below, however, copy
+ *    the blocks to a dense workspace, where the entries outside of the band can
+ *    be explicitly set to zero; this allows calling the general (dense) GETF2,
+ *    LASWP, TRSM and GEMM on them.
+ * ===========================================================================
+ */
+
+/** GBTRF_ZERO_FILL sets to zero the first kl rows of the band storage AB, which
+    will receive the fill-in of the factorization.
+    Call this kernel with batch_count groups in z, and enough groups in x and y
+    to cover kl rows and n columns. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gbtrf_zero_fill(const rocblas_int n,
+                                      const rocblas_int kl,
+                                      U ABA,
+                                      const rocblas_stride shiftAB,
+                                      const rocblas_int ldab,
+                                      const rocblas_stride strideAB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto k = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < kl && k < n)
+    {
+        T* AB = load_ptr_batch<T>(ABA, b, shiftAB, strideAB);
+        AB[i + k * ldab] = 0;
+    }
+}
+
+/** GBTRF_COPY_BAND copies the m-by-n block of the band matrix A that starts at
+    row i0 and column k0 to (or from) the dense workspace W. When copying to W,
+    the entries that lie outside of the band (below the kl-th subdiagonal or above the
+    kv-th superdiagonal) are set to zero. When copying from W, only the entries within
+    the band are written back.
+    Call this kernel with batch_count groups in z, and enough groups in x and y
+    to cover m rows and n columns. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gbtrf_copy_band(const copymat_direction direction,
+                                      const rocblas_int m,
+                                      const rocblas_int n,
+                                      const rocblas_int kl,
+                                      const rocblas_int kv,
+                                      const rocblas_int i0,
+                                      const rocblas_int k0,
+                                      U ABA,
+                                      const rocblas_stride shiftAB,
+                                      const rocblas_int ldab,
+                                      const rocblas_stride strideAB,
+                                      T* WW,
+                                      const rocblas_int ldw,
+                                      const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int k = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < m && k < n)
+    {
+        T* AB = load_ptr_batch<T>(ABA, b, shiftAB, strideAB);
+        T* W = WW + b * strideW;
+
+        // position of A(i0 + i, k0 + k) relative to the diagonal
+        const rocblas_int d = (i0 + i) - (k0 + k);
+        const bool inband = (d <= kl && -d <= kv);
+
+        if(direction == copymat_to_buffer)
+            W[i + k * ldw] = inband ? AB[kv + d + (k0 + k) * ldab] : T(0);
+        else if(inband)
+            AB[kv + d + (k0 + k) * ldab] = W[i + k * ldw];
+    }
+}
+
+/** GBTRF_PANEL_SWAPS applies to the first jb columns of the dense workspace W the row
+    interchanges of the block panel that starts at column j. Each column c is only
+    affected by the interchanges of the later columns jj > c.
+    If undo = true, the interchanges are reverted (in reverse order), which takes the
+    multipliers computed by GETF2 to the form used by LAPACK's GBTRF (where the
+    multipliers of each column are not affected by the following interchanges).
+    If undo = false, the interchanges are re-applied to multipliers stored in the form
+    of GBTRF, so that W holds again the block lower triangular factor returned by GETF2.
+    Call this kernel with batch_count groups in y, and enough groups in x to cover
+    jb columns. **/
+template <typename T>
+ROCSOLVER_KERNEL void gbtrf_panel_swaps(const rocblas_int jb,
+                                        const rocblas_int j,
+                                        const rocblas_int* ipivA,
+                                        const rocblas_stride shiftP,
+                                        const rocblas_stride strideP,
+                                        T* WW,
+                                        const rocblas_int ldw,
+                                        const rocblas_stride strideW,
+                                        const bool undo)
+{
+    const auto b = hipBlockIdx_y;
+    const rocblas_int c = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(c < jb)
+    {
+        const rocblas_int* ipiv = ipivA + b * strideP + shiftP + j;
+        T* W = WW + b * strideW + c * ldw;
+        rocblas_int p;
+
+        if(undo)
+        {
+            for(rocblas_int jj = jb - 1; jj > c; jj--)
+            {
+                p = ipiv[jj] - 1 - j;
+                if(p != jj)
+                    swap(W[jj], W[p]);
+            }
+        }
+        else
+        {
+            for(rocblas_int jj = c + 1; jj < jb; jj++)
+            {
+                p = ipiv[jj] - 1 - j;
+                if(p != jj)
+                    swap(W[jj], W[p]);
+            }
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gbtrf_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int ldab,
+                                        T AB,
+                                        rocblas_int* ipiv,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !AB) || (m && n && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gbtrf_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int kl,
+                                   const rocblas_int ku,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_pivotval,
+                                   size_t* size_pivotidx,
+                                   size_t* size_W,
+                                   bool* optim_mem)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    // if quick return, no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_W = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    rocblas_int kv = kl + ku;
+    rocblas_int nb = std::min(std::min(m, n), rocblas_int(GBTRF_BLOCKSIZE));
+    rocblas_int ldw = nb + kl;
+
+    // requirements for the largest GETF2 on a block panel
+    rocsolver_getf2_getMemorySize<ISBATCHED, T>(ldw, nb, true, batch_count, size_scalars,
+                                                size_pivotval, size_pivotidx, true);
+
+    // requirements for the largest TRSM on the dense workspace
+    if(kv > 0)
+        rocsolver_trsm_mem<false, true, T>(rocblas_side_left, rocblas_operation_none, nb, kv,
+                                           batch_count, size_work1, size_work2, size_work3,
+                                           size_work4, optim_mem, true, ldw, ldw);
+    else
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+    }
+
+    // dense workspace for the block panel and the block of the band that it updates
+    *size_W = sizeof(T) * ldw * (nb + kv) * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gbtrf_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        U AB,
+                                        const rocblas_stride shiftAB,
+                                        const rocblas_int ldab,
+                                        const rocblas_stride strideAB,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride shiftP,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* pivotval,
+                                        rocblas_int* pivotidx,
+                                        T* W,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("gbtrf", "m:", m, "n:", n, "kl:", kl, "ku:", ku, "shiftAB:", shiftAB,
+                    "ldab:", ldab, "shiftP:", shiftP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    // info = 0 (starting with a nonsingular matrix)
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                            batch_count, 0);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    const rocblas_int kv = kl + ku;
+    const rocblas_int dim = std::min(m, n);
+    const rocblas_int nb = std::min(dim, rocblas_int(GBTRF_BLOCKSIZE));
+    const rocblas_int ldw = nb + kl;
+    const rocblas_stride strideW = rocblas_stride(ldw) * (nb + kv);
+    dim3 threads(BS2, BS2, 1);
+    dim3 grid;
+
+    // set the fill-in entries to zero
+    if(kl > 0)
+    {
+        grid = dim3((kl - 1) / BS2 + 1, (n - 1) / BS2 + 1, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(gbtrf_zero_fill<T>, grid, threads, 0, stream, n, kl, AB, shiftAB,
+                                ldab, strideAB);
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    rocblas_int jb, wm, wn;
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        // the block panel has jb columns and wm rows; the rows of the panel
+        // are non-zero in the first wn columns starting at column j
+        jb = std::min(dim - j, nb);
+        wm = std::min(jb + kl, m - j);
+        wn = std::min(jb + kv, n - j);
+
+        // copy the active block of the band to the dense workspace
+        grid = dim3((wm - 1) / BS2 + 1, (wn - 1) / BS2 + 1, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(gbtrf_copy_band<T>, grid, threads, 0, stream, copymat_to_buffer,
+                                wm, wn, kl, kv, j, j, AB, shiftAB, ldab, strideAB, W, ldw, strideW);
+
+        // factorize the block panel
+        rocsolver_getf2_template<ISBATCHED, T>(handle, wm, jb, W, 0, 1, ldw, strideW, ipiv,
+                                               shiftP + j, strideP, info, batch_count, scalars,
+                                               pivotval, pivotidx, true, j);
+
+        if(wn > jb)
+        {
+            // apply the row interchanges to the rest of the block
+            // (the pivot indices are relative to the first row of the matrix)
+            rocsolver_laswp_template<T>(handle, wn - jb, W, idx2D(0, jb, ldw) - j, 1, ldw,
+                                        strideW, j + 1, j + jb, ipiv, shiftP, 1, strideP,
+                                        batch_count);
+
+            // update the block row of U
+            rocsolver_trsm_lower<false, true, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb,
+                wn - jb, W, 0, ldw, strideW, W, idx2D(0, jb, ldw), ldw, strideW, batch_count,
+                optim_mem, work1, work2, work3, work4);
+
+            // update the trailing block
+            if(wm > jb)
+                rocsolver_gemm<false, true, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, wm - jb, wn - jb, jb,
+                    &minone, W, idx2D(jb, 0, ldw), ldw, strideW, W, idx2D(0, jb, ldw), ldw,
+                    strideW, &one, W, idx2D(jb, jb, ldw), ldw, strideW, batch_count, (T**)nullptr);
+        }
+
+        // take the multipliers to the form used by LAPACK
+        ROCSOLVER_LAUNCH_KERNEL(gbtrf_panel_swaps<T>, dim3((jb - 1) / BS1 + 1, batch_count, 1),
+                                dim3(BS1, 1, 1), 0, stream, jb, j, ipiv, shiftP, strideP, W, ldw,
+                                strideW, true);
+
+        // copy the results back to the band
+        ROCSOLVER_LAUNCH_KERNEL(gbtrf_copy_band<T>, grid, threads, 0, stream, copymat_from_buffer,
+                                wm, wn, kl, kv, j, j, AB, shiftAB, ldab, strideAB, W, ldw, strideW);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
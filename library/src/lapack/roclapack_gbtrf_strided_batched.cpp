@@ -0,0 +1,202 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gbtrf.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrf_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int kl,
+                                                    const rocblas_int ku,
+                                                    U AB,
+                                                    const rocblas_int ldab,
+                                                    const rocblas_stride strideAB,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gbtrf_strided_batched", "-m", m, "-n", n, "--kl", kl, "--ku", ku, "--ldab",
+                        ldab, "--strideAB", strideAB, "--strideP", strideP, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gbtrf_argCheck(handle, m, n, kl, ku, ldab, AB, ipiv, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftAB = 0;
+    rocblas_stride shiftP = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size of the dense workspace for the block panels
+    size_t size_W;
+    rocsolver_gbtrf_getMemorySize<false, true, T>(m, n, kl, ku, batch_count, &size_scalars,
+                                                  &size_work1, &size_work2, &size_work3,
+                                                  &size_work4, &size_pivotval, &size_pivotidx,
+                                                  &size_W, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_W);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *W;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_W);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    W = mem[7];
+
+    // execution
+    auto launch = [&]() {
+        if(size_scalars > 0)
+            init_scalars(handle, (T*)scalars);
+
+        return rocsolver_gbtrf_template<false, true, T>(
+            handle, m, n, kl, ku, AB, shiftAB, ldab, strideAB, ipiv, shiftP, strideP, info,
+            batch_count, (T*)scalars, work1, work2, work3, work4, (T*)pivotval,
+            (rocblas_int*)pivotidx, (T*)W, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "gbtrf_strided_batched", launch, m, n, kl, ku, AB,
+                                         ldab, strideAB, ipiv, strideP, info, batch_count, scalars,
+                                         work1, work2, work3, work4, pivotval, pivotidx, W);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgbtrf_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int kl,
+                                                const rocblas_int ku,
+                                                float* AB,
+                                                const rocblas_int ldab,
+                                                const rocblas_stride strideAB,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gbtrf_strided_batched_impl<float>(handle, m, n, kl, ku, AB, ldab,
+                                                                  strideAB, ipiv, strideP, info,
+                                                                  batch_count);
+}
+
+rocblas_status rocsolver_dgbtrf_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int kl,
+                                                const rocblas_int ku,
+                                                double* AB,
+                                                const rocblas_int ldab,
+                                                const rocblas_stride strideAB,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gbtrf_strided_batched_impl<double>(handle, m, n, kl, ku, AB, ldab,
+                                                                   strideAB, ipiv, strideP, info,
+                                                                   batch_count);
+}
+
+rocblas_status rocsolver_cgbtrf_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int kl,
+                                                const rocblas_int ku,
+                                                rocblas_float_complex* AB,
+                                                const rocblas_int ldab,
+                                                const rocblas_stride strideAB,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gbtrf_strided_batched_impl<rocblas_float_complex>(handle, m, n, kl,
+                                                                                  ku, AB, ldab,
+                                                                                  strideAB, ipiv,
+                                                                                  strideP, info,
+                                                                                  batch_count);
+}
+
+rocblas_status rocsolver_zgbtrf_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int kl,
+                                                const rocblas_int ku,
+                                                rocblas_double_complex* AB,
+                                                const rocblas_int ldab,
+                                                const rocblas_stride strideAB,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gbtrf_strided_batched_impl<rocblas_double_complex>(handle, m, n, kl,
+                                                                                   ku, AB, ldab,
+                                                                                   strideAB, ipiv,
+                                                                                   strideP, info,
+                                                                                   batch_count);
+}
+}
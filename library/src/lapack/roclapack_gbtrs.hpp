@@ -0,0 +1,363 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gbtrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_gbtrs_argCheck(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int ldab,
+                                        const rocblas_int ldb,
+                                        T AB,
+                                        T B,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2 * kl + ku + 1 || ldb < n
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !AB) || (n && !ipiv) || (nrhs * n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gbtrs_getMemorySize(const rocblas_operation trans,
+                                   const rocblas_int n,
+                                   const rocblas_int kl,
+                                   const rocblas_int ku,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_W,
+                                   size_t* size_workArr,
+                                   bool* optim_mem,
+                                   const rocblas_int ldb = 1)
+{
+    // if quick return, no workspace needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_W = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    rocblas_int kv = kl + ku;
+    rocblas_int nb = std::min(n, rocblas_int(GBTRF_BLOCKSIZE));
+
+    // requirements for the largest TRSM
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, trans, nb, nrhs, batch_count,
+                                            size_work1, size_work2, size_work3, size_work4,
+                                            optim_mem, true, nb + kv, ldb);
+
+    // dense workspace for the blocks of L and U
+    // (the blocks of L have at most nb + kl rows and nb columns, and the
+    // blocks of U have nb + kv rows and nb columns, or nb rows and nb + kv columns)
+    *size_W = sizeof(T) * nb * (nb + kv) * batch_count;
+
+    // array of pointers to the dense workspace
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+/** GBTRS_SOLVE executes the blocked solver. The blocks of the factors are copied to the
+    dense workspace W, which is also addressed through Wv with the same layout as B
+    (Wv = W in the non-batched and strided_batched cases, or an array of pointers to the
+    instances of W in the batched case). **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void gbtrs_solve(rocblas_handle handle,
+                 const rocblas_operation trans,
+                 const rocblas_int n,
+                 const rocblas_int kl,
+                 const rocblas_int ku,
+                 const rocblas_int nrhs,
+                 U AB,
+                 const rocblas_stride shiftAB,
+                 const rocblas_int ldab,
+                 const rocblas_stride strideAB,
+                 const rocblas_int* ipiv,
+                 const rocblas_stride strideP,
+                 U B,
+                 const rocblas_stride shiftB,
+                 const rocblas_int ldb,
+                 const rocblas_stride strideB,
+                 const rocblas_int batch_count,
+                 T* W,
+                 U Wv,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int kv = kl + ku;
+    const rocblas_int nb = std::min(n, rocblas_int(GBTRF_BLOCKSIZE));
+    const rocblas_int nblocks = (n - 1) / nb + 1;
+    const rocblas_stride strideW = rocblas_stride(nb) * (nb + kv);
+    dim3 threads(BS2, BS2, 1);
+    dim3 grid;
+    dim3 gridSwaps((nb - 1) / BS1 + 1, batch_count, 1);
+    dim3 threadsSwaps(BS1, 1, 1);
+
+    T one = 1;
+    T minone = -1;
+
+    rocblas_int j, jb, wm, wn, r0, ldw;
+
+    if(trans == rocblas_operation_none)
+    {
+        // solve L*Y = P*B, one block of jb columns of L at a time
+        // (there is nothing to do if L is the identity)
+        ldw = nb + kl;
+        for(rocblas_int bk = 0; kl > 0 && bk < nblocks; bk++)
+        {
+            j = bk * nb;
+            jb = std::min(n - j, nb);
+            wm = std::min(jb + kl, n - j);
+
+            // copy the block column of L to the workspace, and apply to it the row
+            // interchanges of the following columns in the block
+            grid = dim3((wm - 1) / BS2 + 1, (jb - 1) / BS2 + 1, batch_count);
+            ROCSOLVER_LAUNCH_KERNEL(gbtrf_copy_band<T>, grid, threads, 0, stream,
+                                    copymat_to_buffer, wm, jb, kl, kv, j, j, AB, shiftAB, ldab,
+                                    strideAB, W, ldw, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(gbtrf_panel_swaps<T>, gridSwaps, threadsSwaps, 0, stream, jb,
+                                    j, ipiv, 0, strideP, W, ldw, strideW, false);
+
+            rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, 1, ldb, strideB, j + 1, j + jb,
+                                        ipiv, 0, 1, strideP, batch_count);
+
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb, nrhs,
+                Wv, 0, ldw, strideW, B, shiftB + j, ldb, strideB, batch_count, optim_mem, work1,
+                work2, work3, work4);
+
+            if(wm > jb)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, wm - jb, nrhs, jb,
+                    &minone, Wv, jb, ldw, strideW, B, shiftB + j, ldb, strideB, &one, B,
+                    shiftB + j + jb, ldb, strideB, batch_count, (T**)nullptr);
+        }
+
+        // solve U*X = Y, one block of jb rows of U at a time, from the bottom up
+        ldw = nb + kv;
+        for(rocblas_int bk = nblocks - 1; bk >= 0; bk--)
+        {
+            j = bk * nb;
+            jb = std::min(n - j, nb);
+            r0 = std::max(0, j - kv);
+
+            // copy the block column of U (from row r0 to the diagonal) to the workspace
+            grid = dim3((j + jb - r0 - 1) / BS2 + 1, (jb - 1) / BS2 + 1, batch_count);
+            ROCSOLVER_LAUNCH_KERNEL(gbtrf_copy_band<T>, grid, threads, 0, stream,
+                                    copymat_to_buffer, j + jb - r0, jb, kl, kv, r0, j, AB, shiftAB,
+                                    ldab, strideAB, W, ldw, strideW);
+
+            rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, jb,
+                nrhs, Wv, j - r0, ldw, strideW, B, shiftB + j, ldb, strideB, batch_count,
+                optim_mem, work1, work2, work3, work4);
+
+            if(j > r0)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, j - r0, nrhs, jb,
+                    &minone, Wv, 0, ldw, strideW, B, shiftB + j, ldb, strideB, &one, B,
+                    shiftB + r0, ldb, strideB, batch_count, (T**)nullptr);
+        }
+    }
+    else
+    {
+        // solve U'*Y = B, one block of jb rows of U at a time
+        ldw = nb;
+        for(rocblas_int bk = 0; bk < nblocks; bk++)
+        {
+            j = bk * nb;
+            jb = std::min(n - j, nb);
+            wn = std::min(jb + kv, n - j);
+
+            // copy the block row of U (from the diagonal to the last non-zero column)
+            // to the workspace
+            grid = dim3((jb - 1) / BS2 + 1, (wn - 1) / BS2 + 1, batch_count);
+            ROCSOLVER_LAUNCH_KERNEL(gbtrf_copy_band<T>, grid, threads, 0, stream,
+                                    copymat_to_buffer, jb, wn, kl, kv, j, j, AB, shiftAB, ldab,
+                                    strideAB, W, ldw, strideW);
+
+            rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, trans, rocblas_diagonal_non_unit, jb, nrhs, Wv, 0, ldw,
+                strideW, B, shiftB + j, ldb, strideB, batch_count, optim_mem, work1, work2, work3,
+                work4);
+
+            if(wn > jb)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, trans, rocblas_operation_none, wn - jb, nrhs, jb, &minone, Wv,
+                    idx2D(0, jb, ldw), ldw, strideW, B, shiftB + j, ldb, strideB, &one, B,
+                    shiftB + j + jb, ldb, strideB, batch_count, (T**)nullptr);
+        }
+
+        // solve L'*P'*X = Y, one block of jb columns of L at a time, from the bottom up
+        ldw = nb + kl;
+        for(rocblas_int bk = nblocks - 1; kl > 0 && bk >= 0; bk--)
+        {
+            j = bk * nb;
+            jb = std::min(n - j, nb);
+            wm = std::min(jb + kl, n - j);
+
+            grid = dim3((wm - 1) / BS2 + 1, (jb - 1) / BS2 + 1, batch_count);
+            ROCSOLVER_LAUNCH_KERNEL(gbtrf_copy_band<T>, grid, threads, 0, stream,
+                                    copymat_to_buffer, wm, jb, kl, kv, j, j, AB, shiftAB, ldab,
+                                    strideAB, W, ldw, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(gbtrf_panel_swaps<T>, gridSwaps, threadsSwaps, 0, stream, jb,
+                                    j, ipiv, 0, strideP, W, ldw, strideW, false);
+
+            if(wm > jb)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, trans, rocblas_operation_none, jb, nrhs, wm - jb, &minone, Wv, jb, ldw,
+                    strideW, B, shiftB + j + jb, ldb, strideB, &one, B, shiftB + j, ldb, strideB,
+                    batch_count, (T**)nullptr);
+
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, trans, rocblas_diagonal_unit, jb, nrhs, Wv, 0, ldw,
+                strideW, B, shiftB + j, ldb, strideB, batch_count, optim_mem, work1, work2, work3,
+                work4);
+
+            rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, 1, ldb, strideB, j + 1, j + jb,
+                                        ipiv, 0, -1, strideP, batch_count);
+        }
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gbtrs_template(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int nrhs,
+                                        U AB,
+                                        const rocblas_stride shiftAB,
+                                        const rocblas_int ldab,
+                                        const rocblas_stride strideAB,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_stride shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* W,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("gbtrs", "trans:", trans, "n:", n, "kl:", kl, "ku:", ku, "nrhs:", nrhs,
+                    "shiftAB:", shiftAB, "ldab:", ldab, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    if constexpr(BATCHED)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        // the blocks of the factors are addressed through an array of pointers
+        const rocblas_int nb = std::min(n, rocblas_int(GBTRF_BLOCKSIZE));
+        const rocblas_stride strideW = rocblas_stride(nb) * (nb + kl + ku);
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(BS1), 0, stream, workArr, W,
+                                strideW, batch_count);
+
+        gbtrs_solve<BATCHED, STRIDED, T>(handle, trans, n, kl, ku, nrhs, AB, shiftAB, ldab,
+                                         strideAB, ipiv, strideP, B, shiftB, ldb, strideB,
+                                         batch_count, W, (T* const*)workArr, work1, work2, work3,
+                                         work4, optim_mem);
+    }
+    else
+    {
+        gbtrs_solve<BATCHED, STRIDED, T>(handle, trans, n, kl, ku, nrhs, AB, shiftAB, ldab,
+                                         strideAB, ipiv, strideP, B, shiftB, ldb, strideB,
+                                         batch_count, W, W, work1, work2, work3, work4, optim_mem);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
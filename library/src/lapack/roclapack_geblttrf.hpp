@@ -0,0 +1,377 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_laswp.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getf2.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    The factorization with partial pivoting eliminates one block column at a
+ *    time. The rows of block column k that can be selected as pivots belong to
+ *    block rows k and k+1, so the interchanges of one step move the entries of
+ *    block row k+1 into block row k, and create fill-in in the second block
+ *    superdiagonal (stored in D). Every step copies the 2nb-by-3nb panel
+ *
+ *        [ B_k  C_k      0       ]
+ *        [ A_k  B_{k+1}  C_{k+1} ]
+ *
+ *    to a dense workspace, where the general GETF2, LASWP, TRSM and GEMM can
+ *    be applied to it, and copies it back to the blocks of the matrix.
+ * ===========================================================================
+ */
+
+/** GEBLTTRF_COPY_PANEL copies the first m rows and n columns of the panel of
+    block column k (see above) to (or from) the dense workspace W. When copying
+    to W, the block that will receive the fill-in is set to zero.
+    Call this kernel with batch_count groups in z, and enough groups in x and y
+    to cover m rows and n columns. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_copy_panel(const copymat_direction direction,
+                                          const rocblas_int nb,
+                                          const rocblas_int k,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          U AA,
+                                          const rocblas_int shiftA,
+                                          const rocblas_int inca,
+                                          const rocblas_int lda,
+                                          const rocblas_stride strideA,
+                                          U BB,
+                                          const rocblas_int shiftB,
+                                          const rocblas_int incb,
+                                          const rocblas_int ldb,
+                                          const rocblas_stride strideB,
+                                          U CC,
+                                          const rocblas_int shiftC,
+                                          const rocblas_int incc,
+                                          const rocblas_int ldc,
+                                          const rocblas_stride strideC,
+                                          U DD,
+                                          const rocblas_int shiftD,
+                                          const rocblas_int incd,
+                                          const rocblas_int ldd,
+                                          const rocblas_stride strideD,
+                                          T* WW,
+                                          const rocblas_int ldw,
+                                          const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < m && j < n)
+    {
+        T* W = WW + b * strideW;
+
+        // select the block of the matrix that holds entry (i,j) of the panel
+        const rocblas_int bi = i / nb;
+        const rocblas_int bj = j / nb;
+        T* X;
+        rocblas_int incx, ldx;
+        if(bi == 0 && bj == 0)
+        {
+            X = load_ptr_batch<T>(BB, b, shiftB + k * ldb * nb, strideB);
+            incx = incb;
+            ldx = ldb;
+        }
+        else if(bi == 1 && bj == 0)
+        {
+            X = load_ptr_batch<T>(AA, b, shiftA + k * lda * nb, strideA);
+            incx = inca;
+            ldx = lda;
+        }
+        else if(bi == 0 && bj == 1)
+        {
+            X = load_ptr_batch<T>(CC, b, shiftC + k * ldc * nb, strideC);
+            incx = incc;
+            ldx = ldc;
+        }
+        else if(bi == 1 && bj == 1)
+        {
+            X = load_ptr_batch<T>(BB, b, shiftB + (k + 1) * ldb * nb, strideB);
+            incx = incb;
+            ldx = ldb;
+        }
+        else if(bi == 0)
+        {
+            X = load_ptr_batch<T>(DD, b, shiftD + k * ldd * nb, strideD);
+            incx = incd;
+            ldx = ldd;
+        }
+        else
+        {
+            X = load_ptr_batch<T>(CC, b, shiftC + (k + 1) * ldc * nb, strideC);
+            incx = incc;
+            ldx = ldc;
+        }
+
+        const rocblas_int ii = i - bi * nb;
+        const rocblas_int jj = j - bj * nb;
+        if(direction == copymat_to_buffer)
+            W[i + j * ldw] = (bi == 0 && bj == 2) ? T(0) : X[ii * incx + jj * ldx];
+        else
+            X[ii * incx + jj * ldx] = W[i + j * ldw];
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_geblttrf_getMemorySize(const rocblas_int nb,
+                                      const rocblas_int nblocks,
+                                      const rocblas_int batch_count,
+                                      size_t* size_scalars,
+                                      size_t* size_work1,
+                                      size_t* size_work2,
+                                      size_t* size_work3,
+                                      size_t* size_work4,
+                                      size_t* size_pivotval,
+                                      size_t* size_pivotidx,
+                                      size_t* size_W,
+                                      bool* optim_mem)
+{
+    // if quick return, no workspace needed
+    if(nb == 0 || nblocks == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_W = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    rocblas_int ldw = 2 * nb;
+
+    // requirements for GETF2 on a block column of the panel
+    rocsolver_getf2_getMemorySize<true, T>(ldw, nb, true, batch_count, size_scalars, size_pivotval,
+                                           size_pivotidx, true);
+
+    // requirements for TRSM on the rest of the panel
+    if(nblocks > 1)
+        rocsolver_trsm_mem<false, true, T>(rocblas_side_left, rocblas_operation_none, nb, 2 * nb,
+                                           batch_count, size_work1, size_work2, size_work3,
+                                           size_work4, optim_mem, true, ldw, ldw);
+    else
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+    }
+
+    // dense workspace for the panel
+    *size_W = sizeof(T) * ldw * 3 * nb * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrf_argCheck(rocblas_handle handle,
+                                           const rocblas_int nb,
+                                           const rocblas_int nblocks,
+                                           const rocblas_int lda,
+                                           const rocblas_int ldb,
+                                           const rocblas_int ldc,
+                                           const rocblas_int ldd,
+                                           T A,
+                                           T B,
+                                           T C,
+                                           T D,
+                                           rocblas_int* ipiv,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count = 1,
+                                           const rocblas_int inca = 1,
+                                           const rocblas_int incb = 1,
+                                           const rocblas_int incc = 1,
+                                           const rocblas_int incd = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(inca < 1 || lda < inca * nb)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * nb)
+        return rocblas_status_invalid_size;
+    if(incc < 1 || ldc < incc * nb)
+        return rocblas_status_invalid_size;
+    if(incd < 1 || ldd < incd * nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((nb && nblocks > 1 && !A) || (nb && nblocks && !B) || (nb && nblocks > 1 && !C)
+       || (nb && nblocks > 2 && !D) || (nb && nblocks && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geblttrf_template(rocblas_handle handle,
+                                           const rocblas_int nb,
+                                           const rocblas_int nblocks,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int inca,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           U B,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int incb,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           U C,
+                                           const rocblas_int shiftC,
+                                           const rocblas_int incc,
+                                           const rocblas_int ldc,
+                                           const rocblas_stride strideC,
+                                           U D,
+                                           const rocblas_int shiftD,
+                                           const rocblas_int incd,
+                                           const rocblas_int ldd,
+                                           const rocblas_stride strideD,
+                                           rocblas_int* ipiv,
+                                           const rocblas_stride shiftP,
+                                           const rocblas_stride strideP,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count,
+                                           T* scalars,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4,
+                                           T* pivotval,
+                                           rocblas_int* pivotidx,
+                                           T* W,
+                                           const bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrf", "nb:", nb, "nblocks:", nblocks, "shiftA:", shiftA, "inca:", inca,
+                    "lda:", lda, "shiftB:", shiftB, "incb:", incb, "ldb:", ldb, "shiftC:", shiftC,
+                    "incc:", incc, "ldc:", ldc, "shiftD:", shiftD, "incd:", incd, "ldd:", ldd,
+                    "shiftP:", shiftP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info = 0 (starting with a nonsingular matrix)
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                            batch_count, 0);
+
+    // quick return if no dimensions
+    if(nb == 0 || nblocks == 0)
+        return rocblas_status_success;
+
+    const rocblas_int ldw = 2 * nb;
+    const rocblas_stride strideW = rocblas_stride(ldw) * 3 * nb;
+    dim3 threads(BS2, BS2, 1);
+    dim3 grid;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    rocblas_int wm, wn;
+    for(rocblas_int k = 0; k < nblocks; k++)
+    {
+        // the panel has wm rows (block rows k and k+1) and wn columns
+        // (block columns k to k+2)
+        wm = (k < nblocks - 1) ? 2 * nb : nb;
+        wn = std::min(nblocks - k, 3) * nb;
+
+        // copy the panel to the dense workspace
+        grid = dim3((wm - 1) / BS2 + 1, (wn - 1) / BS2 + 1, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_copy_panel<T>, grid, threads, 0, stream, copymat_to_buffer,
+                                nb, k, wm, wn, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb,
+                                strideB, C, shiftC, incc, ldc, strideC, D, shiftD, incd, ldd,
+                                strideD, W, ldw, strideW);
+
+        // factorize block column k
+        // (the pivot indices are relative to the first row of the matrix)
+        rocsolver_getf2_template<true, T>(handle, wm, nb, W, 0, 1, ldw, strideW, ipiv,
+                                          shiftP + k * nb, strideP, info, batch_count, scalars,
+                                          pivotval, pivotidx, true, k * nb);
+
+        if(wn > nb)
+        {
+            // apply the row interchanges to the rest of the panel
+            rocsolver_laswp_template<T>(handle, wn - nb, W, idx2D(0, nb, ldw) - k * nb, 1, ldw,
+                                        strideW, k * nb + 1, k * nb + nb, ipiv, shiftP, 1, strideP,
+                                        batch_count);
+
+            // update block row k of U
+            rocsolver_trsm_lower<false, true, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, nb,
+                wn - nb, W, 0, ldw, strideW, W, idx2D(0, nb, ldw), ldw, strideW, batch_count,
+                optim_mem, work1, work2, work3, work4);
+
+            // update block row k+1
+            rocsolver_gemm<false, true, T>(
+                handle, rocblas_operation_none, rocblas_operation_none, nb, wn - nb, nb, &minone, W,
+                idx2D(nb, 0, ldw), ldw, strideW, W, idx2D(0, nb, ldw), ldw, strideW, &one, W,
+                idx2D(nb, nb, ldw), ldw, strideW, batch_count, (T**)nullptr);
+        }
+
+        // copy the results back to the blocks of the matrix
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_copy_panel<T>, grid, threads, 0, stream,
+                                copymat_from_buffer, nb, k, wm, wn, A, shiftA, inca, lda, strideA,
+                                B, shiftB, incb, ldb, strideB, C, shiftC, incc, ldc, strideC, D,
+                                shiftD, incd, ldd, strideD, W, ldw, strideW);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
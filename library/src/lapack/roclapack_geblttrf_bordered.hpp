@@ -0,0 +1,280 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_geblttrf.hpp"
+#include "roclapack_geblttrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    A bordered (arrowhead) block tridiagonal matrix has the form
+ *
+ *        M = [ T  E ]
+ *            [ F  G ]
+ *
+ *    where T is a block tridiagonal matrix with nblocks blocks of size nb, E
+ *    and F are a dense block column and a dense block row with nbr columns and
+ *    rows, respectively, and G is a dense nbr-by-nbr block. T is factorized
+ *    with GEBLTTRF, E is overwritten by T^{-1} * E, and G by the LU
+ *    factorization of the Schur complement G - F * T^{-1} * E. All the extra
+ *    work and storage is linear in the number of blocks.
+ * ===========================================================================
+ */
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_geblttrf_bordered_getMemorySize(const rocblas_int nb,
+                                               const rocblas_int nblocks,
+                                               const rocblas_int nbr,
+                                               const rocblas_int batch_count,
+                                               size_t* size_scalars,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               size_t* size_pivotval,
+                                               size_t* size_pivotidx,
+                                               size_t* size_W,
+                                               bool* optim_mem)
+{
+    // if quick return, no workspace needed
+    if(((nb == 0 || nblocks == 0) && nbr == 0) || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_W = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4, s1, s2, s3;
+
+    // requirements for the factorization of T
+    rocsolver_geblttrf_getMemorySize<BATCHED, STRIDED, T>(
+        nb, nblocks, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_W, &opt1);
+
+    // requirements for computing T^{-1} * E
+    rocsolver_geblttrs_getMemorySize<BATCHED, STRIDED, T>(nb, nblocks, nbr, batch_count, &w1, &w2,
+                                                          &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+
+    // requirements for factorizing the Schur complement
+    rocsolver_getf2_getMemorySize<BATCHED || STRIDED, T>(nbr, nbr, true, batch_count, &s1, &s2,
+                                                         &s3, true);
+
+    *size_scalars = std::max(*size_scalars, s1);
+    *size_pivotval = std::max(*size_pivotval, s2);
+    *size_pivotidx = std::max(*size_pivotidx, s3);
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrf_bordered_argCheck(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int nbr,
+                                                    const rocblas_int lda,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_int lde,
+                                                    const rocblas_int ldf,
+                                                    const rocblas_int ldg,
+                                                    T A,
+                                                    T B,
+                                                    T C,
+                                                    T D,
+                                                    T E,
+                                                    T F,
+                                                    T G,
+                                                    rocblas_int* ipiv,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || nbr < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(lda < nb || ldb < nb || ldc < nb || ldd < nb || lde < nb)
+        return rocblas_status_invalid_size;
+    if(ldf < nbr || ldg < nbr)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    const bool inner = (nb && nblocks);
+    if((inner && nblocks > 1 && !A) || (inner && !B) || (inner && nblocks > 1 && !C)
+       || (inner && nblocks > 2 && !D) || (inner && nbr && !E) || (inner && nbr && !F)
+       || (nbr && !G) || ((inner || nbr) && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geblttrf_bordered_template(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int nbr,
+                                                    U A,
+                                                    const rocblas_int shiftA,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int shiftB,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U C,
+                                                    const rocblas_int shiftC,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_stride strideC,
+                                                    U D,
+                                                    const rocblas_int shiftD,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_stride strideD,
+                                                    U E,
+                                                    const rocblas_int shiftE,
+                                                    const rocblas_int lde,
+                                                    const rocblas_stride strideE,
+                                                    U F,
+                                                    const rocblas_int shiftF,
+                                                    const rocblas_int ldf,
+                                                    const rocblas_stride strideF,
+                                                    U G,
+                                                    const rocblas_int shiftG,
+                                                    const rocblas_int ldg,
+                                                    const rocblas_stride strideG,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride shiftP,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count,
+                                                    T* scalars,
+                                                    void* work1,
+                                                    void* work2,
+                                                    void* work3,
+                                                    void* work4,
+                                                    T* pivotval,
+                                                    rocblas_int* pivotidx,
+                                                    T* W,
+                                                    const bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrf_bordered", "nb:", nb, "nblocks:", nblocks, "nbr:", nbr,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftC:", shiftC, "ldc:", ldc, "shiftD:", shiftD, "ldd:", ldd,
+                    "shiftE:", shiftE, "lde:", lde, "shiftF:", shiftF, "ldf:", ldf,
+                    "shiftG:", shiftG, "ldg:", ldg, "shiftP:", shiftP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info = 0 (starting with a nonsingular matrix)
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                            batch_count, 0);
+
+    // number of rows of T
+    const rocblas_int n1 = nb * nblocks;
+
+    // quick return if no dimensions
+    if(n1 == 0 && nbr == 0)
+        return rocblas_status_success;
+
+    if(n1 > 0)
+    {
+        // factorize T
+        rocsolver_geblttrf_template<BATCHED, STRIDED, T>(
+            handle, nb, nblocks, A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB, C, shiftC,
+            1, ldc, strideC, D, shiftD, 1, ldd, strideD, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work1, work2, work3, work4, pivotval, pivotidx, W, optim_mem);
+
+        if(nbr > 0)
+        {
+            // compute T^{-1} * E
+            rocsolver_geblttrs_template<BATCHED, STRIDED, T>(
+                handle, nb, nblocks, nbr, A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB,
+                C, shiftC, 1, ldc, strideC, D, shiftD, 1, ldd, strideD, ipiv, shiftP, strideP, E,
+                shiftE, 1, lde, strideE, batch_count, work1, work2, work3, work4, optim_mem);
+
+            // everything must be executed with scalars on the host
+            rocblas_pointer_mode old_mode;
+            rocblas_get_pointer_mode(handle, &old_mode);
+            rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+            T one = 1;
+            T minone = -1;
+
+            // Schur complement G - F * T^{-1} * E, one block at a time
+            for(rocblas_int k = 0; k < nblocks; k++)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, nbr, nbr, nb, &minone,
+                    F, shiftF + k * ldf * nb, 1, ldf, strideF, E, shiftE + k * lde * nbr, 1, lde,
+                    strideE, &one, G, shiftG, 1, ldg, strideG, batch_count, (T**)nullptr);
+
+            rocblas_set_pointer_mode(handle, old_mode);
+        }
+    }
+
+    // factorize the Schur complement
+    // (the pivot indices are relative to the first row of the matrix)
+    if(nbr > 0)
+        rocsolver_getf2_template<BATCHED || STRIDED, T>(
+            handle, nbr, nbr, G, shiftG, 1, ldg, strideG, ipiv, shiftP + n1, strideP, info,
+            batch_count, scalars, pivotval, pivotidx, true, n1);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
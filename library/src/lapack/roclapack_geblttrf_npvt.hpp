@@ -48,6 +48,359 @@ ROCSOLVER_KERNEL void
     }
 }
 
+/*
+ * ===========================================================================
+ *    Cyclic reduction kernels. The Schur complements
+ *
+ *        S_0 = B_0,  S_k = B_k - A_{k-1} * inv(S_{k-1}) * C_{k-1}
+ *
+ *    are computed for all k at once with a parallel prefix scan over the block
+ *    rows. The state of a segment of block rows [l, r], once its interior rows
+ *    have been eliminated, is given by four nb-by-nb blocks: P and Q, the
+ *    updates to the diagonal of row l and to its coupling with row r, and R and
+ *    T, the coupling of row r with row l and the update to its diagonal. Every
+ *    step of the scan merges two adjacent segments by eliminating the block row
+ *    that they share, so that after ceil(log2(nblocks - 1)) steps all segments
+ *    start at row 0.
+ *
+ *    The workspace holds, for each instance of the batch and each block row,
+ *    two buffers with the states P, Q, R and T (for the ping-pong of the scan),
+ *    and the scratch blocks M and Y = [Y_R, Y_Q] used to merge segments. The
+ *    elements of a block are interleaved across the block rows so that the
+ *    accesses of consecutive threads are coalesced.
+ * ===========================================================================
+ */
+
+/** GEBLTTRF_CR_GETF2 computes the LU factorization without pivoting of the
+    nb-by-nb matrix M, where element (i,j) is stored in M[i * incm + j * ldm].
+    It returns the index of the first zero pivot, or zero if there is none **/
+template <typename T>
+__device__ rocblas_int geblttrf_cr_getf2(const rocblas_int nb,
+                                         T* M,
+                                         const rocblas_stride incm,
+                                         const rocblas_stride ldm)
+{
+    rocblas_int info = 0;
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        T pivot = M[j * incm + j * ldm];
+        if(pivot != T(0))
+        {
+            for(rocblas_int i = j + 1; i < nb; i++)
+                M[i * incm + j * ldm] /= pivot;
+        }
+        else if(info == 0)
+            info = j + 1;
+
+        for(rocblas_int jj = j + 1; jj < nb; jj++)
+        {
+            T t = M[j * incm + jj * ldm];
+            for(rocblas_int i = j + 1; i < nb; i++)
+                M[i * incm + jj * ldm] -= M[i * incm + j * ldm] * t;
+        }
+    }
+
+    return info;
+}
+
+/** GEBLTTRF_CR_GETRS overwrites the nb-by-nrhs matrix X with inv(M) * X, where
+    M holds the factors computed by GEBLTTRF_CR_GETF2 **/
+template <typename T>
+__device__ void geblttrf_cr_getrs(const rocblas_int nb,
+                                  const rocblas_int nrhs,
+                                  T* M,
+                                  const rocblas_stride incm,
+                                  const rocblas_stride ldm,
+                                  T* X,
+                                  const rocblas_stride incx,
+                                  const rocblas_stride ldx)
+{
+    for(rocblas_int c = 0; c < nrhs; c++)
+    {
+        T* x = X + c * ldx;
+
+        for(rocblas_int i = 1; i < nb; i++)
+        {
+            for(rocblas_int l = 0; l < i; l++)
+                x[i * incx] -= M[i * incm + l * ldm] * x[l * incx];
+        }
+
+        for(rocblas_int i = nb - 1; i >= 0; i--)
+        {
+            for(rocblas_int l = i + 1; l < nb; l++)
+                x[i * incx] -= M[i * incm + l * ldm] * x[l * incx];
+            x[i * incx] = x[i * incx] / M[i * incm + i * ldm];
+        }
+    }
+}
+
+/** GEBLTTRF_CR_INIT sets the state of the segments [k-1, k], for k = 1, ...,
+    nblocks - 1, in the first buffer of the workspace **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_cr_init(const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       U AA,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int inca,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U CC,
+                                       const rocblas_int shiftC,
+                                       const rocblas_int incc,
+                                       const rocblas_int ldc,
+                                       const rocblas_stride strideC,
+                                       T* work)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x + 1;
+    if(k >= nblocks)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA + (k - 1) * lda * nb, strideA);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC + (k - 1) * ldc * nb, strideC);
+    size_t bs = size_t(nb) * nb * nblocks;
+    T* W = work + bid * 11 * bs + k;
+
+    // element (i,j) of a block of the workspace is at (i + j * nb) * nblocks
+    rocblas_stride incw = nblocks;
+    rocblas_stride ldw = rocblas_stride(nb) * nblocks;
+
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        for(rocblas_int i = 0; i < nb; i++)
+        {
+            W[i * incw + j * ldw] = 0;
+            W[bs + i * incw + j * ldw] = C[i * incc + j * ldc];
+            W[2 * bs + i * incw + j * ldw] = A[i * inca + j * lda];
+            W[3 * bs + i * incw + j * ldw] = 0;
+        }
+    }
+}
+
+/** GEBLTTRF_CR_STEP executes one step of the scan, merging the segment ending
+    at row k with the one ending at row k - d (if k - d > 0) **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_cr_step(const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       const rocblas_int d,
+                                       const rocblas_int src,
+                                       U BB,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       T* work)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x + 1;
+    if(k >= nblocks)
+        return;
+
+    // batch instance
+    size_t bs = size_t(nb) * nb * nblocks;
+    T* cur = work + bid * 11 * bs + src * 4 * bs;
+    T* nxt = work + bid * 11 * bs + (1 - src) * 4 * bs + k;
+
+    rocblas_stride incw = nblocks;
+    rocblas_stride ldw = rocblas_stride(nb) * nblocks;
+
+    // the segment already starts at row 0
+    if(k - d < 1)
+    {
+        for(rocblas_int j = 0; j < nb; j++)
+        {
+            for(rocblas_int i = 0; i < nb; i++)
+            {
+                for(rocblas_int s = 0; s < 4; s++)
+                    nxt[s * bs + i * incw + j * ldw] = cur[k + s * bs + i * incw + j * ldw];
+            }
+        }
+        return;
+    }
+
+    // states of the left (1) and right (2) segments, sharing row k - d
+    T* P1 = cur + (k - d);
+    T* Q1 = P1 + bs;
+    T* R1 = P1 + 2 * bs;
+    T* T1 = P1 + 3 * bs;
+    T* P2 = cur + k;
+    T* Q2 = P2 + bs;
+    T* R2 = P2 + 2 * bs;
+    T* T2 = P2 + 3 * bs;
+    T* B = load_ptr_batch<T>(BB, bid, shiftB + (k - d) * ldb * nb, strideB);
+    T* M = work + bid * 11 * bs + 8 * bs + k;
+    T* Y = work + bid * 11 * bs + 9 * bs + k;
+
+    // M = T1 + B + P2 and Y = inv(M) * [R1, Q2]
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        for(rocblas_int i = 0; i < nb; i++)
+        {
+            M[i * incw + j * ldw] = T1[i * incw + j * ldw] + B[i * incb + j * ldb]
+                + P2[i * incw + j * ldw];
+            Y[i * incw + j * ldw] = R1[i * incw + j * ldw];
+            Y[i * incw + (j + nb) * ldw] = Q2[i * incw + j * ldw];
+        }
+    }
+
+    geblttrf_cr_getf2(nb, M, incw, ldw);
+    geblttrf_cr_getrs(nb, 2 * nb, M, incw, ldw, Y, incw, ldw);
+
+    // P = P1 - Q1 * Y_R, Q = -Q1 * Y_Q, R = -R2 * Y_R, T = T2 - R2 * Y_Q
+    T p, q, r, t;
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        for(rocblas_int i = 0; i < nb; i++)
+        {
+            p = P1[i * incw + j * ldw];
+            q = 0;
+            r = 0;
+            t = T2[i * incw + j * ldw];
+            for(rocblas_int l = 0; l < nb; l++)
+            {
+                p -= Q1[i * incw + l * ldw] * Y[l * incw + j * ldw];
+                q -= Q1[i * incw + l * ldw] * Y[l * incw + (j + nb) * ldw];
+                r -= R2[i * incw + l * ldw] * Y[l * incw + j * ldw];
+                t -= R2[i * incw + l * ldw] * Y[l * incw + (j + nb) * ldw];
+            }
+            nxt[i * incw + j * ldw] = p;
+            nxt[bs + i * incw + j * ldw] = q;
+            nxt[2 * bs + i * incw + j * ldw] = r;
+            nxt[3 * bs + i * incw + j * ldw] = t;
+        }
+    }
+}
+
+/** GEBLTTRF_CR_FINISH overwrites B_k, for k = 1, ..., nblocks - 1, with the
+    Schur complement S_k = B_k + T_k - R_k * inv(B_0 + P_k) * Q_k **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_cr_finish(const rocblas_int nb,
+                                         const rocblas_int nblocks,
+                                         const rocblas_int src,
+                                         U BB,
+                                         const rocblas_int shiftB,
+                                         const rocblas_int incb,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB,
+                                         T* work)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x + 1;
+    if(k >= nblocks)
+        return;
+
+    // batch instance
+    size_t bs = size_t(nb) * nb * nblocks;
+    T* P = work + bid * 11 * bs + src * 4 * bs + k;
+    T* Q = P + bs;
+    T* R = P + 2 * bs;
+    T* Tk = P + 3 * bs;
+    T* B0 = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* B = B0 + k * ldb * nb;
+    T* M = work + bid * 11 * bs + 8 * bs + k;
+    T* Y = work + bid * 11 * bs + 9 * bs + k;
+
+    rocblas_stride incw = nblocks;
+    rocblas_stride ldw = rocblas_stride(nb) * nblocks;
+
+    // Y = inv(B_0 + P) * Q
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        for(rocblas_int i = 0; i < nb; i++)
+        {
+            M[i * incw + j * ldw] = B0[i * incb + j * ldb] + P[i * incw + j * ldw];
+            Y[i * incw + j * ldw] = Q[i * incw + j * ldw];
+        }
+    }
+
+    geblttrf_cr_getf2(nb, M, incw, ldw);
+    geblttrf_cr_getrs(nb, nb, M, incw, ldw, Y, incw, ldw);
+
+    T s;
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        for(rocblas_int i = 0; i < nb; i++)
+        {
+            s = B[i * incb + j * ldb] + Tk[i * incw + j * ldw];
+            for(rocblas_int l = 0; l < nb; l++)
+                s -= R[i * incw + l * ldw] * Y[l * incw + j * ldw];
+            B[i * incb + j * ldb] = s;
+        }
+    }
+}
+
+/** GEBLTTRF_CR_FACTOR factorizes the Schur complements S_k stored in B_k, and
+    overwrites C_k with inv(S_k) * C_k. The info values of every block are kept
+    in iinfo **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_cr_factor(const rocblas_int nb,
+                                         const rocblas_int nblocks,
+                                         U BB,
+                                         const rocblas_int shiftB,
+                                         const rocblas_int incb,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB,
+                                         U CC,
+                                         const rocblas_int shiftC,
+                                         const rocblas_int incc,
+                                         const rocblas_int ldc,
+                                         const rocblas_stride strideC,
+                                         rocblas_int* iinfo)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(k >= nblocks)
+        return;
+
+    // batch instance
+    T* B = load_ptr_batch<T>(BB, bid, shiftB + k * ldb * nb, strideB);
+
+    iinfo[bid * nblocks + k] = geblttrf_cr_getf2(nb, B, incb, ldb);
+
+    if(k < nblocks - 1)
+    {
+        T* C = load_ptr_batch<T>(CC, bid, shiftC + k * ldc * nb, strideC);
+        geblttrf_cr_getrs(nb, nb, B, incb, ldb, C, incc, ldc);
+    }
+}
+
+/** GEBLTTRF_CR_INFO sets info to the first zero pivot found by
+    GEBLTTRF_CR_FACTOR **/
+template <typename T>
+ROCSOLVER_KERNEL void geblttrf_cr_info(const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       T* iinfo,
+                                       T* info,
+                                       const rocblas_int bc)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < bc)
+    {
+        info[b] = 0;
+        for(rocblas_int k = 0; k < nblocks; k++)
+        {
+            if(iinfo[b * nblocks + k] != 0)
+            {
+                info[b] = iinfo[b * nblocks + k] + k * nb;
+                break;
+            }
+        }
+    }
+}
+
+/** GEBLTTRF_USE_CR returns true if the block chains are long enough, and the
+    blocks and the batch small enough, for the cyclic reduction to be faster
+    than the sequential elimination of the block rows **/
+inline bool geblttrf_use_cr(const rocblas_int nb,
+                            const rocblas_int nblocks,
+                            const rocblas_int batch_count)
+{
+    return nblocks >= GEBLTTRF_CR_MIN_BLOCKS && nb <= GEBLTTRF_CR_MAX_NB
+        && batch_count <= GEBLTTRF_CR_MAX_BATCH;
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_geblttrf_npvt_getMemorySize(const rocblas_int nb,
                                            const rocblas_int nblocks,
@@ -84,6 +437,24 @@ void rocsolver_geblttrf_npvt_getMemorySize(const rocblas_int nb,
         return;
     }
 
+    // the cyclic reduction only needs work1, for the states of the scan, and
+    // iinfo2, for the info values of every block
+    if(geblttrf_use_cr(nb, nblocks, batch_count))
+    {
+        *size_scalars = 0;
+        *size_work1 = sizeof(T) * 11 * size_t(nb) * nb * nblocks * batch_count;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo1 = 0;
+        *size_iinfo2 = sizeof(rocblas_int) * nblocks * batch_count;
+        *optim_mem = true;
+        return;
+    }
+
     bool unused;
     size_t a1 = 0, a2 = 0;
     size_t b1 = 0, b2 = 0;
@@ -203,6 +574,36 @@ rocblas_status rocsolver_geblttrf_npvt_template(rocblas_handle handle,
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
+    // cyclic reduction with O(log(nblocks)) depth
+    if(geblttrf_use_cr(nb, nblocks, batch_count))
+    {
+        T* work = (T*)work1;
+        rocblas_int blocks = (nblocks - 1) / BS1 + 1;
+        dim3 grid(blocks, batch_count, 1);
+
+        ROCSOLVER_LAUNCH_KERNEL((geblttrf_cr_init<T>), grid, threads, 0, stream, nb, nblocks, A,
+                                shiftA, inca, lda, strideA, C, shiftC, incc, ldc, strideC, work);
+
+        rocblas_int src = 0;
+        for(rocblas_int d = 1; d < nblocks - 1; d *= 2)
+        {
+            ROCSOLVER_LAUNCH_KERNEL((geblttrf_cr_step<T>), grid, threads, 0, stream, nb, nblocks, d,
+                                    src, B, shiftB, incb, ldb, strideB, work);
+            src = 1 - src;
+        }
+
+        ROCSOLVER_LAUNCH_KERNEL((geblttrf_cr_finish<T>), grid, threads, 0, stream, nb, nblocks,
+                                src, B, shiftB, incb, ldb, strideB, work);
+
+        ROCSOLVER_LAUNCH_KERNEL((geblttrf_cr_factor<T>), grid, threads, 0, stream, nb, nblocks, B,
+                                shiftB, incb, ldb, strideB, C, shiftC, incc, ldc, strideC, iinfo2);
+
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_cr_info, gridReset, threads, 0, stream, nb, nblocks,
+                                iinfo2, info, batch_count);
+
+        return rocblas_status_success;
+    }
+
     T one = T(1);
     T minone = T(-1);
 
@@ -0,0 +1,363 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_geblttrf.hpp"
+#include "roclapack_geblttrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    A periodic block tridiagonal matrix M with nblocks = n blocks has, in
+ *    addition to the blocks of the tridiagonal part, the corner blocks A_{n-1}
+ *    (top right) and C_{n-1} (bottom left). Its last block row and column are
+ *    treated as a border:
+ *
+ *        M = [ T  E ]
+ *            [ F  G ]
+ *
+ *    where T is the (non-periodic) block tridiagonal matrix formed by the first
+ *    n-1 blocks, E has the blocks A_{n-1} and C_{n-2} in its first and last
+ *    block rows, F has the blocks C_{n-1} and A_{n-2} in its first and last
+ *    block columns, and G = B_{n-1}. T is factorized with GEBLTTRF, E is
+ *    overwritten by T^{-1} * E, and G by the LU factorization of the Schur
+ *    complement G - F * T^{-1} * E. All the extra work and storage is linear in
+ *    the number of blocks.
+ * ===========================================================================
+ */
+
+/** GEBLTTRF_PERIODIC_BORDER sets the n-1 blocks of the border column E of the
+    periodic matrix (see above). If n = 2, the two corner blocks are added.
+    Call this kernel with batch_count groups in z, and enough groups in x and y
+    to cover nb rows and nb*(n-1) columns. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_periodic_border(const rocblas_int nb,
+                                               const rocblas_int nblocks,
+                                               U AA,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               U CC,
+                                               const rocblas_int shiftC,
+                                               const rocblas_int ldc,
+                                               const rocblas_stride strideC,
+                                               U EE,
+                                               const rocblas_int shiftE,
+                                               const rocblas_int lde,
+                                               const rocblas_stride strideE)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < nb && j < nb * (nblocks - 1))
+    {
+        const rocblas_int k = j / nb;
+        const rocblas_int jj = j - k * nb;
+        T val = 0;
+
+        // top right corner block A_{n-1}
+        if(k == 0)
+        {
+            T* A = load_ptr_batch<T>(AA, b, shiftA + (nblocks - 1) * lda * nb, strideA);
+            val += A[i + jj * lda];
+        }
+
+        // superdiagonal block C_{n-2}
+        if(k == nblocks - 2)
+        {
+            T* C = load_ptr_batch<T>(CC, b, shiftC + k * ldc * nb, strideC);
+            val += C[i + jj * ldc];
+        }
+
+        T* E = load_ptr_batch<T>(EE, b, shiftE, strideE);
+        E[i + j * lde] = val;
+    }
+}
+
+/** GEBLTTRF_PERIODIC_FOLD adds the blocks A_0 and C_0 to B_0 when the periodic
+    matrix has a single block.
+    Call this kernel with batch_count groups in z, and enough groups in x and y
+    to cover nb rows and nb columns. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_periodic_fold(const rocblas_int nb,
+                                             U AA,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             U BB,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             U CC,
+                                             const rocblas_int shiftC,
+                                             const rocblas_int ldc,
+                                             const rocblas_stride strideC)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < nb && j < nb)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        T* C = load_ptr_batch<T>(CC, b, shiftC, strideC);
+
+        B[i + j * ldb] += A[i + j * lda] + C[i + j * ldc];
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_geblttrf_periodic_getMemorySize(const rocblas_int nb,
+                                               const rocblas_int nblocks,
+                                               const rocblas_int batch_count,
+                                               size_t* size_scalars,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               size_t* size_pivotval,
+                                               size_t* size_pivotidx,
+                                               size_t* size_W,
+                                               bool* optim_mem)
+{
+    // if quick return, no workspace needed
+    if(nb == 0 || nblocks == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_W = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4, s1, s2, s3;
+
+    // requirements for the factorization of T
+    rocsolver_geblttrf_getMemorySize<BATCHED, STRIDED, T>(
+        nb, nblocks - 1, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_W, &opt1);
+
+    // requirements for computing T^{-1} * E
+    rocsolver_geblttrs_getMemorySize<BATCHED, STRIDED, T>(nb, nblocks - 1, nb, batch_count, &w1,
+                                                          &w2, &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+
+    // requirements for factorizing the Schur complement
+    rocsolver_getf2_getMemorySize<BATCHED || STRIDED, T>(nb, nb, true, batch_count, &s1, &s2, &s3,
+                                                         true);
+
+    *size_scalars = std::max(*size_scalars, s1);
+    *size_pivotval = std::max(*size_pivotval, s2);
+    *size_pivotidx = std::max(*size_pivotidx, s3);
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrf_periodic_argCheck(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int lda,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_int lde,
+                                                    T A,
+                                                    T B,
+                                                    T C,
+                                                    T D,
+                                                    T E,
+                                                    rocblas_int* ipiv,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(lda < nb || ldb < nb || ldc < nb || ldd < nb || lde < nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((nb && nblocks && !A) || (nb && nblocks && !B) || (nb && nblocks && !C)
+       || (nb && nblocks > 3 && !D) || (nb && nblocks > 1 && !E) || (nb && nblocks && !ipiv)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geblttrf_periodic_template(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    U A,
+                                                    const rocblas_int shiftA,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int shiftB,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U C,
+                                                    const rocblas_int shiftC,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_stride strideC,
+                                                    U D,
+                                                    const rocblas_int shiftD,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_stride strideD,
+                                                    U E,
+                                                    const rocblas_int shiftE,
+                                                    const rocblas_int lde,
+                                                    const rocblas_stride strideE,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride shiftP,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count,
+                                                    T* scalars,
+                                                    void* work1,
+                                                    void* work2,
+                                                    void* work3,
+                                                    void* work4,
+                                                    T* pivotval,
+                                                    rocblas_int* pivotidx,
+                                                    T* W,
+                                                    const bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrf_periodic", "nb:", nb, "nblocks:", nblocks, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "shiftC:", shiftC, "ldc:", ldc,
+                    "shiftD:", shiftD, "ldd:", ldd, "shiftE:", shiftE, "lde:", lde,
+                    "shiftP:", shiftP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info = 0 (starting with a nonsingular matrix)
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                            batch_count, 0);
+
+    // quick return if no dimensions
+    if(nb == 0 || nblocks == 0)
+        return rocblas_status_success;
+
+    // number of rows of T
+    const rocblas_int n1 = nb * (nblocks - 1);
+    dim3 threads(BS2, BS2, 1);
+    dim3 grid;
+
+    if(nblocks > 1)
+    {
+        // factorize T
+        rocsolver_geblttrf_template<BATCHED, STRIDED, T>(
+            handle, nb, nblocks - 1, A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB, C,
+            shiftC, 1, ldc, strideC, D, shiftD, 1, ldd, strideD, ipiv, shiftP, strideP, info,
+            batch_count, scalars, work1, work2, work3, work4, pivotval, pivotidx, W, optim_mem);
+
+        // set the border column E and compute T^{-1} * E
+        grid = dim3((nb - 1) / BS2 + 1, (n1 - 1) / BS2 + 1, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_periodic_border<T>, grid, threads, 0, stream, nb, nblocks,
+                                A, shiftA, lda, strideA, C, shiftC, ldc, strideC, E, shiftE, lde,
+                                strideE);
+
+        rocsolver_geblttrs_template<BATCHED, STRIDED, T>(
+            handle, nb, nblocks - 1, nb, A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB, C,
+            shiftC, 1, ldc, strideC, D, shiftD, 1, ldd, strideD, ipiv, shiftP, strideP, E, shiftE,
+            1, lde, strideE, batch_count, work1, work2, work3, work4, optim_mem);
+
+        // everything must be executed with scalars on the host
+        rocblas_pointer_mode old_mode;
+        rocblas_get_pointer_mode(handle, &old_mode);
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+        T one = 1;
+        T minone = -1;
+
+        // Schur complement G - F * T^{-1} * E, where F only has the blocks C_{n-1}
+        // and A_{n-2}
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nb, nb, nb, &minone, C,
+            shiftC + (nblocks - 1) * ldc * nb, 1, ldc, strideC, E, shiftE, 1, lde, strideE, &one, B,
+            shiftB + (nblocks - 1) * ldb * nb, 1, ldb, strideB, batch_count, (T**)nullptr);
+
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nb, nb, nb, &minone, A,
+            shiftA + (nblocks - 2) * lda * nb, 1, lda, strideA, E,
+            shiftE + (nblocks - 2) * lde * nb, 1, lde, strideE, &one, B,
+            shiftB + (nblocks - 1) * ldb * nb, 1, ldb, strideB, batch_count, (T**)nullptr);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+    }
+    else
+    {
+        // with a single block, the corner blocks are added to the diagonal block
+        grid = dim3((nb - 1) / BS2 + 1, (nb - 1) / BS2 + 1, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_periodic_fold<T>, grid, threads, 0, stream, nb, A, shiftA,
+                                lda, strideA, B, shiftB, ldb, strideB, C, shiftC, ldc, strideC);
+    }
+
+    // factorize the Schur complement
+    // (the pivot indices are relative to the first row of the matrix)
+    rocsolver_getf2_template<BATCHED || STRIDED, T>(
+        handle, nb, nb, B, shiftB + (nblocks - 1) * ldb * nb, 1, ldb, strideB, ipiv, shiftP + n1,
+        strideP, info, batch_count, scalars, pivotval, pivotidx, true, n1);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,236 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geblttrf_periodic.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_geblttrf_periodic_batched_impl(rocblas_handle handle,
+                                                        const rocblas_int nb,
+                                                        const rocblas_int nblocks,
+                                                        U A,
+                                                        const rocblas_int lda,
+                                                        U B,
+                                                        const rocblas_int ldb,
+                                                        U C,
+                                                        const rocblas_int ldc,
+                                                        U D,
+                                                        const rocblas_int ldd,
+                                                        U E,
+                                                        const rocblas_int lde,
+                                                        rocblas_int* ipiv,
+                                                        const rocblas_stride strideP,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geblttrf_periodic_batched", "--nb", nb, "--nblocks", nblocks, "--lda", lda,
+                        "--ldb", ldb, "--ldc", ldc, "--ldd", ldd, "--lde", lde, "--strideP",
+                        strideP, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geblttrf_periodic_argCheck(
+        handle, nb, nblocks, lda, ldb, ldc, ldd, lde, A, B, C, D, E, ipiv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftC = 0;
+    rocblas_int shiftD = 0;
+    rocblas_int shiftE = 0;
+    rocblas_stride shiftP = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideC = 0;
+    rocblas_stride strideD = 0;
+    rocblas_stride strideE = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size of the dense workspace for the panels
+    size_t size_W;
+    rocsolver_geblttrf_periodic_getMemorySize<true, false, T>(
+        nb, nblocks, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_W, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_W);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *W;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_W);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    W = mem[7];
+
+    // execution
+    auto launch = [&]() {
+        if(size_scalars > 0)
+            init_scalars(handle, (T*)scalars);
+
+        return rocsolver_geblttrf_periodic_template<true, false, T>(
+            handle, nb, nblocks, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, C, shiftC, ldc,
+            strideC, D, shiftD, ldd, strideD, E, shiftE, lde, strideE, ipiv, shiftP, strideP, info,
+            batch_count, (T*)scalars, work1, work2, work3, work4, (T*)pivotval,
+            (rocblas_int*)pivotidx, (T*)W, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "geblttrf_periodic_batched", launch, nb, nblocks,
+                                         A, lda, B, ldb, C, ldc, D, ldd, E, lde, ipiv, strideP,
+                                         info, batch_count, scalars, work1, work2, work3, work4,
+                                         pivotval, pivotidx, W);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeblttrf_periodic_batched(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    float* const A[],
+                                                    const rocblas_int lda,
+                                                    float* const B[],
+                                                    const rocblas_int ldb,
+                                                    float* const C[],
+                                                    const rocblas_int ldc,
+                                                    float* const D[],
+                                                    const rocblas_int ldd,
+                                                    float* const E[],
+                                                    const rocblas_int lde,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geblttrf_periodic_batched_impl<float>(
+        handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E, lde, ipiv, strideP, info,
+        batch_count);
+}
+
+rocblas_status rocsolver_dgeblttrf_periodic_batched(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    double* const A[],
+                                                    const rocblas_int lda,
+                                                    double* const B[],
+                                                    const rocblas_int ldb,
+                                                    double* const C[],
+                                                    const rocblas_int ldc,
+                                                    double* const D[],
+                                                    const rocblas_int ldd,
+                                                    double* const E[],
+                                                    const rocblas_int lde,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geblttrf_periodic_batched_impl<double>(
+        handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E, lde, ipiv, strideP, info,
+        batch_count);
+}
+
+rocblas_status rocsolver_cgeblttrf_periodic_batched(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    rocblas_float_complex* const A[],
+                                                    const rocblas_int lda,
+                                                    rocblas_float_complex* const B[],
+                                                    const rocblas_int ldb,
+                                                    rocblas_float_complex* const C[],
+                                                    const rocblas_int ldc,
+                                                    rocblas_float_complex* const D[],
+                                                    const rocblas_int ldd,
+                                                    rocblas_float_complex* const E[],
+                                                    const rocblas_int lde,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geblttrf_periodic_batched_impl<rocblas_float_complex>(
+        handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E, lde, ipiv, strideP, info,
+        batch_count);
+}
+
+rocblas_status rocsolver_zgeblttrf_periodic_batched(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    rocblas_double_complex* const A[],
+                                                    const rocblas_int lda,
+                                                    rocblas_double_complex* const B[],
+                                                    const rocblas_int ldb,
+                                                    rocblas_double_complex* const C[],
+                                                    const rocblas_int ldc,
+                                                    rocblas_double_complex* const D[],
+                                                    const rocblas_int ldd,
+                                                    rocblas_double_complex* const E[],
+                                                    const rocblas_int lde,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geblttrf_periodic_batched_impl<rocblas_double_complex>(
+        handle, nb, nblocks, A, lda, B, ldb, C, ldc, D, ldd, E, lde, ipiv, strideP, info,
+        batch_count);
+}
+
+} // extern C
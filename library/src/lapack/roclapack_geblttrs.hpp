@@ -0,0 +1,278 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEBLTTRS_SWAP applies to the right-hand-side blocks X_k and X_{k+1} the row
+    interchanges of block column k computed by GEBLTTRF.
+    Call this kernel with batch_count groups in y, and enough groups in x to
+    cover nrhs columns. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrs_swap(const rocblas_int nb,
+                                    const rocblas_int nrhs,
+                                    const rocblas_int k,
+                                    const rocblas_int* ipivA,
+                                    const rocblas_stride shiftP,
+                                    const rocblas_stride strideP,
+                                    U XX,
+                                    const rocblas_int shiftX,
+                                    const rocblas_int incx,
+                                    const rocblas_int ldx,
+                                    const rocblas_stride strideX)
+{
+    const auto b = hipBlockIdx_y;
+    const rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(j < nrhs)
+    {
+        const rocblas_int* ipiv = ipivA + b * strideP + shiftP + k * nb;
+        T* X = load_ptr_batch<T>(XX, b, shiftX + k * ldx * nrhs, strideX) + j * ldx;
+
+        // rows nb to 2nb-1 of the pair are in block X_{k+1}
+        const rocblas_stride bsx = rocblas_stride(ldx) * nrhs;
+        rocblas_int p;
+        for(rocblas_int i = 0; i < nb; i++)
+        {
+            p = ipiv[i] - 1 - k * nb;
+            if(p != i)
+                swap(X[i * incx], X[p < nb ? p * incx : bsx + (p - nb) * incx]);
+        }
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_geblttrs_getMemorySize(const rocblas_int nb,
+                                      const rocblas_int nblocks,
+                                      const rocblas_int nrhs,
+                                      const rocblas_int batch_count,
+                                      size_t* size_work1,
+                                      size_t* size_work2,
+                                      size_t* size_work3,
+                                      size_t* size_work4,
+                                      bool* optim_mem,
+                                      const rocblas_int ldb = 1,
+                                      const rocblas_int ldx = 1,
+                                      const rocblas_int incb = 1,
+                                      const rocblas_int incx = 1)
+{
+    // if quick return, no need of workspace
+    if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // size requirements for the triangular solves with the diagonal blocks
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, nb, nrhs,
+                                                       batch_count, size_work1, size_work2,
+                                                       size_work3, size_work4, optim_mem, ldb, ldx,
+                                                       incb, incx);
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrs_argCheck(rocblas_handle handle,
+                                           const rocblas_int nb,
+                                           const rocblas_int nblocks,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int lda,
+                                           const rocblas_int ldb,
+                                           const rocblas_int ldc,
+                                           const rocblas_int ldd,
+                                           const rocblas_int ldx,
+                                           T A,
+                                           T B,
+                                           T C,
+                                           T D,
+                                           const rocblas_int* ipiv,
+                                           T X,
+                                           const rocblas_int batch_count = 1,
+                                           const rocblas_int inca = 1,
+                                           const rocblas_int incb = 1,
+                                           const rocblas_int incc = 1,
+                                           const rocblas_int incd = 1,
+                                           const rocblas_int incx = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(inca < 1 || lda < inca * nb)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * nb)
+        return rocblas_status_invalid_size;
+    if(incc < 1 || ldc < incc * nb)
+        return rocblas_status_invalid_size;
+    if(incd < 1 || ldd < incd * nb)
+        return rocblas_status_invalid_size;
+    if(incx < 1 || ldx < incx * nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((nb && nblocks > 1 && !A) || (nb && nblocks && !B) || (nb && nblocks > 1 && !C)
+       || (nb && nblocks > 2 && !D) || (nb && nblocks && !ipiv) || (nb && nblocks && nrhs && !X))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geblttrs_template(rocblas_handle handle,
+                                           const rocblas_int nb,
+                                           const rocblas_int nblocks,
+                                           const rocblas_int nrhs,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int inca,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           U B,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int incb,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           U C,
+                                           const rocblas_int shiftC,
+                                           const rocblas_int incc,
+                                           const rocblas_int ldc,
+                                           const rocblas_stride strideC,
+                                           U D,
+                                           const rocblas_int shiftD,
+                                           const rocblas_int incd,
+                                           const rocblas_int ldd,
+                                           const rocblas_stride strideD,
+                                           const rocblas_int* ipiv,
+                                           const rocblas_stride shiftP,
+                                           const rocblas_stride strideP,
+                                           U X,
+                                           const rocblas_int shiftX,
+                                           const rocblas_int incx,
+                                           const rocblas_int ldx,
+                                           const rocblas_stride strideX,
+                                           const rocblas_int batch_count,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4,
+                                           bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrs", "nb:", nb, "nblocks:", nblocks, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "inca:", inca, "lda:", lda, "shiftB:", shiftB, "incb:", incb, "ldb:", ldb,
+                    "shiftC:", shiftC, "incc:", incc, "ldc:", ldc, "shiftD:", shiftD, "incd:", incd,
+                    "ldd:", ldd, "shiftP:", shiftP, "shiftX:", shiftX, "incx:", incx, "ldx:", ldx,
+                    "bc:", batch_count);
+
+    // quick return
+    if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (nrhs - 1) / BS1 + 1;
+    dim3 grid(blocks, batch_count, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = T(1);
+    T minone = T(-1);
+
+    // block strides
+    rocblas_int bsa = lda * nb;
+    rocblas_int bsb = ldb * nb;
+    rocblas_int bsc = ldc * nb;
+    rocblas_int bsd = ldd * nb;
+    rocblas_int bsx = ldx * nrhs;
+
+    // forward solve with L, one block column at a time
+    for(rocblas_int k = 0; k < nblocks; k++)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(geblttrs_swap<T>, grid, threads, 0, stream, nb, nrhs, k, ipiv,
+                                shiftP, strideP, X, shiftX, incx, ldx, strideX);
+
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, nb, nrhs, B,
+            shiftB + k * bsb, incb, ldb, strideB, X, shiftX + k * bsx, incx, ldx, strideX,
+            batch_count, optim_mem, work1, work2, work3, work4);
+
+        if(k < nblocks - 1)
+            rocsolver_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nb, &minone, A,
+                shiftA + k * bsa, inca, lda, strideA, X, shiftX + k * bsx, incx, ldx, strideX,
+                &one, X, shiftX + (k + 1) * bsx, incx, ldx, strideX, batch_count, nullptr);
+    }
+
+    // backward solve with U, which has two block superdiagonals
+    for(rocblas_int k = nblocks - 1; k >= 0; k--)
+    {
+        if(k < nblocks - 1)
+            rocsolver_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nb, &minone, C,
+                shiftC + k * bsc, incc, ldc, strideC, X, shiftX + (k + 1) * bsx, incx, ldx,
+                strideX, &one, X, shiftX + k * bsx, incx, ldx, strideX, batch_count, nullptr);
+
+        if(k < nblocks - 2)
+            rocsolver_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nb, &minone, D,
+                shiftD + k * bsd, incd, ldd, strideD, X, shiftX + (k + 2) * bsx, incx, ldx,
+                strideX, &one, X, shiftX + k * bsx, incx, ldx, strideX, batch_count, nullptr);
+
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, nb, nrhs,
+            B, shiftB + k * bsb, incb, ldb, strideB, X, shiftX + k * bsx, incx, ldx, strideX,
+            batch_count, optim_mem, work1, work2, work3, work4);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,259 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_laswp.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geblttrs.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_geblttrs_bordered_getMemorySize(const rocblas_int nb,
+                                               const rocblas_int nblocks,
+                                               const rocblas_int nbr,
+                                               const rocblas_int nrhs,
+                                               const rocblas_int batch_count,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               bool* optim_mem)
+{
+    // if quick return, no need of workspace
+    if(((nb == 0 || nblocks == 0) && nbr == 0) || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4;
+
+    // requirements for solving with T
+    rocsolver_geblttrs_getMemorySize<BATCHED, STRIDED, T>(nb, nblocks, nrhs, batch_count,
+                                                          size_work1, size_work2, size_work3,
+                                                          size_work4, &opt1);
+
+    // requirements for the triangular solves with the Schur complement
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, nbr, nrhs,
+                                                       batch_count, &w1, &w2, &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrs_bordered_argCheck(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int nbr,
+                                                    const rocblas_int nrhs,
+                                                    const rocblas_int lda,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_int lde,
+                                                    const rocblas_int ldf,
+                                                    const rocblas_int ldg,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_int ldy,
+                                                    T A,
+                                                    T B,
+                                                    T C,
+                                                    T D,
+                                                    T E,
+                                                    T F,
+                                                    T G,
+                                                    const rocblas_int* ipiv,
+                                                    T X,
+                                                    T Y,
+                                                    const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || nbr < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(lda < nb || ldb < nb || ldc < nb || ldd < nb || lde < nb || ldx < nb)
+        return rocblas_status_invalid_size;
+    if(ldf < nbr || ldg < nbr || ldy < nbr)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    const bool inner = (nb && nblocks);
+    if((inner && nblocks > 1 && !A) || (inner && !B) || (inner && nblocks > 1 && !C)
+       || (inner && nblocks > 2 && !D) || (inner && nbr && !E) || (inner && nbr && !F)
+       || (nbr && !G) || ((inner || nbr) && !ipiv) || (inner && nrhs && !X)
+       || (nbr && nrhs && !Y))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geblttrs_bordered_template(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int nbr,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int shiftA,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int shiftB,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U C,
+                                                    const rocblas_int shiftC,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_stride strideC,
+                                                    U D,
+                                                    const rocblas_int shiftD,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_stride strideD,
+                                                    U E,
+                                                    const rocblas_int shiftE,
+                                                    const rocblas_int lde,
+                                                    const rocblas_stride strideE,
+                                                    U F,
+                                                    const rocblas_int shiftF,
+                                                    const rocblas_int ldf,
+                                                    const rocblas_stride strideF,
+                                                    U G,
+                                                    const rocblas_int shiftG,
+                                                    const rocblas_int ldg,
+                                                    const rocblas_stride strideG,
+                                                    const rocblas_int* ipiv,
+                                                    const rocblas_stride shiftP,
+                                                    const rocblas_stride strideP,
+                                                    U X,
+                                                    const rocblas_int shiftX,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    U Y,
+                                                    const rocblas_int shiftY,
+                                                    const rocblas_int ldy,
+                                                    const rocblas_stride strideY,
+                                                    const rocblas_int batch_count,
+                                                    void* work1,
+                                                    void* work2,
+                                                    void* work3,
+                                                    void* work4,
+                                                    bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrs_bordered", "nb:", nb, "nblocks:", nblocks, "nbr:", nbr,
+                    "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftC:", shiftC, "ldc:", ldc, "shiftD:", shiftD, "ldd:", ldd,
+                    "shiftE:", shiftE, "lde:", lde, "shiftF:", shiftF, "ldf:", ldf,
+                    "shiftG:", shiftG, "ldg:", ldg, "shiftP:", shiftP, "shiftX:", shiftX,
+                    "ldx:", ldx, "shiftY:", shiftY, "ldy:", ldy, "bc:", batch_count);
+
+    // number of rows of T (see GEBLTTRF_BORDERED)
+    const rocblas_int n1 = nb * nblocks;
+
+    // quick return
+    if((n1 == 0 && nbr == 0) || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // solve with T
+    if(n1 > 0)
+        rocsolver_geblttrs_template<BATCHED, STRIDED, T>(
+            handle, nb, nblocks, nrhs, A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB, C,
+            shiftC, 1, ldc, strideC, D, shiftD, 1, ldd, strideD, ipiv, shiftP, strideP, X, shiftX,
+            1, ldx, strideX, batch_count, work1, work2, work3, work4, optim_mem);
+
+    if(nbr == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = T(1);
+    T minone = T(-1);
+
+    // block strides
+    rocblas_int bse = lde * nbr;
+    rocblas_int bsf = ldf * nb;
+    rocblas_int bsx = ldx * nrhs;
+
+    // update Y with the border row F
+    for(rocblas_int k = 0; k < nblocks && n1 > 0; k++)
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nbr, nrhs, nb, &minone, F,
+            shiftF + k * bsf, 1, ldf, strideF, X, shiftX + k * bsx, 1, ldx, strideX, &one, Y,
+            shiftY, 1, ldy, strideY, batch_count, (T**)nullptr);
+
+    // solve with the Schur complement
+    // (its pivot indices are relative to the first row of the matrix)
+    rocsolver_laswp_template<T>(handle, nrhs, Y, rocblas_stride(shiftY) - n1, 1, ldy, strideY,
+                                n1 + 1, n1 + nbr, ipiv, shiftP, 1, strideP, batch_count);
+
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, nbr, nrhs, G,
+        shiftG, 1, ldg, strideG, Y, shiftY, 1, ldy, strideY, batch_count, optim_mem, work1, work2,
+        work3, work4);
+
+    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, nbr, nrhs, G,
+        shiftG, 1, ldg, strideG, Y, shiftY, 1, ldy, strideY, batch_count, optim_mem, work1, work2,
+        work3, work4);
+
+    // update X with E, which holds T^{-1} times the border column
+    for(rocblas_int k = 0; k < nblocks && n1 > 0; k++)
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nbr, &minone, E,
+            shiftE + k * bse, 1, lde, strideE, Y, shiftY, 1, ldy, strideY, &one, X,
+            shiftX + k * bsx, 1, ldx, strideX, batch_count, (T**)nullptr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,228 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_laswp.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geblttrs.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_geblttrs_periodic_getMemorySize(const rocblas_int nb,
+                                               const rocblas_int nblocks,
+                                               const rocblas_int nrhs,
+                                               const rocblas_int batch_count,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               bool* optim_mem)
+{
+    // if quick return, no need of workspace
+    if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // size requirements for the triangular solves with the diagonal blocks
+    // (the last diagonal block holds the factors of the Schur complement)
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, nb, nrhs,
+                                                       batch_count, size_work1, size_work2,
+                                                       size_work3, size_work4, optim_mem);
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrs_periodic_argCheck(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int nrhs,
+                                                    const rocblas_int lda,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_int lde,
+                                                    const rocblas_int ldx,
+                                                    T A,
+                                                    T B,
+                                                    T C,
+                                                    T D,
+                                                    T E,
+                                                    const rocblas_int* ipiv,
+                                                    T X,
+                                                    const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(lda < nb || ldb < nb || ldc < nb || ldd < nb || lde < nb || ldx < nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((nb && nblocks > 1 && !A) || (nb && nblocks && !B) || (nb && nblocks > 1 && !C)
+       || (nb && nblocks > 3 && !D) || (nb && nblocks > 1 && !E) || (nb && nblocks && !ipiv)
+       || (nb && nblocks && nrhs && !X))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geblttrs_periodic_template(rocblas_handle handle,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int nblocks,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int shiftA,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int shiftB,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U C,
+                                                    const rocblas_int shiftC,
+                                                    const rocblas_int ldc,
+                                                    const rocblas_stride strideC,
+                                                    U D,
+                                                    const rocblas_int shiftD,
+                                                    const rocblas_int ldd,
+                                                    const rocblas_stride strideD,
+                                                    U E,
+                                                    const rocblas_int shiftE,
+                                                    const rocblas_int lde,
+                                                    const rocblas_stride strideE,
+                                                    const rocblas_int* ipiv,
+                                                    const rocblas_stride shiftP,
+                                                    const rocblas_stride strideP,
+                                                    U X,
+                                                    const rocblas_int shiftX,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    const rocblas_int batch_count,
+                                                    void* work1,
+                                                    void* work2,
+                                                    void* work3,
+                                                    void* work4,
+                                                    bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrs_periodic", "nb:", nb, "nblocks:", nblocks, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftC:", shiftC, "ldc:", ldc, "shiftD:", shiftD, "ldd:", ldd,
+                    "shiftE:", shiftE, "lde:", lde, "shiftP:", shiftP, "shiftX:", shiftX,
+                    "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // number of rows of the block tridiagonal part T (see GEBLTTRF_PERIODIC)
+    const rocblas_int n1 = nb * (nblocks - 1);
+
+    // block strides
+    rocblas_int bsb = ldb * nb;
+    rocblas_int bse = lde * nb;
+    rocblas_int bsx = ldx * nrhs;
+
+    // solve with T for the first nblocks-1 blocks of X
+    if(nblocks > 1)
+        rocsolver_geblttrs_template<BATCHED, STRIDED, T>(
+            handle, nb, nblocks - 1, nrhs, A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB,
+            C, shiftC, 1, ldc, strideC, D, shiftD, 1, ldd, strideD, ipiv, shiftP, strideP, X,
+            shiftX, 1, ldx, strideX, batch_count, work1, work2, work3, work4, optim_mem);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = T(1);
+    T minone = T(-1);
+
+    // update the last block of X with the border row, which only has the blocks
+    // C_{n-1} and A_{n-2}
+    if(nblocks > 1)
+    {
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nb, &minone, C,
+            shiftC + (nblocks - 1) * ldc * nb, 1, ldc, strideC, X, shiftX, 1, ldx, strideX, &one, X,
+            shiftX + (nblocks - 1) * bsx, 1, ldx, strideX, batch_count, (T**)nullptr);
+
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nb, &minone, A,
+            shiftA + (nblocks - 2) * lda * nb, 1, lda, strideA, X, shiftX + (nblocks - 2) * bsx, 1,
+            ldx, strideX, &one, X, shiftX + (nblocks - 1) * bsx, 1, ldx, strideX, batch_count,
+            (T**)nullptr);
+    }
+
+    // solve with the Schur complement
+    // (its pivot indices are relative to the first row of the matrix)
+    rocsolver_laswp_template<T>(handle, nrhs, X, shiftX + (nblocks - 1) * bsx - n1, 1, ldx,
+                                strideX, n1 + 1, n1 + nb, ipiv, shiftP, 1, strideP, batch_count);
+
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, nb, nrhs, B,
+        shiftB + (nblocks - 1) * bsb, 1, ldb, strideB, X, shiftX + (nblocks - 1) * bsx, 1, ldx,
+        strideX, batch_count, optim_mem, work1, work2, work3, work4);
+
+    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, nb, nrhs, B,
+        shiftB + (nblocks - 1) * bsb, 1, ldb, strideB, X, shiftX + (nblocks - 1) * bsx, 1, ldx,
+        strideX, batch_count, optim_mem, work1, work2, work3, work4);
+
+    // update the first nblocks-1 blocks of X with E, which holds T^{-1} times the
+    // border column
+    for(rocblas_int k = 0; k < nblocks - 1; k++)
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, nb, nrhs, nb, &minone, E,
+            shiftE + k * bse, 1, lde, strideE, X, shiftX + (nblocks - 1) * bsx, 1, ldx, strideX,
+            &one, X, shiftX + k * bsx, 1, ldx, strideX, batch_count, (T**)nullptr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
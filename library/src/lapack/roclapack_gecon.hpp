@@ -0,0 +1,479 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lange.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+#define LACN2_ITMAX 5 // maximum number of iterations of the 1-norm estimator
+
+/** LACN2_KERNEL executes the step indicated by jump of the Hager/Higham estimator of the
+    1-norm of a matrix B, given only the products of B and B' with the vectors x (as in
+    LAPACK's LACN2). All the instances of the batch follow the same sequence of steps, so
+    that the products can be computed with batched solvers; the instances that have
+    already converged simply ignore the remaining iterations.
+
+    - jump = 0 initializes x.
+    - jump = 1 follows x <- B*x; jump = 2 follows x <- B'*x.
+    - jump = 3 follows x <- B*x; jump = 4 follows x <- B'*x (main iteration).
+    - jump = 5 sets the alternating-sign vector x; jump = 6 follows x <- B*x and computes
+      rcond = 1 / (anorm * est).
+
+    Each instance of the batch is processed by a thread block. The state of the estimator
+    is kept in the arrays est (the current estimate) and state (the index j of the last
+    selected column, the iteration number, and a flag indicating convergence). **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) lacn2_kernel(const rocblas_int jump,
+                                                          const rocblas_int n,
+                                                          T* XX,
+                                                          const rocblas_stride strideX,
+                                                          rocblas_int* isgnA,
+                                                          S* estA,
+                                                          rocblas_int* stateA,
+                                                          const S* anorm,
+                                                          S* rcond)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* x = XX + bid * strideX;
+    rocblas_int* isgn = isgnA + bid * strideX;
+    rocblas_int* state = stateA + 3 * bid;
+
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+    __shared__ bool changed;
+
+    if(jump == 0)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            x[i] = T(S(1) / n);
+        if(tid == 0)
+        {
+            estA[bid] = 0;
+            state[0] = 0;
+            state[1] = 0;
+            state[2] = 0;
+        }
+        return;
+    }
+
+    S est = estA[bid];
+
+    if(jump == 5)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            S altsgn = (i % 2 == 0) ? S(1) : S(-1);
+            x[i] = T(altsgn * (n > 1 ? S(1) + S(i) / S(n - 1) : S(1)));
+        }
+        return;
+    }
+
+    if(jump == 6)
+    {
+        S sum = 0;
+        for(rocblas_int i = tid; i < n; i += BS1)
+            sum += std::abs(x[i]);
+        sum = norm_block_reduce<false>(sum, sval);
+
+        if(tid == 0)
+        {
+            S rc = 1;
+            if(n > 0)
+            {
+                est = std::max(est, 2 * (sum / S(3 * n)));
+
+                // (rcond = 0 if A is numerically singular)
+                S an = anorm[bid];
+                rc = (an != 0 && est != 0 && std::isfinite(est)) ? (S(1) / est) / an : 0;
+            }
+            rcond[bid] = rc;
+        }
+        return;
+    }
+
+    // the instances that already converged wait for the final step
+    if(state[2])
+        return;
+
+    if(jump == 1 || jump == 3)
+    {
+        S sum = 0;
+        for(rocblas_int i = tid; i < n; i += BS1)
+            sum += std::abs(x[i]);
+        sum = norm_block_reduce<false>(sum, sval);
+
+        // in the real case, check for a repeated sign vector (convergence)
+        if(tid == 0)
+            changed = (jump == 1 || rocblas_is_complex<T>);
+        __syncthreads();
+        if(!rocblas_is_complex<T> && jump == 3)
+        {
+            for(rocblas_int i = tid; i < n; i += BS1)
+                if((std::real(x[i]) >= 0 ? 1 : -1) != isgn[i])
+                    changed = true;
+        }
+        __syncthreads();
+
+        bool done = (n == 1 && jump == 1) || !changed || (jump == 3 && sum <= est);
+        if(!done)
+        {
+            // x <- sign(x)
+            for(rocblas_int i = tid; i < n; i += BS1)
+            {
+                if constexpr(rocblas_is_complex<T>)
+                {
+                    S absxi = std::abs(x[i]);
+                    x[i] = (absxi > get_safemin<S>()) ? x[i] / absxi : T(1);
+                }
+                else
+                {
+                    isgn[i] = (x[i] >= 0 ? 1 : -1);
+                    x[i] = T(isgn[i]);
+                }
+            }
+        }
+        else
+        {
+            for(rocblas_int i = tid; i < n; i += BS1)
+                x[i] = 0;
+        }
+
+        if(tid == 0)
+        {
+            estA[bid] = sum;
+            state[2] = done ? 1 : 0;
+        }
+        return;
+    }
+
+    // jump == 2 or jump == 4:
+    // find the (first) index of the largest entry of x
+    S xmax = -1;
+    rocblas_int imax = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S a = std::abs(x[i]);
+        if(a > xmax)
+        {
+            xmax = a;
+            imax = i;
+        }
+    }
+    sval[tid] = xmax;
+    sidx[tid] = imax;
+    __syncthreads();
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            if(sval[tid + i] > sval[tid]
+               || (sval[tid + i] == sval[tid] && sidx[tid + i] < sidx[tid]))
+            {
+                sval[tid] = sval[tid + i];
+                sidx[tid] = sidx[tid + i];
+            }
+        }
+        __syncthreads();
+    }
+    rocblas_int j = sidx[0];
+
+    bool done = false;
+    if(jump == 4)
+    {
+        // stop if the selected column does not change the estimate
+        rocblas_int jlast = state[0];
+        S xlast = rocblas_is_complex<T> ? std::abs(x[jlast]) : std::real(x[jlast]);
+        done = (xlast == sval[0] || state[1] >= LACN2_ITMAX);
+    }
+    __syncthreads();
+
+    // x <- e_j
+    for(rocblas_int i = tid; i < n; i += BS1)
+        x[i] = (!done && i == j) ? T(1) : T(0);
+
+    if(tid == 0)
+    {
+        state[0] = j;
+        state[1] = (jump == 2) ? 2 : state[1] + (done ? 0 : 1);
+        state[2] = done ? 1 : 0;
+    }
+}
+
+/** LACN2_ESTIMATE runs the complete sequence of steps of the 1-norm estimator for all the
+    instances of the batch, and sets rcond = 1 / (anorm * est). Function solve(adjoint)
+    must overwrite the work vectors x with B*x (if adjoint = false) or B'*x (if adjoint =
+    true). As the instances cannot be synchronized with the host, the maximum number of
+    iterations is always executed. **/
+template <typename T, typename S, typename F>
+void lacn2_estimate(rocblas_handle handle,
+                    const rocblas_int n,
+                    T* x,
+                    rocblas_int* isgn,
+                    S* est,
+                    rocblas_int* state,
+                    const S* anorm,
+                    S* rcond,
+                    const rocblas_int batch_count,
+                    F solve)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 grid(1, batch_count, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if n = 0 (rcond = 1)
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<T>), grid, threads, 0, stream, 6, n, x, n, isgn, est,
+                                state, anorm, rcond);
+        return;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<T>), grid, threads, 0, stream, 0, n, x, n, isgn, est,
+                            state, anorm, rcond);
+
+    for(rocblas_int jump = 1; jump <= 2 * LACN2_ITMAX; jump++)
+    {
+        // (the main iteration repeats steps 3 and 4)
+        rocblas_int step = (jump <= 2 ? jump : 4 - jump % 2);
+
+        solve(step % 2 == 0);
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<T>), grid, threads, 0, stream, step, n, x, n, isgn,
+                                est, state, anorm, rcond);
+    }
+
+    // final step with the alternating-sign vector
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<T>), grid, threads, 0, stream, 5, n, x, n, isgn, est,
+                            state, anorm, rcond);
+    solve(false);
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<T>), grid, threads, 0, stream, 6, n, x, n, isgn, est,
+                            state, anorm, rcond);
+}
+
+/** GECON_SOLVE overwrites the work vectors x with inv(A)*x or inv(A')*x, where A is given
+    by its LU factorization. In the batched case, the vectors are addressed through the
+    array of pointers workArr. **/
+template <bool BATCHED, bool STRIDED, typename T>
+void gecon_solve(rocblas_handle handle,
+                 const rocblas_operation trans,
+                 const rocblas_int n,
+                 T* A,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 T* x,
+                 T** workArr,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(
+        handle, trans, n, 1, A, shiftA, 1, lda, strideA, (rocblas_int*)nullptr, 0, x, 0, 1, n, n,
+        batch_count, work1, work2, work3, work4, optim_mem, false);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void gecon_solve(rocblas_handle handle,
+                 const rocblas_operation trans,
+                 const rocblas_int n,
+                 T* const A[],
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 T* x,
+                 T** workArr,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(
+        handle, trans, n, 1, A, shiftA, 1, lda, strideA, (rocblas_int*)nullptr, 0,
+        (T* const*)workArr, 0, 1, n, 0, batch_count, work1, work2, work3, work4, optim_mem, false);
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gecon_argCheck(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm != rocsolver_norm_one && norm != rocsolver_norm_inf)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gecon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_x,
+                                   size_t* size_isgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_workArr,
+                                   bool* optim_mem,
+                                   const rocblas_int lda = 1)
+{
+    // if quick return, no workspace is needed
+    if(batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_x = 0;
+        *size_isgn = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling GETRS with one right-hand side
+    size_t w1a, w2a, w3a, w4a, w1b, w2b, w3b, w4b;
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, n, 1, batch_count,
+                                                       &w1a, &w2a, &w3a, &w4a, optim_mem, lda, n);
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_conjugate_transpose, n, 1,
+                                                       batch_count, &w1b, &w2b, &w3b, &w4b,
+                                                       optim_mem, lda, n);
+    *size_work1 = std::max(w1a, w1b);
+    *size_work2 = std::max(w2a, w2b);
+    *size_work3 = std::max(w3a, w3b);
+    *size_work4 = std::max(w4a, w4b);
+
+    // size of the work vectors and of the state of the estimator
+    *size_x = sizeof(T) * n * batch_count;
+    *size_isgn = sizeof(rocblas_int) * n * batch_count;
+    *size_est = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * 3 * batch_count;
+
+    // size of array of pointers to the work vectors (batched case)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_template(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* x,
+                                        rocblas_int* isgn,
+                                        S* est,
+                                        rocblas_int* state,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("gecon", "norm:", norm, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if(BATCHED && n > 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(BS1), 0, stream, workArr, x,
+                                rocblas_stride(n), batch_count);
+    }
+
+    // ||inv(A)||_1 is estimated with products by inv(A) and inv(A)'; the infinity-norm
+    // ||inv(A)||_inf = ||inv(A)'||_1 reverses the roles of the two
+    rocblas_operation op1
+        = (norm == rocsolver_norm_one ? rocblas_operation_none
+                                      : rocblas_operation_conjugate_transpose);
+    rocblas_operation op2
+        = (norm == rocsolver_norm_one ? rocblas_operation_conjugate_transpose
+                                      : rocblas_operation_none);
+
+    auto solve = [&](const bool adjoint) {
+        gecon_solve<BATCHED, STRIDED, T>(handle, adjoint ? op2 : op1, n, A, shiftA, lda, strideA,
+                                         x, workArr, batch_count, work1, work2, work3, work4,
+                                         optim_mem);
+    };
+
+    lacn2_estimate<T>(handle, n, x, isgn, est, state, anorm, rcond, batch_count, solve);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
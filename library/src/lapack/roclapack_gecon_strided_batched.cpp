@@ -0,0 +1,172 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gecon.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_strided_batched_impl(rocblas_handle handle,
+                                                    const rocsolver_norm_type norm,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const S* anorm,
+                                                    S* rcond,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gecon_strided_batched", "--norm", norm, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gecon_argCheck(handle, norm, n, lda, A, anorm, rcond,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size of reusable workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of the work vectors and of the state of the estimator
+    size_t size_x, size_isgn, size_est, size_state;
+    // size of array of pointers to the work vectors (batched case)
+    size_t size_workArr;
+    rocsolver_gecon_getMemorySize<false, true, T, S>(
+        n, batch_count, &size_work1, &size_work2, &size_work3, &size_work4, &size_x, &size_isgn,
+        &size_est, &size_state, &size_workArr, &optim_mem, lda);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_x, size_isgn, size_est,
+                                                      size_state, size_workArr);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *x, *isgn, *est, *state, *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_x,
+                              size_isgn, size_est, size_state, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    x = mem[4];
+    isgn = mem[5];
+    est = mem[6];
+    state = mem[7];
+    workArr = mem[8];
+
+    // execution
+    auto launch = [&]() {
+        return rocsolver_gecon_template<false, true, T>(
+            handle, norm, n, A, shiftA, lda, strideA, anorm, rcond, batch_count, work1, work2,
+            work3, work4, (T*)x, (rocblas_int*)isgn, (S*)est, (rocblas_int*)state, (T**)workArr,
+            optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "gecon_strided_batched", launch, norm, n, A, lda,
+                                         strideA, anorm, rcond, batch_count, work1, work2, work3,
+                                         work4, x, isgn, est, state, workArr);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgecon_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_int n,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const float* anorm,
+                                                float* rcond,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gecon_strided_batched_impl<float>(handle, norm, n, A, lda, strideA,
+                                                                  anorm, rcond, batch_count);
+}
+
+rocblas_status rocsolver_dgecon_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_int n,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const double* anorm,
+                                                double* rcond,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gecon_strided_batched_impl<double>(handle, norm, n, A, lda, strideA,
+                                                                   anorm, rcond, batch_count);
+}
+
+rocblas_status rocsolver_cgecon_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const float* anorm,
+                                                float* rcond,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gecon_strided_batched_impl<rocblas_float_complex>(
+        handle, norm, n, A, lda, strideA, anorm, rcond, batch_count);
+}
+
+rocblas_status rocsolver_zgecon_strided_batched(rocblas_handle handle,
+                                                const rocsolver_norm_type norm,
+                                                const rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const double* anorm,
+                                                double* rcond,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gecon_strided_batched_impl<rocblas_double_complex>(
+        handle, norm, n, A, lda, strideA, anorm, rcond, batch_count);
+}
+}
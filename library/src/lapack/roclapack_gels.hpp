@@ -37,6 +37,7 @@
 #include "rocblas.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
+#include "roclapack_geqrf_tsqr.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
 
@@ -76,6 +77,7 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
                                   size_t* size_diag_trfac_invA,
                                   size_t* size_trfact_workTrmm_invA_arr,
                                   size_t* size_ipiv_savedB,
+                                  size_t* size_tsqr,
                                   bool* optim_mem)
 {
     // if quick return no workspace needed
@@ -87,6 +89,7 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
         *size_diag_trfac_invA = 0;
         *size_trfact_workTrmm_invA_arr = 0;
         *size_ipiv_savedB = 0;
+        *size_tsqr = 0;
         *optim_mem = true;
         return;
     }
@@ -95,7 +98,17 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
     size_t ormxx_scalars, ormxx_work, ormxx_workArr, ormxx_trfact, ormxx_workTrmm;
     size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
 
-    if(m >= n)
+    *size_tsqr = 0;
+    if(m >= n && rocsolver_geqrf_tsqr_use(m, n))
+    {
+        // requirements for the tiled QR factorization and the application of its Q
+        rocsolver_geqrf_tsqr_getMemorySize<T>(m, n, nrhs, batch_count, &gexxf_scalars, &gexxf_work,
+                                              &gexxf_workArr, &gexxf_diag, &gexxf_trfact,
+                                              size_tsqr);
+
+        ormxx_work = ormxx_workArr = ormxx_trfact = ormxx_workTrmm = 0;
+    }
+    else if(m >= n)
     {
         rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, &gexxf_scalars, &gexxf_work,
                                                   &gexxf_workArr, &gexxf_diag, &gexxf_trfact);
@@ -196,6 +209,7 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                        T* diag_trfac_invA,
                                        T** trfact_workTrmm_invA_arr,
                                        T* ipiv_savedB,
+                                       void* tsqr,
                                        bool optim_mem)
 {
     ROCSOLVER_ENTER("gels", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
@@ -247,18 +261,32 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
 
     if(m >= n)
     {
+        // tall matrices are factorized with the tiled algorithm
+        const bool use_tsqr = rocsolver_geqrf_tsqr_use(m, n);
+
         // compute QR factorization of A
-        rocsolver_geqrf_template<BATCHED, STRIDED>(
-            handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
-            work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+        if(use_tsqr)
+            rocsolver_geqrf_tsqr_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, batch_count, scalars, work_x_temp,
+                workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr, tsqr);
+        else
+            rocsolver_geqrf_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
+                work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
 
         if(trans == rocblas_operation_none)
         {
-            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
-                shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count,
-                scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+            if(use_tsqr)
+                rocsolver_ormqr_tsqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_operation_conjugate_transpose, m, n, nrhs, A, shiftA, lda,
+                    strideA, B, shiftB, ldb, strideB, batch_count, scalars, (void*)work_x_temp,
+                    (T*)workArr_temp_arr, (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr, tsqr);
+            else
+                rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
+                    shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB,
+                    batch_count, scalars, (T*)work_x_temp, (T*)workArr_temp_arr,
+                    (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
 
             // do the equivalent of trtrs
             ROCSOLVER_LAUNCH_KERNEL(check_singularity<T>, dim3(batch_count, 1, 1),
@@ -306,11 +334,17 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                     dim3(zeroblocksx, copyblocksy, batch_count), dim3(32, 32), 0,
                                     stream, n, m, nrhs, B, shiftB, ldb, strideB, info);
 
-            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
-                strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
-                (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+            if(use_tsqr)
+                rocsolver_ormqr_tsqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_operation_none, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB,
+                    ldb, strideB, batch_count, scalars, (void*)work_x_temp, (T*)workArr_temp_arr,
+                    (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr, tsqr);
+            else
+                rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
+                    strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                    (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+                    (T**)trfact_workTrmm_invA_arr);
 
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
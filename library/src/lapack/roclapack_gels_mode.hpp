@@ -0,0 +1,379 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lansy_lanhe.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gels.hpp"
+#include "roclapack_pocon.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GELS_NORMAL_USE returns true if the problem is solved through the normal equations, which are
+    only formed for overdetermined problems. **/
+inline bool rocsolver_gels_normal_use(const rocsolver_lsq_mode mode,
+                                      const rocblas_operation trans,
+                                      const rocblas_int m,
+                                      const rocblas_int n)
+{
+    return mode == rocsolver_lsq_mode_normal && ((trans == rocblas_operation_none) == (m >= n));
+}
+
+/** GELS_NORMAL_CHECK flags in ginfo (ginfo[l] = 1) the instances in the batch for which the
+    Cholesky factorization of the Gram matrix failed, or the estimated reciprocal condition number
+    of the Gram matrix is below the threshold (or is NaN), and counts them in nfail. The other
+    instances get ginfo[l] = 0. **/
+template <typename S>
+ROCSOLVER_KERNEL void gels_normal_check(const rocblas_int batch_count,
+                                        rocblas_int* ginfo,
+                                        const S* rcond,
+                                        const S thresh,
+                                        rocblas_int* nfail)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        const bool fail = (ginfo[b] != 0 || !(rcond[b] >= thresh));
+        ginfo[b] = fail ? 1 : 0;
+        if(fail)
+            atomicAdd(nfail, 1);
+    }
+}
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_gels_mode_argCheck(rocblas_handle handle,
+                                            const rocsolver_lsq_mode mode,
+                                            rocblas_operation trans,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            T A,
+                                            const rocblas_int lda,
+                                            T B,
+                                            const rocblas_int ldb,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(mode != rocsolver_lsq_mode_qr && mode != rocsolver_lsq_mode_normal)
+        return rocblas_status_invalid_value;
+
+    // the remaining checks are those of GELS
+    return rocsolver_gels_argCheck<COMPLEX>(handle, trans, m, n, nrhs, A, lda, B, ldb, info,
+                                            batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gels_mode_getMemorySize(const rocsolver_lsq_mode mode,
+                                       const rocblas_operation trans,
+                                       const rocblas_int m,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int batch_count,
+                                       size_t* size_scalars,
+                                       size_t* size_work_x_temp,
+                                       size_t* size_workArr_temp_arr,
+                                       size_t* size_diag_trfac_invA,
+                                       size_t* size_trfact_workTrmm_invA_arr,
+                                       size_t* size_ipiv_savedB,
+                                       size_t* size_tsqr,
+                                       size_t* size_gram,
+                                       size_t* size_rhs,
+                                       size_t* size_norms,
+                                       size_t* size_x,
+                                       size_t* size_iwork,
+                                       size_t* size_workArr,
+                                       bool* optim_mem)
+{
+    using S = decltype(std::real(T{}));
+
+    // if the normal equations are not used, only the workspace of the QR (or LQ) path is needed
+    if(!rocsolver_gels_normal_use(mode, trans, m, n) || m == 0 || n == 0 || nrhs == 0
+       || batch_count == 0)
+    {
+        rocsolver_gels_getMemorySize<BATCHED, STRIDED, T>(
+            trans, m, n, nrhs, batch_count, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+            size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB, size_tsqr,
+            optim_mem);
+        *size_gram = 0;
+        *size_rhs = 0;
+        *size_norms = 0;
+        *size_x = 0;
+        *size_iwork = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int kk = std::max(m, n);
+    size_t sc, w1, w2, w3, w4, pv, ii, isgn, est, state, wa;
+    bool opt1, opt2, opt3;
+
+    // workspace required for the QR (or LQ) path, which is the fallback of the instances that
+    // cannot be solved through the normal equations
+    rocsolver_gels_getMemorySize<BATCHED, STRIDED, T>(
+        trans, m, n, nrhs, batch_count, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+        size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB, size_tsqr,
+        optim_mem);
+
+    // workspace required for calling POTRF, POTRS and POCON on the (strided) Gram matrices
+    rocsolver_potrf_getMemorySize<false, true, T>(k, rocblas_fill_upper, batch_count, &sc, &w1,
+                                                  &w2, &w3, &w4, &pv, &ii, &opt1);
+    *size_scalars = std::max(*size_scalars, sc);
+    *size_work_x_temp = std::max(*size_work_x_temp, w1);
+    *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, w2);
+    *size_diag_trfac_invA = std::max(*size_diag_trfac_invA, w3);
+    *size_trfact_workTrmm_invA_arr = std::max(*size_trfact_workTrmm_invA_arr, w4);
+    *size_ipiv_savedB = std::max(*size_ipiv_savedB, pv);
+
+    rocsolver_potrs_getMemorySize<false, true, T>(k, nrhs, batch_count, &w1, &w2, &w3, &w4, &opt2);
+    *size_work_x_temp = std::max(*size_work_x_temp, w1);
+    *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, w2);
+    *size_diag_trfac_invA = std::max(*size_diag_trfac_invA, w3);
+    *size_trfact_workTrmm_invA_arr = std::max(*size_trfact_workTrmm_invA_arr, w4);
+
+    rocsolver_pocon_getMemorySize<false, true, T, S>(k, batch_count, &w1, &w2, &w3, &w4, size_x,
+                                                     &isgn, &est, &state, &wa, &opt3);
+    *size_work_x_temp = std::max(*size_work_x_temp, w1);
+    *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, w2);
+    *size_diag_trfac_invA = std::max(*size_diag_trfac_invA, w3);
+    *size_trfact_workTrmm_invA_arr = std::max(*size_trfact_workTrmm_invA_arr, w4);
+
+    *optim_mem = *optim_mem && opt1 && opt2 && opt3;
+
+    // Gram matrices and right-hand sides of the normal equations
+    // (they are reused to save A and B of the well-conditioned instances during the fallback)
+    *size_gram = sizeof(T) * m * n * batch_count;
+    *size_rhs = sizeof(T) * kk * nrhs * batch_count;
+
+    // norms of the Gram matrices, reciprocal condition numbers and state of the estimator
+    *size_norms = sizeof(S) * 2 * batch_count + est;
+
+    // integer workspace of the estimator, info of the factorizations and failure counter
+    *size_iwork = isgn + state + sizeof(rocblas_int) * (2 * batch_count + 1);
+
+    // size of arrays of pointers to the Gram matrices and right-hand sides (batched case)
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_mode_template(rocblas_handle handle,
+                                            const rocsolver_lsq_mode mode,
+                                            rocblas_operation trans,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U A,
+                                            const rocblas_int shiftA,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            U B,
+                                            const rocblas_int shiftB,
+                                            const rocblas_int ldb,
+                                            const rocblas_stride strideB,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count,
+                                            T* scalars,
+                                            T* work_x_temp,
+                                            T* workArr_temp_arr,
+                                            T* diag_trfac_invA,
+                                            T** trfact_workTrmm_invA_arr,
+                                            T* ipiv_savedB,
+                                            void* tsqr,
+                                            T* gram,
+                                            T* rhs,
+                                            void* norms,
+                                            T* x,
+                                            rocblas_int* iwork,
+                                            T** workArr,
+                                            bool optim_mem)
+{
+    ROCSOLVER_ENTER("gels_mode", "mode:", mode, "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // use the QR (or LQ) factorization unless the normal equations were requested for a
+    // non-empty overdetermined problem
+    if(!rocsolver_gels_normal_use(mode, trans, m, n) || m == 0 || n == 0 || nrhs == 0
+       || batch_count == 0)
+        return rocsolver_gels_template<BATCHED, STRIDED, T>(
+            handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, info,
+            batch_count, scalars, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+            trfact_workTrmm_invA_arr, ipiv_savedB, tsqr, optim_mem);
+
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (the normal equations are only solved when A has full rank)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    S sone = 1;
+    S szero = 0;
+    T one = 1;
+    T zero = 0;
+
+    // constants in host memory
+    const rocblas_operation transH = rocblas_is_complex<T> ? rocblas_operation_conjugate_transpose
+                                                           : rocblas_operation_transpose;
+    const rocblas_operation transG = (trans == rocblas_operation_none) ? transH
+                                                                       : rocblas_operation_none;
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int kk = std::max(m, n);
+    const rocblas_stride strideG = rocblas_stride(k) * k;
+    const rocblas_stride strideC = rocblas_stride(k) * nrhs;
+    const rocblas_int copyblocksx = (k - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+    const S thresh = std::sqrt(get_epsilon<S>());
+    S* anorm = (S*)norms;
+    S* rcond = anorm + batch_count;
+    S* est = rcond + batch_count;
+    rocblas_int* isgn = iwork;
+    rocblas_int* state = isgn + k * batch_count;
+    rocblas_int* ginfo = state + 3 * batch_count;
+    rocblas_int* iinfo = ginfo + batch_count;
+    rocblas_int* nfail = iinfo + batch_count;
+    rocblas_int h_nfail;
+    T** workArrC = BATCHED ? workArr + batch_count : nullptr;
+
+    // form the Gram matrices G = A'A (or AA' if transposed); only the upper triangular part
+    // is computed
+    if constexpr(BATCHED)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, workArr, gram, strideG,
+                                batch_count);
+        rocblasCall_syrk_herk<true, T>(handle, rocblas_fill_upper, transG, k, kk, &sone, A, shiftA,
+                                       lda, strideA, &szero, (U)workArr, 0, k, strideG,
+                                       batch_count);
+    }
+    else
+        rocblasCall_syrk_herk<false, T>(handle, rocblas_fill_upper, transG, k, kk, &sone, A, shiftA,
+                                        lda, strideA, &szero, gram, 0, k, strideG, batch_count);
+
+    // form the right-hand sides C = A'B (or AB if transposed)
+    rocblasCall_gemm(handle, transG, rocblas_operation_none, k, nrhs, kk, &one, A, shiftA, lda,
+                     strideA, B, shiftB, ldb, strideB, &zero, rhs, 0, k, strideC, batch_count,
+                     workArrC);
+
+    // compute the Cholesky factorizations of G and estimate their reciprocal condition numbers
+    rocsolver_lansy_template<T>(handle, rocsolver_norm_one, rocblas_fill_upper, k, gram, 0, k,
+                                strideG, anorm, batch_count);
+    rocsolver_potrf_template<false, true, T, S>(
+        handle, rocblas_fill_upper, k, gram, 0, k, strideG, ginfo, batch_count, scalars,
+        work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr, ipiv_savedB,
+        iinfo, optim_mem);
+    rocsolver_pocon_template<false, true, T>(handle, rocblas_fill_upper, k, gram, 0, k, strideG,
+                                             (const S*)anorm, rcond, batch_count, work_x_temp,
+                                             workArr_temp_arr, diag_trfac_invA,
+                                             trfact_workTrmm_invA_arr, x, isgn, est, state,
+                                             (T**)nullptr, optim_mem);
+
+    // as the condition number of G is the square of that of A, the normal equations are only
+    // accurate if rcond(G) >= sqrt(eps)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1), threads, 0, stream, nfail, 1, 0);
+    ROCSOLVER_LAUNCH_KERNEL(gels_normal_check<S>, gridReset, threads, 0, stream, batch_count, ginfo,
+                            rcond, thresh, nfail);
+
+    // solve G X = C and copy the solutions to B for the well-conditioned instances
+    rocsolver_potrs_template<false, true, T>(handle, rocblas_fill_upper, k, nrhs, gram, 0, k,
+                                             strideG, rhs, 0, k, strideC, batch_count, work_x_temp,
+                                             workArr_temp_arr, diag_trfac_invA,
+                                             trfact_workTrmm_invA_arr, optim_mem);
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count), dim3(32, 32),
+                            0, stream, copymat_from_buffer, k, nrhs, B, shiftB, ldb, strideB, rhs,
+                            info_mask(ginfo, info_mask::negate));
+
+    // if no instance failed, there is nothing else to do
+    // (the failure counter is not read back while the stream is being captured)
+    hipStreamCaptureStatus capture_status;
+    HIP_CHECK(hipStreamIsCapturing(stream, &capture_status));
+    if(capture_status == hipStreamCaptureStatusNone)
+    {
+        HIP_CHECK(
+            hipMemcpyAsync(&h_nfail, nfail, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        if(h_nfail == 0)
+        {
+            rocblas_set_pointer_mode(handle, old_mode);
+            return rocblas_status_success;
+        }
+    }
+
+    // the instances that are ill-conditioned or rank deficient are solved with the QR (or LQ)
+    // factorization; A and B of the other instances are saved in the (no longer needed) Gram
+    // matrices and right-hand sides, and restored afterwards
+    const rocblas_int blocksm = (m - 1) / 32 + 1;
+    const rocblas_int blocksn = (n - 1) / 32 + 1;
+    const rocblas_int blockskk = (kk - 1) / 32 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksm, blocksn, batch_count), dim3(32, 32), 0,
+                            stream, copymat_to_buffer, m, n, A, shiftA, lda, strideA, gram,
+                            info_mask(ginfo, info_mask::negate));
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blockskk, copyblocksy, batch_count), dim3(32, 32), 0,
+                            stream, copymat_to_buffer, kk, nrhs, B, shiftB, ldb, strideB, rhs,
+                            info_mask(ginfo, info_mask::negate));
+
+    rocsolver_gels_template<BATCHED, STRIDED, T>(
+        handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, iinfo,
+        batch_count, scalars, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+        trfact_workTrmm_invA_arr, ipiv_savedB, tsqr, optim_mem);
+
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksm, blocksn, batch_count), dim3(32, 32), 0,
+                            stream, copymat_from_buffer, m, n, A, shiftA, lda, strideA, gram,
+                            info_mask(ginfo, info_mask::negate));
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blockskk, copyblocksy, batch_count), dim3(32, 32), 0,
+                            stream, copymat_from_buffer, kk, nrhs, B, shiftB, ldb, strideB, rhs,
+                            info_mask(ginfo, info_mask::negate));
+
+    // info of the QR (or LQ) factorization of the instances that failed
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<rocblas_int>, dim3(1, 1, batch_count), dim3(32, 32), 0, stream,
+                            copymat_from_buffer, 1, 1, info, 0, 1, 1, iinfo, info_mask(ginfo));
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
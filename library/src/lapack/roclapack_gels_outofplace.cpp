@@ -83,21 +83,24 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
         size_trfact_workTrmm_invA_arr, size_ipiv;
     // extra requirements to copy B
     size_t size_savedB;
+    // size of the tiled QR factorization of tall matrices
+    size_t size_tsqr;
     rocsolver_gels_outofplace_getMemorySize<false, false, T>(
         trans, m, n, nrhs, batch_count, &size_scalars, &size_work_x_temp, &size_workArr_temp_arr,
-        &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv, &size_savedB, &optim_mem);
+        &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv, &size_savedB,
+        &size_tsqr, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
-            size_trfact_workTrmm_invA_arr, size_ipiv, size_savedB);
+            size_trfact_workTrmm_invA_arr, size_ipiv, size_savedB, size_tsqr);
 
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
-        *ipiv, *savedB;
+        *ipiv, *savedB, *tsqr;
     rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
                               size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv,
-                              size_savedB);
+                              size_savedB, size_tsqr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -109,6 +112,7 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
     trfact_workTrmm_invA_arr = mem[4];
     ipiv = mem[5];
     savedB = mem[6];
+    tsqr = mem[7];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
@@ -116,7 +120,8 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
     return rocsolver_gels_outofplace_template<false, false, T>(
         handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, X, shiftX, ldx,
         strideX, info, batch_count, (T*)scalars, (T*)work_x_temp, (T*)workArr_temp_arr,
-        (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr, (T*)ipiv, (T*)savedB, optim_mem);
+        (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr, (T*)ipiv, (T*)savedB, tsqr,
+        optim_mem);
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -55,6 +55,7 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
                                              size_t* size_trfact_workTrmm_invA_arr,
                                              size_t* size_ipiv,
                                              size_t* size_savedB,
+                                             size_t* size_tsqr,
                                              bool* optim_mem)
 {
     // if quick return no workspace needed
@@ -67,6 +68,7 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
         *size_trfact_workTrmm_invA_arr = 0;
         *size_ipiv = 0;
         *size_savedB = 0;
+        *size_tsqr = 0;
         *optim_mem = true;
         return;
     }
@@ -75,7 +77,7 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
 
     rocsolver_gels_getMemorySize<BATCHED, STRIDED, T>(
         trans, m, n, nrhs, batch_count, size_scalars, size_work_x_temp, size_workArr_temp_arr,
-        size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, &unused, optim_mem);
+        size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, &unused, size_tsqr, optim_mem);
 
     *size_ipiv = sizeof(T) * std::min(m, n) * batch_count;
 
@@ -158,6 +160,7 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                                   T** trfact_workTrmm_invA_arr,
                                                   T* ipiv,
                                                   T* savedB,
+                                                  void* tsqr,
                                                   bool optim_mem)
 {
     ROCSOLVER_ENTER("gels_outofplace", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs,
@@ -213,10 +216,18 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
 
     if(m >= n)
     {
+        // tall matrices are factorized with the tiled algorithm
+        const bool use_tsqr = rocsolver_geqrf_tsqr_use(m, n);
+
         // compute QR factorization of A
-        rocsolver_geqrf_template<BATCHED, STRIDED>(
-            handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work_x_temp,
-            workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+        if(use_tsqr)
+            rocsolver_geqrf_tsqr_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, batch_count, scalars, work_x_temp,
+                workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr, tsqr);
+        else
+            rocsolver_geqrf_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
+                work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
 
         if(trans == rocblas_operation_none)
         {
@@ -225,10 +236,17 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                     dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
                                     ldb, strideB, savedB);
 
-            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
-                shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
-                work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+            if(use_tsqr)
+                rocsolver_ormqr_tsqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_operation_conjugate_transpose, m, n, nrhs, A, shiftA, lda,
+                    strideA, B, shiftB, ldb, strideB, batch_count, scalars, (void*)work_x_temp,
+                    workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr, tsqr);
+            else
+                rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
+                    shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count,
+                    scalars, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+                    trfact_workTrmm_invA_arr);
 
             ROCSOLVER_LAUNCH_KERNEL(check_singularity<T>, dim3(batch_count, 1, 1),
                                     dim3(1, check_threads, 1), 0, stream, n, A, shiftA, lda,
@@ -274,10 +292,16 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                     dim3(zeroblocksx, copyblocksy, batch_count), dim3(32, 32), 0,
                                     stream, n, m, nrhs, X, shiftX, ldx, strideX, info);
 
-            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
-                strideA, ipiv, strideP, X, shiftX, ldx, strideX, batch_count, scalars, work_x_temp,
-                workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+            if(use_tsqr)
+                rocsolver_ormqr_tsqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_operation_none, m, n, nrhs, A, shiftA, lda, strideA, X, shiftX,
+                    ldx, strideX, batch_count, scalars, (void*)work_x_temp, workArr_temp_arr,
+                    diag_trfac_invA, trfact_workTrmm_invA_arr, tsqr);
+            else
+                rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
+                    strideA, ipiv, strideP, X, shiftX, ldx, strideX, batch_count, scalars,
+                    work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
         }
     }
     else
@@ -70,20 +70,24 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
         size_trfact_workTrmm_invA_arr;
     // extra requirements for calling ORMQR/ORMLQ and to copy B
     size_t size_ipiv_savedB;
+    // size of the tiled QR factorization of tall matrices
+    size_t size_tsqr;
     rocsolver_gels_getMemorySize<false, true, T>(
         trans, m, n, nrhs, batch_count, &size_scalars, &size_work_x_temp, &size_workArr_temp_arr,
-        &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv_savedB, &optim_mem);
+        &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv_savedB, &size_tsqr,
+        &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
-            size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
+            size_trfact_workTrmm_invA_arr, size_ipiv_savedB, size_tsqr);
 
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
-        *ipiv_savedB;
+        *ipiv_savedB, *tsqr;
     rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
-                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
+                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB,
+                              size_tsqr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -94,6 +98,7 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
     diag_trfac_invA = mem[3];
     trfact_workTrmm_invA_arr = mem[4];
     ipiv_savedB = mem[5];
+    tsqr = mem[6];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
@@ -101,7 +106,7 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
     return rocsolver_gels_template<false, true, T>(
         handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, info,
         batch_count, (T*)scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-        (T**)trfact_workTrmm_invA_arr, (T*)ipiv_savedB, optim_mem);
+        (T**)trfact_workTrmm_invA_arr, (T*)ipiv_savedB, tsqr, optim_mem);
 }
 
 ROCSOLVER_END_NAMESPACE
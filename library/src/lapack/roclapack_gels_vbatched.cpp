@@ -0,0 +1,141 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+
+#include "roclapack_gels_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_gels_vbatched_impl(rocblas_handle handle,
+                                            rocblas_operation trans,
+                                            const rocblas_int* m,
+                                            const rocblas_int* n,
+                                            const rocblas_int* nrhs,
+                                            T* const A[],
+                                            const rocblas_int* lda,
+                                            T* const B[],
+                                            const rocblas_int* ldb,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gels_vbatched", "--trans", trans, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gels_vbatched_argCheck<COMPLEX>(handle, trans, m, n, nrhs, A,
+                                                                  lda, B, ldb, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_gels_vbatched_template<T>(handle, trans, m, n, nrhs, A, lda, B, ldb, info,
+                                               batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgels_vbatched(rocblas_handle handle,
+                                        rocblas_operation trans,
+                                        const rocblas_int* m,
+                                        const rocblas_int* n,
+                                        const rocblas_int* nrhs,
+                                        float* const A[],
+                                        const rocblas_int* lda,
+                                        float* const B[],
+                                        const rocblas_int* ldb,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gels_vbatched_impl<float>(handle, trans, m, n, nrhs, A, lda, B, ldb,
+                                                          info, batch_count);
+}
+
+rocblas_status rocsolver_dgels_vbatched(rocblas_handle handle,
+                                        rocblas_operation trans,
+                                        const rocblas_int* m,
+                                        const rocblas_int* n,
+                                        const rocblas_int* nrhs,
+                                        double* const A[],
+                                        const rocblas_int* lda,
+                                        double* const B[],
+                                        const rocblas_int* ldb,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gels_vbatched_impl<double>(handle, trans, m, n, nrhs, A, lda, B,
+                                                           ldb, info, batch_count);
+}
+
+rocblas_status rocsolver_cgels_vbatched(rocblas_handle handle,
+                                        rocblas_operation trans,
+                                        const rocblas_int* m,
+                                        const rocblas_int* n,
+                                        const rocblas_int* nrhs,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int* lda,
+                                        rocblas_float_complex* const B[],
+                                        const rocblas_int* ldb,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gels_vbatched_impl<rocblas_float_complex>(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
+
+rocblas_status rocsolver_zgels_vbatched(rocblas_handle handle,
+                                        rocblas_operation trans,
+                                        const rocblas_int* m,
+                                        const rocblas_int* n,
+                                        const rocblas_int* nrhs,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int* lda,
+                                        rocblas_double_complex* const B[],
+                                        const rocblas_int* ldb,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gels_vbatched_impl<rocblas_double_complex>(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
+
+} // extern C
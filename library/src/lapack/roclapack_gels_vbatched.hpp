@@ -0,0 +1,408 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_geqrf_vbatched.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GELS_VBATCHED_LARFG is GEQRF_VBATCHED_LARFG, except that the identity is never returned:
+    if tau = 0, the reflector H = I - 2 * e1 * e1' is used instead. This way, tau can be
+    recovered from v (and, in the complex case, from the ratio of its imaginary and real parts),
+    as required by GELS_VBATCHED_TAU. **/
+template <typename T, typename S>
+__device__ T gels_vbatched_larfg(const rocblas_int tid,
+                                 const rocblas_int nt,
+                                 const rocblas_int n,
+                                 T* x,
+                                 const rocblas_int incx,
+                                 T* sp,
+                                 S* sval)
+{
+    T tau = geqrf_vbatched_larfg(tid, nt, n, x, incx, sp, sval);
+    if(tau == T(0))
+    {
+        if(tid == 0)
+            x[0] = -x[0];
+        tau = 2;
+        __syncthreads();
+    }
+    return tau;
+}
+
+/** GELS_VBATCHED_TAU recovers the Householder scalar tau of the reflector whose vector v
+    (without its leading 1) is the vector of length n with elements v[i * incv]. In the complex
+    case, the imaginary part of d holds the ratio r of the imaginary and real parts of tau
+    (r = 0 in the real case). As the reflector is unitary,
+    tau = 2 * (1 + i * r) / ((1 + r^2) * (1 + v' * v)). **/
+template <typename T, typename S>
+__device__ T gels_vbatched_tau(const rocblas_int tid,
+                               const rocblas_int nt,
+                               const rocblas_int n,
+                               const T* v,
+                               const rocblas_int incv,
+                               const T d,
+                               S* sval)
+{
+    S ss = 0;
+    for(rocblas_int i = tid; i < n; i += nt)
+        ss += std::real(conj(v[i * incv]) * v[i * incv]);
+    ss = vbatched_sum(tid, nt, ss, sval);
+
+    if constexpr(rocblas_is_complex<T>)
+    {
+        const S r = d.imag();
+        const S a = 2 / ((1 + r * r) * (1 + ss));
+        return T(a, a * r);
+    }
+    else
+        return T(2 / (1 + ss));
+}
+
+/** GELS_VBATCHED_CONJ conjugates the m-by-n matrix A (with leading dimension lda) **/
+template <typename T>
+__device__ void gels_vbatched_conj(const rocblas_int tid,
+                                   const rocblas_int nt,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   T* A,
+                                   const rocblas_int lda)
+{
+    if constexpr(rocblas_is_complex<T>)
+    {
+        __syncthreads();
+        for(rocblas_int e = tid; e < m * n; e += nt)
+            A[(e % m) + (e / m) * lda] = conj(A[(e % m) + (e / m) * lda]);
+        __syncthreads();
+    }
+}
+
+/** GELS_VBATCHED_GELS solves the least-squares problem (if under is false) or the
+    minimum-norm problem (if under is true) with the m-by-n matrix C, m >= n, with elements
+    C[i * incc + j * ldc], using all the threads of the work-group:
+
+    - if under is false, min || C * X - B ||, where B is m-by-nrhs,
+    - if under is true, min || X || such that C' * X = B, where B is n-by-nrhs on entry,
+
+    with B (leading dimension ldb) overwritten by X. C is overwritten by its QR factorization.
+    Returns the position of the first zero diagonal element of R (or 0). In that case, B is
+    overwritten by Q' * B if under is false, and left unchanged otherwise.
+
+    When under is true, the Householder scalars are needed again after the factorization and
+    there is no workspace to keep them: the reflectors are generated with GELS_VBATCHED_LARFG
+    and, as the diagonal of R is real, the imaginary parts of the diagonal elements hold the
+    ratios of the imaginary and real parts of tau while B is computed. **/
+template <typename T, typename S>
+__device__ rocblas_int gels_vbatched_gels(const rocblas_int tid,
+                                          const rocblas_int nt,
+                                          const bool under,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          T* C,
+                                          const rocblas_int incc,
+                                          const rocblas_int ldc,
+                                          T* B,
+                                          const rocblas_int ldb,
+                                          T* sw,
+                                          T* sp,
+                                          S* sval,
+                                          rocblas_int* sidx)
+{
+    // QR factorization of C (and B = Q' * B if under is false)
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        T* v = C + j * incc + j * ldc;
+        const T t = under ? gels_vbatched_larfg(tid, nt, m - j, v, incc, sp, sval)
+                          : geqrf_vbatched_larfg(tid, nt, m - j, v, incc, sp, sval);
+
+        vbatched_larf_left(tid, nt, m - j, n - j - 1, v, incc, conj(t), v + ldc, incc, ldc, sw);
+        if(!under)
+            vbatched_larf_left(tid, nt, m - j, nrhs, v, incc, conj(t), B + j, 1, ldb, sw);
+
+        if constexpr(rocblas_is_complex<T>)
+        {
+            if(under && tid == 0)
+                v[0] = T(v[0].real(), t.imag() / t.real());
+        }
+    }
+    __syncthreads();
+
+    // position of the first zero diagonal element of R
+    rocblas_int z = n;
+    for(rocblas_int j = tid; j < n; j += nt)
+    {
+        if(std::real(C[j * incc + j * ldc]) == 0)
+        {
+            z = j;
+            break;
+        }
+    }
+    z = -vbatched_max(tid, nt, -z, sidx);
+
+    if(z == n)
+    {
+        if(!under)
+        {
+            // solve R * X = Q' * B
+            vbatched_trsm(tid, nt, rocblas_fill_upper, rocblas_operation_none,
+                          rocblas_diagonal_non_unit, n, nrhs, C, incc, ldc, B, ldb);
+        }
+        else
+        {
+            // solve R' * Y = B, and set X = Q * [Y; 0]
+            vbatched_trsm(tid, nt, rocblas_fill_upper, rocblas_operation_conjugate_transpose,
+                          rocblas_diagonal_non_unit, n, nrhs, C, incc, ldc, B, ldb, true);
+            for(rocblas_int e = tid; e < (m - n) * nrhs; e += nt)
+                B[n + e % (m - n) + (e / (m - n)) * ldb] = 0;
+            __syncthreads();
+
+            for(rocblas_int j = n - 1; j >= 0; --j)
+            {
+                T* v = C + j * incc + j * ldc;
+                const T t = gels_vbatched_tau(tid, nt, m - j - 1, v + incc, incc, v[0], sval);
+                vbatched_larf_left(tid, nt, m - j, nrhs, v, incc, t, B + j, 1, ldb, sw);
+            }
+        }
+    }
+
+    // restore the real diagonal of R
+    if constexpr(rocblas_is_complex<T>)
+    {
+        if(under)
+        {
+            for(rocblas_int j = tid; j < n; j += nt)
+                C[j * incc + j * ldc] = T(std::real(C[j * incc + j * ldc]));
+        }
+    }
+    __syncthreads();
+
+    return (z == n) ? 0 : z + 1;
+}
+
+/** GELS_VBATCHED_KERNEL solves the batch instances in the size class with bounds lo and hi,
+    with one work-group per instance. If m < n, the problem is solved with the conjugate
+    transpose of A, which is then kept in LDS or, if A is too large, accessed in place with
+    conjugated elements. The instances with invalid dimensions are reported in info by the
+    first size class. **/
+template <typename T>
+ROCSOLVER_KERNEL void gels_vbatched_kernel(const rocblas_int lo,
+                                           const rocblas_int hi,
+                                           const bool lds,
+                                           const rocblas_operation trans,
+                                           const rocblas_int* mm,
+                                           const rocblas_int* nn,
+                                           const rocblas_int* nnrhs,
+                                           T* const A[],
+                                           const rocblas_int* ldaa,
+                                           T* const B[],
+                                           const rocblas_int* ldbb,
+                                           rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nt = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int nrhs = nnrhs[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int ldb = ldbb[b];
+
+    // position of the first invalid argument (as in LAPACK)
+    const rocblas_int arg = (m < 0) ? 2
+        : (n < 0)                   ? 3
+        : (nrhs < 0)                ? 4
+        : (lda < m)                 ? 6
+        : (ldb < m || ldb < n)      ? 8
+                                    : 0;
+    if(arg)
+    {
+        if(lo == 0 && tid == 0)
+            info[b] = -arg;
+        return;
+    }
+
+    // C is A if m >= n, and A' otherwise
+    const rocblas_int cm = std::max(m, n);
+    const rocblas_int cn = std::min(m, n);
+    if(!vbatched_in_class(cm, lo, hi))
+        return;
+
+    T* Ap = A[b];
+    T* Bp = B[b];
+
+    // quick return if A is empty
+    if(cn == 0 || nrhs == 0)
+    {
+        for(rocblas_int e = tid; e < cm * nrhs; e += nt)
+            Bp[(e % cm) + (e / cm) * ldb] = 0;
+        if(tid == 0)
+            info[b] = 0;
+        return;
+    }
+
+    extern __shared__ double lmem[];
+    T *sA, *sw, *sp;
+    S* sval;
+    rocblas_int* sidx;
+    vbatched_lmem(lmem, lds ? cm * cn : 0, &sA, &sw, &sp, &sval, &sidx);
+
+    const bool tall = (m >= n);
+    T* C;
+    rocblas_int incc, ldc;
+    if(lds)
+    {
+        if(tall)
+            vbatched_load(tid, nt, m, n, Ap, lda, sA);
+        else
+        {
+            for(rocblas_int e = tid; e < m * n; e += nt)
+                sA[(e / m) + (e % m) * cm] = conj(Ap[(e % m) + (e / m) * lda]);
+            __syncthreads();
+        }
+        C = sA;
+        incc = 1;
+        ldc = cm;
+    }
+    else
+    {
+        if(!tall)
+            gels_vbatched_conj(tid, nt, m, n, Ap, lda);
+        C = Ap;
+        incc = tall ? 1 : lda;
+        ldc = tall ? lda : 1;
+    }
+
+    // the problem is underdetermined if op(A) has fewer rows than columns
+    const bool under = (tall == (trans != rocblas_operation_none));
+    const rocblas_int inf = gels_vbatched_gels(tid, nt, under, cm, cn, nrhs, C, incc, ldc, Bp,
+                                               ldb, sw, sp, sval, sidx);
+
+    if(lds)
+    {
+        if(tall)
+            vbatched_store(tid, nt, m, n, sA, Ap, lda);
+        else
+        {
+            for(rocblas_int e = tid; e < m * n; e += nt)
+                Ap[(e % m) + (e / m) * lda] = conj(sA[(e / m) + (e % m) * cm]);
+        }
+    }
+    else if(!tall)
+        gels_vbatched_conj(tid, nt, m, n, Ap, lda);
+
+    if(tid == 0)
+        info[b] = inf;
+}
+
+/** Argument checking. The dimensions of the batch instances are only read on the device;
+    instances with invalid dimensions are reported in info **/
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_gels_vbatched_argCheck(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int* m,
+                                                const rocblas_int* n,
+                                                const rocblas_int* nrhs,
+                                                T A,
+                                                const rocblas_int* lda,
+                                                T B,
+                                                const rocblas_int* ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !nrhs || !A || !lda || !B || !ldb || !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_gels_vbatched_template(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int* m,
+                                                const rocblas_int* n,
+                                                const rocblas_int* nrhs,
+                                                T* const A[],
+                                                const rocblas_int* lda,
+                                                T* const B[],
+                                                const rocblas_int* ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gels_vbatched", "trans:", trans, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // solve the instances of each size class
+    // (the matrices of the small classes are kept in LDS)
+    for(rocblas_int c = 0; c <= VBATCHED_NUM_INTERVALS; ++c)
+    {
+        rocblas_int lo, hi, threads;
+        bool lds;
+        rocsolver_vbatched_class<T>(c, &lo, &hi, &threads, &lds);
+        size_t lmemsize = rocsolver_vbatched_lmem_size<T>(threads, lds ? hi * hi : 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(gels_vbatched_kernel<T>, dim3(batch_count), dim3(threads),
+                                lmemsize, stream, lo, hi, lds, trans, m, n, nrhs, A, lda, B, ldb,
+                                info);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,393 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gelqf.hpp"
+#include "roclapack_geqp3.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GELSY_RANK determines the effective rank of each matrix in the batch as the order of the
+    leading submatrix of R whose diagonal elements satisfy |R(i,i)| > rcond * |R(0,0)|.
+    Each thread processes one instance of the batch. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gelsy_rank(const rocblas_int mn,
+                                 U AA,
+                                 const rocblas_stride shiftA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride strideA,
+                                 const S rcond,
+                                 rocblas_int* rank,
+                                 const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(bid < batch_count)
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+        const S tol = rcond * std::abs(A[0]);
+        rocblas_int r = 0;
+        while(r < mn && std::abs(A[r + r * static_cast<int64_t>(lda)]) > tol)
+            r++;
+
+        rank[bid] = r;
+    }
+}
+
+/** GELSY_PREPARE_R keeps only the first rank rows of the upper trapezoidal factor R
+    in the first mn rows of A, zeroing the Householder vectors below the diagonal and the rows
+    beyond the effective rank. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_prepare_r(const rocblas_int mn,
+                                      const rocblas_int n,
+                                      U AA,
+                                      const rocblas_stride shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      const rocblas_int* rank)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < mn && j < n && (j < i || i >= rank[b]))
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        A[i + j * static_cast<int64_t>(lda)] = 0;
+    }
+}
+
+/** GELSY_SET_DIAG sets the diagonal elements of A beyond the effective rank to the given
+    value. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_set_diag(const rocblas_int mn,
+                                     U AA,
+                                     const rocblas_stride shiftA,
+                                     const rocblas_int lda,
+                                     const rocblas_stride strideA,
+                                     const rocblas_int* rank,
+                                     const T val)
+{
+    const auto b = hipBlockIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < mn && i >= rank[b])
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        A[i + i * static_cast<int64_t>(lda)] = val;
+    }
+}
+
+/** GELSY_SET_ZERO sets to zero the rows of B from the effective rank to n-1. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_set_zero(const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     U BB,
+                                     const rocblas_stride shiftB,
+                                     const rocblas_int ldb,
+                                     const rocblas_stride strideB,
+                                     const rocblas_int* rank)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs && i >= rank[b])
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        B[i + j * static_cast<int64_t>(ldb)] = 0;
+    }
+}
+
+/** GELSY_PERMUTE undoes the column permutation of A in the solution, copying row i of the
+    buffer (an n-by-nrhs matrix per instance) to row jpvt[i]-1 of B. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_permute(const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    U BB,
+                                    const rocblas_stride shiftB,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride strideB,
+                                    const rocblas_int* jpvtA,
+                                    const rocblas_stride strideJ,
+                                    T* buffer)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        const rocblas_int* jpvt = jpvtA + b * strideJ;
+        T* X = buffer + b * rocblas_stride(n) * nrhs;
+
+        B[(jpvt[i] - 1) + j * static_cast<int64_t>(ldb)] = X[i + j * static_cast<int64_t>(n)];
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gelsy_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_x_temp,
+                                   size_t* size_workArr_temp_arr,
+                                   size_t* size_diag_trfac_invA,
+                                   size_t* size_trfact_workTrmm_invA_arr,
+                                   size_t* size_ipiv,
+                                   size_t* size_savedB,
+                                   bool* optim_mem)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_diag_trfac_invA = 0;
+        *size_trfact_workTrmm_invA_arr = 0;
+        *size_ipiv = 0;
+        *size_savedB = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int mn = std::min(m, n);
+    size_t geqp3_workArr, geqp3_norms, geqp3_F;
+    size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
+    size_t gelqf_scalars, gelqf_work, gelqf_workArr, gelqf_diag, gelqf_trfact;
+    size_t ormlq_scalars, ormlq_work, ormlq_workArr, ormlq_trfact, ormlq_workTrmm;
+    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
+
+    // requirements for the QR factorization with column pivoting
+    rocsolver_geqp3_getMemorySize<BATCHED, T, S>(m, n, batch_count, &geqp3_workArr, &geqp3_norms,
+                                                 &geqp3_F);
+
+    // requirements for applying Q'
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, nrhs, mn, batch_count,
+                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                    &ormqr_trfact, &ormqr_workTrmm);
+
+    // requirements for the complete orthogonal factorization and for applying Z'
+    rocsolver_gelqf_getMemorySize<BATCHED, T>(mn, n, batch_count, &gelqf_scalars, &gelqf_work,
+                                              &gelqf_workArr, &gelqf_diag, &gelqf_trfact);
+    rocsolver_ormlq_unmlq_getMemorySize<BATCHED, T>(rocblas_side_left, n, nrhs, mn, batch_count,
+                                                    &ormlq_scalars, &ormlq_work, &ormlq_workArr,
+                                                    &ormlq_trfact, &ormlq_workTrmm);
+
+    // requirements for the triangular solve
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, mn, nrhs,
+                                            batch_count, &trsm_x_temp, &trsm_x_temp_arr,
+                                            &trsm_invA, &trsm_invA_arr, optim_mem);
+
+    // the stages are executed one after the other, so they share the workspace
+    *size_scalars = std::max({ormqr_scalars, gelqf_scalars, ormlq_scalars});
+    *size_work_x_temp = std::max({ormqr_work, gelqf_work, ormlq_work, trsm_x_temp});
+    *size_workArr_temp_arr
+        = std::max({geqp3_workArr, ormqr_workArr, gelqf_workArr, ormlq_workArr, trsm_x_temp_arr});
+    *size_diag_trfac_invA
+        = std::max({geqp3_norms, ormqr_trfact, gelqf_diag, ormlq_trfact, trsm_invA});
+    *size_trfact_workTrmm_invA_arr
+        = std::max({geqp3_F, ormqr_workTrmm, gelqf_trfact, ormlq_workTrmm, trsm_invA_arr});
+
+    // size of the Householder scalars
+    *size_ipiv = sizeof(T) * mn * batch_count;
+
+    // size of the buffer used to permute the solution
+    *size_savedB = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_gelsy_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        rocblas_int* jpvt,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (((m && nrhs) || (n && nrhs)) && !B) || (m && n && !jpvt)
+       || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_stride shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        T* work_x_temp,
+                                        T* workArr_temp_arr,
+                                        T* diag_trfac_invA,
+                                        T** trfact_workTrmm_invA_arr,
+                                        T* ipiv,
+                                        T* savedB,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gelsy", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // rank = 0 (for the quick return cases)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+    // quick return if B is empty
+    if(nrhs == 0)
+        return rocblas_status_success;
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+    {
+        rocblas_int rowsB = std::max(m, n);
+        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_stride strideP = mn;
+    const rocblas_int blocksmn = (mn - 1) / 32 + 1;
+    const rocblas_int blocksn = (n - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+
+    // compute the QR factorization with column pivoting A * P = Q * R
+    rocsolver_geqp3_template<BATCHED, STRIDED>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count,
+        (T**)workArr_temp_arr, (S*)diag_trfac_invA, (T*)trfact_workTrmm_invA_arr);
+
+    // determine the effective rank r
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_rank<T>), gridReset, threads, 0, stream, mn, A, shiftA, lda,
+                            strideA, rcond, rank, batch_count);
+
+    // compute Q' * B
+    rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, mn, A, shiftA,
+        lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars, work_x_temp,
+        workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+    // only the first r rows of R and Q' * B are kept
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_prepare_r<T>), dim3(blocksmn, blocksn, batch_count),
+                            dim3(32, 32), 0, stream, mn, n, A, shiftA, lda, strideA, rank);
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_set_zero<T>), dim3(blocksn, blocksy, batch_count), dim3(32, 32),
+                            0, stream, n, nrhs, B, shiftB, ldb, strideB, rank);
+
+    // compute the complete orthogonal factorization [R11 R12] = [L11 0] * Z
+    // (the rows of R beyond the effective rank are zero, and so are the corresponding rows of L)
+    rocsolver_gelqf_template<BATCHED, STRIDED>(handle, mn, n, A, shiftA, lda, strideA, ipiv,
+                                               strideP, batch_count, scalars, work_x_temp,
+                                               workArr_temp_arr, diag_trfac_invA,
+                                               trfact_workTrmm_invA_arr);
+
+    // solve L11 * Y1 = (Q' * B)1, using a unit diagonal beyond the effective rank
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_set_diag<T>), dim3((mn - 1) / BS1 + 1, batch_count, 1),
+                            dim3(BS1, 1, 1), 0, stream, mn, A, shiftA, lda, strideA, rank, T(1));
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, mn, nrhs, A,
+        shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work_x_temp,
+        workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_set_diag<T>), dim3((mn - 1) / BS1 + 1, batch_count, 1),
+                            dim3(BS1, 1, 1), 0, stream, mn, A, shiftA, lda, strideA, rank, T(0));
+
+    // compute the minimum norm solution Z' * Y, with Y2 = 0
+    rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, nrhs, mn, A, shiftA,
+        lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars, work_x_temp,
+        workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+    // undo the column permutation: X = P * Z' * Y
+    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(blocksn, blocksy, batch_count), dim3(32, 32), 0,
+                            stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb, strideB, savedB);
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_permute<T>), dim3(blocksn, blocksy, batch_count), dim3(32, 32),
+                            0, stream, n, nrhs, B, shiftB, ldb, strideB, jpvt, strideJ, savedB);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,569 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lange.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqr2.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQP3_BLOCK_SUM reduces the values held by the BS1 threads of a block to their sum.
+    The result is returned to all the threads. Array sval must be a shared-memory array of
+    dimension BS1. **/
+template <typename T>
+__device__ T geqp3_block_sum(T val, T* sval)
+{
+    rocblas_int tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] = sval[tid] + sval[tid + i];
+        __syncthreads();
+    }
+
+    T res = sval[0];
+    __syncthreads();
+    return res;
+}
+
+/** GEQP3_PENDING returns element i of column c of A after applying the updates of the first
+    kk + 1 columns of the current panel, which are deferred in matrix F. (The row index i must be
+    larger than the row of the last reflector of the panel). **/
+template <typename T>
+__device__ T geqp3_pending(const rocblas_int i,
+                           const rocblas_int c,
+                           const rocblas_int offset,
+                           const rocblas_int kk,
+                           T* A,
+                           const rocblas_int lda,
+                           T* F,
+                           const rocblas_int ldf)
+{
+    T a = A[i + c * static_cast<int64_t>(lda)];
+    for(rocblas_int l = 0; l <= kk; ++l)
+        a -= A[i + (offset + l) * static_cast<int64_t>(lda)]
+            * conj(F[(c - offset) + l * static_cast<int64_t>(ldf)]);
+    return a;
+}
+
+/** GEQP3_INIT_KERNEL computes the initial norms of the columns of A and sets the
+    identity permutation in jpvt. Each column of each instance in the batch is processed by a
+    thread block. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_init_kernel(const rocblas_int m,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_stride shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               rocblas_int* jpvtA,
+                                                               const rocblas_stride strideJ,
+                                                               S* normsA)
+{
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA) + j * static_cast<int64_t>(lda);
+    rocblas_int* jpvt = jpvtA + bid * strideJ;
+    S* vn1 = normsA + bid * 2 * static_cast<int64_t>(n);
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BS1];
+
+    // scaled sum of squares to avoid unnecessary overflow
+    S amax = 0;
+    for(rocblas_int i = tid; i < m; i += BS1)
+        amax = std::max(amax, aabs<S>(A[i]));
+    amax = norm_block_reduce<true>(amax, sval);
+
+    S nrm = 0;
+    if(amax > 0)
+    {
+        for(rocblas_int i = tid; i < m; i += BS1)
+        {
+            T a = A[i] / T(amax);
+            nrm += std::real(a * conj(a));
+        }
+        nrm = amax * std::sqrt(norm_block_reduce<false>(nrm, sval));
+    }
+
+    if(tid == 0)
+    {
+        jpvt[j] = j + 1;
+        vn1[j] = nrm;
+        vn2[j] = nrm;
+    }
+}
+
+/** GEQP3_PIVOT_KERNEL selects the column with the largest partial norm among columns k to n-1,
+    and interchanges it with column k. The corresponding rows of F, the pivot indices and the
+    partial norms are interchanged accordingly. The deferred updates of the current panel are
+    then applied to column k:
+    A(k:m-1,k) = A(k:m-1,k) - A(k:m-1,offset:k-1) * F(k-offset,0:k-offset-1)',
+    and the Householder reflector that annihilates A(k+1:m-1,k) is generated (as in LARFG), with
+    tau stored in ipiv. Each instance of the batch is processed by a thread block. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_pivot_kernel(const rocblas_int k,
+                                                                const rocblas_int offset,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_stride shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int* jpvtA,
+                                                                const rocblas_stride strideJ,
+                                                                S* normsA,
+                                                                T* FF,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF,
+                                                                T* ipivA,
+                                                                const rocblas_stride strideP)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* F = FF + bid * strideF;
+    T* tau = ipivA + bid * strideP;
+    rocblas_int* jpvt = jpvtA + bid * strideJ;
+    S* vn1 = normsA + bid * 2 * static_cast<int64_t>(n);
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+
+    // find the first column with the largest partial norm
+    S vmax = -1;
+    rocblas_int imax = k;
+    for(rocblas_int j = k + tid; j < n; j += BS1)
+    {
+        if(vn1[j] > vmax)
+        {
+            vmax = vn1[j];
+            imax = j;
+        }
+    }
+    sval[tid] = vmax;
+    sidx[tid] = imax;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            // ties are resolved in favour of the smallest column index
+            S v = sval[tid + i];
+            rocblas_int idx = sidx[tid + i];
+            if(v > sval[tid] || (v == sval[tid] && idx < sidx[tid]))
+            {
+                sval[tid] = v;
+                sidx[tid] = idx;
+            }
+        }
+        __syncthreads();
+    }
+
+    // interchange columns p and k
+    rocblas_int p = sidx[0];
+    if(p != k)
+    {
+        for(rocblas_int i = tid; i < m; i += BS1)
+            swap(A[i + p * static_cast<int64_t>(lda)], A[i + k * static_cast<int64_t>(lda)]);
+        for(rocblas_int l = tid; l < k - offset; l += BS1)
+            swap(F[(p - offset) + l * static_cast<int64_t>(ldf)],
+                 F[(k - offset) + l * static_cast<int64_t>(ldf)]);
+
+        if(tid == 0)
+        {
+            swap(jpvt[p], jpvt[k]);
+            vn1[p] = vn1[k];
+            vn2[p] = vn2[k];
+        }
+        __syncthreads();
+    }
+
+    // apply the deferred updates of the panel to column k
+    T* a = A + k * static_cast<int64_t>(lda);
+    rocblas_int kk = k - offset;
+    if(kk > 0)
+    {
+        for(rocblas_int i = k + tid; i < m; i += BS1)
+        {
+            T sum = 0;
+            for(rocblas_int l = 0; l < kk; ++l)
+                sum += A[i + (offset + l) * static_cast<int64_t>(lda)]
+                    * conj(F[kk + l * static_cast<int64_t>(ldf)]);
+            a[i] -= sum;
+        }
+        __syncthreads();
+    }
+
+    // generate the Householder reflector to work on column k
+    // (scaled sum of squares to avoid unnecessary overflow)
+    __shared__ T sscale;
+    S xmax = 0;
+    for(rocblas_int i = k + 1 + tid; i < m; i += BS1)
+        xmax = std::max(xmax, aabs<S>(a[i]));
+    xmax = norm_block_reduce<true>(xmax, sval);
+
+    S xnrm = 0;
+    if(xmax > 0)
+    {
+        for(rocblas_int i = k + 1 + tid; i < m; i += BS1)
+        {
+            T x = a[i] / T(xmax);
+            xnrm += std::real(x * conj(x));
+        }
+        xnrm = xmax * std::sqrt(norm_block_reduce<false>(xnrm, sval));
+    }
+
+    if(tid == 0)
+    {
+        T beta = a[k];
+        geqr2_small_reflector(beta, xnrm, sscale, tau[k]);
+        a[k] = beta;
+    }
+    __syncthreads();
+
+    for(rocblas_int i = k + 1 + tid; i < m; i += BS1)
+        a[i] *= sscale;
+}
+
+/** GEQP3_COMPUTE_F computes y = A(k:m-1,offset:n-1)' * v, where v is the Householder vector
+    stored in column k (with v[0] = 1). The entries of y corresponding to the columns before k
+    are stored in auxv, and those corresponding to the columns after k are stored in
+    F(:,k-offset). Each column of each instance in the batch is processed by a thread block. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_compute_f(const rocblas_int k,
+                                                             const rocblas_int offset,
+                                                             const rocblas_int m,
+                                                             U AA,
+                                                             const rocblas_stride shiftA,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             T* FF,
+                                                             const rocblas_int ldf,
+                                                             const rocblas_stride strideF,
+                                                             T* auxvA,
+                                                             const rocblas_int nb)
+{
+    rocblas_int c = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int kk = k - offset;
+
+    if(c == kk)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* F = FF + bid * strideF;
+    T* auxv = auxvA + bid * nb;
+    T* a = A + (offset + c) * static_cast<int64_t>(lda);
+    T* v = A + k * static_cast<int64_t>(lda);
+
+    __shared__ T sval[BS1];
+
+    T sum = 0;
+    for(rocblas_int i = k + tid; i < m; i += BS1)
+        sum += conj(a[i]) * (i == k ? T(1) : v[i]);
+    sum = geqp3_block_sum(sum, sval);
+
+    if(tid == 0)
+    {
+        if(c < kk)
+            auxv[c] = sum;
+        else
+            F[c + kk * static_cast<int64_t>(ldf)] = sum;
+    }
+}
+
+/** GEQP3_UPDATE_ROW_NORMS processes the trailing column c > k: it completes row c-offset of
+    column kk = k-offset of F as F(c-offset,kk) = tau * (y - F(c-offset,0:kk-1) * auxv), where y
+    is the result of GEQP3_COMPUTE_F, applies the updates of the current panel to row k:
+    A(k,c) = A(k,c) - A(k,offset:k) * F(c-offset,0:kk)', where A(k,k) is taken as 1, and, if
+    k < dim-1, downdates the partial norm of column c. When cancellation makes the downdated
+    value unreliable, the norm is recomputed from the trailing part of the column, including the
+    updates of the current panel that are still deferred. Each column of each instance in the
+    batch is processed by a thread block. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_update_row_norms(const rocblas_int k,
+                                                                    const rocblas_int offset,
+                                                                    const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    const rocblas_int dim,
+                                                                    U AA,
+                                                                    const rocblas_stride shiftA,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    T* ipivA,
+                                                                    const rocblas_stride strideP,
+                                                                    S* normsA,
+                                                                    T* FF,
+                                                                    const rocblas_int ldf,
+                                                                    const rocblas_stride strideF,
+                                                                    T* auxvA,
+                                                                    const rocblas_int nb,
+                                                                    const S tol3z)
+{
+    rocblas_int c = k + 1 + hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* F = FF + bid * strideF;
+    T* auxv = auxvA + bid * nb;
+    S* vn1 = normsA + bid * 2 * static_cast<int64_t>(n);
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BS1];
+    __shared__ T tval[BS1];
+
+    rocblas_int kk = k - offset;
+    rocblas_int r = c - offset;
+    T tau = ipivA[bid * strideP + k];
+    T y = F[r + kk * static_cast<int64_t>(ldf)];
+
+    // complete row r of column kk of F
+    T sum = 0;
+    for(rocblas_int l = tid; l < kk; l += BS1)
+        sum += F[r + l * static_cast<int64_t>(ldf)] * auxv[l];
+    T f = tau * (y - geqp3_block_sum(sum, tval));
+
+    // update element (k,c)
+    sum = 0;
+    for(rocblas_int l = tid; l < kk; l += BS1)
+        sum += A[k + (offset + l) * static_cast<int64_t>(lda)]
+            * conj(F[r + l * static_cast<int64_t>(ldf)]);
+    T a = A[k + c * static_cast<int64_t>(lda)] - geqp3_block_sum(sum, tval) - conj(f);
+
+    if(tid == 0)
+    {
+        F[r + kk * static_cast<int64_t>(ldf)] = f;
+        A[k + c * static_cast<int64_t>(lda)] = a;
+    }
+    __syncthreads();
+
+    // downdate the partial norm
+    S n1 = vn1[c];
+    S n2 = vn2[c];
+    S akc = std::abs(a);
+
+    if(k >= dim - 1 || n1 == 0)
+        return;
+
+    S temp = akc / n1;
+    temp = std::max(S(0), (1 + temp) * (1 - temp));
+    S temp2 = temp * (n1 / n2) * (n1 / n2);
+    if(temp2 > tol3z)
+    {
+        if(tid == 0)
+            vn1[c] = n1 * std::sqrt(temp);
+        return;
+    }
+
+    // recompute the norm of the updated column
+    S amax = 0;
+    for(rocblas_int i = k + 1 + tid; i < m; i += BS1)
+        amax = std::max(amax, aabs<S>(geqp3_pending(i, c, offset, kk, A, lda, F, ldf)));
+    amax = norm_block_reduce<true>(amax, sval);
+
+    S nrm = 0;
+    if(amax > 0)
+    {
+        for(rocblas_int i = k + 1 + tid; i < m; i += BS1)
+        {
+            T x = geqp3_pending(i, c, offset, kk, A, lda, F, ldf) / T(amax);
+            nrm += std::real(x * conj(x));
+        }
+        nrm = amax * std::sqrt(norm_block_reduce<false>(nrm, sval));
+    }
+
+    if(tid == 0)
+    {
+        vn1[c] = nrm;
+        vn2[c] = nrm;
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_geqp3_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_workArr,
+                                   size_t* size_norms,
+                                   size_t* size_F)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_workArr = 0;
+        *size_norms = 0;
+        *size_F = 0;
+        return;
+    }
+
+    // size of array of pointers for the trailing update (batched cases)
+    *size_workArr = BATCHED ? sizeof(T*) * batch_count : 0;
+
+    // size of the partial column norms and their reference values
+    *size_norms = sizeof(S) * 2 * n * batch_count;
+
+    // size of the matrix F with the deferred updates, followed by the auxiliary vector
+    const rocblas_int nb = std::min(GEQP3_BLOCKSIZE, std::min(m, n));
+    *size_F = sizeof(T) * (n + 1) * nb * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* jpvt,
+                                        U ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (m && n && !jpvt) || (m && n && !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count,
+                                        T** workArr,
+                                        S* norms,
+                                        T* F)
+{
+    ROCSOLVER_ENTER("geqp3", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    T minone = -1;
+    T one = 1;
+    const rocblas_int dim = std::min(m, n); // total number of pivots
+    const rocblas_int nb = std::min(GEQP3_BLOCKSIZE, dim);
+    const rocblas_int ldf = n;
+    const rocblas_stride strideF = rocblas_stride(ldf) * nb;
+    T* auxv = F + strideF * batch_count;
+    const S tol3z = std::sqrt(S(get_epsilon<S>()));
+
+    // initial column norms and identity permutation
+    ROCSOLVER_LAUNCH_KERNEL((geqp3_init_kernel<T>), dim3(n, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, m, n, A, shiftA, lda, strideA, jpvt, strideJ, norms);
+
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        // factorize the panel of columns j to j + jb - 1, deferring the updates of the
+        // columns to the right in matrix F
+        const rocblas_int jb = std::min(nb, dim - j);
+        for(rocblas_int k = j; k < j + jb; ++k)
+        {
+            // move the column with the largest partial norm to position k, apply the deferred
+            // updates of the panel to it, and generate the Householder reflector
+            ROCSOLVER_LAUNCH_KERNEL((geqp3_pivot_kernel<T>), dim3(1, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, k, j, m, n, A, shiftA, lda,
+                                    strideA, jpvt, strideJ, norms, F, ldf, strideF, ipiv, strideP);
+
+            // compute column k - j of F
+            ROCSOLVER_LAUNCH_KERNEL((geqp3_compute_f<T>), dim3(n - j, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, k, j, m, A, shiftA, lda, strideA,
+                                    F, ldf, strideF, auxv, nb);
+
+            // complete column k - j of F, update row k of the trailing columns and downdate
+            // their partial norms
+            if(k < n - 1)
+                ROCSOLVER_LAUNCH_KERNEL((geqp3_update_row_norms<T>),
+                                        dim3(n - k - 1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                                        k, j, m, n, dim, A, shiftA, lda, strideA, ipiv, strideP,
+                                        norms, F, ldf, strideF, auxv, nb, tol3z);
+        }
+
+        // apply the deferred updates to the trailing matrix:
+        // A(j+jb:m-1,j+jb:n-1) = A(j+jb:m-1,j+jb:n-1) - A(j+jb:m-1,j:j+jb-1) * F(jb:n-j-1,0:jb-1)'
+        if(j + jb < m && j + jb < n)
+            rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                             m - j - jb, n - j - jb, jb, &minone, A, shiftA + idx2D(j + jb, j, lda),
+                             lda, strideA, F, jb, ldf, strideF, &one, A,
+                             shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count,
+                             workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,166 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geqp3.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    rocblas_int* jpvt,
+                                                    const rocblas_stride strideJ,
+                                                    T* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqp3_strided_batched", "-m", m, "-n", n, "--lda", lda,
+                        "--strideA", strideA, "--strideJ", strideJ, "--strideP", strideP,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqp3_argCheck(handle, m, n, lda, A, jpvt, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    using S = decltype(std::real(T{}));
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+
+    // memory workspace sizes:
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    // size to store the partial column norms
+    size_t size_norms;
+    // size to store the deferred updates of the trailing matrix
+    size_t size_F;
+    rocsolver_geqp3_getMemorySize<false, T, S>(m, n, batch_count, &size_workArr, &size_norms,
+                                               &size_F);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_workArr, size_norms, size_F);
+
+    // memory workspace allocation
+    void *workArr, *norms, *F;
+    rocblas_device_malloc mem(handle, size_workArr, size_norms, size_F);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    workArr = mem[0];
+    norms = mem[1];
+    F = mem[2];
+
+    // execution
+    return rocsolver_geqp3_template<false, true, T>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count,
+        (T**)workArr, (S*)norms, (T*)F);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqp3_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                float* ipiv,
+                                                const rocblas_stride strideP,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqp3_strided_batched_impl<float>(
+        handle, m, n, A, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count);
+}
+
+rocblas_status rocsolver_dgeqp3_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                double* ipiv,
+                                                const rocblas_stride strideP,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqp3_strided_batched_impl<double>(
+        handle, m, n, A, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count);
+}
+
+rocblas_status rocsolver_cgeqp3_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                rocblas_float_complex* ipiv,
+                                                const rocblas_stride strideP,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqp3_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count);
+}
+
+rocblas_status rocsolver_zgeqp3_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                rocblas_double_complex* ipiv,
+                                                const rocblas_stride strideP,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqp3_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count);
+}
+
+} // extern C
@@ -35,11 +35,277 @@
 #include "auxiliary/rocauxiliary_lacgv.hpp"
 #include "auxiliary/rocauxiliary_larf.hpp"
 #include "auxiliary/rocauxiliary_larfg.hpp"
+#include "auxiliary/rocauxiliary_org2r_ung2r.hpp"
+#include "ideal_sizes.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** GEQR2_SMALL_REFLECTOR generates the Householder reflector that annihilates x, given
+    alpha and the norm of x (as in LARFG). Beta is computed as in LAPY2/LAPY3 to avoid
+    unnecessary overflow and underflow. On exit, alpha is overwritten by beta and scale is
+    the factor by which x must be multiplied to obtain v. **/
+template <typename T, typename S, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ void geqr2_small_reflector(T& alpha, const S xnorm, T& scale, T& tau)
+{
+    if(xnorm > 0)
+    {
+        S mx = std::max(std::abs(alpha), xnorm);
+        S mn = std::min(std::abs(alpha), xnorm);
+        S n = mx * sqrt(1 + (mn / mx) * (mn / mx));
+        n = alpha >= 0 ? -n : n;
+
+        scale = 1.0 / (alpha - n);
+        tau = (n - alpha) / n;
+        alpha = n;
+    }
+    else
+    {
+        scale = 1;
+        tau = 0;
+    }
+}
+
+template <typename T, typename S, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ void geqr2_small_reflector(T& alpha, const S xnorm, T& scale, T& tau)
+{
+    S ar = alpha.real();
+    S ai = alpha.imag();
+
+    if(xnorm > 0 || ai != 0)
+    {
+        S mx = std::max({std::abs(ar), std::abs(ai), xnorm});
+        S xr = ar / mx;
+        S xi = ai / mx;
+        S xn = xnorm / mx;
+        S n = mx * sqrt(xr * xr + xi * xi + xn * xn);
+        n = ar >= 0 ? -n : n;
+
+        // scale = 1 / (alpha - n), where |ar - n| >= |ai|
+        S d = ar - n;
+        S q = ai / d;
+        S r = d * (1 + q * q);
+        scale = rocblas_complex_num<S>(1 / r, -q / r);
+        tau = rocblas_complex_num<S>((n - ar) / n, -ai / n);
+        alpha = n;
+    }
+    else
+    {
+        scale = 1;
+        tau = 0;
+    }
+}
+
+/** GEQR2_SMALL_FACTOR computes, in shared memory, the QR factorization of the m-by-n matrix
+    in sA (with leading dimension m). The norm of each column is accumulated with the
+    entries scaled by their largest magnitude (as in NRM2). sw must have room for n elements,
+    sp for 3 and sr for GEQR2_SMALL_THREADS. The scalars tau are stored in the given array. **/
+template <typename T, typename I>
+__device__ void geqr2_small_factor(const I m,
+                                   const I n,
+                                   T* sA,
+                                   T* sw,
+                                   T* sp,
+                                   T* sr,
+                                   T* tau,
+                                   const I tid)
+{
+    using S = decltype(std::real(T{}));
+    S* ss = reinterpret_cast<S*>(sr);
+    const I dim = std::min(m, n);
+
+    for(I j = 0; j < dim; ++j)
+    {
+        // v is the j-th column of A from the diagonal down
+        T* v = sA + j + j * m;
+        const I mj = m - j;
+        const I nj = n - j - 1;
+
+        // largest magnitude in x = A(j+1:m-1,j)
+        S s = 0;
+        for(I i = tid + 1; i < mj; i += GEQR2_SMALL_THREADS)
+            s = std::max(s, aabs<S>(v[i]));
+        ss[tid] = s;
+        __syncthreads();
+        for(I r = GEQR2_SMALL_THREADS / 2; r > 0; r /= 2)
+        {
+            if(tid < r)
+                ss[tid] = std::max(ss[tid], ss[tid + r]);
+            __syncthreads();
+        }
+        const S xmax = ss[0];
+        __syncthreads();
+
+        // sum of squares of x / xmax
+        s = 0;
+        if(xmax > 0)
+        {
+            for(I i = tid + 1; i < mj; i += GEQR2_SMALL_THREADS)
+            {
+                T y = v[i] / T(xmax);
+                s += std::real(conj(y) * y);
+            }
+        }
+        ss[tid] = s;
+        __syncthreads();
+        for(I r = GEQR2_SMALL_THREADS / 2; r > 0; r /= 2)
+        {
+            if(tid < r)
+                ss[tid] += ss[tid + r];
+            __syncthreads();
+        }
+
+        // generate Householder reflector to work on column j
+        if(tid == 0)
+        {
+            T beta = v[0];
+            geqr2_small_reflector(beta, xmax * sqrt(ss[0]), sp[0], sp[1]);
+            tau[j] = sp[1];
+            sp[2] = beta;
+            v[0] = 1;
+        }
+        __syncthreads();
+        for(I i = tid + 1; i < mj; i += GEQR2_SMALL_THREADS)
+            v[i] *= sp[0];
+        __syncthreads();
+
+        // apply H(j)' = I - conj(tau) * v * v' to A(j:m-1,j+1:n-1)
+        for(I c = tid; c < nj; c += GEQR2_SMALL_THREADS)
+        {
+            T* a = v + (c + 1) * m;
+            T t = 0;
+            for(I i = 0; i < mj; ++i)
+                t += conj(v[i]) * a[i];
+            sw[c] = conj(sp[1]) * t;
+        }
+        __syncthreads();
+        for(I e = tid; e < mj * nj; e += GEQR2_SMALL_THREADS)
+        {
+            I i = e % mj;
+            I c = e / mj;
+            v[i + (c + 1) * m] -= v[i] * sw[c];
+        }
+        __syncthreads();
+
+        // restore A(j,j) = beta
+        if(tid == 0)
+            v[0] = sp[2];
+    }
+    __syncthreads();
+}
+
+/** GEQR2_SMALL_KERNEL computes the QR factorization of small matrices with one work-group
+    per matrix in the batch. The matrix is loaded into shared memory, where all the Householder
+    reflectors are generated and applied, and it is written back only once at the end.
+
+    Call this kernel with GEQR2_SMALL_THREADS threads and shared memory for
+    m * n + n + 3 + GEQR2_SMALL_THREADS elements of type T. **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GEQR2_SMALL_THREADS)
+    geqr2_small_kernel(const I m,
+                       const I n,
+                       U A,
+                       const rocblas_stride shiftA,
+                       const I lda,
+                       const rocblas_stride strideA,
+                       T* ipiv,
+                       const rocblas_stride strideP)
+{
+    const auto b = hipBlockIdx_x;
+    const I tid = hipThreadIdx_x;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* tau = ipiv + b * strideP;
+
+    // shared memory for the matrix (with leading dimension m), the products of the
+    // reflector with the trailing columns, the reflector scalars, and the partial sums
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    T* sw = sA + m * n;
+    T* sp = sw + n;
+    T* sr = sp + 3;
+
+    for(I e = tid; e < m * n; e += GEQR2_SMALL_THREADS)
+        sA[e] = Ap[(e % m) + (e / m) * lda];
+    __syncthreads();
+
+    geqr2_small_factor(m, n, sA, sw, sp, sr, tau, tid);
+
+    for(I e = tid; e < m * n; e += GEQR2_SMALL_THREADS)
+        Ap[(e % m) + (e / m) * lda] = sA[e];
+}
+
+/** GEQR2_ORG2R_SMALL_KERNEL computes the QR factorization of small m-by-n matrices (m >= n)
+    and generates the first nq columns of Q (n <= nq <= m) with one work-group per matrix in
+    the batch. The upper triangular factor R is written to the n-by-n matrix R, the scalars
+    tau to ipiv, and Q overwrites A. The matrix is read and written only once.
+
+    Call this kernel with GEQR2_SMALL_THREADS threads and shared memory for
+    m * nq + nq + n + 3 + GEQR2_SMALL_THREADS elements of type T. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GEQR2_SMALL_THREADS)
+    geqr2_org2r_small_kernel(const rocblas_int m,
+                             const rocblas_int n,
+                             const rocblas_int nq,
+                             U A,
+                             const rocblas_int shiftA,
+                             const rocblas_int lda,
+                             const rocblas_stride strideA,
+                             T* RR,
+                             const rocblas_int ldr,
+                             const rocblas_stride strideR,
+                             T* ipiv,
+                             const rocblas_stride strideP)
+{
+    const auto b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* R = RR + b * strideR;
+    T* tau = ipiv + b * strideP;
+
+    // shared memory for the matrix (with leading dimension m and room for the nq columns
+    // of Q), the products of the reflector with the trailing columns, the scalars tau, the
+    // reflector scalars, and the partial sums
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    T* sw = sA + m * nq;
+    T* st = sw + nq;
+    T* sp = st + n;
+    T* sr = sp + 3;
+
+    for(rocblas_int e = tid; e < m * n; e += GEQR2_SMALL_THREADS)
+        sA[e] = Ap[(e % m) + (e / m) * lda];
+    __syncthreads();
+
+    geqr2_small_factor(m, n, sA, sw, sp, sr, st, tid);
+
+    // write R and tau, and initialize the columns of Q that are not reflectors
+    for(rocblas_int e = tid; e < n * n; e += GEQR2_SMALL_THREADS)
+    {
+        rocblas_int i = e % n;
+        rocblas_int j = e / n;
+        R[i + j * ldr] = (i <= j) ? sA[i + j * m] : T(0);
+    }
+    for(rocblas_int j = tid; j < n; j += GEQR2_SMALL_THREADS)
+        tau[j] = st[j];
+    __syncthreads();
+    for(rocblas_int e = tid; e < m * nq; e += GEQR2_SMALL_THREADS)
+    {
+        rocblas_int i = e % m;
+        rocblas_int j = e / m;
+        if(i <= j || j >= n)
+            sA[e] = (i == j) ? T(1) : T(0);
+    }
+    __syncthreads();
+
+    org2r_small_generate(m, nq, n, sA, sw, st, tid);
+
+    for(rocblas_int e = tid; e < m * nq; e += GEQR2_SMALL_THREADS)
+        Ap[(e % m) + (e / m) * lda] = sA[e];
+}
+
 template <bool BATCHED, typename T, typename I>
 void rocsolver_geqr2_getMemorySize(const I m,
                                    const I n,
@@ -126,6 +392,16 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // if the matrix is small, factorize it in shared memory with a single kernel launch
+    if(m <= GEQR2_MAX_SMALL_SIZE(T) && n <= GEQR2_MAX_SMALL_SIZE(T))
+    {
+        size_t lmemsize = sizeof(T) * (m * n + n + 3 + GEQR2_SMALL_THREADS);
+        ROCSOLVER_LAUNCH_KERNEL((geqr2_small_kernel<T>), dim3(batch_count, 1, 1),
+                                dim3(GEQR2_SMALL_THREADS, 1, 1), lmemsize, stream, m, n, A, shiftA,
+                                lda, strideA, ipiv, strideP);
+        return rocblas_status_success;
+    }
+
     I dim = std::min(m, n); // total number of pivots
 
     for(I j = 0; j < dim; ++j)
@@ -164,4 +440,41 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/** GEQR2_ORG2R_SMALL_TEMPLATE computes the QR factorization of small matrices and generates
+    the first nq columns of Q with a single kernel launch (see geqr2_org2r_small_kernel).
+    It is only valid when m <= GEQR2_MAX_SMALL_SIZE(T) and n <= nq <= m. **/
+template <typename T, typename U>
+rocblas_status rocsolver_geqr2_org2r_small_template(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nq,
+                                                    U A,
+                                                    const rocblas_int shiftA,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    T* R,
+                                                    const rocblas_int ldr,
+                                                    const rocblas_stride strideR,
+                                                    T* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqr2_org2r_small", "m:", m, "n:", n, "nq:", nq, "shiftA:", shiftA,
+                    "lda:", lda, "ldr:", ldr, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t lmemsize = sizeof(T) * (m * nq + nq + n + 3 + GEQR2_SMALL_THREADS);
+    ROCSOLVER_LAUNCH_KERNEL((geqr2_org2r_small_kernel<T>), dim3(batch_count, 1, 1),
+                            dim3(GEQR2_SMALL_THREADS, 1, 1), lmemsize, stream, m, n, nq, A,
+                            shiftA, lda, strideA, R, ldr, strideR, ipiv, strideP);
+
+    return rocblas_status_success;
+}
+
 ROCSOLVER_END_NAMESPACE
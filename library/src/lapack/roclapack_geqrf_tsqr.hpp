@@ -0,0 +1,434 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+#include <vector>
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Set the pointers to the q row tiles of all the instances in the batch. The tiles have
+    mt rows, except the last one of each instance that takes the remaining rows. The first
+    q-1 tiles of all the instances are stored first, and the last tiles afterwards **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geqrf_tsqr_tile_ptrs(T** tiles,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const rocblas_stride strideA,
+                                           const rocblas_int mt,
+                                           const rocblas_int q,
+                                           const rocblas_int batch_count)
+{
+    rocblas_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx < batch_count * q)
+    {
+        rocblas_int nfull = batch_count * (q - 1);
+        rocblas_int bid = (idx < nfull) ? idx / (q - 1) : idx - nfull;
+        rocblas_int k = (idx < nfull) ? idx % (q - 1) : q - 1;
+
+        tiles[idx] = load_ptr_batch<T>(A, bid, shiftA + rocblas_stride(k) * mt, strideA);
+    }
+}
+
+/** Copy the leading n-by-cols block of the nparts parts of a level of the reduction tree
+    to (copymat_to_buffer) or from (copymat_from_buffer) W, where the parts are stacked in
+    groups of g. The parts are the row tiles given by the pointer array tiles or, if tiles is
+    null, the groups of the previous level stored in prev. Missing parts in the last group
+    are filled with zeros, and, if upper is true, only the upper triangular part of the
+    blocks is copied **/
+template <typename T>
+ROCSOLVER_KERNEL void geqrf_tsqr_copy_parts(const copymat_direction direction,
+                                            const rocblas_int n,
+                                            const rocblas_int cols,
+                                            const rocblas_int nparts,
+                                            const rocblas_int g,
+                                            T* const tiles[],
+                                            T* prev,
+                                            const rocblas_int ldp,
+                                            const rocblas_stride strideprev,
+                                            T* W,
+                                            const bool upper,
+                                            const rocblas_int batch_count)
+{
+    const auto gid = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    const rocblas_int ldw = g * n;
+
+    if(i < ldw && j < cols)
+    {
+        const rocblas_int ng = (nparts - 1) / g + 1;
+        const rocblas_int bid = gid / ng;
+        const rocblas_int p = (gid % ng) * g + i / n;
+        const rocblas_int r = i % n;
+
+        T* Wg = W + gid * rocblas_stride(ldw) * cols;
+        T* P = nullptr;
+        if(p < nparts)
+        {
+            rocblas_int nfull = batch_count * (nparts - 1);
+            if(tiles)
+                P = tiles[p < nparts - 1 ? bid * (nparts - 1) + p : nfull + bid];
+            else
+                P = prev + (rocblas_stride(bid) * nparts + p) * strideprev;
+        }
+
+        if(direction == copymat_to_buffer)
+            Wg[i + j * ldw] = (P && !(upper && r > j)) ? P[r + j * ldp] : T(0);
+        else if(P)
+            P[r + j * ldp] = Wg[i + j * ldw];
+    }
+}
+
+/** Return true if the m-by-n QR factorization should use the tiled algorithm (TSQR) **/
+inline bool rocsolver_geqrf_tsqr_use(const rocblas_int m, const rocblas_int n)
+{
+    return m >= GEQRF_TSQR_MIN_ROWS && m >= GEQRF_TSQR_MIN_RATIO * n && n <= GEQRF_TSQR_MAX_COLS;
+}
+
+/** Split the m rows in q tiles of mt rows (the last tile takes the remaining rows), and
+    return the number of groups of R factors reduced at each level of the tree **/
+inline std::vector<rocblas_int> rocsolver_geqrf_tsqr_tiles(const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           rocblas_int* mt,
+                                                           rocblas_int* q)
+{
+    *mt = std::max(GEQRF_TSQR_TILE_ROWS, 2 * n);
+    *q = std::max(m / *mt, 1);
+
+    std::vector<rocblas_int> levels;
+    for(rocblas_int nparts = *q; nparts > 1; nparts = levels.back())
+        levels.push_back((nparts - 1) / GEQRF_TSQR_FANIN + 1);
+
+    return levels;
+}
+
+template <typename T>
+void rocsolver_geqrf_tsqr_getMemorySize(const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int batch_count,
+                                        size_t* size_scalars,
+                                        size_t* size_work,
+                                        size_t* size_Abyx_tmptr,
+                                        size_t* size_diag_trfact,
+                                        size_t* size_workArr,
+                                        size_t* size_tsqr)
+{
+    *size_scalars = 0;
+    *size_work = 0;
+    *size_Abyx_tmptr = 0;
+    *size_diag_trfact = 0;
+    *size_workArr = 0;
+    *size_tsqr = 0;
+
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    rocblas_int mt, q;
+    std::vector<rocblas_int> levels = rocsolver_geqrf_tsqr_tiles(m, n, &mt, &q);
+    const rocblas_int g = GEQRF_TSQR_FANIN;
+    const rocblas_int mlast = m - (q - 1) * mt;
+    const rocblas_int ng = levels.empty() ? 0 : levels[0];
+
+    size_t s1, s2, s3, s4, s5;
+    auto keep_max = [&]() {
+        *size_scalars = std::max(*size_scalars, s1);
+        *size_work = std::max(*size_work, s2);
+        *size_Abyx_tmptr = std::max(*size_Abyx_tmptr, s3);
+        *size_diag_trfact = std::max(*size_diag_trfact, s4);
+        *size_workArr = std::max(*size_workArr, s5);
+    };
+
+    // requirements for calling GEQRF with the tiles and with the stacked R factors
+    // (the first level of the tree has the largest number of groups)
+    rocsolver_geqrf_getMemorySize<true, T>(mt, n, batch_count * (q - 1), &s1, &s2, &s3, &s4, &s5);
+    keep_max();
+    rocsolver_geqrf_getMemorySize<true, T>(mlast, n, batch_count, &s1, &s2, &s3, &s4, &s5);
+    keep_max();
+    rocsolver_geqrf_getMemorySize<false, T>(g * n, n, batch_count * ng, &s1, &s2, &s3, &s4, &s5);
+    keep_max();
+
+    // requirements for calling ORMQR with the tiles and with the stacked rows of B
+    rocsolver_ormqr_unmqr_getMemorySize<true, T>(rocblas_side_left, mt, nrhs, n,
+                                                 batch_count * (q - 1), &s1, &s2, &s3, &s4, &s5);
+    keep_max();
+    rocsolver_ormqr_unmqr_getMemorySize<true, T>(rocblas_side_left, mlast, nrhs, n, batch_count,
+                                                 &s1, &s2, &s3, &s4, &s5);
+    keep_max();
+    rocsolver_ormqr_unmqr_getMemorySize<false, T>(rocblas_side_left, g * n, nrhs, n,
+                                                  batch_count * ng, &s1, &s2, &s3, &s4, &s5);
+    keep_max();
+
+    // size of the pointers to the tiles of A and B, the Householder scalars of the tiles, and,
+    // for every group in the tree, the stacked R factors, their Householder scalars and the
+    // stacked rows of B
+    size_t ngroups = 0;
+    for(rocblas_int l : levels)
+        ngroups += l;
+    *size_tsqr = sizeof(T*) * 2 * batch_count * q
+        + sizeof(T) * batch_count
+            * (size_t(q) * n + ngroups * (size_t(g) * n * n + n + size_t(g) * n * nrhs));
+}
+
+/** GEQRF_TSQR computes the QR factorization of a tall matrix A by splitting its rows in
+    tiles that are factorized independently (as a batch), and reducing the R factors of the
+    tiles in a tree, where groups of GEQRF_TSQR_FANIN stacked R factors are factorized at
+    each level. On exit, the final R factor is in the upper triangular part of A, and the
+    orthogonal matrix Q is given implicitly by the Householder vectors of the tiles (stored
+    in A under their R factors) and by the factorizations of the tree (stored in the
+    workspace tsqr). Q can only be applied with ORMQR_TSQR **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geqrf_tsqr_template(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             void* work,
+                                             T* Abyx_tmptr,
+                                             T* diag_trfact,
+                                             T** workArr,
+                                             void* tsqr)
+{
+    ROCSOLVER_ENTER("geqrf_tsqr", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int mt, q;
+    std::vector<rocblas_int> levels = rocsolver_geqrf_tsqr_tiles(m, n, &mt, &q);
+    const rocblas_int g = GEQRF_TSQR_FANIN;
+    const rocblas_int mlast = m - (q - 1) * mt;
+    const rocblas_int nfull = batch_count * (q - 1);
+    const rocblas_int ldw = g * n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * n;
+
+    // distribute workspace
+    T** tilesA = (T**)tsqr;
+    T* tau = (T*)(tilesA + 2 * batch_count * q);
+    size_t ngroups = 0;
+    for(rocblas_int l : levels)
+        ngroups += l;
+    T* W = tau + size_t(batch_count) * q * n;
+    T* tauW = W + batch_count * ngroups * strideW;
+
+    // set the pointers to the tiles of A
+    rocblas_int blocks = (batch_count * q - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((geqrf_tsqr_tile_ptrs<T>), dim3(blocks), dim3(BS1), 0, stream, tilesA,
+                            A, shiftA, strideA, mt, q, batch_count);
+
+    // factorize all the tiles independently
+    if(q > 1)
+        rocsolver_geqrf_template<true, false, T>(handle, mt, n, (T* const*)tilesA, 0, lda, 0, tau,
+                                                 n, nfull, scalars, work, Abyx_tmptr, diag_trfact,
+                                                 workArr);
+    rocsolver_geqrf_template<true, false, T>(handle, mlast, n, (T* const*)(tilesA + nfull), 0, lda,
+                                             0, tau + size_t(nfull) * n, n, batch_count, scalars,
+                                             work, Abyx_tmptr, diag_trfact, workArr);
+
+    // reduce the R factors in the tree
+    rocblas_int nparts = q;
+    T* prev = nullptr;
+    for(rocblas_int ng : levels)
+    {
+        // stack the R factors of the parts in groups of g, and factorize the groups
+        ROCSOLVER_LAUNCH_KERNEL((geqrf_tsqr_copy_parts<T>),
+                                dim3((ldw - 1) / 32 + 1, (n - 1) / 32 + 1, batch_count * ng),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, n, nparts, g,
+                                prev ? nullptr : (T* const*)tilesA, prev, prev ? ldw : lda,
+                                strideW, W, true, batch_count);
+
+        rocsolver_geqrf_template<false, true, T>(handle, ldw, n, W, 0, ldw, strideW, tauW, n,
+                                                 batch_count * ng, scalars, work, Abyx_tmptr,
+                                                 diag_trfact, workArr);
+
+        prev = W;
+        W += batch_count * ng * strideW;
+        tauW += size_t(batch_count) * ng * n;
+        nparts = ng;
+    }
+
+    // copy the final R factor to the leading rows of A
+    if(prev)
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, T*, U>),
+                                dim3((n - 1) / 32 + 1, (n - 1) / 32 + 1, batch_count), dim3(32, 32),
+                                0, stream, n, n, prev, 0, ldw, strideW, A, shiftA, lda, strideA,
+                                no_mask{}, rocblas_fill_upper);
+
+    return rocblas_status_success;
+}
+
+/** ORMQR_TSQR overwrites the m-by-nrhs matrix B with Q * B (trans = none) or Q' * B,
+    where Q is the orthogonal matrix of the tiled QR factorization computed by GEQRF_TSQR.
+    The workspaces A and tsqr must be those that were passed to GEQRF_TSQR **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_ormqr_tsqr_template(rocblas_handle handle,
+                                             const rocblas_operation trans,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             U B,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             void* work,
+                                             T* Abyx_tmptr,
+                                             T* diag_trfact,
+                                             T** workArr,
+                                             void* tsqr)
+{
+    ROCSOLVER_ENTER("ormqr_tsqr", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int mt, q;
+    std::vector<rocblas_int> levels = rocsolver_geqrf_tsqr_tiles(m, n, &mt, &q);
+    const rocblas_int nlevels = levels.size();
+    const rocblas_int g = GEQRF_TSQR_FANIN;
+    const rocblas_int mlast = m - (q - 1) * mt;
+    const rocblas_int nfull = batch_count * (q - 1);
+    const rocblas_int ldw = g * n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * n;
+    const rocblas_stride strideC = rocblas_stride(ldw) * nrhs;
+    const rocblas_int blocksx = (ldw - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+
+    // distribute workspace
+    T** tilesA = (T**)tsqr;
+    T** tilesB = tilesA + batch_count * q;
+    T* tau = (T*)(tilesB + batch_count * q);
+    size_t ngroups = 0;
+    for(rocblas_int l : levels)
+        ngroups += l;
+    T* W0 = tau + size_t(batch_count) * q * n;
+    T* tauW0 = W0 + batch_count * ngroups * strideW;
+    T* C0 = tauW0 + batch_count * ngroups * n;
+
+    // offsets of the groups of each level of the tree
+    std::vector<size_t> offset(nlevels + 1, 0);
+    for(rocblas_int l = 0; l < nlevels; l++)
+        offset[l + 1] = offset[l] + size_t(batch_count) * levels[l];
+
+    // number of parts of level l, and pointers to them
+    auto nparts = [&](rocblas_int l) { return l == 0 ? q : levels[l - 1]; };
+    auto tiles = [&](rocblas_int l) { return l == 0 ? (T* const*)tilesB : nullptr; };
+    auto prev = [&](rocblas_int l) { return l == 0 ? nullptr : C0 + offset[l - 1] * strideC; };
+
+    // set the pointers to the tiles of B
+    rocblas_int blocks = (batch_count * q - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((geqrf_tsqr_tile_ptrs<T>), dim3(blocks), dim3(BS1), 0, stream, tilesB,
+                            B, shiftB, strideB, mt, q, batch_count);
+
+    // apply the reflectors of the tiles
+    auto apply_tiles = [&]() {
+        if(q > 1)
+            rocsolver_ormqr_unmqr_template<true, false, T>(
+                handle, rocblas_side_left, trans, mt, nrhs, n, (T* const*)tilesA, 0, lda, 0, tau,
+                n, (T* const*)tilesB, 0, ldb, 0, nfull, scalars, (T*)work, Abyx_tmptr,
+                diag_trfact, workArr);
+        rocsolver_ormqr_unmqr_template<true, false, T>(
+            handle, rocblas_side_left, trans, mlast, nrhs, n, (T* const*)(tilesA + nfull), 0, lda,
+            0, tau + size_t(nfull) * n, n, (T* const*)(tilesB + nfull), 0, ldb, 0, batch_count,
+            scalars, (T*)work, Abyx_tmptr, diag_trfact, workArr);
+    };
+
+    // apply the reflectors of the groups of level l to the stacked rows of B
+    auto apply_level = [&](rocblas_int l) {
+        rocsolver_ormqr_unmqr_template<false, true, T>(
+            handle, rocblas_side_left, trans, ldw, nrhs, n, W0 + offset[l] * strideW, 0, ldw,
+            strideW, tauW0 + offset[l] * n, n, C0 + offset[l] * strideC, 0, ldw, strideC,
+            batch_count * levels[l], scalars, (T*)work, Abyx_tmptr, diag_trfact, workArr);
+    };
+
+    // copy the leading rows of the parts of level l to or from the stacked rows of B
+    auto copy_level = [&](copymat_direction direction, rocblas_int l) {
+        ROCSOLVER_LAUNCH_KERNEL((geqrf_tsqr_copy_parts<T>),
+                                dim3(blocksx, blocksy, batch_count * levels[l]), dim3(32, 32), 0,
+                                stream, direction, n, nrhs, nparts(l), g, tiles(l), prev(l),
+                                l == 0 ? ldb : ldw, strideC, C0 + offset[l] * strideC, false,
+                                batch_count);
+    };
+
+    if(trans == rocblas_operation_none)
+    {
+        // Q = Q_tiles * Q_1 * ... * Q_L
+        for(rocblas_int l = 0; l < nlevels; l++)
+            copy_level(copymat_to_buffer, l);
+        for(rocblas_int l = nlevels - 1; l >= 0; l--)
+        {
+            apply_level(l);
+            copy_level(copymat_from_buffer, l);
+        }
+        apply_tiles();
+    }
+    else
+    {
+        // Q' = Q_L' * ... * Q_1' * Q_tiles'
+        apply_tiles();
+        for(rocblas_int l = 0; l < nlevels; l++)
+        {
+            copy_level(copymat_to_buffer, l);
+            apply_level(l);
+        }
+        for(rocblas_int l = nlevels - 1; l >= 0; l--)
+            copy_level(copymat_from_buffer, l);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
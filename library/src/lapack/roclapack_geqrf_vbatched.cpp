@@ -0,0 +1,124 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+
+#include "roclapack_geqrf_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_geqrf_vbatched_impl(rocblas_handle handle,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             T* const A[],
+                                             const rocblas_int* lda,
+                                             T* ipiv,
+                                             const rocblas_stride strideP,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqrf_vbatched", "--strideP", strideP, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrf_vbatched_argCheck(handle, m, n, A, lda, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_geqrf_vbatched_template<T>(handle, m, n, A, lda, ipiv, strideP, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         float* const A[],
+                                         const rocblas_int* lda,
+                                         float* ipiv,
+                                         const rocblas_stride strideP,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_vbatched_impl<float>(handle, m, n, A, lda, ipiv, strideP,
+                                                           batch_count);
+}
+
+rocblas_status rocsolver_dgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         double* const A[],
+                                         const rocblas_int* lda,
+                                         double* ipiv,
+                                         const rocblas_stride strideP,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_vbatched_impl<double>(handle, m, n, A, lda, ipiv, strideP,
+                                                            batch_count);
+}
+
+rocblas_status rocsolver_cgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         rocblas_float_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_float_complex* ipiv,
+                                         const rocblas_stride strideP,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_vbatched_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, ipiv, strideP, batch_count);
+}
+
+rocblas_status rocsolver_zgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         rocblas_double_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_double_complex* ipiv,
+                                         const rocblas_stride strideP,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_vbatched_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, ipiv, strideP, batch_count);
+}
+
+} // extern C
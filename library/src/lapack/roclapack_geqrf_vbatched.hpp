@@ -0,0 +1,227 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_geqr2.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQRF_VBATCHED_LARFG generates the Householder reflector H = I - tau * v * v' such that
+    H' * x = beta * e1, where x is the vector of length n with elements x[i * incx], using all
+    the threads of the work-group (as GEQR2_SMALL_FACTOR, the norm is accumulated with the
+    entries scaled by their largest magnitude). On exit, x[0] is overwritten by beta and the
+    rest of x by v (without its leading 1). Returns tau. **/
+template <typename T, typename S>
+__device__ T geqrf_vbatched_larfg(const rocblas_int tid,
+                                  const rocblas_int nt,
+                                  const rocblas_int n,
+                                  T* x,
+                                  const rocblas_int incx,
+                                  T* sp,
+                                  S* sval)
+{
+    // largest magnitude in x(1:n-1)
+    S xmax = 0;
+    for(rocblas_int i = tid + 1; i < n; i += nt)
+        xmax = std::max(xmax, aabs<S>(x[i * incx]));
+    xmax = vbatched_max(tid, nt, xmax, sval);
+
+    // sum of squares of x(1:n-1) / xmax
+    S ss = 0;
+    if(xmax > 0)
+    {
+        for(rocblas_int i = tid + 1; i < n; i += nt)
+        {
+            T y = x[i * incx] / T(xmax);
+            ss += std::real(conj(y) * y);
+        }
+    }
+    ss = vbatched_sum(tid, nt, ss, sval);
+
+    if(tid == 0)
+    {
+        T beta = x[0];
+        geqr2_small_reflector(beta, xmax * sqrt(ss), sp[0], sp[1]);
+        x[0] = beta;
+    }
+    __syncthreads();
+
+    const T scale = sp[0];
+    const T tau = sp[1];
+    for(rocblas_int i = tid + 1; i < n; i += nt)
+        x[i * incx] *= scale;
+    __syncthreads();
+
+    return tau;
+}
+
+/** GEQRF_VBATCHED_GEQR2 computes the QR factorization of the m-by-n matrix A with elements
+    A[i * inca + j * lda], using all the threads of the work-group. The Householder scalars are
+    stored in tau. sw must have room for one element per thread. **/
+template <typename T, typename S>
+__device__ void geqrf_vbatched_geqr2(const rocblas_int tid,
+                                     const rocblas_int nt,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     T* A,
+                                     const rocblas_int inca,
+                                     const rocblas_int lda,
+                                     T* tau,
+                                     T* sw,
+                                     T* sp,
+                                     S* sval)
+{
+    const rocblas_int dim = std::min(m, n);
+
+    for(rocblas_int j = 0; j < dim; ++j)
+    {
+        T* v = A + j * inca + j * lda;
+        const T t = geqrf_vbatched_larfg(tid, nt, m - j, v, inca, sp, sval);
+        if(tid == 0)
+            tau[j] = t;
+
+        // apply H(j)' to A(j:m-1,j+1:n-1)
+        vbatched_larf_left(tid, nt, m - j, n - j - 1, v, inca, conj(t), v + lda, inca, lda, sw);
+    }
+}
+
+/** GEQRF_VBATCHED_KERNEL factorizes the batch instances in the size class with bounds lo and
+    hi, with one work-group per instance. The instances with invalid dimensions are skipped. **/
+template <typename T>
+ROCSOLVER_KERNEL void geqrf_vbatched_kernel(const rocblas_int lo,
+                                            const rocblas_int hi,
+                                            const bool lds,
+                                            const rocblas_int* mm,
+                                            const rocblas_int* nn,
+                                            T* const A[],
+                                            const rocblas_int* ldaa,
+                                            T* ipiv,
+                                            const rocblas_stride strideP)
+{
+    using S = decltype(std::real(T{}));
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nt = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int lda = ldaa[b];
+
+    if(m < 0 || n < 0 || lda < m)
+        return;
+    if(!vbatched_in_class(std::max(m, n), lo, hi) || m == 0 || n == 0)
+        return;
+
+    extern __shared__ double lmem[];
+    T *sA, *sw, *sp;
+    S* sval;
+    rocblas_int* sidx;
+    vbatched_lmem(lmem, lds ? m * n : 0, &sA, &sw, &sp, &sval, &sidx);
+
+    T* Ap = A[b];
+    if(lds)
+        vbatched_load(tid, nt, m, n, Ap, lda, sA);
+
+    geqrf_vbatched_geqr2(tid, nt, m, n, lds ? sA : Ap, 1, lds ? m : lda, ipiv + b * strideP, sw,
+                         sp, sval);
+
+    if(lds)
+        vbatched_store(tid, nt, m, n, sA, Ap, lda);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 T A,
+                                                 const rocblas_int* lda,
+                                                 U ipiv,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the dimensions of the batch instances are only read on the device; instances with
+    // invalid dimensions are skipped)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !A || !lda || !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_geqrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 T* const A[],
+                                                 const rocblas_int* lda,
+                                                 T* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqrf_vbatched", "strideP:", strideP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // factorize the instances of each size class
+    // (the matrices of the small classes are kept in LDS)
+    for(rocblas_int c = 0; c <= VBATCHED_NUM_INTERVALS; ++c)
+    {
+        rocblas_int lo, hi, threads;
+        bool lds;
+        rocsolver_vbatched_class<T>(c, &lo, &hi, &threads, &lds);
+        size_t lmemsize = rocsolver_vbatched_lmem_size<T>(threads, lds ? hi * hi : 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(geqrf_vbatched_kernel<T>, dim3(batch_count), dim3(threads),
+                                lmemsize, stream, lo, hi, lds, m, n, A, lda, ipiv, strideP);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
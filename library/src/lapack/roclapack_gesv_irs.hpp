@@ -0,0 +1,731 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+#define IRS_MAX_ITERS 30 // maximum number of refinement steps before falling back to full precision
+#define IRS_CHECK_STEPS 3 // refinement steps between checks of the convergence on the host
+
+/** IRS_SINGLE_TYPE gives the precision used for the factorizations in the
+    mixed-precision iterative refinement solvers **/
+template <typename T>
+struct irs_single_type;
+
+template <>
+struct irs_single_type<double>
+{
+    using type = float;
+};
+
+template <>
+struct irs_single_type<rocblas_double_complex>
+{
+    using type = rocblas_float_complex;
+};
+
+/** IRS_CONVERT returns the value x converted to type T2 **/
+template <typename T2, typename T1>
+__device__ T2 irs_convert(const T1 x)
+{
+    if constexpr(rocblas_is_complex<T1>)
+        return T2(x.real(), x.imag());
+    else
+        return T2(x);
+}
+
+/** IRS_OVERFLOW returns true if x cannot be represented in the precision of Ts **/
+template <typename Ts, typename T>
+__device__ bool irs_overflow(const T x)
+{
+    using S = decltype(std::real(Ts{}));
+    const S big = std::numeric_limits<S>::max();
+
+    if constexpr(rocblas_is_complex<T>)
+        return x.real() > big || x.real() < -big || x.imag() > big || x.imag() < -big;
+    else
+        return x > big || x < -big;
+}
+
+/** IRS_LOWER_MAT converts the m-by-n matrices A_l into the lower-precision
+    matrices As_l (with leading dimension m). Instances that are not being
+    refined anymore (status[l] != 0) are skipped, and those with entries that
+    overflow in the lower precision are flagged in ovf.
+    If uplo = rocblas_fill_upper, only the upper triangular part is converted
+    If uplo = rocblas_fill_lower, only the lower triangular part is converted **/
+template <typename T, typename Ts, typename U>
+ROCSOLVER_KERNEL void irs_lower_mat(const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    Ts* As,
+                                    rocblas_int* status,
+                                    rocblas_int* ovf,
+                                    const rocblas_fill uplo = rocblas_fill_full)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    const bool full = (uplo == rocblas_fill_full);
+    const bool upper = (uplo == rocblas_fill_upper);
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    if(i < m && j < n && !status[b])
+    {
+        if(full || (upper && j >= i) || (lower && i >= j))
+        {
+            T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+            Ts* Asp = As + b * rocblas_stride(m) * n;
+            const T a = Ap[i + j * lda];
+
+            if(irs_overflow<Ts>(a))
+                ovf[b] = 1;
+            Asp[i + j * m] = irs_convert<Ts>(a);
+        }
+    }
+}
+
+/** IRS_RAISE_MAT sets X_l = Xs_l (if add = false) or X_l = X_l + Xs_l (if add = true)
+    for the instances that are still being refined. X_l and Xs_l are m-by-n
+    matrices with leading dimension m **/
+template <typename T, typename Ts>
+ROCSOLVER_KERNEL void irs_raise_mat(const bool add,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    T* X,
+                                    Ts* Xs,
+                                    rocblas_int* status,
+                                    rocblas_int* ovf)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m && j < n && !status[b] && !ovf[b])
+    {
+        const rocblas_stride idx = b * rocblas_stride(m) * n + i + j * m;
+        const T x = irs_convert<T>(Xs[idx]);
+        X[idx] = add ? X[idx] + x : x;
+    }
+}
+
+/** IRS_MAT_NORM computes the infinity norm of the n-by-n matrices A_l.
+    If uplo = rocblas_fill_upper or rocblas_fill_lower, A_l is symmetric/hermitian
+    and only the indicated triangular part is referenced.
+    Call this kernel with batch_count groups in x, and BS1 threads **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) irs_mat_norm(const rocblas_int n,
+                                                          U A,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          S* norms,
+                                                          const rocblas_fill uplo)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+
+    __shared__ S snorm[BS1];
+
+    // each thread computes the sum of some of the rows
+    S norm = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S sum = 0;
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            const bool trans = (uplo == rocblas_fill_upper && j < i)
+                || (uplo == rocblas_fill_lower && j > i);
+            sum += aabs<S>(trans ? Ap[j + i * lda] : Ap[i + j * lda]);
+        }
+        norm = (sum > norm) ? sum : norm;
+    }
+    snorm[tid] = norm;
+    __syncthreads();
+
+    // reduce the maximum
+    for(rocblas_int s = BS1 / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            snorm[tid] = (snorm[tid + s] > snorm[tid]) ? snorm[tid + s] : snorm[tid];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        norms[b] = snorm[0];
+}
+
+/** IRS_CHECK_RESIDUAL flags in nconv the instances for which some column X_l[:,j]
+    of the current solution does not satisfy the stopping criterion
+    ||R_l[:,j]||_inf <= ||X_l[:,j]||_inf * ||A_l||_inf * eps * sqrt(n), where R_l is the residual.
+    X_l and R_l are n-by-nrhs matrices with leading dimension n.
+    Call this kernel with nrhs groups in x, batch_count groups in y, and BS1 threads **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) irs_check_residual(const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                T* X,
+                                                                T* R,
+                                                                S* norms,
+                                                                const S eps,
+                                                                rocblas_int* status,
+                                                                rocblas_int* nconv)
+{
+    const auto j = hipBlockIdx_x;
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+
+    // skip instances that are not being refined anymore
+    if(status[b])
+        return;
+
+    const rocblas_stride offset = b * rocblas_stride(n) * nrhs + j * rocblas_stride(n);
+
+    __shared__ S srnorm[BS1];
+    __shared__ S sxnorm[BS1];
+
+    S rnorm = 0, xnorm = 0, val;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        val = aabs<S>(R[offset + i]);
+        rnorm = (val > rnorm) ? val : rnorm;
+        val = aabs<S>(X[offset + i]);
+        xnorm = (val > xnorm) ? val : xnorm;
+    }
+    srnorm[tid] = rnorm;
+    sxnorm[tid] = xnorm;
+    __syncthreads();
+
+    // reduce the maxima
+    for(rocblas_int s = BS1 / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+        {
+            srnorm[tid] = (srnorm[tid + s] > srnorm[tid]) ? srnorm[tid + s] : srnorm[tid];
+            sxnorm[tid] = (sxnorm[tid + s] > sxnorm[tid]) ? sxnorm[tid + s] : sxnorm[tid];
+        }
+        __syncthreads();
+    }
+
+    // (a NaN residual is never considered converged)
+    if(tid == 0 && !(srnorm[0] <= sxnorm[0] * norms[b] * eps * sqrt(S(n))))
+        nconv[b] = 1;
+}
+
+/** IRS_UPDATE_STATE updates the state of the instances that are still being refined
+    after refinement step k (k < 0 refers to the factorization in lower precision).
+    The array state has dimension 2 + 3*batch_count: state[0] counts the instances
+    that are finished, state[1] those that failed and must be solved in full precision;
+    it is followed by the arrays status, ovf and nconv of batch_count elements each. **/
+template <typename T>
+ROCSOLVER_KERNEL void irs_update_state(const rocblas_int k,
+                                       rocblas_int* iter,
+                                       rocblas_int* info,
+                                       rocblas_int* state,
+                                       const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        rocblas_int* status = state + 2;
+        rocblas_int* ovf = status + batch_count;
+        rocblas_int* nconv = ovf + batch_count;
+
+        if(!status[b])
+        {
+            // status = 1: converged; status = 2: failed
+            rocblas_int st = 0;
+            if(ovf[b])
+            {
+                st = 2;
+                iter[b] = -2;
+            }
+            else if(info[b] != 0)
+            {
+                st = 2;
+                iter[b] = -3;
+            }
+            else if(k >= 0 && !nconv[b])
+            {
+                st = 1;
+                iter[b] = k;
+            }
+            else if(k >= IRS_MAX_ITERS)
+            {
+                st = 2;
+                iter[b] = -IRS_MAX_ITERS - 1;
+            }
+
+            if(st)
+            {
+                status[b] = st;
+                atomicAdd(state, 1);
+                if(st == 2)
+                    atomicAdd(state + 1, 1);
+            }
+        }
+
+        nconv[b] = 0;
+    }
+}
+
+/** IRS_SET_FALLBACK marks in nconv the instances whose refinement did not succeed
+    (status[l] = 2), which must be solved in full precision, and resets ovf, where the
+    info of the full-precision factorization is returned **/
+template <typename T>
+ROCSOLVER_KERNEL void irs_set_fallback(rocblas_int* state, const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        rocblas_int* status = state + 2;
+        rocblas_int* ovf = status + batch_count;
+        rocblas_int* nconv = ovf + batch_count;
+
+        nconv[b] = (status[b] == 2) ? 1 : 0;
+        ovf[b] = 0;
+    }
+}
+
+/** IRS_SET_INFO copies to info the result of the full-precision factorization (in ovf)
+    of the instances that were solved in full precision **/
+template <typename T>
+ROCSOLVER_KERNEL void
+    irs_set_info(rocblas_int* info, rocblas_int* state, const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        rocblas_int* ovf = state + 2 + batch_count;
+        rocblas_int* nconv = ovf + batch_count;
+
+        if(nconv[b])
+            info[b] = ovf[b];
+    }
+}
+
+/** IRS_CHECK_DONE sets done = true if all the instances have finished after refinement
+    step k. The counters in state are only read back every IRS_CHECK_STEPS steps (and after
+    the last step), so that the host waits for the device once for the common case of a
+    few steps; they are not read while the stream is being captured. h_state receives the
+    number of instances that finished and of those that failed. **/
+inline rocblas_status rocsolver_irs_check_done(hipStream_t stream,
+                                               const rocblas_int k,
+                                               const bool capturing,
+                                               rocblas_int* state,
+                                               rocblas_int* h_state,
+                                               const rocblas_int batch_count,
+                                               bool* done)
+{
+    *done = false;
+    if(capturing || ((k + 1) % IRS_CHECK_STEPS != 0 && k < IRS_MAX_ITERS))
+        return rocblas_status_success;
+
+    HIP_CHECK(
+        hipMemcpyAsync(h_state, state, 2 * sizeof(rocblas_int), hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    *done = (h_state[0] == batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_gesv_irs_argCheck(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int lda,
+                                           const rocblas_int ldb,
+                                           T A,
+                                           T B,
+                                           const rocblas_int* ipiv,
+                                           const rocblas_int* iter,
+                                           const rocblas_int* info,
+                                           const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs && n && !B) || (batch_count && !iter)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gesv_irs_getMemorySize(const rocblas_int n,
+                                      const rocblas_int nrhs,
+                                      const rocblas_int batch_count,
+                                      size_t* size_scalars,
+                                      size_t* size_scalarsLow,
+                                      size_t* size_work1,
+                                      size_t* size_work2,
+                                      size_t* size_work3,
+                                      size_t* size_work4,
+                                      size_t* size_pivotval,
+                                      size_t* size_pivotidx,
+                                      size_t* size_iipiv,
+                                      size_t* size_iinfo,
+                                      size_t* size_workArr,
+                                      size_t* size_Alow,
+                                      size_t* size_Xlow,
+                                      size_t* size_X,
+                                      size_t* size_R,
+                                      size_t* size_norms,
+                                      size_t* size_state,
+                                      bool* optim_mem)
+{
+    using Ts = typename irs_single_type<T>::type;
+    using S = decltype(std::real(T{}));
+
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_scalarsLow = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_workArr = 0;
+        *size_Alow = 0;
+        *size_Xlow = 0;
+        *size_X = 0;
+        *size_R = 0;
+        *size_norms = 0;
+        *size_state = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3, opt4;
+    size_t unused, w1, w2, w3, w4, pv, pi, ip, ii;
+
+    // workspace required for calling GETRF and GETRS in full precision
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T>(
+        n, n, true, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, &opt1);
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, n, nrhs, batch_count,
+                                                       &w1, &w2, &w3, &w4, &opt2);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // workspace required for calling GETRF and GETRS in lower precision
+    // (the factorization is stored in a strided workspace)
+    rocsolver_getrf_getMemorySize<false, true, Ts>(n, n, true, batch_count, size_scalarsLow, &w1,
+                                                   &w2, &w3, &w4, &pv, &pi, &ip, &ii, &opt3, n);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *size_pivotval = std::max(*size_pivotval, pv);
+    *size_pivotidx = std::max(*size_pivotidx, pi);
+    *size_iipiv = std::max(*size_iipiv, ip);
+    *size_iinfo = std::max(*size_iinfo, ii);
+
+    rocsolver_getrs_getMemorySize<false, true, Ts>(rocblas_operation_none, n, nrhs, batch_count,
+                                                   &w1, &w2, &w3, &w4, &opt4, n, n);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    *optim_mem = opt1 && opt2 && opt3 && opt4;
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+
+    // lower-precision copies of A and of the right-hand sides/corrections
+    // (if some instances are solved in full precision, they are reused to save A and the
+    // pivots of the instances that converged)
+    *size_Alow = sizeof(T) * n * n * batch_count;
+    *size_Xlow = sizeof(Ts) * n * nrhs * batch_count;
+
+    // current solutions and residuals
+    *size_X = sizeof(T) * n * nrhs * batch_count;
+    *size_R = sizeof(T) * n * nrhs * batch_count;
+
+    // norms of A and state of the refinement
+    *size_norms = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * (2 + 3 * batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gesv_irs_template(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           rocblas_int* ipiv,
+                                           const rocblas_stride strideP,
+                                           U B,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count,
+                                           T* scalars,
+                                           void* scalarsLow,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4,
+                                           void* pivotval,
+                                           rocblas_int* pivotidx,
+                                           rocblas_int* iipiv,
+                                           rocblas_int* iinfo,
+                                           T** workArr,
+                                           void* Alow,
+                                           void* Xlow,
+                                           T* X,
+                                           T* R,
+                                           void* norms,
+                                           rocblas_int* state,
+                                           bool optim_mem)
+{
+    ROCSOLVER_ENTER("gesv_irs", "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    using Ts = typename irs_single_type<T>::type;
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 and iter=0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, 0);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T minone = -1;
+    T one = 1;
+
+    // constants in host memory
+    const rocblas_int copyblocksx = (n - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+    const rocblas_stride strideX = rocblas_stride(n) * nrhs;
+    const S eps = get_epsilon<S>();
+    Ts* As = (Ts*)Alow;
+    Ts* Xs = (Ts*)Xlow;
+    rocblas_int* status = state + 2;
+    rocblas_int* ovf = status + batch_count;
+    rocblas_int h_state[2];
+
+    // initialize the state of the refinement
+    rocblas_int blocksState = (2 + 3 * batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksState), threads, 0, stream, state,
+                            2 + 3 * batch_count, 0);
+
+    // compute the norms of A and convert A to lower precision
+    ROCSOLVER_LAUNCH_KERNEL((irs_mat_norm<T>), dim3(batch_count), threads, 0, stream, n, A,
+                            shiftA, lda, strideA, (S*)norms, rocblas_fill_full);
+    ROCSOLVER_LAUNCH_KERNEL((irs_lower_mat<T>), dim3(copyblocksx, copyblocksx, batch_count),
+                            dim3(32, 32), 0, stream, n, n, A, shiftA, lda, strideA, As, status,
+                            ovf, rocblas_fill_full);
+
+    // compute LU factorization in lower precision
+    rocsolver_getrf_template<false, true, Ts>(
+        handle, n, n, As, 0, 1, n, rocblas_stride(n) * n, ipiv, 0, strideP, info, batch_count,
+        (Ts*)scalarsLow, work1, work2, work3, work4, (Ts*)pivotval, pivotidx, iipiv, iinfo,
+        optim_mem, true);
+
+    // convert B to lower precision and find initial solutions
+    ROCSOLVER_LAUNCH_KERNEL((irs_lower_mat<T>), dim3(copyblocksx, copyblocksy, batch_count),
+                            dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, Xs, status,
+                            ovf, rocblas_fill_full);
+    ROCSOLVER_LAUNCH_KERNEL(irs_update_state<T>, gridReset, threads, 0, stream, -1, iter, info,
+                            state, batch_count);
+
+    rocsolver_getrs_template<false, true, Ts>(
+        handle, rocblas_operation_none, n, nrhs, As, 0, 1, n, rocblas_stride(n) * n, ipiv, strideP,
+        Xs, 0, 1, n, strideX, batch_count, work1, work2, work3, work4, optim_mem, true);
+    ROCSOLVER_LAUNCH_KERNEL(irs_raise_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                            dim3(32, 32), 0, stream, false, n, nrhs, X, Xs, status, ovf);
+
+    // iterative refinement
+    // (the instances that finished are skipped by the conversions and the convergence check;
+    // the state is read back by the host only every IRS_CHECK_STEPS steps, or never while
+    // the stream is being captured, in which case all the steps are executed)
+    hipStreamCaptureStatus capture_status;
+    HIP_CHECK(hipStreamIsCapturing(stream, &capture_status));
+    const bool capturing = (capture_status != hipStreamCaptureStatusNone);
+    bool done = false;
+    h_state[1] = 0;
+
+    for(rocblas_int k = 0; k <= IRS_MAX_ITERS && !done; k++)
+    {
+        if(k > 0)
+        {
+            // compute corrections in lower precision and update solutions
+            ROCSOLVER_LAUNCH_KERNEL((irs_lower_mat<T>), dim3(copyblocksx, copyblocksy, batch_count),
+                                    dim3(32, 32), 0, stream, n, nrhs, R, 0, n, strideX, Xs, status,
+                                    ovf, rocblas_fill_full);
+            rocsolver_getrs_template<false, true, Ts>(
+                handle, rocblas_operation_none, n, nrhs, As, 0, 1, n, rocblas_stride(n) * n, ipiv,
+                strideP, Xs, 0, 1, n, strideX, batch_count, work1, work2, work3, work4, optim_mem,
+                true);
+            ROCSOLVER_LAUNCH_KERNEL(irs_raise_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                    dim3(32, 32), 0, stream, true, n, nrhs, X, Xs, status, ovf);
+        }
+
+        // compute residuals R = B - AX in full precision
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, R, 0,
+                                n, strideX);
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, nrhs, n,
+                         &minone, A, shiftA, lda, strideA, X, 0, n, strideX, &one, R, 0, n,
+                         strideX, batch_count, workArr);
+
+        // check convergence
+        ROCSOLVER_LAUNCH_KERNEL(irs_check_residual<T>, dim3(nrhs, batch_count), threads, 0, stream,
+                                n, nrhs, X, R, (S*)norms, eps, status, status + 2 * batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(irs_update_state<T>, gridReset, threads, 0, stream, k, iter, info,
+                                state, batch_count);
+        ROCBLAS_CHECK(
+            rocsolver_irs_check_done(stream, k, capturing, state, h_state, batch_count, &done));
+    }
+
+    if(!capturing && h_state[1] == 0)
+    {
+        // all the instances converged; copy the solutions to B
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, X, 0, n, strideX, B, shiftB, ldb,
+                                strideB);
+    }
+    else
+    {
+        // solve in full precision the systems whose refinement did not succeed; the other
+        // instances keep A, the pivots and the refined solutions
+        rocblas_int* failed = status + 2 * batch_count;
+        rocblas_int* finfo = ovf;
+        T* Asave = (T*)Alow;
+        rocblas_int* Psave = (rocblas_int*)Xlow;
+
+        ROCSOLVER_LAUNCH_KERNEL(irs_set_fallback<T>, gridReset, threads, 0, stream, state,
+                                batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksx, batch_count),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, n, A, shiftA, lda,
+                                strideA, Asave, info_mask(failed, info_mask::negate));
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<rocblas_int>, dim3(copyblocksx, 1, batch_count),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, 1, ipiv, 0, n,
+                                strideP, Psave, info_mask(failed, info_mask::negate));
+
+        rocsolver_getrf_template<BATCHED, STRIDED, T>(
+            handle, n, n, A, shiftA, 1, lda, strideA, ipiv, 0, strideP, finfo, batch_count,
+            scalars, work1, work2, work3, work4, (T*)pivotval, pivotidx, iipiv, iinfo, optim_mem,
+            true);
+
+        // save elements of B that will be overwritten by GETRS for cases where info is nonzero
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb,
+                                strideB, R, info_mask(finfo));
+
+        rocsolver_getrs_template<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, n, nrhs, A, shiftA, 1, lda, strideA, ipiv, strideP, B,
+            shiftB, 1, ldb, strideB, batch_count, work1, work2, work3, work4, optim_mem, true);
+
+        // restore elements of B that were overwritten by GETRS in cases where info is nonzero
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, R, info_mask(finfo));
+
+        // restore A and the pivots, and copy the solutions to B, for the instances that
+        // converged
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksx, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, n, A, shiftA, lda,
+                                strideA, Asave, info_mask(failed, info_mask::negate));
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<rocblas_int>, dim3(copyblocksx, 1, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, 1, ipiv, 0, n,
+                                strideP, Psave, info_mask(failed, info_mask::negate));
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, X, info_mask(failed, info_mask::negate));
+        ROCSOLVER_LAUNCH_KERNEL(irs_set_info<T>, gridReset, threads, 0, stream, info, state,
+                                batch_count);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
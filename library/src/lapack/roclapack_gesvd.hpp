@@ -568,31 +568,56 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             nu = leftvN ? 0 : k;
             nv = rightvN ? 0 : k;
 
-            //*** STAGE 1: Row (or column) compression ***//
-            local_geqrlq_template<BATCHED, STRIDED>(
-                handle, m, n, A, shiftA, lda, strideA, tau_splits, k, batch_count, scalars,
-                work_workArr, Abyx_norms_trfact_X, diag_tmptr_Y, workArr, row);
-
-            if(leadvA)
-                // copy factorization to U or V when needed
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
-                                        shiftA, lda, strideA, UV, shiftUV, lduv, strideUV);
-
-            // copy the triangular part to be used in the bidiagonalization
-            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
-                                    dim3(thread_count, thread_count, 1), 0, stream, k, k, A, shiftA,
-                                    lda, strideA, bufferT, shiftT, ldt, strideT, no_mask{}, uplo);
-
-            //*** STAGE 2: generate orthonormal/unitary matrix from row/column compression ***//
-            if(leadvA)
-                local_orgqrlq_ungqrlq_template<false, STRIDED>(
-                    handle, kk, kk, k, UV, shiftUV, lduv, strideUV, tau_splits, k, batch_count,
-                    scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+            if(row && m <= GEQR2_MAX_SMALL_SIZE(T))
+            {
+                //*** STAGES 1 AND 2: column compression and generation of Q ***//
+                // small matrices: factorize and generate Q with a single kernel launch, writing
+                // the triangular factor directly to the buffer
+                if(leadvA)
+                {
+                    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n,
+                                            A, shiftA, lda, strideA, UV, shiftUV, lduv, strideUV);
+                    rocsolver_geqr2_org2r_small_template<T>(
+                        handle, m, n, m, UV, shiftUV, lduv, strideUV, bufferT + shiftT, ldt,
+                        strideT, tau_splits, k, batch_count);
+                }
+                else
+                    rocsolver_geqr2_org2r_small_template<T>(handle, m, n, n, A, shiftA, lda,
+                                                            strideA, bufferT + shiftT, ldt, strideT,
+                                                            tau_splits, k, batch_count);
+            }
             else
-                local_orgqrlq_ungqrlq_template<BATCHED, STRIDED>(
-                    handle, m, n, k, A, shiftA, lda, strideA, tau_splits, k, batch_count, scalars,
-                    (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+            {
+                //*** STAGE 1: Row (or column) compression ***//
+                local_geqrlq_template<BATCHED, STRIDED>(
+                    handle, m, n, A, shiftA, lda, strideA, tau_splits, k, batch_count, scalars,
+                    work_workArr, Abyx_norms_trfact_X, diag_tmptr_Y, workArr, row);
+
+                if(leadvA)
+                    // copy factorization to U or V when needed
+                    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n,
+                                            A, shiftA, lda, strideA, UV, shiftUV, lduv, strideUV);
+
+                // copy the triangular part to be used in the bidiagonalization
+                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream, k, k, A,
+                                        shiftA, lda, strideA, bufferT, shiftT, ldt, strideT,
+                                        no_mask{}, uplo);
+
+                //*** STAGE 2: generate orthonormal/unitary matrix from row/column compression ***//
+                if(leadvA)
+                    local_orgqrlq_ungqrlq_template<false, STRIDED>(
+                        handle, kk, kk, k, UV, shiftUV, lduv, strideUV, tau_splits, k, batch_count,
+                        scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr,
+                        row);
+                else
+                    local_orgqrlq_ungqrlq_template<BATCHED, STRIDED>(
+                        handle, m, n, k, A, shiftA, lda, strideA, tau_splits, k, batch_count,
+                        scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr,
+                        row);
+            }
 
             //*** STAGE 3: Bidiagonalization ***//
             // clean triangular factor
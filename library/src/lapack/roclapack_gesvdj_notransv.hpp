@@ -162,6 +162,8 @@ void rocsolver_gesvdj_notransv_getMemorySize(const rocblas_svect left_svect,
             *size_VUtmp = sizeof(T) * n * n * batch_count;
         if(!leftv)
             a2 = sizeof(T) * m * n * batch_count;
+        else if(m <= GEQR2_MAX_SMALL_SIZE(T))
+            a2 = sizeof(T) * n * n * batch_count;
     }
     else
     {
@@ -182,6 +184,8 @@ void rocsolver_gesvdj_notransv_getMemorySize(const rocblas_svect left_svect,
             *size_VUtmp = sizeof(T) * m * m * batch_count;
         if(!rightv)
             a2 = sizeof(T) * m * n * batch_count;
+        else if(n <= GEQR2_MAX_SMALL_SIZE(T))
+            a2 = sizeof(T) * m * m * batch_count;
     }
 
     // extra requirements for temporary Householder scalars
@@ -299,20 +303,38 @@ rocblas_status rocsolver_gesvdj_notransv_template(rocblas_handle handle,
                          shiftA, lda, strideA, V_gemm, 0, ldv_gemm, strideV_gemm, &zero, U_gemm, 0,
                          ldu_gemm, strideU_gemm, batch_count, (T**)work6_workArr);
 
-        // apply QR factorization to AV, obtaining U = Q and S = R
-        rocsolver_geqrf_template<false, STRIDED, T>(handle, m, n, U_gemm, 0, ldu_gemm, strideU_gemm,
-                                                    (T*)work5_ipiv, n, batch_count, scalars, work2,
-                                                    (T*)work3, (T*)work4, (T**)work6_workArr);
-
         rocblas_int blocks = (n - 1) / BS1 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
-                                0, stream, n, S, strideS, U_gemm, ldu_gemm, strideU_gemm, V_gemm,
-                                ldv_gemm, strideV_gemm);
-
-        if(leftv)
-            rocsolver_orgqr_ungqr_template<false, STRIDED, T>(
-                handle, m, (left_full ? m : n), n, U_gemm, 0, ldu_gemm, strideU_gemm, (T*)work5_ipiv,
-                n, batch_count, scalars, (T*)work2, (T*)work3, (T*)work4, (T**)work6_workArr);
+
+        if(leftv && m <= GEQR2_MAX_SMALL_SIZE(T))
+        {
+            // small matrices: factorize AV and generate U = Q with a single kernel launch,
+            // keeping S = R in work1
+            T* R = (T*)work1_UVtmp;
+            rocsolver_geqr2_org2r_small_template<T>(handle, m, n, (left_full ? m : n), U_gemm, 0,
+                                                    ldu_gemm, strideU_gemm, R, n, n * n,
+                                                    (T*)work5_ipiv, n, batch_count);
+
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, n, S, strideS, R, n, n * n, V_gemm,
+                                    ldv_gemm, strideV_gemm);
+        }
+        else
+        {
+            // apply QR factorization to AV, obtaining U = Q and S = R
+            rocsolver_geqrf_template<false, STRIDED, T>(
+                handle, m, n, U_gemm, 0, ldu_gemm, strideU_gemm, (T*)work5_ipiv, n, batch_count,
+                scalars, work2, (T*)work3, (T*)work4, (T**)work6_workArr);
+
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, n, S, strideS, U_gemm, ldu_gemm,
+                                    strideU_gemm, V_gemm, ldv_gemm, strideV_gemm);
+
+            if(leftv)
+                rocsolver_orgqr_ungqr_template<false, STRIDED, T>(
+                    handle, m, (left_full ? m : n), n, U_gemm, 0, ldu_gemm, strideU_gemm,
+                    (T*)work5_ipiv, n, batch_count, scalars, (T*)work2, (T*)work3, (T*)work4,
+                    (T**)work6_workArr);
+        }
     }
     else
     {
@@ -341,20 +363,38 @@ rocblas_status rocsolver_gesvdj_notransv_template(rocblas_handle handle,
                          m, m, &one, A, shiftA, lda, strideA, U_gemm, 0, ldu_gemm, strideU_gemm,
                          &zero, V_gemm, 0, ldv_gemm, strideV_gemm, batch_count, (T**)work6_workArr);
 
-        // apply QR factorization to A'U, obtaining V = Q and S = R
-        rocsolver_geqrf_template<false, STRIDED, T>(handle, n, m, V_gemm, 0, ldv_gemm, strideV_gemm,
-                                                    (T*)work5_ipiv, m, batch_count, scalars, work2,
-                                                    (T*)work3, (T*)work4, (T**)work6_workArr);
-
         rocblas_int blocks = (m - 1) / BS1 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
-                                0, stream, m, S, strideS, V_gemm, ldv_gemm, strideV_gemm, U_gemm,
-                                ldu_gemm, strideU_gemm);
-
-        if(rightv)
-            rocsolver_orgqr_ungqr_template<false, STRIDED, T>(
-                handle, n, (right_full ? n : m), m, V_gemm, 0, ldv_gemm, strideV_gemm, (T*)work5_ipiv,
-                m, batch_count, scalars, (T*)work2, (T*)work3, (T*)work4, (T**)work6_workArr);
+
+        if(rightv && n <= GEQR2_MAX_SMALL_SIZE(T))
+        {
+            // small matrices: factorize A'U and generate V = Q with a single kernel launch,
+            // keeping S = R in work1
+            T* R = (T*)work1_UVtmp;
+            rocsolver_geqr2_org2r_small_template<T>(handle, n, m, (right_full ? n : m), V_gemm, 0,
+                                                    ldv_gemm, strideV_gemm, R, m, m * m,
+                                                    (T*)work5_ipiv, m, batch_count);
+
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, m, S, strideS, R, m, m * m, U_gemm,
+                                    ldu_gemm, strideU_gemm);
+        }
+        else
+        {
+            // apply QR factorization to A'U, obtaining V = Q and S = R
+            rocsolver_geqrf_template<false, STRIDED, T>(
+                handle, n, m, V_gemm, 0, ldv_gemm, strideV_gemm, (T*)work5_ipiv, m, batch_count,
+                scalars, work2, (T*)work3, (T*)work4, (T**)work6_workArr);
+
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, m, S, strideS, V_gemm, ldv_gemm,
+                                    strideV_gemm, U_gemm, ldu_gemm, strideU_gemm);
+
+            if(rightv)
+                rocsolver_orgqr_ungqr_template<false, STRIDED, T>(
+                    handle, n, (right_full ? n : m), m, V_gemm, 0, ldv_gemm, strideV_gemm,
+                    (T*)work5_ipiv, m, batch_count, scalars, (T*)work2, (T*)work3, (T*)work4,
+                    (T**)work6_workArr);
+        }
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
@@ -0,0 +1,708 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lange.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+#define GESVX_ITMAX 5 // maximum number of iterative refinement steps (as in LAPACK's GERFS)
+#define GESVX_THRESH 0.1 // scaling is only applied if the ratio of scale factors is below this
+
+/** GESVX_EQUILIBRATE computes row and column scale factors R_l and C_l intended to
+    equilibrate the n-by-n matrices A_l (as in LAPACK's GEEQU), and decides whether the
+    equilibration is worth applying (as in LAPACK's LAQGE). If so, A_l is overwritten by
+    the equilibrated matrix. The applied equilibration is returned in equed.
+    Call this kernel with batch_count groups in y, and BS1 threads **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gesvx_equilibrate(const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               S* RR,
+                                                               const rocblas_stride strideR,
+                                                               S* CC,
+                                                               const rocblas_stride strideC,
+                                                               rocsolver_equed* equed,
+                                                               const S smlnum,
+                                                               const S eps)
+{
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    S* R = RR + b * strideR;
+    S* C = CC + b * strideC;
+
+    const S bignum = S(1) / smlnum;
+
+    __shared__ S sval[BS1];
+
+    // row scale factors
+    S rcmin = bignum;
+    S rcmax = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S r = 0;
+        for(rocblas_int j = 0; j < n; j++)
+            r = std::max(r, aabs<S>(A[i + j * lda]));
+        R[i] = r;
+        rcmin = std::min(rcmin, r);
+        rcmax = std::max(rcmax, r);
+    }
+    // (the minimum is reduced as the maximum of the negated values)
+    rcmin = -norm_block_reduce<true>(-rcmin, sval);
+    rcmax = norm_block_reduce<true>(rcmax, sval);
+    const S amax = rcmax;
+
+    // a zero row means that the matrix is singular; do not equilibrate
+    if(rcmin == 0)
+    {
+        if(tid == 0)
+            equed[b] = rocsolver_equed_none;
+        return;
+    }
+
+    for(rocblas_int i = tid; i < n; i += BS1)
+        R[i] = S(1) / std::min(std::max(R[i], smlnum), bignum);
+    const S rowcnd = std::max(rcmin, smlnum) / std::min(rcmax, bignum);
+    __syncthreads();
+
+    // column scale factors (of the row-scaled matrix)
+    rcmin = bignum;
+    rcmax = 0;
+    for(rocblas_int j = tid; j < n; j += BS1)
+    {
+        S c = 0;
+        for(rocblas_int i = 0; i < n; i++)
+            c = std::max(c, aabs<S>(A[i + j * lda]) * R[i]);
+        C[j] = S(1) / std::min(std::max(c, smlnum), bignum);
+        rcmin = std::min(rcmin, c);
+        rcmax = std::max(rcmax, c);
+    }
+    rcmin = -norm_block_reduce<true>(-rcmin, sval);
+    rcmax = norm_block_reduce<true>(rcmax, sval);
+
+    // a zero column means that the matrix is singular; do not equilibrate
+    if(rcmin == 0)
+    {
+        if(tid == 0)
+            equed[b] = rocsolver_equed_none;
+        return;
+    }
+    const S colcnd = std::max(rcmin, smlnum) / std::min(rcmax, bignum);
+
+    // decide which scaling to apply
+    const S small = smlnum / eps;
+    const S large = S(1) / small;
+    const bool rowequ = (rowcnd < S(GESVX_THRESH) || amax < small || amax > large);
+    const bool colequ = (colcnd < S(GESVX_THRESH));
+
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            if(rowequ && colequ)
+                A[i + j * lda] *= R[i] * C[j];
+            else if(rowequ)
+                A[i + j * lda] *= R[i];
+            else if(colequ)
+                A[i + j * lda] *= C[j];
+        }
+    }
+
+    if(tid == 0)
+        equed[b] = rowequ ? (colequ ? rocsolver_equed_both : rocsolver_equed_row)
+                          : (colequ ? rocsolver_equed_col : rocsolver_equed_none);
+}
+
+/** GESVX_SCALE multiplies the rows of the m-by-n matrices M_l by the scale factors D_l,
+    but only if the equilibration equed[l] includes the scaling indicated by which
+    (rocsolver_equed_row or rocsolver_equed_col) **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gesvx_scale(const rocsolver_equed which,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  U MM,
+                                  const rocblas_int shiftM,
+                                  const rocblas_int ldm,
+                                  const rocblas_stride strideM,
+                                  const S* DD,
+                                  const rocblas_stride strideD,
+                                  const rocsolver_equed* equed)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    const rocsolver_equed eq = equed[b];
+
+    if(i < m && j < n && (eq == which || eq == rocsolver_equed_both))
+    {
+        T* M = load_ptr_batch<T>(MM, b, shiftM, strideM);
+        const S* D = DD + b * strideD;
+        M[i + j * ldm] *= D[i];
+    }
+}
+
+/** GESVX_BERR computes the component-wise relative backward errors of the current
+    solutions X_l[:,j] given the residuals W_l[:,j] = B_l[:,j] - op(A_l)*X_l[:,j]
+    (as in LAPACK's GERFS), and decides whether another refinement step is performed.
+    The residuals of the columns that are not refined anymore are set to zero, so that
+    the following correction leaves the solution unchanged. W_l has dimension n-by-nrhs
+    with leading dimension n. The state of the refinement is kept in the arrays lstres
+    (the last backward error) and count (the number of the next step, or -1 if finished).
+    Call this kernel with nrhs groups in x, batch_count groups in y, and BS1 threads **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gesvx_berr(const rocblas_int k,
+                                                        const rocblas_operation trans,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        U AA,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        U BB,
+                                                        const rocblas_int shiftB,
+                                                        const rocblas_int ldb,
+                                                        const rocblas_stride strideB,
+                                                        U XX,
+                                                        const rocblas_int shiftX,
+                                                        const rocblas_int ldx,
+                                                        const rocblas_stride strideX,
+                                                        T* WW,
+                                                        S* berrA,
+                                                        const rocblas_stride strideBerr,
+                                                        S* lstresA,
+                                                        rocblas_int* countA,
+                                                        const rocblas_int* info,
+                                                        const S eps,
+                                                        const S safe1,
+                                                        const S safe2)
+{
+    const auto j = hipBlockIdx_x;
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+
+    const rocblas_stride idx = b * rocblas_stride(nrhs) + j;
+    T* W = WW + b * rocblas_stride(n) * nrhs + j * rocblas_stride(n);
+    S* berr = berrA + b * strideBerr;
+
+    __shared__ S sval[BS1];
+
+    // singular instances are not refined
+    rocblas_int count = (k == 0) ? (info[b] == 0 ? 1 : -1) : countA[idx];
+    if(k == 0 && count < 0 && tid == 0)
+    {
+        berr[j] = 0;
+        countA[idx] = -1;
+    }
+
+    if(count < 0)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            W[i] = 0;
+        return;
+    }
+
+    const S lstres = (k == 0) ? S(3) : lstresA[idx];
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* Bj = load_ptr_batch<T>(BB, b, shiftB, strideB) + j * rocblas_stride(ldb);
+    T* Xj = load_ptr_batch<T>(XX, b, shiftX, strideX) + j * rocblas_stride(ldx);
+
+    // max_i |W(i)| / (|B(i)| + (|op(A)|*|X|)(i)), avoiding division by tiny numbers
+    S s = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S w = aabs<S>(Bj[i]);
+        if(trans == rocblas_operation_none)
+        {
+            for(rocblas_int kk = 0; kk < n; kk++)
+                w += aabs<S>(A[i + kk * lda]) * aabs<S>(Xj[kk]);
+        }
+        else
+        {
+            for(rocblas_int kk = 0; kk < n; kk++)
+                w += aabs<S>(A[kk + i * lda]) * aabs<S>(Xj[kk]);
+        }
+
+        const S r = aabs<S>(W[i]);
+        const S v = (w > safe2) ? r / w : (r + safe1) / (w + safe1);
+        s = (v > s) ? v : s;
+    }
+    s = norm_block_reduce<true>(s, sval);
+
+    // refine while the backward error is larger than eps and has been at least halved
+    const bool refine = (s > eps && 2 * s <= lstres && count <= GESVX_ITMAX);
+
+    if(!refine)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            W[i] = 0;
+    }
+
+    if(tid == 0)
+    {
+        berr[j] = s;
+        lstresA[idx] = s;
+        countA[idx] = refine ? count + 1 : -1;
+    }
+}
+
+/** GESVX_UPDATE sets X_l = X_l + W_l, where W_l has dimension m-by-n with leading
+    dimension m **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gesvx_update(const rocblas_int m,
+                                   const rocblas_int n,
+                                   U XX,
+                                   const rocblas_int shiftX,
+                                   const rocblas_int ldx,
+                                   const rocblas_stride strideX,
+                                   T* WW)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m && j < n)
+    {
+        T* X = load_ptr_batch<T>(XX, b, shiftX, strideX);
+        X[i + j * ldx] += WW[b * rocblas_stride(m) * n + i + j * rocblas_stride(m)];
+    }
+}
+
+/** GESVX_SET_INFO sets rcond = 0 for the singular instances, and info = n+1 for the
+    instances that are singular to working precision (rcond < eps) **/
+template <typename S>
+ROCSOLVER_KERNEL void gesvx_set_info(const rocblas_int n,
+                                     S* rcond,
+                                     rocblas_int* info,
+                                     const S eps,
+                                     const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        if(info[b] != 0)
+            rcond[b] = 0;
+        else if(rcond[b] < eps)
+            info[b] = n + 1;
+    }
+}
+
+/** GESVX_SOLVE overwrites the corrections W with op(inv(A))*W, where A is given by its
+    LU factorization. In the batched case, the corrections are addressed through the
+    array of pointers workArr. **/
+template <bool BATCHED, bool STRIDED, typename T>
+void gesvx_solve(rocblas_handle handle,
+                 const rocblas_operation trans,
+                 const rocblas_int n,
+                 const rocblas_int nrhs,
+                 T* A,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 const rocblas_int* ipiv,
+                 const rocblas_stride strideP,
+                 T* W,
+                 T** workArr,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(
+        handle, trans, n, nrhs, A, shiftA, 1, lda, strideA, ipiv, strideP, W, 0, 1, n,
+        rocblas_stride(n) * nrhs, batch_count, work1, work2, work3, work4, optim_mem, true);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void gesvx_solve(rocblas_handle handle,
+                 const rocblas_operation trans,
+                 const rocblas_int n,
+                 const rocblas_int nrhs,
+                 T* const A[],
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 const rocblas_int* ipiv,
+                 const rocblas_stride strideP,
+                 T* W,
+                 T** workArr,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(BS1), 0, stream, workArr, W,
+                            rocblas_stride(n) * nrhs, batch_count);
+
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(
+        handle, trans, n, nrhs, A, shiftA, 1, lda, strideA, ipiv, strideP, (T* const*)workArr, 0,
+        1, n, 0, batch_count, work1, work2, work3, work4, optim_mem, true);
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gesvx_argCheck(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldaf,
+                                        const rocblas_int ldb,
+                                        const rocblas_int ldx,
+                                        T A,
+                                        T AF,
+                                        const rocblas_int* ipiv,
+                                        const rocsolver_equed* equed,
+                                        const S* R,
+                                        const S* C,
+                                        T B,
+                                        T X,
+                                        const S* rcond,
+                                        const S* berr,
+                                        const rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldaf < n || ldb < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !AF) || (n && !ipiv) || (n && !R) || (n && !C) || (nrhs && n && !B)
+       || (nrhs && n && !X) || (nrhs && !berr) || (batch_count && !equed)
+       || (batch_count && !rcond) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gesvx_getMemorySize(const rocblas_operation trans,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_pivotval,
+                                   size_t* size_pivotidx,
+                                   size_t* size_iipiv,
+                                   size_t* size_iinfo,
+                                   size_t* size_anorm,
+                                   size_t* size_W,
+                                   size_t* size_isgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_lstres,
+                                   size_t* size_count,
+                                   size_t* size_workArr,
+                                   bool* optim_mem,
+                                   const rocblas_int ldaf = 1,
+                                   const rocblas_int ldx = 1)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_anorm = 0;
+        *size_W = 0;
+        *size_isgn = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_lstres = 0;
+        *size_count = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3, opt4;
+    size_t unused, w1, w2, w3, w4;
+
+    // workspace required for calling GETRF
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T>(
+        n, n, true, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, &opt1, ldaf);
+
+    // workspace required for calling GETRS on the solutions and on the corrections
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(trans, n, nrhs, batch_count, &w1, &w2, &w3,
+                                                       &w4, &opt2, ldaf, ldx);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(trans, n, nrhs, batch_count, &w1, &w2, &w3,
+                                                       &w4, &opt3, ldaf, n);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // workspace required for calling GECON
+    // (the work vectors of the estimator are stored in the array of residuals W)
+    rocsolver_gecon_getMemorySize<BATCHED, STRIDED, T, S>(n, batch_count, &w1, &w2, &w3, &w4,
+                                                          &unused, size_isgn, size_est, size_state,
+                                                          size_workArr, &opt4, ldaf);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    *optim_mem = opt1 && opt2 && opt3 && opt4;
+
+    // norms of the equilibrated matrices
+    *size_anorm = sizeof(S) * batch_count;
+
+    // residuals and corrections of the refinement, and state of the refinement
+    *size_W = sizeof(T) * n * std::max(nrhs, 1) * batch_count;
+    *size_lstres = sizeof(S) * nrhs * batch_count;
+    *size_count = sizeof(rocblas_int) * nrhs * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gesvx_template(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U AF,
+                                        const rocblas_int shiftAF,
+                                        const rocblas_int ldaf,
+                                        const rocblas_stride strideAF,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocsolver_equed* equed,
+                                        S* R,
+                                        const rocblas_stride strideR,
+                                        S* C,
+                                        const rocblas_stride strideC,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        U X,
+                                        const rocblas_int shiftX,
+                                        const rocblas_int ldx,
+                                        const rocblas_stride strideX,
+                                        S* rcond,
+                                        S* berr,
+                                        const rocblas_stride strideBerr,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        void* pivotval,
+                                        rocblas_int* pivotidx,
+                                        rocblas_int* iipiv,
+                                        rocblas_int* iinfo,
+                                        S* anorm,
+                                        T* W,
+                                        rocblas_int* isgn,
+                                        S* est,
+                                        rocblas_int* state,
+                                        S* lstres,
+                                        rocblas_int* count,
+                                        T** workArr,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gesvx", "trans:", trans, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftAF:", shiftAF, "ldaf:", ldaf, "shiftB:", shiftB,
+                    "ldb:", ldb, "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A is empty
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T minone = -1;
+    T one = 1;
+
+    // constants in host memory
+    const rocblas_int copyblocksx = (n - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+    const rocblas_stride strideW = rocblas_stride(n) * nrhs;
+    const S eps = get_epsilon<S>();
+    const S safemin = get_safemin<S>();
+    const S safe1 = (n + 1) * safemin;
+    const S safe2 = safe1 / eps;
+
+    // the row scaling applies to the right-hand sides of A*X = B, and the column scaling to
+    // those of A'*X = B (and vice versa for the solutions)
+    const bool notrans = (trans == rocblas_operation_none);
+    const rocsolver_equed bscale = notrans ? rocsolver_equed_row : rocsolver_equed_col;
+    const rocsolver_equed xscale = notrans ? rocsolver_equed_col : rocsolver_equed_row;
+    S* Db = notrans ? R : C;
+    S* Dx = notrans ? C : R;
+    const rocblas_stride strideDb = notrans ? strideR : strideC;
+    const rocblas_stride strideDx = notrans ? strideC : strideR;
+
+    // equilibrate A and factorize it into AF
+    ROCSOLVER_LAUNCH_KERNEL((gesvx_equilibrate<T>), dim3(1, batch_count), threads, 0, stream, n,
+                            A, shiftA, lda, strideA, R, strideR, C, strideC, equed, safemin, eps);
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksx, batch_count),
+                            dim3(32, 32), 0, stream, n, n, A, shiftA, lda, strideA, AF, shiftAF,
+                            ldaf, strideAF);
+
+    rocsolver_getrf_template<BATCHED, STRIDED, T>(
+        handle, n, n, AF, shiftAF, 1, ldaf, strideAF, ipiv, 0, strideP, info, batch_count, scalars,
+        work1, work2, work3, work4, (T*)pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+
+    // estimate the reciprocal condition numbers of the equilibrated matrices
+    const rocsolver_norm_type norm = notrans ? rocsolver_norm_one : rocsolver_norm_inf;
+    rocsolver_lange_template<T>(handle, norm, n, n, A, shiftA, lda, strideA, anorm, batch_count);
+    rocsolver_gecon_template<BATCHED, STRIDED, T>(handle, norm, n, AF, shiftAF, ldaf, strideAF,
+                                                  anorm, rcond, batch_count, work1, work2, work3,
+                                                  work4, W, isgn, est, state, workArr, optim_mem);
+
+    if(nrhs > 0)
+    {
+        // scale the right-hand sides and find the initial solutions
+        ROCSOLVER_LAUNCH_KERNEL((gesvx_scale<T>), dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, bscale, n, nrhs, B, shiftB, ldb, strideB,
+                                Db, strideDb, equed);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, X,
+                                shiftX, ldx, strideX);
+
+        rocsolver_getrs_template<BATCHED, STRIDED, T>(
+            handle, trans, n, nrhs, AF, shiftAF, 1, ldaf, strideAF, ipiv, strideP, X, shiftX, 1,
+            ldx, strideX, batch_count, work1, work2, work3, work4, optim_mem, true);
+
+        // iterative refinement; as the instances cannot be synchronized with the host, the
+        // maximum number of steps is always executed, and the columns that have finished
+        // receive null corrections
+        for(rocblas_int k = 0; k <= GESVX_ITMAX; k++)
+        {
+            // compute residuals W = B - op(A)*X
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                    dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, W,
+                                    0, n, strideW);
+            rocblasCall_gemm(handle, trans, rocblas_operation_none, n, nrhs, n, &minone, A, shiftA,
+                             lda, strideA, X, shiftX, ldx, strideX, &one, W, 0, n, strideW,
+                             batch_count, workArr);
+
+            // compute backward errors and check convergence
+            ROCSOLVER_LAUNCH_KERNEL((gesvx_berr<T>), dim3(nrhs, batch_count), threads, 0, stream,
+                                    k, trans, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb,
+                                    strideB, X, shiftX, ldx, strideX, W, berr, strideBerr, lstres,
+                                    count, info, eps, safe1, safe2);
+
+            // compute corrections and update solutions
+            if(k < GESVX_ITMAX)
+            {
+                gesvx_solve<BATCHED, STRIDED, T>(handle, trans, n, nrhs, AF, shiftAF, ldaf,
+                                                 strideAF, ipiv, strideP, W, workArr, batch_count,
+                                                 work1, work2, work3, work4, optim_mem);
+                ROCSOLVER_LAUNCH_KERNEL((gesvx_update<T>),
+                                        dim3(copyblocksx, copyblocksy, batch_count), dim3(32, 32),
+                                        0, stream, n, nrhs, X, shiftX, ldx, strideX, W);
+            }
+        }
+
+        // transform the solutions back to the original system
+        ROCSOLVER_LAUNCH_KERNEL((gesvx_scale<T>), dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, xscale, n, nrhs, X, shiftX, ldx, strideX,
+                                Dx, strideDx, equed);
+    }
+
+    // flag the matrices that are singular to working precision
+    ROCSOLVER_LAUNCH_KERNEL(gesvx_set_info<S>, gridReset, threads, 0, stream, n, rcond, info, eps,
+                            batch_count);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
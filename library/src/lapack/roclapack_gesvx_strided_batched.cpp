@@ -0,0 +1,331 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gesvx.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gesvx_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_operation trans,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U AF,
+                                                    const rocblas_int ldaf,
+                                                    const rocblas_stride strideAF,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocsolver_equed* equed,
+                                                    S* R,
+                                                    const rocblas_stride strideR,
+                                                    S* C,
+                                                    const rocblas_stride strideC,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U X,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    S* rcond,
+                                                    S* berr,
+                                                    const rocblas_stride strideBerr,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gesvx_strided_batched", "--trans", trans, "-n", n, "--nrhs", nrhs, "--lda",
+                        lda, "--strideA", strideA, "--ldaf", ldaf, "--strideAF", strideAF,
+                        "--strideP", strideP, "--strideR", strideR, "--strideC", strideC, "--ldb",
+                        ldb, "--strideB", strideB, "--ldx", ldx, "--strideX", strideX,
+                        "--strideBerr", strideBerr, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gesvx_argCheck(handle, trans, n, nrhs, lda, ldaf, ldb, ldx, A, AF,
+                                                 ipiv, equed, R, C, B, X, rcond, berr, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftAF = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftX = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling GETRF, GETRS and GECON)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETRF
+    size_t size_pivotval, size_pivotidx, size_iipiv, size_iinfo;
+    // size for the norms, the residuals and the state of the condition estimator
+    size_t size_anorm, size_W, size_isgn, size_est, size_state;
+    // size for the state of the refinement
+    size_t size_lstres, size_count;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_gesvx_getMemorySize<false, true, T, S>(
+        trans, n, nrhs, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3,
+        &size_work4, &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &size_anorm,
+        &size_W, &size_isgn, &size_est, &size_state, &size_lstres, &size_count, &size_workArr,
+        &optim_mem, ldaf, ldx);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_pivotval,
+            size_pivotidx, size_iipiv, size_iinfo, size_anorm, size_W, size_isgn, size_est,
+            size_state, size_lstres, size_count, size_workArr);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iipiv, *iinfo, *anorm,
+        *W, *isgn, *est, *state, *lstres, *count, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo, size_anorm,
+                              size_W, size_isgn, size_est, size_state, size_lstres, size_count,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    anorm = mem[9];
+    W = mem[10];
+    isgn = mem[11];
+    est = mem[12];
+    state = mem[13];
+    lstres = mem[14];
+    count = mem[15];
+    workArr = mem[16];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    auto launch = [&]() {
+        return rocsolver_gesvx_template<false, true, T>(
+            handle, trans, n, nrhs, A, shiftA, lda, strideA, AF, shiftAF, ldaf, strideAF, ipiv,
+            strideP, equed, R, strideR, C, strideC, B, shiftB, ldb, strideB, X, shiftX, ldx,
+            strideX, rcond, berr, strideBerr, info, batch_count, (T*)scalars, work1, work2, work3,
+            work4, pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iipiv, (rocblas_int*)iinfo,
+            (S*)anorm, (T*)W, (rocblas_int*)isgn, (S*)est, (rocblas_int*)state, (S*)lstres,
+            (rocblas_int*)count, (T**)workArr, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "gesvx_strided_batched", launch, trans, n, nrhs, A,
+                                         lda, strideA, AF, ldaf, strideAF, ipiv, strideP, equed, R,
+                                         strideR, C, strideC, B, ldb, strideB, X, ldx, strideX,
+                                         rcond, berr, strideBerr, info, batch_count, scalars, work1,
+                                         work2, work3, work4, pivotval, pivotidx, iipiv, iinfo,
+                                         anorm, W, isgn, est, state, lstres, count, workArr);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgesvx_strided_batched(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* AF,
+                                                const rocblas_int ldaf,
+                                                const rocblas_stride strideAF,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocsolver_equed* equed,
+                                                float* R,
+                                                const rocblas_stride strideR,
+                                                float* C,
+                                                const rocblas_stride strideC,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                float* X,
+                                                const rocblas_int ldx,
+                                                const rocblas_stride strideX,
+                                                float* rcond,
+                                                float* berr,
+                                                const rocblas_stride strideBerr,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesvx_strided_batched_impl<float>(handle, trans, n, nrhs, A, lda,
+                                                                  strideA, AF, ldaf, strideAF, ipiv,
+                                                                  strideP, equed, R, strideR, C,
+                                                                  strideC, B, ldb, strideB, X, ldx,
+                                                                  strideX, rcond, berr, strideBerr,
+                                                                  info, batch_count);
+}
+
+rocblas_status rocsolver_dgesvx_strided_batched(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* AF,
+                                                const rocblas_int ldaf,
+                                                const rocblas_stride strideAF,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocsolver_equed* equed,
+                                                double* R,
+                                                const rocblas_stride strideR,
+                                                double* C,
+                                                const rocblas_stride strideC,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                double* X,
+                                                const rocblas_int ldx,
+                                                const rocblas_stride strideX,
+                                                double* rcond,
+                                                double* berr,
+                                                const rocblas_stride strideBerr,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesvx_strided_batched_impl<double>(handle, trans, n, nrhs, A, lda,
+                                                                   strideA, AF, ldaf, strideAF,
+                                                                   ipiv, strideP, equed, R, strideR,
+                                                                   C, strideC, B, ldb, strideB, X,
+                                                                   ldx, strideX, rcond, berr,
+                                                                   strideBerr, info, batch_count);
+}
+
+rocblas_status rocsolver_cgesvx_strided_batched(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_float_complex* AF,
+                                                const rocblas_int ldaf,
+                                                const rocblas_stride strideAF,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocsolver_equed* equed,
+                                                float* R,
+                                                const rocblas_stride strideR,
+                                                float* C,
+                                                const rocblas_stride strideC,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_float_complex* X,
+                                                const rocblas_int ldx,
+                                                const rocblas_stride strideX,
+                                                float* rcond,
+                                                float* berr,
+                                                const rocblas_stride strideBerr,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesvx_strided_batched_impl<rocblas_float_complex>(handle, trans, n,
+                                                                                  nrhs, A, lda,
+                                                                                  strideA, AF, ldaf,
+                                                                                  strideAF, ipiv,
+                                                                                  strideP, equed, R,
+                                                                                  strideR, C,
+                                                                                  strideC, B, ldb,
+                                                                                  strideB, X, ldx,
+                                                                                  strideX, rcond,
+                                                                                  berr, strideBerr,
+                                                                                  info,
+                                                                                  batch_count);
+}
+
+rocblas_status rocsolver_zgesvx_strided_batched(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_double_complex* AF,
+                                                const rocblas_int ldaf,
+                                                const rocblas_stride strideAF,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocsolver_equed* equed,
+                                                double* R,
+                                                const rocblas_stride strideR,
+                                                double* C,
+                                                const rocblas_stride strideC,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_double_complex* X,
+                                                const rocblas_int ldx,
+                                                const rocblas_stride strideX,
+                                                double* rcond,
+                                                double* berr,
+                                                const rocblas_stride strideBerr,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesvx_strided_batched_impl<rocblas_double_complex>(handle, trans, n,
+                                                                                   nrhs, A, lda,
+                                                                                   strideA, AF,
+                                                                                   ldaf, strideAF,
+                                                                                   ipiv, strideP,
+                                                                                   equed, R,
+                                                                                   strideR, C,
+                                                                                   strideC, B, ldb,
+                                                                                   strideB, X, ldx,
+                                                                                   strideX, rcond,
+                                                                                   berr, strideBerr,
+                                                                                   info,
+                                                                                   batch_count);
+}
+}
@@ -0,0 +1,155 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GETDET_KERNEL reduces the diagonal of a triangular factor, and the row interchanges
+    if any, to the logarithm of the absolute value of the determinant (times scale) and
+    its sign (phase in the complex case). Each instance of the batch is processed by a
+    thread block. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) getdet_kernel(const rocblas_int n,
+                                                           U AA,
+                                                           const rocblas_int shiftA,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const rocblas_int* ipivA,
+                                                           const rocblas_stride strideP,
+                                                           const S scale,
+                                                           S* logdetA,
+                                                           T* signA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    const rocblas_int* ipiv = (ipivA != nullptr ? ipivA + bid * strideP : nullptr);
+
+    __shared__ S slog[BS1];
+    __shared__ T ssign[BS1];
+
+    // each thread reduces a part of the diagonal
+    S lval = 0;
+    T sval = 1;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        T d = A[i + i * static_cast<int64_t>(lda)];
+        S ad = std::abs(d);
+        lval += std::log(ad);
+        sval = (ad == 0) ? T(0) : sval * (d / ad);
+        if(ipiv && ipiv[i] != i + 1)
+            sval = -sval;
+    }
+    slog[tid] = lval;
+    ssign[tid] = sval;
+    __syncthreads();
+
+    // reduction in shared memory
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            slog[tid] += slog[tid + i];
+            ssign[tid] *= ssign[tid + i];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        logdetA[bid] = scale * slog[0];
+        if(signA)
+            signA[bid] = ssign[0];
+    }
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getdet_argCheck(rocblas_handle handle,
+                                         const rocblas_int n,
+                                         const rocblas_int lda,
+                                         U A,
+                                         const rocblas_int* ipiv,
+                                         S* logdet,
+                                         T* sign,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (batch_count && !logdet) || (batch_count && !sign))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getdet_template(rocblas_handle handle,
+                                         const rocblas_int n,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const rocblas_int* ipiv,
+                                         const rocblas_stride strideP,
+                                         S* logdet,
+                                         T* sign,
+                                         const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getdet", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // (if n = 0, logdet = 0 and sign = 1)
+    ROCSOLVER_LAUNCH_KERNEL((getdet_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, n, A, shiftA, lda, strideA, ipiv, strideP, S(1), logdet, sign);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -32,10 +32,12 @@
 
 #pragma once
 
+#include "auxiliary/rocauxiliary_laswp.hpp"
 #include "rocblas.hpp"
 #include "roclapack_getf2.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_side_stream.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -442,6 +444,105 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
     return blk;
 }
 
+/** This function decides whether a block panel is factorized with the recursive
+    algorithm. A negative inner block size selects it explicitly; otherwise the
+    crossover is given by GETRF_RECURSIVE_MIN_ROWS and GETRF_RECURSIVE_MIN_RATIO.
+    On return, blk is the width of the sub-panels factorized with getf2. **/
+template <bool ISBATCHED, typename I>
+bool getrf_use_recursive_panel(const I mm, const I nn, I& blk)
+{
+    if(blk < 0)
+    {
+        blk = -blk;
+        return nn > blk;
+    }
+
+    return !ISBATCHED && nn > blk && mm >= GETRF_RECURSIVE_MIN_ROWS
+        && mm / nn >= GETRF_RECURSIVE_MIN_RATIO;
+}
+
+/** This is the recursive factorization of a block panel (Toledo's algorithm).
+    The panel is split by columns; the left half is factorized recursively, the
+    right half is updated with trsm and gemm, and then factorized recursively.
+    Row interchanges are only applied within the columns of the panel.
+    (shiftA and shiftP point to the first row and column of the whole matrix;
+    the panel has nn columns starting at row/column j, and the matrix has m rows) **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_panelLU_recursive(rocblas_handle handle,
+                                       const I m,
+                                       const I j,
+                                       const I nn,
+                                       const I blk,
+                                       U A,
+                                       const rocblas_stride shiftA,
+                                       const I inca,
+                                       const I lda,
+                                       const rocblas_stride strideA,
+                                       I* ipiv,
+                                       const rocblas_stride shiftP,
+                                       const rocblas_stride strideP,
+                                       INFO* info,
+                                       const I batch_count,
+                                       T* scalars,
+                                       void* work1,
+                                       void* work2,
+                                       void* work3,
+                                       void* work4,
+                                       const bool optim_mem,
+                                       T* pivotval,
+                                       I* pivotidx)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    // narrow panels are factorized directly
+    if(nn <= blk)
+        return rocsolver_getf2_template<ISBATCHED, T>(
+            handle, m - j, nn, A, shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, ipiv,
+            shiftP + j, strideP, info, batch_count, scalars, pivotval, pivotidx, true, j);
+
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    // the left half is a multiple of blk
+    I n1 = std::max(blk, (nn / (2 * blk)) * blk);
+    I n2 = nn - n1;
+
+    // factorize left half
+    getrf_panelLU_recursive<BATCHED, STRIDED, T>(handle, m, j, n1, blk, A, shiftA, inca, lda,
+                                                 strideA, ipiv, shiftP, strideP, info, batch_count,
+                                                 scalars, work1, work2, work3, work4, optim_mem,
+                                                 pivotval, pivotidx);
+
+    // apply its row interchanges to the right half, and update the right half
+    rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, j + n1, inca, lda), inca, lda,
+                                strideA, j + 1, j + n1, ipiv, shiftP, I(1), strideP, batch_count);
+
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, n1, n2, A,
+        shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, A,
+        shiftA + idx2D(j, j + n1, inca, lda), inca, lda, strideA, batch_count, optim_mem, work1,
+        work2, work3, work4);
+
+    rocsolver_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_none, rocblas_operation_none, m - j - n1, n2, n1, &minone, A,
+        shiftA + idx2D(j + n1, j, inca, lda), inca, lda, strideA, A,
+        shiftA + idx2D(j, j + n1, inca, lda), inca, lda, strideA, &one, A,
+        shiftA + idx2D(j + n1, j + n1, inca, lda), inca, lda, strideA, batch_count, (T**)nullptr);
+
+    // factorize right half
+    getrf_panelLU_recursive<BATCHED, STRIDED, T>(handle, m, j + n1, n2, blk, A, shiftA, inca, lda,
+                                                 strideA, ipiv, shiftP, strideP, info, batch_count,
+                                                 scalars, work1, work2, work3, work4, optim_mem,
+                                                 pivotval, pivotidx);
+
+    // apply its row interchanges to the left half
+    rocsolver_laswp_template<T>(handle, n1, A, shiftA + idx2D(0, j, inca, lda), inca, lda, strideA,
+                                j + n1 + 1, j + nn, ipiv, shiftP, I(1), strideP, batch_count);
+
+    return rocblas_status_success;
+}
+
 /** This is the implementation of the factorization of the
     panel blocks in getrf **/
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
@@ -470,7 +571,8 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
                              I* pivotidx,
                              const I offset,
                              I* permut_idx,
-                             const rocblas_stride stridePI)
+                             const rocblas_stride stridePI,
+                             const bool swap_panel_only = false)
 {
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
@@ -491,6 +593,32 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
     dim3 grid, threads;
     size_t lmemsize;
 
+    // tall panels are factorized recursively
+    if(pivot && getrf_use_recursive_panel<ISBATCHED>(mm, nn, blk))
+    {
+        // position of the first row and column of the matrix, and of the first pivot
+        rocblas_stride shiftO = r_shiftA - offset * inca;
+        rocblas_stride shiftPO = shiftP - offset;
+
+        getrf_panelLU_recursive<BATCHED, STRIDED, T>(
+            handle, mm + offset, offset, nn, blk, A, shiftO, inca, lda, strideA, ipiv, shiftPO,
+            strideP, info, batch_count, scalars, work1, work2, work3, work4, optim_mem, pivotval,
+            pivotidx);
+
+        // apply the row interchanges to the columns on both sides of the panel
+        if(!swap_panel_only)
+        {
+            rocsolver_laswp_template<T>(handle, offset, A, shiftO, inca, lda, strideA, offset + 1,
+                                        offset + nn, ipiv, shiftPO, I(1), strideP, batch_count);
+            rocsolver_laswp_template<T>(handle, n - offset - nn, A,
+                                        shiftO + idx2D(0, offset + nn, inca, lda), inca, lda,
+                                        strideA, offset + 1, offset + nn, ipiv, shiftPO, I(1),
+                                        strideP, batch_count);
+        }
+
+        return rocblas_status_success;
+    }
+
     // Main loop
     for(I k = 0; k < nn; k += blk)
     {
@@ -503,17 +631,25 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
                                                offset + k, permut_idx, stridePI);
         if(pivot)
         {
+            // (when swap_panel_only is true, the rows are swapped only in the columns of
+            // the panel; the caller is responsible for permuting the rest of the matrix)
+            I ncols = swap_panel_only ? nn : n;
             dimx = jb;
             dimy = I(1024) / dimx;
-            blocks = (n - jb - 1) / dimy + 1;
+            blocks = (ncols - jb - 1) / dimy + 1;
             grid = dim3(1, blocks, batch_count);
             threads = dim3(dimx, dimy, 1);
             lmemsize = dimx * dimy * sizeof(T);
 
             // swap rows
-            ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream, n,
-                                    offset + k, jb, A, r_shiftA + k * inca, inca, lda, strideA,
-                                    permut_idx, stridePI);
+            if(swap_panel_only)
+                ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream,
+                                        nn, k, jb, A, shiftA + k * inca, inca, lda, strideA,
+                                        permut_idx, stridePI);
+            else
+                ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream,
+                                        n, offset + k, jb, A, r_shiftA + k * inca, inca, lda,
+                                        strideA, permut_idx, stridePI);
         }
 
         // update trailing sub-block
@@ -681,14 +817,31 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                                                       ipiv, shiftP, strideP, info, batch_count,
                                                       scalars, pivotval, pivotidx, pivot);
 
+    // with look-ahead, the next block panel is factorized while the rest of the
+    // trailing matrix is updated in a secondary stream
+    // (the largest update in the secondary stream is that of the first iteration)
+    T one = 1;
+    T minone = -1;
+    bool lookahead = !ISBATCHED && pivot && dim >= GETRF_LOOKAHEAD_MIN_SIZE;
+    rocsolver_side_stream side(handle);
+    if(lookahead)
+    {
+        I bs = std::abs(blk);
+        ROCBLAS_CHECK(side.init([&](rocblas_handle h) {
+            return rocblasCall_gemm(h, rocblas_operation_none, rocblas_operation_none, m - bs,
+                                    std::max(n - 2 * bs, I(0)), bs, &minone, A, shiftA, lda,
+                                    strideA, A, shiftA, lda, strideA, &one, A, shiftA, lda,
+                                    strideA, batch_count, (T**)nullptr);
+        }));
+        lookahead = side.active();
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
-    T one = 1;
-    T minone = -1;
 
-    I jb, dimx, dimy;
+    I jb, jbn, dimx, dimy;
     I nextpiv, mm, nn;
     size_t lmemsize;
     I j = 0;
@@ -702,12 +855,20 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         blk = -blk;
     }
 
+    // factorized indicates that the current block panel was already factorized in the
+    // previous iteration (look-ahead)
+    bool factorized = false;
+
     // MAIN LOOP
     for(I j = 0; j < dim; j += blk)
     {
         jb = std::min(dim - j, blk);
 
-        if(pivot || panel)
+        if(factorized)
+        {
+            factorized = false;
+        }
+        else if(pivot || panel)
         {
             // factorize outer block panel
             getrf_panelLU<BATCHED, STRIDED, T>(handle, m - j, jb, n, A, shiftA + j * inca, inca,
@@ -743,7 +904,45 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                 shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, batch_count, optim_mem,
                 work1, work2, work3, work4);
 
-            if(nextpiv < m)
+            jbn = std::min(dim - nextpiv, blk); //size of the next block panel
+            if(lookahead && nextpiv < dim && jbn < nn)
+            {
+                // update the next block panel first
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, mm, jbn, jb, &minone,
+                    A, shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+                    shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, &one, A,
+                    shiftA + idx2D(nextpiv, nextpiv, inca, lda), inca, lda, strideA, batch_count,
+                    (T**)nullptr);
+
+                // update the rest of the trailing matrix in the secondary stream
+                ROCBLAS_CHECK(side.begin());
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    side.get_handle(), rocblas_operation_none, rocblas_operation_none, mm, nn - jbn,
+                    jb, &minone, A, shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+                    shiftA + idx2D(j, nextpiv + jbn, inca, lda), inca, lda, strideA, &one, A,
+                    shiftA + idx2D(nextpiv, nextpiv + jbn, inca, lda), inca, lda, strideA,
+                    batch_count, (T**)nullptr);
+
+                // meanwhile, factorize the next block panel (the rows are swapped only
+                // in the columns of the panel, as the rest of the matrix is being updated)
+                getrf_panelLU<BATCHED, STRIDED, T>(
+                    handle, m - nextpiv, jbn, n, A, shiftA + nextpiv * inca, inca, lda, strideA,
+                    ipiv, shiftP + nextpiv, strideP, info, batch_count, pivot, scalars, work1,
+                    work2, work3, work4, optim_mem, pivotval, pivotidx, nextpiv, iipiv, m, true);
+                ROCBLAS_CHECK(side.join());
+
+                // apply the row interchanges to the columns on both sides of the panel
+                rocsolver_laswp_template<T>(handle, nextpiv, A, shiftA, inca, lda, strideA,
+                                            nextpiv + 1, nextpiv + jbn, ipiv, shiftP, I(1),
+                                            strideP, batch_count);
+                rocsolver_laswp_template<T>(handle, nn - jbn, A,
+                                            shiftA + idx2D(0, nextpiv + jbn, inca, lda), inca,
+                                            lda, strideA, nextpiv + 1, nextpiv + jbn, ipiv,
+                                            shiftP, I(1), strideP, batch_count);
+                factorized = true;
+            }
+            else if(nextpiv < m)
             {
                 rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, rocblas_operation_none, mm, nn, jb, &minone, A,
@@ -755,6 +954,7 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         }
     }
 
+    ROCBLAS_CHECK(side.release());
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrf.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -107,14 +108,21 @@ rocblas_status rocsolver_getrf_info32_impl(rocblas_handle handle,
     pivotidx = mem[6];
     iipiv = mem[7];
     iinfo = mem[8];
-    if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_getrf_template<false, false, T>(
-        handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
-        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (int64_t*)pivotidx, (int64_t*)iipiv,
-        (rocblas_int*)iinfo, optim_mem, pivot);
+    auto launch = [&]() {
+        if(size_scalars > 0)
+            init_scalars(handle, (T*)scalars);
+
+        return rocsolver_getrf_template<false, false, T>(
+            handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (int64_t*)pivotidx,
+            (int64_t*)iipiv, (rocblas_int*)iinfo, optim_mem, pivot);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, name, launch, m, n, A, lda, ipiv, info, pivot,
+                                         scalars, work1, work2, work3, work4, pivotval, pivotidx,
+                                         iinfo, iipiv);
 }
 
 ROCSOLVER_END_NAMESPACE
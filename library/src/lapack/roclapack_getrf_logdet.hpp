@@ -0,0 +1,168 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getdet.hpp"
+#include "roclapack_getrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Determines if the fused factorization and reduction can be done entirely in registers **/
+template <typename T>
+bool getrf_logdet_use_reg(const rocblas_int n)
+{
+#ifdef OPTIMAL
+    return n > 0 && n <= GETF2_REG_MAX_SIZE(T);
+#else
+    return false;
+#endif
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_logdet_argCheck(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int lda,
+                                               U A,
+                                               S* logdet,
+                                               T* sign,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !logdet) || (batch_count && !sign) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_getrf_logdet_getMemorySize(const rocblas_int n,
+                                          const rocblas_int batch_count,
+                                          size_t* size_scalars,
+                                          size_t* size_work1,
+                                          size_t* size_work2,
+                                          size_t* size_work3,
+                                          size_t* size_work4,
+                                          size_t* size_pivotval,
+                                          size_t* size_pivotidx,
+                                          size_t* size_iipiv,
+                                          size_t* size_iinfo,
+                                          size_t* size_ipiv,
+                                          bool* optim_mem,
+                                          const rocblas_int lda = 1)
+{
+    // if quick return, or if the factorization is done in registers, no workspace is needed
+    if(n == 0 || batch_count == 0 || getrf_logdet_use_reg<T>(n))
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_ipiv = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // requirements for calling GETRF
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T>(
+        n, n, true, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, optim_mem, lda);
+
+    // size of the pivot indices of the internal factorization
+    *size_ipiv = sizeof(rocblas_int) * n * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_logdet_template(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               S* logdet,
+                                               T* sign,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               T* scalars,
+                                               void* work1,
+                                               void* work2,
+                                               void* work3,
+                                               void* work4,
+                                               T* pivotval,
+                                               rocblas_int* pivotidx,
+                                               rocblas_int* iipiv,
+                                               rocblas_int* iinfo,
+                                               rocblas_int* ipiv,
+                                               const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrf_logdet", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+#ifdef OPTIMAL
+    // tiny matrices are factorized and reduced in registers;
+    // the factors are not written back
+    if(getrf_logdet_use_reg<T>(n))
+        return getrf_logdet_run_reg<T>(handle, n, A, shiftA, lda, strideA, logdet, sign, info,
+                                       batch_count);
+#endif
+
+    // factorize in place and reduce the factors
+    rocblas_stride strideP = n;
+    rocsolver_getrf_template<BATCHED, STRIDED, T>(
+        handle, n, n, A, shiftA, 1, lda, strideA, ipiv, 0, strideP, info, batch_count, scalars,
+        work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+
+    return rocsolver_getdet_template<T>(handle, n, A, shiftA, lda, strideA, ipiv, strideP, logdet,
+                                        sign, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
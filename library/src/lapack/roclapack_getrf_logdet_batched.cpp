@@ -0,0 +1,179 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_getrf_logdet.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_logdet_batched_impl(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   U A,
+                                                   const rocblas_int lda,
+                                                   S* logdet,
+                                                   T* sign,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrf_logdet_batched", "-n", n, "--lda", lda, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_getrf_logdet_argCheck(handle, n, lda, A, logdet, sign, info,
+                                                        batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo, size_iipiv;
+    // size of the pivot indices of the internal factorization
+    size_t size_ipiv;
+    rocsolver_getrf_logdet_getMemorySize<true, false, T>(
+        n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &size_ipiv, &optim_mem, lda);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iipiv, size_iinfo,
+                                                      size_ipiv);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv, *ipiv;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo, size_ipiv);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    ipiv = mem[9];
+
+    // execution
+    auto launch = [&]() {
+        if(size_scalars > 0)
+            init_scalars(handle, (T*)scalars);
+
+        return rocsolver_getrf_logdet_template<true, false, T>(
+            handle, n, A, shiftA, lda, strideA, logdet, sign, info, batch_count, (T*)scalars, work1,
+            work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iipiv,
+            (rocblas_int*)iinfo, (rocblas_int*)ipiv, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "getrf_logdet_batched", launch, n, A, lda, logdet,
+                                         sign, info, batch_count, scalars, work1, work2, work3,
+                                         work4, pivotval, pivotidx, iinfo, iipiv, ipiv);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_logdet_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               float* const A[],
+                                               const rocblas_int lda,
+                                               float* logdet,
+                                               float* sign,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrf_logdet_batched_impl<float>(handle, n, A, lda, logdet, sign,
+                                                                 info, batch_count);
+}
+
+rocblas_status rocsolver_dgetrf_logdet_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               double* const A[],
+                                               const rocblas_int lda,
+                                               double* logdet,
+                                               double* sign,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrf_logdet_batched_impl<double>(handle, n, A, lda, logdet, sign,
+                                                                  info, batch_count);
+}
+
+rocblas_status rocsolver_cgetrf_logdet_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int lda,
+                                               float* logdet,
+                                               rocblas_float_complex* sign,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrf_logdet_batched_impl<rocblas_float_complex>(
+        handle, n, A, lda, logdet, sign, info, batch_count);
+}
+
+rocblas_status rocsolver_zgetrf_logdet_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int lda,
+                                               double* logdet,
+                                               rocblas_double_complex* sign,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrf_logdet_batched_impl<rocblas_double_complex>(
+        handle, n, A, lda, logdet, sign, info, batch_count);
+}
+}
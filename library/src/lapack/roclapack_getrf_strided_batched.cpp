@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrf.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -101,14 +102,21 @@ rocblas_status rocsolver_getrf_strided_batched_impl(rocblas_handle handle,
     pivotidx = mem[6];
     iipiv = mem[7];
     iinfo = mem[8];
-    if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_getrf_template<false, true, T>(
-        handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
-        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (I*)pivotidx, (I*)iipiv, (I*)iinfo,
-        optim_mem, pivot);
+    auto launch = [&]() {
+        if(size_scalars > 0)
+            init_scalars(handle, (T*)scalars);
+
+        return rocsolver_getrf_template<false, true, T>(
+            handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (I*)pivotidx, (I*)iipiv,
+            (I*)iinfo, optim_mem, pivot);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, name, launch, m, n, A, lda, strideA, ipiv, strideP,
+                                         info, pivot, batch_count, scalars, work1, work2, work3,
+                                         work4, pivotval, pivotidx, iinfo, iipiv);
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,170 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_getrf_tpvt.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_tpvt_impl(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         U A,
+                                         const rocblas_int lda,
+                                         rocblas_int* ipiv,
+                                         rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("getrf_tpvt", "-m", m, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_getf2_getrf_argCheck(handle, m, n, lda, A, ipiv, info, true);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftP = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size of the copy of the panel, and of the candidate pivot rows and their factorizations
+    size_t size_workW, size_cand, size_ids, size_wpiv, size_winfo;
+
+    rocsolver_getrf_tpvt_getMemorySize<false, false, T>(
+        m, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_workW, &size_cand, &size_ids, &size_wpiv,
+        &size_winfo, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_pivotval,
+            size_pivotidx, size_workW, size_cand, size_ids, size_wpiv, size_winfo);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *workW, *cand, *ids,
+        *wpiv, *winfo;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_workW, size_cand, size_ids,
+                              size_wpiv, size_winfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    workW = mem[7];
+    cand = mem[8];
+    ids = mem[9];
+    wpiv = mem[10];
+    winfo = mem[11];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_getrf_tpvt_template<false, false, T>(
+        handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx, (T*)workW,
+        (rocblas_int*)cand, (rocblas_int*)ids, (rocblas_int*)wpiv, (rocblas_int*)winfo, optim_mem);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_tpvt(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     float* A,
+                                     const rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_getrf_tpvt_impl<float>(handle, m, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_dgetrf_tpvt(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     double* A,
+                                     const rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_getrf_tpvt_impl<double>(handle, m, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_cgetrf_tpvt(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     rocblas_float_complex* A,
+                                     const rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_getrf_tpvt_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_zgetrf_tpvt(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     rocblas_double_complex* A,
+                                     const rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_getrf_tpvt_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, ipiv, info);
+}
+
+} // extern C
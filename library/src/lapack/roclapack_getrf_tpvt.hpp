@@ -0,0 +1,472 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_laswp.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getf2.hpp"
+#include "roclapack_getrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Copy the rows of a block panel to the workspace, split into q leaves (row blocks).
+    The first q-1 leaves of all the instances in the batch have br rows and are stored
+    first; the last leaves, with the remaining rows, are stored afterwards **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void getrf_tpvt_gather_leaves(const rocblas_int mm,
+                                               const rocblas_int nn,
+                                               const rocblas_int q,
+                                               const rocblas_int br,
+                                               U AA,
+                                               const rocblas_stride shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               T* W,
+                                               const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int c = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < mm)
+    {
+        // batch instance
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+        rocblas_int l = std::min(i / br, q - 1);
+        rocblas_int r = i - l * br;
+        rocblas_int ldw;
+        T* Wl;
+        if(l < q - 1)
+        {
+            ldw = br;
+            Wl = W + (size_t(bid) * (q - 1) + l) * br * nn;
+        }
+        else
+        {
+            ldw = mm - (q - 1) * br;
+            Wl = W + size_t(batch_count) * (q - 1) * br * nn + size_t(bid) * ldw * nn;
+        }
+
+        Wl[r + c * ldw] = A[i + c * lda];
+    }
+}
+
+/** Copy the rows of each pair of candidate sets to the workspace (one instance per pair).
+    The candidate sets of the instance bid are stored consecutively in cand **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void getrf_tpvt_gather_pairs(const rocblas_int nn,
+                                              const rocblas_int npairs,
+                                              U AA,
+                                              const rocblas_stride shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              const rocblas_int* cand,
+                                              const rocblas_stride strideC,
+                                              T* W,
+                                              rocblas_int* ids)
+{
+    rocblas_int g = hipBlockIdx_x;
+    rocblas_int c = hipBlockIdx_y;
+    rocblas_int t = hipThreadIdx_x;
+    rocblas_int bid = g / npairs;
+    rocblas_int p = g % npairs;
+
+    if(t < 2 * nn)
+    {
+        // batch instance
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+        rocblas_int row = cand[bid * strideC + 2 * p * nn + t];
+        W[size_t(g) * 2 * nn * nn + t + c * 2 * nn] = A[row + c * lda];
+        if(c == 0)
+            ids[size_t(g) * 2 * nn + t] = row;
+    }
+}
+
+/** Select the candidate pivot rows of a group of instances factorized with GETF2
+    (the rows that end up in the first nn positions after the row interchanges).
+    Row r of instance g is row ids[g * ldids + r] of the panel, or, if ids is null,
+    row (soff + p) * br + r (leaves) **/
+template <typename I>
+ROCSOLVER_KERNEL void getrf_tpvt_select(const I nn,
+                                        const I nper,
+                                        const I soff,
+                                        const I br,
+                                        const I* wpiv,
+                                        const I* ids,
+                                        const I ldids,
+                                        I* cand,
+                                        const rocblas_stride strideC)
+{
+    I g = hipBlockIdx_x;
+    I tid = hipThreadIdx_x;
+    I bid = g / nper;
+    I p = g % nper;
+
+    // shared mem for the row interchanges
+    extern __shared__ double lmem[];
+    I* piv = reinterpret_cast<I*>(lmem);
+
+    for(I k = tid; k < nn; k += hipBlockDim_x)
+        piv[k] = wpiv[g * nn + k] - 1;
+    __syncthreads();
+
+    for(I k = tid; k < nn; k += hipBlockDim_x)
+    {
+        // undo the interchanges to find the original position of the row in position k
+        I pos = k;
+        for(I t = nn - 1; t >= 0; t--)
+        {
+            if(pos == t)
+                pos = piv[t];
+            else if(pos == piv[t])
+                pos = t;
+        }
+
+        cand[bid * strideC + (soff + p) * nn + k]
+            = ids ? ids[g * ldids + pos] : (soff + p) * br + pos;
+    }
+}
+
+/** Copy candidate set from to candidate set to **/
+template <typename I>
+ROCSOLVER_KERNEL void getrf_tpvt_copy_cand(const I nn,
+                                           const I from,
+                                           const I to,
+                                           I* cand,
+                                           const rocblas_stride strideC)
+{
+    I bid = hipBlockIdx_y;
+    I k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(k < nn)
+        cand[bid * strideC + to * nn + k] = cand[bid * strideC + from * nn + k];
+}
+
+/** Express the selected pivot rows as LAPACK row interchanges. Only the rows
+    with index < nn can be displaced by an interchange before being selected,
+    so their positions are tracked in shared memory **/
+template <typename I>
+ROCSOLVER_KERNEL void getrf_tpvt_set_ipiv(const I nn,
+                                          const I j,
+                                          const I* cand,
+                                          const rocblas_stride strideC,
+                                          I* ipivA,
+                                          const rocblas_stride shiftP,
+                                          const rocblas_stride strideP)
+{
+    I bid = hipBlockIdx_x;
+    I tid = hipThreadIdx_x;
+    const I* C = cand + bid * strideC;
+    I* ipiv = ipivA + bid * strideP + shiftP;
+
+    // shared mem for the positions of the rows, and the rows at the positions
+    extern __shared__ double lmem[];
+    I* posOf = reinterpret_cast<I*>(lmem);
+    I* rowAt = posOf + nn;
+
+    for(I k = tid; k < nn; k += hipBlockDim_x)
+    {
+        posOf[k] = k;
+        rowAt[k] = k;
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        for(I k = 0; k < nn; k++)
+        {
+            I r = C[k];
+            I p = (r < nn) ? posOf[r] : r;
+            ipiv[j + k] = p + j + 1; // use Fortran 1-based indexing
+
+            // row at position k is displaced to position p
+            I d = rowAt[k];
+            posOf[d] = p;
+            if(p < nn)
+                rowAt[p] = d;
+            if(r < nn)
+                posOf[r] = k;
+            rowAt[k] = r;
+        }
+    }
+}
+
+/** This function returns the width of the block panels of GETRF_TPVT **/
+template <bool ISBATCHED, typename T>
+rocblas_int getrf_tpvt_get_blksize(const rocblas_int dim)
+{
+    rocblas_int blk = getrf_get_blksize<ISBATCHED, T>(dim, true);
+    if(blk <= 0)
+        blk = dim;
+
+    // the pairs of candidate sets are factorized with one thread per row
+    return std::min(blk, rocblas_int(512));
+}
+
+/** Return the sizes of the different workspace arrays **/
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_getrf_tpvt_getMemorySize(const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int batch_count,
+                                        size_t* size_scalars,
+                                        size_t* size_work1,
+                                        size_t* size_work2,
+                                        size_t* size_work3,
+                                        size_t* size_work4,
+                                        size_t* size_pivotval,
+                                        size_t* size_pivotidx,
+                                        size_t* size_workW,
+                                        size_t* size_cand,
+                                        size_t* size_ids,
+                                        size_t* size_wpiv,
+                                        size_t* size_winfo,
+                                        bool* optim_mem)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    // if quick return, no need of workspace
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_workW = 0;
+        *size_cand = 0;
+        *size_ids = 0;
+        *size_wpiv = 0;
+        *size_winfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    rocblas_int dim = std::min(m, n);
+    rocblas_int blk = getrf_tpvt_get_blksize<ISBATCHED, T>(dim);
+    rocblas_int br = std::max(blk, rocblas_int(GETRF_TPVT_LEAF_ROWS));
+    rocblas_int q = std::max(1, m / br);
+
+    // requirements for GETF2 (the largest batch is formed by the leaves of the first panel)
+    rocsolver_getf2_getMemorySize<true, T>(2 * br, blk, true, batch_count * q, size_scalars,
+                                           size_pivotval, size_pivotidx, true);
+
+    // copy of the first panel, and candidate pivot rows
+    *size_workW = sizeof(T) * m * blk * batch_count;
+    *size_cand = sizeof(rocblas_int) * q * blk * batch_count;
+    *size_ids = sizeof(rocblas_int) * q * blk * batch_count;
+    *size_wpiv = sizeof(rocblas_int) * q * blk * batch_count;
+    *size_winfo = sizeof(rocblas_int) * q * batch_count;
+
+    // extra workspace for calling largest possible TRSM
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, blk, n,
+                                            batch_count, size_work1, size_work2, size_work3,
+                                            size_work4, optim_mem, true);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_getrf_tpvt_template(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             U A,
+                                             const rocblas_stride shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             rocblas_int* ipiv,
+                                             const rocblas_stride shiftP,
+                                             const rocblas_stride strideP,
+                                             rocblas_int* info,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             void* work1,
+                                             void* work2,
+                                             void* work3,
+                                             void* work4,
+                                             T* pivotval,
+                                             rocblas_int* pivotidx,
+                                             T* workW,
+                                             rocblas_int* cand,
+                                             rocblas_int* ids,
+                                             rocblas_int* wpiv,
+                                             rocblas_int* winfo,
+                                             const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrf_tpvt", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "shiftP:", shiftP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+    rocblas_int dim = std::min(m, n);
+    dim3 grid, threads;
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        grid = dim3(blocks, 1, 1);
+        threads = dim3(BS1, 1, 1);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // size of the block panels and of the leaves
+    rocblas_int blk = getrf_tpvt_get_blksize<ISBATCHED, T>(dim);
+    rocblas_int br = std::max(blk, rocblas_int(GETRF_TPVT_LEAF_ROWS));
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    rocblas_int jb, mm, q, bl, npairs, nextpiv;
+    rocblas_stride strideC;
+    size_t lmemsize;
+
+    // MAIN LOOP
+    for(rocblas_int j = 0; j < dim; j += blk)
+    {
+        jb = std::min(dim - j, blk);
+        mm = m - j;
+        q = std::max(1, mm / br); // number of leaves
+        bl = mm - (q - 1) * br; // number of rows of the last leaf
+        strideC = rocblas_stride(q) * jb;
+        lmemsize = 2 * jb * sizeof(rocblas_int);
+
+        // factorize the leaves independently to get the candidate pivot rows
+        grid = dim3((mm - 1) / BS1 + 1, jb, batch_count);
+        threads = dim3(BS1, 1, 1);
+        ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_gather_leaves<T>, grid, threads, 0, stream, mm, jb, q,
+                                br, A, shiftA + idx2D(j, j, lda), lda, strideA, workW,
+                                batch_count);
+
+        threads = dim3(std::min(jb, rocblas_int(BS1)), 1, 1);
+        if(q > 1)
+        {
+            rocsolver_getf2_template<true, T>(handle, br, jb, workW, 0, 1, br,
+                                              rocblas_stride(br) * jb, wpiv, 0, jb, winfo,
+                                              batch_count * (q - 1), scalars, pivotval, pivotidx,
+                                              true);
+
+            grid = dim3(batch_count * (q - 1), 1, 1);
+            ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_select<rocblas_int>, grid, threads, lmemsize,
+                                    stream, jb, q - 1, 0, br, wpiv, (rocblas_int*)nullptr, 0, cand,
+                                    strideC);
+        }
+
+        rocsolver_getf2_template<true, T>(handle, bl, jb,
+                                          workW + size_t(batch_count) * (q - 1) * br * jb, 0, 1,
+                                          bl, rocblas_stride(bl) * jb, wpiv, 0, jb, winfo,
+                                          batch_count, scalars, pivotval, pivotidx, true);
+
+        grid = dim3(batch_count, 1, 1);
+        ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_select<rocblas_int>, grid, threads, lmemsize, stream,
+                                jb, 1, q - 1, br, wpiv, (rocblas_int*)nullptr, 0, cand, strideC);
+
+        // reduce the candidate pivot rows in a binary tree
+        for(rocblas_int s = q; s > 1; s = npairs + s % 2)
+        {
+            npairs = s / 2;
+
+            grid = dim3(batch_count * npairs, jb, 1);
+            threads = dim3(2 * jb, 1, 1);
+            ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_gather_pairs<T>, grid, threads, 0, stream, jb,
+                                    npairs, A, shiftA + idx2D(j, j, lda), lda, strideA, cand,
+                                    strideC, workW, ids);
+
+            // an odd candidate set passes to the next level
+            if(s % 2)
+            {
+                grid = dim3((jb - 1) / BS1 + 1, batch_count, 1);
+                threads = dim3(BS1, 1, 1);
+                ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_copy_cand<rocblas_int>, grid, threads, 0,
+                                        stream, jb, s - 1, npairs, cand, strideC);
+            }
+
+            rocsolver_getf2_template<true, T>(handle, 2 * jb, jb, workW, 0, 1, 2 * jb,
+                                              rocblas_stride(2 * jb) * jb, wpiv, 0, jb, winfo,
+                                              batch_count * npairs, scalars, pivotval, pivotidx,
+                                              true);
+
+            grid = dim3(batch_count * npairs, 1, 1);
+            threads = dim3(std::min(jb, rocblas_int(BS1)), 1, 1);
+            ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_select<rocblas_int>, grid, threads, lmemsize,
+                                    stream, jb, npairs, 0, br, wpiv, ids, 2 * jb, cand, strideC);
+        }
+
+        // move the selected rows to the top of the panel
+        grid = dim3(batch_count, 1, 1);
+        threads = dim3(std::min(jb, rocblas_int(BS1)), 1, 1);
+        ROCSOLVER_LAUNCH_KERNEL(getrf_tpvt_set_ipiv<rocblas_int>, grid, threads, lmemsize, stream,
+                                jb, j, cand, strideC, ipiv, shiftP, strideP);
+
+        rocsolver_laswp_template<T>(handle, n, A, shiftA, 1, lda, strideA, j + 1, j + jb, ipiv,
+                                    shiftP, 1, strideP, batch_count);
+
+        // factorize the panel without further pivot searches
+        getrf_panelLU<BATCHED, STRIDED, T>(handle, mm, jb, n, A, shiftA + j, 1, lda, strideA, ipiv,
+                                           shiftP + j, strideP, info, batch_count, false, scalars,
+                                           work1, work2, work3, work4, optim_mem, pivotval,
+                                           pivotidx, j, (rocblas_int*)nullptr, 0);
+
+        // update trailing matrix
+        nextpiv = j + jb;
+        if(nextpiv < n)
+        {
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb,
+                n - nextpiv, A, shiftA + idx2D(j, j, lda), 1, lda, strideA, A,
+                shiftA + idx2D(j, nextpiv, lda), 1, lda, strideA, batch_count, optim_mem, work1,
+                work2, work3, work4);
+
+            if(nextpiv < m)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, m - nextpiv,
+                    n - nextpiv, jb, &minone, A, shiftA + idx2D(nextpiv, j, lda), 1, lda, strideA,
+                    A, shiftA + idx2D(j, nextpiv, lda), 1, lda, strideA, &one, A,
+                    shiftA + idx2D(nextpiv, nextpiv, lda), 1, lda, strideA, batch_count,
+                    (T**)nullptr);
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
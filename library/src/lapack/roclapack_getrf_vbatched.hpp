@@ -0,0 +1,230 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GETRF_VBATCHED_GETF2 computes the LU factorization of the m-by-n matrix A (with leading
+    dimension lda) with the unblocked right-looking algorithm, using all the threads of the
+    work-group. sval and sidx must have room for one element per thread. **/
+template <typename T, typename S>
+__device__ void getrf_vbatched_getf2(const rocblas_int tid,
+                                     const rocblas_int nt,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     T* A,
+                                     const rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_int* info,
+                                     S* sval,
+                                     rocblas_int* sidx)
+{
+    const rocblas_int dim = std::min(m, n);
+    rocblas_int zero_pivot = 0;
+
+    for(rocblas_int j = 0; j < dim; ++j)
+    {
+        // find the pivot in A(j:m-1,j)
+        // (if the column is all NaN, no row is selected and the diagonal is kept as pivot)
+        S pval = -1;
+        rocblas_int p = j;
+        for(rocblas_int i = j + tid; i < m; i += nt)
+        {
+            S v = aabs<S>(A[i + j * lda]);
+            if(v > pval)
+            {
+                pval = v;
+                p = i;
+            }
+        }
+        vbatched_iamax(tid, nt, pval, p, sval, sidx);
+
+        if(tid == 0)
+            ipiv[j] = p + 1;
+        if(pval == 0 && zero_pivot == 0)
+            zero_pivot = j + 1;
+
+        // swap rows j and p
+        if(p != j && p < m)
+        {
+            for(rocblas_int c = tid; c < n; c += nt)
+                swap(A[j + c * lda], A[p + c * lda]);
+            __syncthreads();
+        }
+
+        // scale the j-th column (a zero pivot leaves the column unchanged)
+        if(pval != 0)
+        {
+            const T inv = T(1) / A[j + j * lda];
+            for(rocblas_int i = j + 1 + tid; i < m; i += nt)
+                A[i + j * lda] *= inv;
+            __syncthreads();
+        }
+
+        // update the trailing submatrix
+        const rocblas_int mj = m - j - 1;
+        const rocblas_int nj = n - j - 1;
+        for(int64_t e = tid; e < int64_t(mj) * nj; e += nt)
+        {
+            rocblas_int i = j + 1 + rocblas_int(e % mj);
+            rocblas_int c = j + 1 + rocblas_int(e / mj);
+            A[i + c * lda] -= A[i + j * lda] * A[j + c * lda];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        *info = zero_pivot;
+}
+
+/** GETRF_VBATCHED_KERNEL factorizes the batch instances in the size class with bounds lo and
+    hi, with one work-group per instance. The instances with invalid dimensions are reported
+    in info by the first size class. **/
+template <typename T>
+ROCSOLVER_KERNEL void getrf_vbatched_kernel(const rocblas_int lo,
+                                            const rocblas_int hi,
+                                            const bool lds,
+                                            const rocblas_int* mm,
+                                            const rocblas_int* nn,
+                                            T* const A[],
+                                            const rocblas_int* ldaa,
+                                            rocblas_int* ipiv,
+                                            const rocblas_stride strideP,
+                                            rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nt = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int lda = ldaa[b];
+
+    // position of the first invalid argument (as in LAPACK)
+    const rocblas_int arg = (m < 0) ? 1 : (n < 0) ? 2 : (lda < m) ? 4 : 0;
+    if(arg)
+    {
+        if(lo == 0 && tid == 0)
+            info[b] = -arg;
+        return;
+    }
+    if(!vbatched_in_class(std::max(m, n), lo, hi))
+        return;
+
+    extern __shared__ double lmem[];
+    T *sA, *sw, *sp;
+    S* sval;
+    rocblas_int* sidx;
+    vbatched_lmem(lmem, lds ? m * n : 0, &sA, &sw, &sp, &sval, &sidx);
+
+    T* Ap = A[b];
+    if(lds)
+        vbatched_load(tid, nt, m, n, Ap, lda, sA);
+
+    getrf_vbatched_getf2(tid, nt, m, n, lds ? sA : Ap, lds ? m : lda, ipiv + b * strideP,
+                         info + b, sval, sidx);
+
+    if(lds)
+        vbatched_store(tid, nt, m, n, sA, Ap, lda);
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 T A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the dimensions of the batch instances are only read on the device; instances with
+    // invalid dimensions are reported in info)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !A || !lda || !ipiv || !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 T* const A[],
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrf_vbatched", "strideP:", strideP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // factorize the instances of each size class
+    // (the matrices of the small classes are kept in LDS)
+    for(rocblas_int c = 0; c <= VBATCHED_NUM_INTERVALS; ++c)
+    {
+        rocblas_int lo, hi, threads;
+        bool lds;
+        rocsolver_vbatched_class<T>(c, &lo, &hi, &threads, &lds);
+        size_t lmemsize = rocsolver_vbatched_lmem_size<T>(threads, lds ? hi * hi : 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(getrf_vbatched_kernel<T>, dim3(batch_count), dim3(threads),
+                                lmemsize, stream, lo, hi, lds, m, n, A, lda, ipiv, strideP, info);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrs.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -88,9 +89,14 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // execution
-    return rocsolver_getrs_template<false, false, T>(
-        handle, trans, n, nrhs, A, shiftA, inca, lda, strideA, ipiv, strideP, B, shiftB, incb, ldb,
-        strideB, batch_count, work1, work2, work3, work4, optim_mem, true);
+    auto launch = [&]() {
+        return rocsolver_getrs_template<false, false, T>(
+            handle, trans, n, nrhs, A, shiftA, inca, lda, strideA, ipiv, strideP, B, shiftB, incb,
+            ldb, strideB, batch_count, work1, work2, work3, work4, optim_mem, true);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "getrs", launch, trans, n, nrhs, A, lda, ipiv, B,
+                                         ldb, work1, work2, work3, work4);
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrs.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -33,16 +34,16 @@ template <typename T, typename I, typename U>
 rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle,
                                                     const rocblas_operation trans,
                                                     const I n,
-                                                    const I nrhs,
+                                                    I nrhs,
                                                     U A,
                                                     const I lda,
                                                     const rocblas_stride strideA,
                                                     const I* ipiv,
                                                     const rocblas_stride strideP,
                                                     U B,
-                                                    const I ldb,
-                                                    const rocblas_stride strideB,
-                                                    const I batch_count)
+                                                    I ldb,
+                                                    rocblas_stride strideB,
+                                                    I batch_count)
 {
     ROCSOLVER_ENTER_TOP("getrs_strided_batched", "--trans", trans, "-n", n, "--nrhs", nrhs, "--lda",
                         lda, "--strideA", strideA, "--strideP", strideP, "--ldb", ldb, "--strideB",
@@ -57,6 +58,11 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    // broadcast mode: if all the instances share the same factorization,
+    // solve the right hand sides as a single system whenever possible
+    if(strideA == 0 && strideP == 0)
+        fold_broadcast_rhs(n, nrhs, ldb, strideB, batch_count);
+
     // working with unshifted arrays
     rocblas_stride shiftA = 0;
     rocblas_stride shiftB = 0;
@@ -90,9 +96,15 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // execution
-    return rocsolver_getrs_template<false, true, T>(
-        handle, trans, n, nrhs, A, shiftA, inca, lda, strideA, ipiv, strideP, B, shiftB, incb, ldb,
-        strideB, batch_count, work1, work2, work3, work4, optim_mem, true);
+    auto launch = [&]() {
+        return rocsolver_getrs_template<false, true, T>(
+            handle, trans, n, nrhs, A, shiftA, inca, lda, strideA, ipiv, strideP, B, shiftB, incb,
+            ldb, strideB, batch_count, work1, work2, work3, work4, optim_mem, true);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "getrs_strided_batched", launch, trans, n, nrhs, A,
+                                         lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count,
+                                         work1, work2, work3, work4);
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,141 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#include "roclapack_getrs_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_getrs_vbatched_impl(rocblas_handle handle,
+                                             const rocblas_operation trans,
+                                             const rocblas_int* n,
+                                             const rocblas_int* nrhs,
+                                             T* const A[],
+                                             const rocblas_int* lda,
+                                             const rocblas_int* ipiv,
+                                             const rocblas_stride strideP,
+                                             T* const B[],
+                                             const rocblas_int* ldb,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrs_vbatched", "--trans", trans, "--strideP", strideP, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_getrs_vbatched_argCheck(handle, trans, n, nrhs, A, lda, ipiv, B,
+                                                          ldb, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_getrs_vbatched_template<T>(handle, trans, n, nrhs, A, lda, ipiv, strideP, B,
+                                                ldb, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         float* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* ipiv,
+                                         const rocblas_stride strideP,
+                                         float* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrs_vbatched_impl<float>(handle, trans, n, nrhs, A, lda, ipiv,
+                                                           strideP, B, ldb, batch_count);
+}
+
+rocblas_status rocsolver_dgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         double* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* ipiv,
+                                         const rocblas_stride strideP,
+                                         double* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrs_vbatched_impl<double>(handle, trans, n, nrhs, A, lda, ipiv,
+                                                            strideP, B, ldb, batch_count);
+}
+
+rocblas_status rocsolver_cgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         rocblas_float_complex* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* ipiv,
+                                         const rocblas_stride strideP,
+                                         rocblas_float_complex* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrs_vbatched_impl<rocblas_float_complex>(
+        handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, batch_count);
+}
+
+rocblas_status rocsolver_zgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         rocblas_double_complex* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* ipiv,
+                                         const rocblas_stride strideP,
+                                         rocblas_double_complex* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrs_vbatched_impl<rocblas_double_complex>(
+        handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,220 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_vbatched.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GETRS_VBATCHED_GETRS solves op(A) * X = B, where A is given by its LU factorization with
+    partial pivoting (with leading dimension lda), using all the threads of the work-group.
+    B is the n-by-nrhs matrix with leading dimension ldb that is overwritten with X. **/
+template <typename T>
+__device__ void getrs_vbatched_getrs(const rocblas_int tid,
+                                     const rocblas_int nt,
+                                     const rocblas_operation trans,
+                                     const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     const T* A,
+                                     const rocblas_int lda,
+                                     const rocblas_int* ipiv,
+                                     T* B,
+                                     const rocblas_int ldb)
+{
+    if(trans == rocblas_operation_none)
+    {
+        // apply the row interchanges to B
+        for(rocblas_int i = 0; i < n; ++i)
+        {
+            const rocblas_int p = ipiv[i] - 1;
+            if(p != i)
+            {
+                for(rocblas_int c = tid; c < nrhs; c += nt)
+                    swap(B[i + c * ldb], B[p + c * ldb]);
+                __syncthreads();
+            }
+        }
+
+        // solve L * Y = B, overwriting B with Y
+        vbatched_trsm(tid, nt, rocblas_fill_lower, trans, rocblas_diagonal_unit, n, nrhs, A, 1,
+                      lda, B, ldb);
+
+        // solve U * X = Y, overwriting B with X
+        vbatched_trsm(tid, nt, rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, nrhs, A,
+                      1, lda, B, ldb);
+    }
+    else
+    {
+        // solve U' * Y = B, overwriting B with Y
+        vbatched_trsm(tid, nt, rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, nrhs, A,
+                      1, lda, B, ldb);
+
+        // solve L' * X = Y, overwriting B with X
+        vbatched_trsm(tid, nt, rocblas_fill_lower, trans, rocblas_diagonal_unit, n, nrhs, A, 1,
+                      lda, B, ldb);
+
+        // apply the row interchanges to X in reverse order
+        for(rocblas_int i = n - 1; i >= 0; --i)
+        {
+            const rocblas_int p = ipiv[i] - 1;
+            if(p != i)
+            {
+                for(rocblas_int c = tid; c < nrhs; c += nt)
+                    swap(B[i + c * ldb], B[p + c * ldb]);
+                __syncthreads();
+            }
+        }
+    }
+}
+
+/** GETRS_VBATCHED_KERNEL solves the systems of the batch instances in the size class with
+    bounds lo and hi, with one work-group per instance. The instances with invalid dimensions
+    are skipped. **/
+template <typename T>
+ROCSOLVER_KERNEL void getrs_vbatched_kernel(const rocblas_int lo,
+                                            const rocblas_int hi,
+                                            const bool lds,
+                                            const rocblas_operation trans,
+                                            const rocblas_int* nn,
+                                            const rocblas_int* nnrhs,
+                                            T* const A[],
+                                            const rocblas_int* ldaa,
+                                            const rocblas_int* ipiv,
+                                            const rocblas_stride strideP,
+                                            T* const B[],
+                                            const rocblas_int* ldbb)
+{
+    using S = decltype(std::real(T{}));
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nt = hipBlockDim_x;
+
+    const rocblas_int n = nn[b];
+    const rocblas_int nrhs = nnrhs[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int ldb = ldbb[b];
+
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n)
+        return;
+    if(!vbatched_in_class(n, lo, hi) || n == 0 || nrhs == 0)
+        return;
+
+    extern __shared__ double lmem[];
+    T *sA, *sw, *sp;
+    S* sval;
+    rocblas_int* sidx;
+    vbatched_lmem(lmem, lds ? n * n : 0, &sA, &sw, &sp, &sval, &sidx);
+
+    // the factors are read many times, so they are kept in LDS when possible
+    T* Ap = A[b];
+    if(lds)
+        vbatched_load(tid, nt, n, n, Ap, lda, sA);
+
+    getrs_vbatched_getrs(tid, nt, trans, n, nrhs, lds ? sA : Ap, lds ? n : lda,
+                         ipiv + b * strideP, B[b], ldb);
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 T A,
+                                                 const rocblas_int* lda,
+                                                 const rocblas_int* ipiv,
+                                                 T B,
+                                                 const rocblas_int* ldb,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the dimensions of the batch instances are only read on the device; instances with
+    // invalid dimensions are skipped)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!n || !nrhs || !A || !lda || !ipiv || !B || !ldb))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 T* const A[],
+                                                 const rocblas_int* lda,
+                                                 const rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 T* const B[],
+                                                 const rocblas_int* ldb,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrs_vbatched", "trans:", trans, "strideP:", strideP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // solve the systems of each size class
+    // (the factors of the small classes are kept in LDS)
+    for(rocblas_int c = 0; c <= VBATCHED_NUM_INTERVALS; ++c)
+    {
+        rocblas_int lo, hi, threads;
+        bool lds;
+        rocsolver_vbatched_class<T>(c, &lo, &hi, &threads, &lds);
+        size_t lmemsize = rocsolver_vbatched_lmem_size<T>(threads, lds ? hi * hi : 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(getrs_vbatched_kernel<T>, dim3(batch_count), dim3(threads),
+                                lmemsize, stream, lo, hi, lds, trans, n, nrhs, A, lda, ipiv,
+                                strideP, B, ldb);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
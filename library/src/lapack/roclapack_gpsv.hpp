@@ -0,0 +1,207 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GPSV_KERNEL solves a pentadiagonal system of linear equations with Gaussian
+    elimination without pivoting. Each thread works on one instance of the batch.
+
+    On exit, ds and dl contain the multipliers of the unit lower triangular factor L,
+    and d and du contain the main diagonal and first superdiagonal of the factor U
+    (the second superdiagonal of U is dw, which is not modified). **/
+template <typename T>
+ROCSOLVER_KERNEL void gpsv_kernel(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  T* DSA,
+                                  T* DLA,
+                                  T* DA,
+                                  T* DUA,
+                                  T* DWA,
+                                  const rocblas_int incd,
+                                  const rocblas_stride strideD,
+                                  T* BB,
+                                  const rocblas_int incb,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride strideB,
+                                  rocblas_int* infoA,
+                                  const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* ds = DSA + bid * strideD;
+    T* dl = DLA + bid * strideD;
+    T* d = DA + bid * strideD;
+    T* du = DUA + bid * strideD;
+    T* dw = DWA + bid * strideD;
+    T* B = BB + bid * strideB;
+
+    T di, f, temp;
+
+    // forward elimination
+    for(rocblas_int i = 0; i < n; i++)
+    {
+        di = d[i * incd];
+        if(di == T(0))
+        {
+            // the matrix is singular
+            infoA[bid] = i + 1; // use Fortran 1-based indexing
+            return;
+        }
+
+        // eliminate the first subdiagonal
+        if(i < n - 1)
+        {
+            f = dl[i * incd] / di;
+            dl[i * incd] = f;
+            d[(i + 1) * incd] -= f * du[i * incd];
+            if(i < n - 2)
+                du[(i + 1) * incd] -= f * dw[i * incd];
+            for(rocblas_int j = 0; j < nrhs; j++)
+                B[(i + 1) * incb + j * ldb] -= f * B[i * incb + j * ldb];
+        }
+
+        // eliminate the second subdiagonal
+        if(i < n - 2)
+        {
+            f = ds[i * incd] / di;
+            ds[i * incd] = f;
+            dl[(i + 1) * incd] -= f * du[i * incd];
+            d[(i + 2) * incd] -= f * dw[i * incd];
+            for(rocblas_int j = 0; j < nrhs; j++)
+                B[(i + 2) * incb + j * ldb] -= f * B[i * incb + j * ldb];
+        }
+    }
+    infoA[bid] = 0;
+
+    // back substitution with U
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        T* x = B + j * ldb;
+
+        for(rocblas_int i = n - 1; i >= 0; i--)
+        {
+            temp = x[i * incb];
+            if(i < n - 1)
+                temp -= du[i * incd] * x[(i + 1) * incb];
+            if(i < n - 2)
+                temp -= dw[i * incd] * x[(i + 2) * incb];
+            x[i * incb] = temp / d[i * incd];
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gpsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int incd,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       T ds,
+                                       T dl,
+                                       T d,
+                                       T du,
+                                       T dw,
+                                       T B,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || incd < 1 || incb < 1 || ldb < incb * n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !ds) || (n && !dl) || (n && !d) || (n && !du) || (n && !dw) || (n && nrhs && !B)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_gpsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       T* ds,
+                                       T* dl,
+                                       T* d,
+                                       T* du,
+                                       T* dw,
+                                       const rocblas_int incd,
+                                       const rocblas_stride strideD,
+                                       T* B,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gpsv", "n:", n, "nrhs:", nrhs, "incd:", incd, "incb:", incb, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with info = 0
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(gpsv_kernel<T>, grid, threads, 0, stream, n, nrhs, ds, dl, d, du, dw,
+                            incd, strideD, B, incb, ldb, strideB, info, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,228 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GTSV_KERNEL solves a tridiagonal system of linear equations with Gaussian
+    elimination and partial pivoting. Each thread works on one instance of the
+    batch, so that the kernel is bounded by the memory bandwidth and, when the
+    systems are stored in interleaved layout (incd = incb = batch_count), consecutive
+    threads access consecutive addresses.
+
+    The elimination is applied to the right-hand sides as the factorization proceeds;
+    on exit, d and du contain the main diagonal and first superdiagonal of the
+    factor U, and dl contains its second superdiagonal (as in LAPACK). **/
+template <typename T>
+ROCSOLVER_KERNEL void gtsv_kernel(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  T* DLA,
+                                  T* DA,
+                                  T* DUA,
+                                  const rocblas_int incd,
+                                  const rocblas_stride strideD,
+                                  T* BB,
+                                  const rocblas_int incb,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride strideB,
+                                  rocblas_int* infoA,
+                                  const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* dl = DLA + bid * strideD;
+    T* d = DA + bid * strideD;
+    T* du = DUA + bid * strideD;
+    T* B = BB + bid * strideB;
+
+    T fact, temp, di, dli;
+
+    // forward elimination
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        di = d[i * incd];
+        dli = dl[i * incd];
+
+        if(aabs<S>(di) >= aabs<S>(dli))
+        {
+            // no row interchange required
+            if(di == T(0))
+            {
+                infoA[bid] = i + 1; // use Fortran 1-based indexing
+                return;
+            }
+
+            fact = dli / di;
+            d[(i + 1) * incd] -= fact * du[i * incd];
+            for(rocblas_int j = 0; j < nrhs; j++)
+                B[(i + 1) * incb + j * ldb] -= fact * B[i * incb + j * ldb];
+            if(i < n - 2)
+                dl[i * incd] = 0;
+        }
+        else
+        {
+            // interchange rows i and i+1
+            fact = di / dli;
+            d[i * incd] = dli;
+            temp = d[(i + 1) * incd];
+            d[(i + 1) * incd] = du[i * incd] - fact * temp;
+            if(i < n - 2)
+            {
+                dl[i * incd] = du[(i + 1) * incd];
+                du[(i + 1) * incd] = -fact * dl[i * incd];
+            }
+            du[i * incd] = temp;
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                temp = B[i * incb + j * ldb];
+                B[i * incb + j * ldb] = B[(i + 1) * incb + j * ldb];
+                B[(i + 1) * incb + j * ldb] = temp - fact * B[(i + 1) * incb + j * ldb];
+            }
+        }
+    }
+
+    if(d[(n - 1) * incd] == T(0))
+    {
+        infoA[bid] = n; // use Fortran 1-based indexing
+        return;
+    }
+    infoA[bid] = 0;
+
+    // back substitution with U
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        T* x = B + j * ldb;
+
+        x[(n - 1) * incb] = x[(n - 1) * incb] / d[(n - 1) * incd];
+        if(n > 1)
+        {
+            temp = x[(n - 2) * incb] - du[(n - 2) * incd] * x[(n - 1) * incb];
+            x[(n - 2) * incb] = temp / d[(n - 2) * incd];
+        }
+        for(rocblas_int i = n - 3; i >= 0; i--)
+        {
+            temp = x[i * incb] - du[i * incd] * x[(i + 1) * incb]
+                - dl[i * incd] * x[(i + 2) * incb];
+            x[i * incb] = temp / d[i * incd];
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gtsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int incd,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       T dl,
+                                       T d,
+                                       T du,
+                                       T B,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || incd < 1 || incb < 1 || ldb < incb * n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !dl) || (n && !d) || (n && !du) || (n && nrhs && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_gtsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       T* dl,
+                                       T* d,
+                                       T* du,
+                                       const rocblas_int incd,
+                                       const rocblas_stride strideD,
+                                       T* B,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gtsv", "n:", n, "nrhs:", nrhs, "incd:", incd, "incb:", incb, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with info = 0
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // (the solution of a tridiagonal system with partial pivoting is inherently
+    // sequential; one thread per system keeps this kernel bandwidth bound)
+    ROCSOLVER_LAUNCH_KERNEL(gtsv_kernel<T>, grid, threads, 0, stream, n, nrhs, dl, d, du, incd,
+                            strideD, B, incb, ldb, strideB, info, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
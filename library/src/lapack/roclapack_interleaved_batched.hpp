@@ -0,0 +1,652 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    Kernels for batches of small matrices stored in interleaved layout
+ *    (inca = batch_count, strideA = 1). Each thread works on one instance
+ *    of the batch, so that consecutive threads access consecutive addresses.
+ * ===========================================================================
+ */
+
+/** GETRF_INTERLEAVED_KERNEL computes the LU factorization of a matrix
+    (with or without partial pivoting) **/
+template <typename T>
+ROCSOLVER_KERNEL void getrf_interleaved_kernel(const rocblas_int m,
+                                               const rocblas_int n,
+                                               T* AA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               rocblas_int* ipivA,
+                                               const rocblas_stride strideP,
+                                               rocblas_int* infoA,
+                                               const bool pivot,
+                                               const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = AA + bid * strideA;
+
+    rocblas_int dim = std::min(m, n);
+    rocblas_int info = 0;
+    rocblas_int p;
+    S pmax, val;
+    T pivval, tmp;
+
+    for(rocblas_int k = 0; k < dim; k++)
+    {
+        if(pivot)
+        {
+            // find pivot
+            p = k;
+            pmax = aabs<S>(A[k * inca + k * lda]);
+            for(rocblas_int i = k + 1; i < m; i++)
+            {
+                val = aabs<S>(A[i * inca + k * lda]);
+                if(val > pmax)
+                {
+                    pmax = val;
+                    p = i;
+                }
+            }
+            ipivA[bid * strideP + k] = p + 1; // use Fortran 1-based indexing
+
+            // swap rows
+            if(p != k)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                    swap(A[k * inca + j * lda], A[p * inca + j * lda]);
+            }
+        }
+
+        // check singularity and scale column
+        pivval = A[k * inca + k * lda];
+        if(pivval == T(0))
+        {
+            if(info == 0)
+                info = k + 1; // use Fortran 1-based indexing
+        }
+        else
+        {
+            pivval = S(1) / pivval;
+            for(rocblas_int i = k + 1; i < m; i++)
+                A[i * inca + k * lda] *= pivval;
+        }
+
+        // update trailing matrix
+        for(rocblas_int j = k + 1; j < n; j++)
+        {
+            tmp = A[k * inca + j * lda];
+            for(rocblas_int i = k + 1; i < m; i++)
+                A[i * inca + j * lda] -= A[i * inca + k * lda] * tmp;
+        }
+    }
+
+    infoA[bid] = info;
+}
+
+/** GETRS_INTERLEAVED_KERNEL solves a system of linear equations using
+    the LU factorization computed by GETRF_INTERLEAVED_KERNEL **/
+template <typename T>
+ROCSOLVER_KERNEL void getrs_interleaved_kernel(const rocblas_operation trans,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               T* AA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               const rocblas_int* ipivA,
+                                               const rocblas_stride strideP,
+                                               T* BB,
+                                               const rocblas_int incb,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = AA + bid * strideA;
+    T* B = BB + bid * strideB;
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+
+    bool conjugate = (trans == rocblas_operation_conjugate_transpose);
+    rocblas_int p;
+    T a, tmp;
+
+    for(rocblas_int c = 0; c < nrhs; c++)
+    {
+        T* x = B + c * ldb;
+
+        if(trans == rocblas_operation_none)
+        {
+            // apply row interchanges
+            for(rocblas_int k = 0; k < n; k++)
+            {
+                p = ipiv[k] - 1;
+                if(p != k)
+                    swap(x[k * incb], x[p * incb]);
+            }
+
+            // solve L*y = b
+            for(rocblas_int k = 0; k < n; k++)
+            {
+                tmp = x[k * incb];
+                for(rocblas_int i = k + 1; i < n; i++)
+                    x[i * incb] -= A[i * inca + k * lda] * tmp;
+            }
+
+            // solve U*x = y
+            for(rocblas_int k = n - 1; k >= 0; k--)
+            {
+                tmp = x[k * incb] / A[k * inca + k * lda];
+                x[k * incb] = tmp;
+                for(rocblas_int i = 0; i < k; i++)
+                    x[i * incb] -= A[i * inca + k * lda] * tmp;
+            }
+        }
+        else
+        {
+            // solve U'*y = b
+            for(rocblas_int k = 0; k < n; k++)
+            {
+                tmp = x[k * incb];
+                for(rocblas_int i = 0; i < k; i++)
+                {
+                    a = A[i * inca + k * lda];
+                    tmp -= (conjugate ? conj(a) : a) * x[i * incb];
+                }
+                a = A[k * inca + k * lda];
+                x[k * incb] = tmp / (conjugate ? conj(a) : a);
+            }
+
+            // solve L'*z = y
+            for(rocblas_int k = n - 1; k >= 0; k--)
+            {
+                tmp = x[k * incb];
+                for(rocblas_int i = k + 1; i < n; i++)
+                {
+                    a = A[i * inca + k * lda];
+                    tmp -= (conjugate ? conj(a) : a) * x[i * incb];
+                }
+                x[k * incb] = tmp;
+            }
+
+            // apply row interchanges in reverse order
+            for(rocblas_int k = n - 1; k >= 0; k--)
+            {
+                p = ipiv[k] - 1;
+                if(p != k)
+                    swap(x[k * incb], x[p * incb]);
+            }
+        }
+    }
+}
+
+/** POTRF_INTERLEAVED_KERNEL computes the Cholesky factorization of a
+    hermitian positive definite matrix **/
+template <typename T>
+ROCSOLVER_KERNEL void potrf_interleaved_kernel(const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               T* AA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               rocblas_int* infoA,
+                                               const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = AA + bid * strideA;
+
+    // (the factor is computed as U = L', so that the lower and upper cases
+    // only differ in the strides used to access the matrix)
+    rocblas_int ii = (uplo == rocblas_fill_lower) ? inca : lda;
+    rocblas_int jj = (uplo == rocblas_fill_lower) ? lda : inca;
+    rocblas_int info = 0;
+    S ajj;
+    T tmp;
+
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        // compute diagonal element
+        ajj = std::real(A[j * ii + j * jj]);
+        for(rocblas_int k = 0; k < j; k++)
+        {
+            tmp = A[j * ii + k * jj];
+            ajj -= std::real(tmp * conj(tmp));
+        }
+
+        if(ajj <= 0)
+        {
+            // the matrix is not positive definite
+            A[j * ii + j * jj] = ajj;
+            info = j + 1; // use Fortran 1-based indexing
+            break;
+        }
+        ajj = std::sqrt(ajj);
+        A[j * ii + j * jj] = ajj;
+
+        // compute elements of column j of L
+        for(rocblas_int i = j + 1; i < n; i++)
+        {
+            tmp = (uplo == rocblas_fill_lower) ? A[i * ii + j * jj] : conj(A[i * ii + j * jj]);
+            for(rocblas_int k = 0; k < j; k++)
+            {
+                if(uplo == rocblas_fill_lower)
+                    tmp -= A[i * ii + k * jj] * conj(A[j * ii + k * jj]);
+                else
+                    tmp -= conj(A[i * ii + k * jj]) * A[j * ii + k * jj];
+            }
+            tmp = tmp / ajj;
+            A[i * ii + j * jj] = (uplo == rocblas_fill_lower) ? tmp : conj(tmp);
+        }
+    }
+
+    infoA[bid] = info;
+}
+
+/** POTRS_INTERLEAVED_KERNEL solves a system of linear equations using
+    the Cholesky factorization computed by POTRF_INTERLEAVED_KERNEL **/
+template <typename T>
+ROCSOLVER_KERNEL void potrs_interleaved_kernel(const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               T* AA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               T* BB,
+                                               const rocblas_int incb,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = AA + bid * strideA;
+    T* B = BB + bid * strideB;
+
+    // (element (i,j) of L is element (j,i) of U conjugated)
+    rocblas_int ii = (uplo == rocblas_fill_lower) ? inca : lda;
+    rocblas_int jj = (uplo == rocblas_fill_lower) ? lda : inca;
+    bool conjugate = (uplo == rocblas_fill_upper);
+    T a, tmp;
+
+    for(rocblas_int c = 0; c < nrhs; c++)
+    {
+        T* x = B + c * ldb;
+
+        // solve L*y = b
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            tmp = x[k * incb] / A[k * ii + k * jj];
+            x[k * incb] = tmp;
+            for(rocblas_int i = k + 1; i < n; i++)
+            {
+                a = A[i * ii + k * jj];
+                x[i * incb] -= (conjugate ? conj(a) : a) * tmp;
+            }
+        }
+
+        // solve L'*x = y
+        for(rocblas_int k = n - 1; k >= 0; k--)
+        {
+            tmp = x[k * incb];
+            for(rocblas_int i = k + 1; i < n; i++)
+            {
+                a = A[i * ii + k * jj];
+                tmp -= (conjugate ? a : conj(a)) * x[i * incb];
+            }
+            x[k * incb] = tmp / A[k * ii + k * jj];
+        }
+    }
+}
+
+/*
+ * ===========================================================================
+ *    Argument checking
+ * ===========================================================================
+ */
+
+template <typename T>
+rocblas_status rocsolver_getrf_interleaved_argCheck(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    T A,
+                                                    rocblas_int* ipiv,
+                                                    rocblas_int* info,
+                                                    const bool pivot,
+                                                    const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || inca < 1 || lda < inca * m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (m && n && pivot && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_interleaved_argCheck(rocblas_handle handle,
+                                                    const rocblas_operation trans,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_int incb,
+                                                    const rocblas_int ldb,
+                                                    T A,
+                                                    T B,
+                                                    const rocblas_int* ipiv,
+                                                    const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || inca < 1 || lda < inca * n || incb < 1 || ldb < incb * n
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs && n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_interleaved_argCheck(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    T A,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || inca < 1 || lda < inca * n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrs_interleaved_argCheck(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_int incb,
+                                                    const rocblas_int ldb,
+                                                    T A,
+                                                    T B,
+                                                    const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || inca < 1 || lda < inca * n || incb < 1 || ldb < incb * n
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (nrhs && n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/*
+ * ===========================================================================
+ *    Templates
+ * ===========================================================================
+ */
+
+template <typename T>
+rocblas_status rocsolver_getrf_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    T* A,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const bool pivot,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrf_interleaved", "m:", m, "n:", n, "inca:", inca, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(getrf_interleaved_kernel<T>, grid, threads, 0, stream, m, n, A, inca,
+                            lda, strideA, ipiv, strideP, info, pivot, batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_operation trans,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    T* A,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    T* B,
+                                                    const rocblas_int incb,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrs_interleaved", "trans:", trans, "n:", n, "nrhs:", nrhs, "inca:", inca,
+                    "lda:", lda, "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL(getrs_interleaved_kernel<T>, grid, threads, 0, stream, trans, n, nrhs,
+                            A, inca, lda, strideA, ipiv, strideP, B, incb, ldb, strideB,
+                            batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    T* A,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrf_interleaved", "uplo:", uplo, "n:", n, "inca:", inca, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(potrf_interleaved_kernel<T>, grid, threads, 0, stream, uplo, n, A,
+                            inca, lda, strideA, info, batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrs_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    T* A,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    T* B,
+                                                    const rocblas_int incb,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrs_interleaved", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "inca:", inca,
+                    "lda:", lda, "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL(potrs_interleaved_kernel<T>, grid, threads, 0, stream, uplo, n, nrhs,
+                            A, inca, lda, strideA, B, incb, ldb, strideB, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,213 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** POCON_SOLVE overwrites the work vectors x with inv(A)*x, where A is given by its
+    Cholesky factorization. In the batched case, the vectors are addressed through the
+    array of pointers workArr. **/
+template <bool BATCHED, bool STRIDED, typename T>
+void pocon_solve(rocblas_handle handle,
+                 const rocblas_fill uplo,
+                 const rocblas_int n,
+                 T* A,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 T* x,
+                 T** workArr,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, 1, A, shiftA, lda, strideA, x,
+                                                  0, n, n, batch_count, work1, work2, work3, work4,
+                                                  optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void pocon_solve(rocblas_handle handle,
+                 const rocblas_fill uplo,
+                 const rocblas_int n,
+                 T* const A[],
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 T* x,
+                 T** workArr,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 const bool optim_mem)
+{
+    rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, 1, A, shiftA, lda, strideA,
+                                                  (T* const*)workArr, 0, n, 0, batch_count, work1,
+                                                  work2, work3, work4, optim_mem);
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_pocon_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_pocon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_x,
+                                   size_t* size_isgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_workArr,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_x = 0;
+        *size_isgn = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling POTRS with one right-hand side
+    rocsolver_potrs_getMemorySize<BATCHED, STRIDED, T>(n, 1, batch_count, size_work1, size_work2,
+                                                       size_work3, size_work4, optim_mem);
+
+    // size of the work vectors and of the state of the estimator
+    *size_x = sizeof(T) * n * batch_count;
+    *size_isgn = sizeof(rocblas_int) * n * batch_count;
+    *size_est = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * 3 * batch_count;
+
+    // size of array of pointers to the work vectors (batched case)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* x,
+                                        rocblas_int* isgn,
+                                        S* est,
+                                        rocblas_int* state,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("pocon", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if(BATCHED && n > 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(BS1), 0, stream, workArr, x,
+                                rocblas_stride(n), batch_count);
+    }
+
+    // A is Hermitian, so that the products by inv(A) and inv(A)' coincide
+    // (and the one-norm and infinity-norm are the same)
+    auto solve = [&](const bool adjoint) {
+        pocon_solve<BATCHED, STRIDED, T>(handle, uplo, n, A, shiftA, lda, strideA, x, workArr,
+                                         batch_count, work1, work2, work3, work4, optim_mem);
+    };
+
+    lacn2_estimate<T>(handle, n, x, isgn, est, state, anorm, rcond, batch_count, solve);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,382 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gesv_irs.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_posv_irs_argCheck(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int lda,
+                                           const rocblas_int ldb,
+                                           T A,
+                                           T B,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (nrhs && n && !B) || (batch_count && !iter) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_posv_irs_getMemorySize(const rocblas_int n,
+                                      const rocblas_int nrhs,
+                                      const rocblas_fill uplo,
+                                      const rocblas_int batch_count,
+                                      size_t* size_scalars,
+                                      size_t* size_scalarsLow,
+                                      size_t* size_work1,
+                                      size_t* size_work2,
+                                      size_t* size_work3,
+                                      size_t* size_work4,
+                                      size_t* size_pivots,
+                                      size_t* size_iinfo,
+                                      size_t* size_workArr,
+                                      size_t* size_Alow,
+                                      size_t* size_Xlow,
+                                      size_t* size_X,
+                                      size_t* size_R,
+                                      size_t* size_norms,
+                                      size_t* size_state,
+                                      bool* optim_mem)
+{
+    using Ts = typename irs_single_type<T>::type;
+    using S = decltype(std::real(T{}));
+
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_scalarsLow = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_workArr = 0;
+        *size_Alow = 0;
+        *size_Xlow = 0;
+        *size_X = 0;
+        *size_R = 0;
+        *size_norms = 0;
+        *size_state = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3, opt4;
+    size_t w1, w2, w3, w4, pv, ii;
+
+    // workspace required for calling POTRF and POTRS in full precision
+    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(n, uplo, batch_count, size_scalars,
+                                                       size_work1, size_work2, size_work3,
+                                                       size_work4, size_pivots, size_iinfo, &opt1);
+    rocsolver_potrs_getMemorySize<BATCHED, STRIDED, T>(n, nrhs, batch_count, &w1, &w2, &w3, &w4,
+                                                       &opt2);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // workspace required for calling POTRF and POTRS in lower precision
+    // (the factorization is stored in a strided workspace)
+    rocsolver_potrf_getMemorySize<false, true, Ts>(n, uplo, batch_count, size_scalarsLow, &w1, &w2,
+                                                   &w3, &w4, &pv, &ii, &opt3);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *size_pivots = std::max(*size_pivots, pv);
+    *size_iinfo = std::max(*size_iinfo, ii);
+
+    rocsolver_potrs_getMemorySize<false, true, Ts>(n, nrhs, batch_count, &w1, &w2, &w3, &w4, &opt4);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    *optim_mem = opt1 && opt2 && opt3 && opt4;
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+
+    // lower-precision copies of A and of the right-hand sides/corrections
+    // (if some instances are solved in full precision, the first one is reused to save A of
+    // the instances that converged)
+    *size_Alow = sizeof(T) * n * n * batch_count;
+    *size_Xlow = sizeof(Ts) * n * nrhs * batch_count;
+
+    // current solutions and residuals
+    *size_X = sizeof(T) * n * nrhs * batch_count;
+    *size_R = sizeof(T) * n * nrhs * batch_count;
+
+    // norms of A and state of the refinement
+    *size_norms = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * (2 + 3 * batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_posv_irs_template(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           U B,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count,
+                                           T* scalars,
+                                           void* scalarsLow,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4,
+                                           void* pivots,
+                                           rocblas_int* iinfo,
+                                           T** workArr,
+                                           void* Alow,
+                                           void* Xlow,
+                                           T* X,
+                                           T* R,
+                                           void* norms,
+                                           rocblas_int* state,
+                                           bool optim_mem)
+{
+    ROCSOLVER_ENTER("posv_irs", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    using Ts = typename irs_single_type<T>::type;
+    using S = decltype(std::real(T{}));
+    using Ss = decltype(std::real(Ts{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 and iter=0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, 0);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T minone = -1;
+    T one = 1;
+
+    // constants in host memory
+    const rocblas_int copyblocksx = (n - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+    const rocblas_stride strideX = rocblas_stride(n) * nrhs;
+    const S eps = get_epsilon<S>();
+    Ts* As = (Ts*)Alow;
+    Ts* Xs = (Ts*)Xlow;
+    rocblas_int* status = state + 2;
+    rocblas_int* ovf = status + batch_count;
+    rocblas_int h_state[2];
+
+    // initialize the state of the refinement
+    rocblas_int blocksState = (2 + 3 * batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksState), threads, 0, stream, state,
+                            2 + 3 * batch_count, 0);
+
+    // compute the norms of A and convert A to lower precision
+    ROCSOLVER_LAUNCH_KERNEL((irs_mat_norm<T>), dim3(batch_count), threads, 0, stream, n, A,
+                            shiftA, lda, strideA, (S*)norms, uplo);
+    ROCSOLVER_LAUNCH_KERNEL((irs_lower_mat<T>), dim3(copyblocksx, copyblocksx, batch_count),
+                            dim3(32, 32), 0, stream, n, n, A, shiftA, lda, strideA, As, status,
+                            ovf, uplo);
+
+    // compute Cholesky factorization in lower precision
+    rocsolver_potrf_template<false, true, Ts, Ss>(handle, uplo, n, As, 0, n, rocblas_stride(n) * n,
+                                                  info, batch_count, (Ts*)scalarsLow, work1, work2,
+                                                  work3, work4, (Ts*)pivots, iinfo, optim_mem);
+
+    // convert B to lower precision and find initial solutions
+    ROCSOLVER_LAUNCH_KERNEL((irs_lower_mat<T>), dim3(copyblocksx, copyblocksy, batch_count),
+                            dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, Xs, status,
+                            ovf, rocblas_fill_full);
+    ROCSOLVER_LAUNCH_KERNEL(irs_update_state<T>, gridReset, threads, 0, stream, -1, iter, info,
+                            state, batch_count);
+
+    rocsolver_potrs_template<false, true, Ts>(handle, uplo, n, nrhs, As, 0, n,
+                                              rocblas_stride(n) * n, Xs, 0, n, strideX, batch_count,
+                                              work1, work2, work3, work4, optim_mem);
+    ROCSOLVER_LAUNCH_KERNEL(irs_raise_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                            dim3(32, 32), 0, stream, false, n, nrhs, X, Xs, status, ovf);
+
+    // iterative refinement
+    // (the instances that finished are skipped by the conversions and the convergence check;
+    // the state is read back by the host only every IRS_CHECK_STEPS steps, or never while
+    // the stream is being captured, in which case all the steps are executed)
+    hipStreamCaptureStatus capture_status;
+    HIP_CHECK(hipStreamIsCapturing(stream, &capture_status));
+    const bool capturing = (capture_status != hipStreamCaptureStatusNone);
+    bool done = false;
+    h_state[1] = 0;
+
+    for(rocblas_int k = 0; k <= IRS_MAX_ITERS && !done; k++)
+    {
+        if(k > 0)
+        {
+            // compute corrections in lower precision and update solutions
+            ROCSOLVER_LAUNCH_KERNEL((irs_lower_mat<T>), dim3(copyblocksx, copyblocksy, batch_count),
+                                    dim3(32, 32), 0, stream, n, nrhs, R, 0, n, strideX, Xs, status,
+                                    ovf, rocblas_fill_full);
+            rocsolver_potrs_template<false, true, Ts>(handle, uplo, n, nrhs, As, 0, n,
+                                                      rocblas_stride(n) * n, Xs, 0, n, strideX,
+                                                      batch_count, work1, work2, work3, work4,
+                                                      optim_mem);
+            ROCSOLVER_LAUNCH_KERNEL(irs_raise_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                    dim3(32, 32), 0, stream, true, n, nrhs, X, Xs, status, ovf);
+        }
+
+        // compute residuals R = B - AX in full precision
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, R, 0,
+                                n, strideX);
+        rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n, nrhs, &minone, A, shiftA, lda,
+                              strideA, X, 0, n, strideX, &one, R, 0, n, strideX, batch_count,
+                              workArr);
+
+        // check convergence
+        ROCSOLVER_LAUNCH_KERNEL(irs_check_residual<T>, dim3(nrhs, batch_count), threads, 0, stream,
+                                n, nrhs, X, R, (S*)norms, eps, status, status + 2 * batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(irs_update_state<T>, gridReset, threads, 0, stream, k, iter, info,
+                                state, batch_count);
+        ROCBLAS_CHECK(
+            rocsolver_irs_check_done(stream, k, capturing, state, h_state, batch_count, &done));
+    }
+
+    if(!capturing && h_state[1] == 0)
+    {
+        // all the instances converged; copy the solutions to B
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, X, 0, n, strideX, B, shiftB, ldb,
+                                strideB);
+    }
+    else
+    {
+        // solve in full precision the systems whose refinement did not succeed; the other
+        // instances keep A and the refined solutions
+        rocblas_int* failed = status + 2 * batch_count;
+        rocblas_int* finfo = ovf;
+        T* Asave = (T*)Alow;
+
+        ROCSOLVER_LAUNCH_KERNEL(irs_set_fallback<T>, gridReset, threads, 0, stream, state,
+                                batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksx, batch_count),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, n, A, shiftA, lda,
+                                strideA, Asave, info_mask(failed, info_mask::negate), uplo);
+
+        rocsolver_potrf_template<BATCHED, STRIDED, T, S>(
+            handle, uplo, n, A, shiftA, lda, strideA, finfo, batch_count, scalars, work1, work2,
+            work3, work4, (T*)pivots, iinfo, optim_mem);
+
+        // save elements of B that will be overwritten by POTRS for cases where info is nonzero
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb,
+                                strideB, R, info_mask(finfo));
+
+        rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, A, shiftA, lda,
+                                                      strideA, B, shiftB, ldb, strideB, batch_count,
+                                                      work1, work2, work3, work4, optim_mem);
+
+        // restore elements of B that were overwritten by POTRS in cases where info is nonzero
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, R, info_mask(finfo));
+
+        // restore A, and copy the solutions to B, for the instances that converged
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksx, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, n, A, shiftA, lda,
+                                strideA, Asave, info_mask(failed, info_mask::negate), uplo);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, X, info_mask(failed, info_mask::negate));
+        ROCSOLVER_LAUNCH_KERNEL(irs_set_info<T>, gridReset, threads, 0, stream, info, state,
+                                batch_count);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,109 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_potdet.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_potdet_impl(rocblas_handle handle,
+                                     const rocblas_int n,
+                                     U A,
+                                     const rocblas_int lda,
+                                     S* logdet)
+{
+    ROCSOLVER_ENTER_TOP("potdet", "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potdet_argCheck<T>(handle, n, lda, A, logdet);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_potdet_template<T>(handle, n, A, shiftA, lda, strideA, logdet, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotdet(rocblas_handle handle,
+                                 const rocblas_int n,
+                                 float* A,
+                                 const rocblas_int lda,
+                                 float* logdet)
+{
+    return rocsolver::rocsolver_potdet_impl<float>(handle, n, A, lda, logdet);
+}
+
+rocblas_status rocsolver_dpotdet(rocblas_handle handle,
+                                 const rocblas_int n,
+                                 double* A,
+                                 const rocblas_int lda,
+                                 double* logdet)
+{
+    return rocsolver::rocsolver_potdet_impl<double>(handle, n, A, lda, logdet);
+}
+
+rocblas_status rocsolver_cpotdet(rocblas_handle handle,
+                                 const rocblas_int n,
+                                 rocblas_float_complex* A,
+                                 const rocblas_int lda,
+                                 float* logdet)
+{
+    return rocsolver::rocsolver_potdet_impl<rocblas_float_complex>(handle, n, A, lda, logdet);
+}
+
+rocblas_status rocsolver_zpotdet(rocblas_handle handle,
+                                 const rocblas_int n,
+                                 rocblas_double_complex* A,
+                                 const rocblas_int lda,
+                                 double* logdet)
+{
+    return rocsolver::rocsolver_potdet_impl<rocblas_double_complex>(handle, n, A, lda, logdet);
+}
+}
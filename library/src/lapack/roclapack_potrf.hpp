@@ -36,6 +36,7 @@
 #include "roclapack_potf2.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_side_stream.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -191,10 +192,34 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
 
     // constants for rocblas functions calls
     T t_one = 1;
+    T t_minone = -1;
     S s_one = 1;
     S s_minone = -1;
 
-    rocblas_int jb, j = 0;
+    // with look-ahead, the next diagonal block and panel are factorized while the rest
+    // of the trailing matrix is updated in a secondary stream
+    // (the largest update in the secondary stream is that of the first iteration)
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+    bool lookahead = !ISBATCHED && n >= POTRF_LOOKAHEAD_MIN_SIZE;
+    rocsolver_side_stream side(handle);
+    if(lookahead)
+    {
+        rocblas_operation trans = (uplo == rocblas_fill_upper)
+            ? rocblas_operation_conjugate_transpose
+            : rocblas_operation_none;
+        ROCBLAS_CHECK(side.init([&](rocblas_handle h) {
+            return rocblasCall_syrk_herk<BATCHED, T>(h, uplo, trans, std::max(n - 2 * nb, 0), nb,
+                                                     &s_minone, A, shiftA, lda, strideA, &s_one,
+                                                     A, shiftA, lda, strideA, batch_count);
+        }));
+        lookahead = side.active();
+    }
+
+    rocblas_int jb, jbn, j = 0;
+
+    // factorized indicates that the current diagonal block and panel were already
+    // factorized in the previous iteration (look-ahead)
+    bool factorized = false;
 
     // (TODO: When the matrix is detected to be non positive definite, we need to
     //  prevent TRSM and HERK to modify further the input matrix; ideally with no
@@ -205,29 +230,79 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         // Compute the Cholesky factorization A = U'*U.
         while(j < n - POTRF_POTF2_SWITCHSIZE(T))
         {
-            // Factor diagonal and subdiagonal blocks
             jb = std::min(n - j, nb); // number of columns in the block
-            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
-            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                        strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
-
-            // test for non-positive-definiteness.
-            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                    batch_count);
+            if(!factorized)
+            {
+                // Factor diagonal and subdiagonal blocks
+                ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo,
+                                        batch_count, 0);
+                rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
+                                            strideA, iinfo, batch_count, scalars, (T*)work1,
+                                            pivots);
+
+                // test for non-positive-definiteness.
+                ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo,
+                                        info, j, batch_count);
+
+                if(j + jb < n)
+                    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                        rocblas_diagonal_non_unit, jb, (n - j - jb), A, shiftA + idx2D(j, j, lda),
+                        lda, strideA, A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count,
+                        optim_mem, work1, work2, work3, work4);
+            }
+            factorized = false;
 
             if(j + jb < n)
             {
                 // update trailing submatrix
-                rocsolver_trsm_upper<BATCHED, STRIDED, T>(
-                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
-                    rocblas_diagonal_non_unit, jb, (n - j - jb), A, shiftA + idx2D(j, j, lda), lda,
-                    strideA, A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count,
-                    optim_mem, work1, work2, work3, work4);
-
-                rocblasCall_syrk_herk<BATCHED, T>(
-                    handle, uplo, rocblas_operation_conjugate_transpose, n - j - jb, jb, &s_minone,
-                    A, shiftA + idx2D(j, j + jb, lda), lda, strideA, &s_one, A,
-                    shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+                jbn = std::min(n - j - jb, nb); // size of the next block
+                if(lookahead && j + jb < n - POTRF_POTF2_SWITCHSIZE(T) && j + jb + jbn < n)
+                {
+                    // update the next diagonal block and row panel first
+                    rocblasCall_syrk_herk<BATCHED, T>(
+                        handle, uplo, rocblas_operation_conjugate_transpose, jbn, jb, &s_minone,
+                        A, shiftA + idx2D(j, j + jb, lda), lda, strideA, &s_one, A,
+                        shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+                    rocsolver_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, jbn,
+                        n - j - jb - jbn, jb, &t_minone, A, shiftA + idx2D(j, j + jb, lda), lda,
+                        strideA, A, shiftA + idx2D(j, j + jb + jbn, lda), lda, strideA, &t_one, A,
+                        shiftA + idx2D(j + jb, j + jb + jbn, lda), lda, strideA, batch_count,
+                        (T**)nullptr);
+
+                    // update the rest of the trailing submatrix in the secondary stream
+                    ROCBLAS_CHECK(side.begin());
+                    rocblasCall_syrk_herk<BATCHED, T>(
+                        side.get_handle(), uplo, rocblas_operation_conjugate_transpose,
+                        n - j - jb - jbn, jb, &s_minone, A, shiftA + idx2D(j, j + jb + jbn, lda),
+                        lda, strideA, &s_one, A, shiftA + idx2D(j + jb + jbn, j + jb + jbn, lda),
+                        lda, strideA, batch_count);
+
+                    // meanwhile, factor the next diagonal block and row panel
+                    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo,
+                                            batch_count, 0);
+                    rocsolver_potf2_template<T>(handle, uplo, jbn, A,
+                                                shiftA + idx2D(j + jb, j + jb, lda), lda, strideA,
+                                                iinfo, batch_count, scalars, (T*)work1, pivots);
+                    ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo,
+                                            info, j + jb, batch_count);
+                    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                        rocblas_diagonal_non_unit, jbn, n - j - jb - jbn, A,
+                        shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, A,
+                        shiftA + idx2D(j + jb, j + jb + jbn, lda), lda, strideA, batch_count,
+                        optim_mem, work1, work2, work3, work4);
+                    ROCBLAS_CHECK(side.join());
+                    factorized = true;
+                }
+                else
+                {
+                    rocblasCall_syrk_herk<BATCHED, T>(
+                        handle, uplo, rocblas_operation_conjugate_transpose, n - j - jb, jb,
+                        &s_minone, A, shiftA + idx2D(j, j + jb, lda), lda, strideA, &s_one, A,
+                        shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+                }
             }
             j += nb;
         }
@@ -237,29 +312,80 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         // Compute the Cholesky factorization A = L*L'.
         while(j < n - POTRF_POTF2_SWITCHSIZE(T))
         {
-            // Factor diagonal and subdiagonal blocks
             jb = std::min(n - j, nb); // number of columns in the block
-            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
-            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                        strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
-
-            // test for non-positive-definiteness.
-            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                    batch_count);
+            if(!factorized)
+            {
+                // Factor diagonal and subdiagonal blocks
+                ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo,
+                                        batch_count, 0);
+                rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
+                                            strideA, iinfo, batch_count, scalars, (T*)work1,
+                                            pivots);
+
+                // test for non-positive-definiteness.
+                ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo,
+                                        info, j, batch_count);
+
+                if(j + jb < n)
+                    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                        rocblas_diagonal_non_unit, (n - j - jb), jb, A, shiftA + idx2D(j, j, lda),
+                        lda, strideA, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count,
+                        optim_mem, work1, work2, work3, work4);
+            }
+            factorized = false;
 
             if(j + jb < n)
             {
                 // update trailing submatrix
-                rocsolver_trsm_lower<BATCHED, STRIDED, T>(
-                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
-                    rocblas_diagonal_non_unit, (n - j - jb), jb, A, shiftA + idx2D(j, j, lda), lda,
-                    strideA, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count,
-                    optim_mem, work1, work2, work3, work4);
-
-                rocblasCall_syrk_herk<BATCHED, T>(
-                    handle, uplo, rocblas_operation_none, n - j - jb, jb, &s_minone, A,
-                    shiftA + idx2D(j + jb, j, lda), lda, strideA, &s_one, A,
-                    shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+                jbn = std::min(n - j - jb, nb); // size of the next block
+                if(lookahead && j + jb < n - POTRF_POTF2_SWITCHSIZE(T) && j + jb + jbn < n)
+                {
+                    // update the next diagonal block and column panel first
+                    rocblasCall_syrk_herk<BATCHED, T>(
+                        handle, uplo, rocblas_operation_none, jbn, jb, &s_minone, A,
+                        shiftA + idx2D(j + jb, j, lda), lda, strideA, &s_one, A,
+                        shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+                    rocsolver_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                        n - j - jb - jbn, jbn, jb, &t_minone, A,
+                        shiftA + idx2D(j + jb + jbn, j, lda), lda, strideA, A,
+                        shiftA + idx2D(j + jb, j, lda), lda, strideA, &t_one, A,
+                        shiftA + idx2D(j + jb + jbn, j + jb, lda), lda, strideA, batch_count,
+                        (T**)nullptr);
+
+                    // update the rest of the trailing submatrix in the secondary stream
+                    ROCBLAS_CHECK(side.begin());
+                    rocblasCall_syrk_herk<BATCHED, T>(
+                        side.get_handle(), uplo, rocblas_operation_none, n - j - jb - jbn, jb,
+                        &s_minone, A, shiftA + idx2D(j + jb + jbn, j, lda), lda, strideA, &s_one,
+                        A, shiftA + idx2D(j + jb + jbn, j + jb + jbn, lda), lda, strideA,
+                        batch_count);
+
+                    // meanwhile, factor the next diagonal block and column panel
+                    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo,
+                                            batch_count, 0);
+                    rocsolver_potf2_template<T>(handle, uplo, jbn, A,
+                                                shiftA + idx2D(j + jb, j + jb, lda), lda, strideA,
+                                                iinfo, batch_count, scalars, (T*)work1, pivots);
+                    ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo,
+                                            info, j + jb, batch_count);
+                    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                        rocblas_diagonal_non_unit, n - j - jb - jbn, jbn, A,
+                        shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, A,
+                        shiftA + idx2D(j + jb + jbn, j + jb, lda), lda, strideA, batch_count,
+                        optim_mem, work1, work2, work3, work4);
+                    ROCBLAS_CHECK(side.join());
+                    factorized = true;
+                }
+                else
+                {
+                    rocblasCall_syrk_herk<BATCHED, T>(
+                        handle, uplo, rocblas_operation_none, n - j - jb, jb, &s_minone, A,
+                        shiftA + idx2D(j + jb, j, lda), lda, strideA, &s_one, A,
+                        shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+                }
             }
             j += nb;
         }
@@ -274,6 +400,7 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                 batch_count);
     }
 
+    ROCBLAS_CHECK(side.release());
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_potrf.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -91,13 +92,20 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     work4 = mem[4];
     pivots = mem[5];
     iinfo = mem[6];
-    if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_potrf_template<true, false, T, S>(
-        handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, work1, work2,
-        work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+    auto launch = [&]() {
+        if(size_scalars > 0)
+            init_scalars(handle, (T*)scalars);
+
+        return rocsolver_potrf_template<true, false, T, S>(
+            handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, work1, work2,
+            work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "potrf_batched", launch, uplo, n, A, lda, info,
+                                         batch_count, scalars, work1, work2, work3, work4, pivots,
+                                         iinfo);
 }
 
 ROCSOLVER_END_NAMESPACE
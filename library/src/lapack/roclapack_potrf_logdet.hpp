@@ -0,0 +1,144 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_potdet.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_potrf_logdet_argCheck(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int lda,
+                                               U A,
+                                               S* logdet,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !logdet) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_potrf_logdet_getMemorySize(const rocblas_int n,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int batch_count,
+                                          size_t* size_scalars,
+                                          size_t* size_work1,
+                                          size_t* size_work2,
+                                          size_t* size_work3,
+                                          size_t* size_work4,
+                                          size_t* size_pivots,
+                                          size_t* size_iinfo,
+                                          bool* optim_mem)
+{
+    // if quick return, or if the factorization is done in registers, no workspace is needed
+    if(n == 0 || batch_count == 0 || n <= POTF2_REG_MAX_SIZE(T))
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // requirements for calling POTRF
+    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(n, uplo, batch_count, size_scalars,
+                                                       size_work1, size_work2, size_work3,
+                                                       size_work4, size_pivots, size_iinfo,
+                                                       optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_potrf_logdet_template(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               S* logdet,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               T* scalars,
+                                               void* work1,
+                                               void* work2,
+                                               void* work3,
+                                               void* work4,
+                                               T* pivots,
+                                               rocblas_int* iinfo,
+                                               const bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrf_logdet", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // tiny matrices are factorized and reduced in registers;
+    // the factor is not written back
+    if(n > 0 && n <= POTF2_REG_MAX_SIZE(T))
+        return potrf_logdet_run_reg<T>(handle, uplo, n, A, shiftA, lda, strideA, logdet, info,
+                                       batch_count);
+
+    // factorize in place and reduce the factor
+    rocsolver_potrf_template<BATCHED, STRIDED, T, S>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                                     batch_count, scalars, work1, work2, work3,
+                                                     work4, pivots, iinfo, optim_mem);
+
+    return rocsolver_potdet_template<T>(handle, n, A, shiftA, lda, strideA, logdet, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
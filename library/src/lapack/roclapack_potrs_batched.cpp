@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_potrs.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -83,9 +84,14 @@ rocblas_status rocsolver_potrs_batched_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // execution
-    return rocsolver_potrs_template<true, false, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
-                                                    B, shiftB, ldb, strideB, batch_count, work1,
-                                                    work2, work3, work4, optim_mem);
+    auto launch = [&]() {
+        return rocsolver_potrs_template<true, false, T>(
+            handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
+            work1, work2, work3, work4, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "potrs_batched", launch, uplo, n, nrhs, A, lda, B,
+                                         ldb, batch_count, work1, work2, work3, work4);
 }
 
 ROCSOLVER_END_NAMESPACE
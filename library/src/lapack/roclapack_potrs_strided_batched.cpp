@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_potrs.hpp"
+#include "rocsolver_graph_cache.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -33,14 +34,14 @@ template <typename T, typename U>
 rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
                                                     const rocblas_fill uplo,
                                                     const rocblas_int n,
-                                                    const rocblas_int nrhs,
+                                                    rocblas_int nrhs,
                                                     U A,
                                                     const rocblas_int lda,
                                                     const rocblas_stride strideA,
                                                     U B,
-                                                    const rocblas_int ldb,
-                                                    const rocblas_stride strideB,
-                                                    const rocblas_int batch_count)
+                                                    rocblas_int ldb,
+                                                    rocblas_stride strideB,
+                                                    rocblas_int batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrs_strided_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda",
                         lda, "--strideA", strideA, "--ldb", ldb, "--strideB", strideB,
@@ -54,6 +55,11 @@ rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    // broadcast mode: if all the instances share the same factorization,
+    // solve the right hand sides as a single system whenever possible
+    if(strideA == 0)
+        fold_broadcast_rhs(n, nrhs, ldb, strideB, batch_count);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftB = 0;
@@ -82,9 +88,15 @@ rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // execution
-    return rocsolver_potrs_template<false, true, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
-                                                    B, shiftB, ldb, strideB, batch_count, work1,
-                                                    work2, work3, work4, optim_mem);
+    auto launch = [&]() {
+        return rocsolver_potrs_template<false, true, T>(
+            handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
+            work1, work2, work3, work4, optim_mem);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "potrs_strided_batched", launch, uplo, n, nrhs, A,
+                                         lda, strideA, B, ldb, strideB, batch_count, work1, work2,
+                                         work3, work4);
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,155 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_ptsv.hpp"
+#include "rocsolver_graph_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S>
+rocblas_status rocsolver_ptsv_impl(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   S* D,
+                                   T* E,
+                                   T* B,
+                                   const rocblas_int ldb,
+                                   rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("ptsv", "-n", n, "--nrhs", nrhs, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_ptsv_argCheck(handle, n, nrhs, 1, 1, ldb, D, E, B, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with contiguous vectors
+    rocblas_int incd = 1;
+    rocblas_int incb = 1;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideD = 0;
+    rocblas_stride strideE = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the workspace for the parallel cyclic reduction
+    size_t size_work;
+    rocsolver_ptsv_getMemorySize<T>(n, nrhs, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    auto launch = [&]() {
+        return rocsolver_ptsv_template<T>(handle, n, nrhs, D, E, incd, strideD, strideE, B, incb,
+                                          ldb, strideB, info, batch_count, (T*)work);
+    };
+
+    return rocsolver_graph_cache::run<T>(handle, "ptsv", launch, n, nrhs, D, E, incd, strideD,
+                                         strideE, B, incb, ldb, strideB, info, batch_count, work);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sptsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               float* D,
+                               float* E,
+                               float* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver::rocsolver_ptsv_impl<float>(handle, n, nrhs, D, E, B, ldb, info);
+}
+
+rocblas_status rocsolver_dptsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               double* D,
+                               double* E,
+                               double* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver::rocsolver_ptsv_impl<double>(handle, n, nrhs, D, E, B, ldb, info);
+}
+
+rocblas_status rocsolver_cptsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               float* D,
+                               rocblas_float_complex* E,
+                               rocblas_float_complex* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver::rocsolver_ptsv_impl<rocblas_float_complex>(handle, n, nrhs, D, E, B, ldb,
+                                                                 info);
+}
+
+rocblas_status rocsolver_zptsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               double* D,
+                               rocblas_double_complex* E,
+                               rocblas_double_complex* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver::rocsolver_ptsv_impl<rocblas_double_complex>(handle, n, nrhs, D, E, B, ldb,
+                                                                  info);
+}
+
+} // extern C
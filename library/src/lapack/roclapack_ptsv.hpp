@@ -0,0 +1,362 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** PTSV_KERNEL computes the L*D*L' factorization of a hermitian positive definite
+    tridiagonal matrix and, if solve = true, uses it to solve the system. Each thread
+    works on one instance of the batch (Thomas algorithm). **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void ptsv_kernel(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  S* DA,
+                                  T* EA,
+                                  const rocblas_int incd,
+                                  const rocblas_stride strideD,
+                                  const rocblas_stride strideE,
+                                  T* BB,
+                                  const rocblas_int incb,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride strideB,
+                                  rocblas_int* infoA,
+                                  const bool solve,
+                                  const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    S* d = DA + bid * strideD;
+    T* e = EA + bid * strideE;
+    T* B = BB + bid * strideB;
+
+    S di;
+    T ei;
+
+    // factorization
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        di = d[i * incd];
+        if(di <= 0)
+        {
+            // the matrix is not positive definite
+            infoA[bid] = i + 1; // use Fortran 1-based indexing
+            return;
+        }
+
+        ei = e[i * incd];
+        e[i * incd] = ei / di;
+        d[(i + 1) * incd] -= std::real(ei * conj(ei)) / di;
+    }
+
+    if(d[(n - 1) * incd] <= 0)
+    {
+        infoA[bid] = n; // use Fortran 1-based indexing
+        return;
+    }
+    infoA[bid] = 0;
+
+    if(!solve)
+        return;
+
+    // solve L*D*L'*X = B
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        T* x = B + j * ldb;
+
+        for(rocblas_int i = 1; i < n; i++)
+            x[i * incb] -= x[(i - 1) * incb] * e[(i - 1) * incd];
+
+        x[(n - 1) * incb] = x[(n - 1) * incb] / d[(n - 1) * incd];
+        for(rocblas_int i = n - 2; i >= 0; i--)
+            x[i * incb] = x[i * incb] / d[i * incd] - x[(i + 1) * incb] * conj(e[i * incd]);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    Parallel cyclic reduction (PCR) kernels. The coefficients of the systems
+ *    are copied to a workspace holding, for each instance of the batch, two
+ *    buffers of size n * (3 + nrhs): the sub-diagonal, the diagonal, the
+ *    super-diagonal, and the right-hand sides. Every step of the reduction
+ *    decouples each equation from its neighbors at distance s, reading one
+ *    buffer and writing the other, so that after ceil(log2(n)) steps the
+ *    systems are diagonal.
+ * ===========================================================================
+ */
+
+/** PTSV_PCR_INIT copies the tridiagonal systems to the first buffer of the
+    workspace **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void ptsv_pcr_init(const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    S* DA,
+                                    T* EA,
+                                    const rocblas_int incd,
+                                    const rocblas_stride strideD,
+                                    const rocblas_stride strideE,
+                                    T* BB,
+                                    const rocblas_int incb,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride strideB,
+                                    T* work)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(i >= n)
+        return;
+
+    // batch instance
+    S* d = DA + bid * strideD;
+    T* e = EA + bid * strideE;
+    T* B = BB + bid * strideB;
+    T* W = work + bid * 2 * size_t(n) * (3 + nrhs);
+
+    W[i] = (i > 0) ? e[(i - 1) * incd] : T(0);
+    W[n + i] = d[i * incd];
+    W[2 * n + i] = (i < n - 1) ? conj(e[i * incd]) : T(0);
+    for(rocblas_int j = 0; j < nrhs; j++)
+        W[(3 + j) * n + i] = B[i * incb + j * ldb];
+}
+
+/** PTSV_PCR_STEP executes one step of the reduction, eliminating the
+    couplings between equations i and i-s, and i and i+s **/
+template <typename T>
+ROCSOLVER_KERNEL void ptsv_pcr_step(const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    const rocblas_int s,
+                                    const rocblas_int src,
+                                    T* work)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(i >= n)
+        return;
+
+    // batch instance
+    size_t ldw = size_t(n) * (3 + nrhs);
+    T* cur = work + bid * 2 * ldw + src * ldw;
+    T* nxt = work + bid * 2 * ldw + (1 - src) * ldw;
+
+    T k1 = 0, k2 = 0, a = 0, c = 0;
+    T b = cur[n + i];
+    if(i >= s)
+    {
+        k1 = cur[i] / cur[n + i - s];
+        a = -cur[i - s] * k1;
+        b -= cur[2 * n + i - s] * k1;
+    }
+    if(i + s < n)
+    {
+        k2 = cur[2 * n + i] / cur[n + i + s];
+        c = -cur[2 * n + i + s] * k2;
+        b -= cur[i + s] * k2;
+    }
+    nxt[i] = a;
+    nxt[n + i] = b;
+    nxt[2 * n + i] = c;
+
+    T r;
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        r = cur[(3 + j) * n + i];
+        if(i >= s)
+            r -= cur[(3 + j) * n + i - s] * k1;
+        if(i + s < n)
+            r -= cur[(3 + j) * n + i + s] * k2;
+        nxt[(3 + j) * n + i] = r;
+    }
+}
+
+/** PTSV_PCR_SOLVE writes the solution of the (now diagonal) systems to B,
+    for those instances that are positive definite **/
+template <typename T>
+ROCSOLVER_KERNEL void ptsv_pcr_solve(const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     const rocblas_int src,
+                                     T* work,
+                                     T* BB,
+                                     const rocblas_int incb,
+                                     const rocblas_int ldb,
+                                     const rocblas_stride strideB,
+                                     rocblas_int* infoA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(i >= n || infoA[bid] != 0)
+        return;
+
+    // batch instance
+    size_t ldw = size_t(n) * (3 + nrhs);
+    T* cur = work + bid * 2 * ldw + src * ldw;
+    T* B = BB + bid * strideB;
+
+    T b = cur[n + i];
+    for(rocblas_int j = 0; j < nrhs; j++)
+        B[i * incb + j * ldb] = cur[(3 + j) * n + i] / b;
+}
+
+/** PTSV_USE_PCR returns true if the systems are long enough, and the batch small
+    enough, for PCR to be faster than the Thomas algorithm **/
+inline bool ptsv_use_pcr(const rocblas_int n, const rocblas_int batch_count)
+{
+    return n >= PTSV_PCR_MIN_SIZE && batch_count <= PTSV_PCR_MAX_BATCH;
+}
+
+template <typename T>
+void rocsolver_ptsv_getMemorySize(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_int batch_count,
+                                  size_t* size_work)
+{
+    // if quick return, or the Thomas algorithm is used, no workspace needed
+    if(n == 0 || batch_count == 0 || !ptsv_use_pcr(n, batch_count))
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // two buffers per instance for the PCR ping-pong
+    *size_work = sizeof(T) * 2 * size_t(n) * (3 + nrhs) * batch_count;
+}
+
+template <typename S, typename T>
+rocblas_status rocsolver_ptsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int incd,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       S D,
+                                       T E,
+                                       T B,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || incd < 1 || incb < 1 || ldb < incb * n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || (n && nrhs && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_ptsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       S* D,
+                                       T* E,
+                                       const rocblas_int incd,
+                                       const rocblas_stride strideD,
+                                       const rocblas_stride strideE,
+                                       T* B,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* work)
+{
+    ROCSOLVER_ENTER("ptsv", "n:", n, "nrhs:", nrhs, "incd:", incd, "incb:", incb, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with info = 0
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    if(!ptsv_use_pcr(n, batch_count))
+    {
+        // Thomas algorithm
+        ROCSOLVER_LAUNCH_KERNEL((ptsv_kernel<T, S>), grid, threads, 0, stream, n, nrhs, D, E,
+                                incd, strideD, strideE, B, incb, ldb, strideB, info, true,
+                                batch_count);
+        return rocblas_status_success;
+    }
+
+    // PCR; the systems are copied to the workspace before the factorization
+    // overwrites D and E, and the factorization determines info
+    rocblas_int blocksn = (n - 1) / BS1 + 1;
+    dim3 gridn(blocksn, batch_count, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL((ptsv_pcr_init<T, S>), gridn, threads, 0, stream, n, nrhs, D, E, incd,
+                            strideD, strideE, B, incb, ldb, strideB, work);
+
+    ROCSOLVER_LAUNCH_KERNEL((ptsv_kernel<T, S>), grid, threads, 0, stream, n, nrhs, D, E, incd,
+                            strideD, strideE, B, incb, ldb, strideB, info, false, batch_count);
+
+    rocblas_int src = 0;
+    for(rocblas_int s = 1; s < n; s *= 2)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(ptsv_pcr_step<T>, gridn, threads, 0, stream, n, nrhs, s, src, work);
+        src = 1 - src;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(ptsv_pcr_solve<T>, gridn, threads, 0, stream, n, nrhs, src, work, B,
+                            incb, ldb, strideB, info);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
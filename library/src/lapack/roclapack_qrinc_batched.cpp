@@ -0,0 +1,151 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#include "roclapack_qrupdate.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U, typename V>
+rocblas_status rocsolver_qrinc_batched_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            U Q,
+                                            const rocblas_int ldq,
+                                            U R,
+                                            const rocblas_int ldr,
+                                            const rocblas_int j,
+                                            V x,
+                                            const rocblas_int incx,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("qrinc_batched", "-m", m, "-n", n, "--ldq", ldq, "--ldr", ldr, "-j", j,
+                        "--incx", incx, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qrinc_argCheck(handle, m, n, Q, ldq, R, ldr, j, x, incx,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftQ = 0;
+    rocblas_stride shiftR = 0;
+    rocblas_stride shiftx = 0;
+
+    // batched execution
+    rocblas_stride strideQ = 0;
+    rocblas_stride strideR = 0;
+    rocblas_stride stridex = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_qrinc_template<T>(handle, m, n, Q, shiftQ, ldq, strideQ, R, shiftR, ldr,
+                                       strideR, j, x, shiftx, incx, stridex, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqrinc_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        float* const Q[],
+                                        const rocblas_int ldq,
+                                        float* const R[],
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        float* const x[],
+                                        const rocblas_int incx,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_qrinc_batched_impl<float>(handle, m, n, Q, ldq, R, ldr, j, x, incx,
+                                                          batch_count);
+}
+
+rocblas_status rocsolver_dqrinc_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        double* const Q[],
+                                        const rocblas_int ldq,
+                                        double* const R[],
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        double* const x[],
+                                        const rocblas_int incx,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_qrinc_batched_impl<double>(handle, m, n, Q, ldq, R, ldr, j, x, incx,
+                                                           batch_count);
+}
+
+rocblas_status rocsolver_cqrinc_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const Q[],
+                                        const rocblas_int ldq,
+                                        rocblas_float_complex* const R[],
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        rocblas_float_complex* const x[],
+                                        const rocblas_int incx,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_qrinc_batched_impl<rocblas_float_complex>(
+        handle, m, n, Q, ldq, R, ldr, j, x, incx, batch_count);
+}
+
+rocblas_status rocsolver_zqrinc_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const Q[],
+                                        const rocblas_int ldq,
+                                        rocblas_double_complex* const R[],
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        rocblas_double_complex* const x[],
+                                        const rocblas_int incx,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_qrinc_batched_impl<rocblas_double_complex>(
+        handle, m, n, Q, ldq, R, ldr, j, x, incx, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,661 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    Device helpers for the QR updating routines. Every instance of the batch
+ *    is processed by a single thread block of BS1 threads; all the threads of
+ *    the block must call these functions.
+ * ===========================================================================
+ */
+
+/** QRUPD_ROTG computes a plane rotation G = [c s; -conj(s) c], with c real, such that
+    G * [f; g] = [r; 0]. On exit, f is overwritten by r. **/
+template <typename T, typename S>
+__device__ void qrupd_rotg(T& f, const T g, S& c, T& s)
+{
+    const S af = std::abs(f);
+    const S ag = std::abs(g);
+
+    if(ag == 0)
+    {
+        c = 1;
+        s = 0;
+    }
+    else if(af == 0)
+    {
+        c = 0;
+        s = conj(g) / ag;
+        f = ag;
+    }
+    else
+    {
+        // scale to avoid unnecessary overflow
+        const S t = std::max(af, ag);
+        const S nrm = t * std::sqrt((af / t) * (af / t) + (ag / t) * (ag / t));
+        const T ph = f / af;
+        c = af / nrm;
+        s = ph * conj(g) / nrm;
+        f = ph * nrm;
+    }
+}
+
+/** QRUPD_ROT_ROWS applies the rotation G = [c s; -conj(s) c] from the left to the rows x and y
+    of a matrix with leading dimension ld, on columns c0 to c1-1. **/
+template <typename T, typename S>
+__device__ void qrupd_rot_rows(const rocblas_int c0,
+                               const rocblas_int c1,
+                               T* x,
+                               T* y,
+                               const rocblas_int ld,
+                               const S c,
+                               const T s)
+{
+    for(rocblas_int k = c0 + hipThreadIdx_x; k < c1; k += BS1)
+    {
+        const int64_t o = k * static_cast<int64_t>(ld);
+        const T a = x[o];
+        const T b = y[o];
+        x[o] = c * a + s * b;
+        y[o] = -conj(s) * a + c * b;
+    }
+}
+
+/** QRUPD_ROT_COLS applies the rotation G' from the right to the columns x and y (of length nr)
+    of a matrix, where G = [c s; -conj(s) c]. **/
+template <typename T, typename S>
+__device__ void qrupd_rot_cols(const rocblas_int nr, T* x, T* y, const S c, const T s)
+{
+    for(rocblas_int k = hipThreadIdx_x; k < nr; k += BS1)
+    {
+        const T a = x[k];
+        const T b = y[k];
+        x[k] = c * a + conj(s) * b;
+        y[k] = -s * a + c * b;
+    }
+}
+
+/** QRUPD_MOVE copies the nr-by-nc block starting at src into the block starting at dst. Both
+    blocks have leading dimension ld and may overlap. The elements are moved in chunks of BS1,
+    starting from the end of the block that is farthest from the destination, so that no
+    element is overwritten before it has been read. **/
+template <typename T>
+__device__ void qrupd_move(const rocblas_int nr,
+                           const rocblas_int nc,
+                           const T* src,
+                           T* dst,
+                           const rocblas_int ld)
+{
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int ne = nr * nc;
+    const bool backward = (dst > src);
+
+    for(rocblas_int e0 = 0; e0 < ne; e0 += BS1)
+    {
+        const rocblas_int e = backward ? ne - 1 - e0 - tid : e0 + tid;
+        const bool active = (e >= 0 && e < ne);
+        int64_t o = 0;
+        T v = 0;
+        if(active)
+        {
+            o = (e % nr) + (e / nr) * static_cast<int64_t>(ld);
+            v = src[o];
+        }
+        __syncthreads();
+
+        if(active)
+            dst[o] = v;
+        __syncthreads();
+    }
+}
+
+/*
+ * ===========================================================================
+ *    Kernels
+ * ===========================================================================
+ */
+
+/** QRINR_KERNEL updates the QR factorization A = Q * R of an m-by-n matrix when row x is
+    inserted before row j (0-based) of A. R is updated in place to (m+1)-by-n and, if
+    provided, Q is updated in place to (m+1)-by-(m+1). **/
+template <typename T, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) qrinr_kernel(const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          U QQ,
+                                                          const rocblas_stride shiftQ,
+                                                          const rocblas_int ldq,
+                                                          const rocblas_stride strideQ,
+                                                          U RR,
+                                                          const rocblas_stride shiftR,
+                                                          const rocblas_int ldr,
+                                                          const rocblas_stride strideR,
+                                                          const rocblas_int j,
+                                                          V xx,
+                                                          const rocblas_stride shiftx,
+                                                          const rocblas_int incx,
+                                                          const rocblas_stride stridex)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* Q = QQ ? load_ptr_batch<T>(QQ, bid, shiftQ, strideQ) : nullptr;
+    T* R = n ? load_ptr_batch<T>(RR, bid, shiftR, strideR) : nullptr;
+    T* x = n ? load_ptr_batch<T>(xx, bid, shiftx, stridex) : nullptr;
+
+    __shared__ S sc;
+    __shared__ T ss;
+
+    // append x as the last row of R
+    for(rocblas_int k = tid; k < n; k += BS1)
+        R[m + k * static_cast<int64_t>(ldr)] = x[k * static_cast<int64_t>(incx)];
+
+    // Q = P * [Q 0; 0 1], where P moves the last row to position j
+    if(Q)
+    {
+        qrupd_move(m - j, m, Q + j, Q + j + 1, ldq);
+        for(rocblas_int k = tid; k < m; k += BS1)
+            Q[j + k * static_cast<int64_t>(ldq)] = 0;
+        for(rocblas_int i = tid; i <= m; i += BS1)
+            Q[i + m * static_cast<int64_t>(ldq)] = (i == j) ? 1 : 0;
+    }
+    __syncthreads();
+
+    // annihilate the last row of R
+    const rocblas_int dim = std::min(m, n);
+    for(rocblas_int i = 0; i < dim; ++i)
+    {
+        T* Ri = R + i + i * static_cast<int64_t>(ldr);
+        T* Rm = R + m + i * static_cast<int64_t>(ldr);
+        if(tid == 0)
+        {
+            qrupd_rotg(*Ri, *Rm, sc, ss);
+            *Rm = 0;
+        }
+        __syncthreads();
+
+        qrupd_rot_rows(1, n - i, Ri, Rm, ldr, sc, ss);
+        if(Q)
+            qrupd_rot_cols(m + 1, Q + i * static_cast<int64_t>(ldq),
+                           Q + m * static_cast<int64_t>(ldq), sc, ss);
+        __syncthreads();
+    }
+}
+
+/** QRDER_KERNEL updates the QR factorization A = Q * R of an m-by-n matrix when row j (0-based)
+    of A is deleted. Q and R are updated in place to (m-1)-by-(m-1) and (m-1)-by-n. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) qrder_kernel(const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          U QQ,
+                                                          const rocblas_stride shiftQ,
+                                                          const rocblas_int ldq,
+                                                          const rocblas_stride strideQ,
+                                                          U RR,
+                                                          const rocblas_stride shiftR,
+                                                          const rocblas_int ldr,
+                                                          const rocblas_stride strideR,
+                                                          const rocblas_int j)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* Q = load_ptr_batch<T>(QQ, bid, shiftQ, strideQ);
+    T* R = n ? load_ptr_batch<T>(RR, bid, shiftR, strideR) : nullptr;
+
+    __shared__ S sc;
+    __shared__ T ss;
+
+    // reduce row j of Q to a multiple of e_1 with rotations of adjacent columns, from the
+    // right; R becomes upper Hessenberg
+    for(rocblas_int i = m - 2; i >= 0; --i)
+    {
+        T* Qi = Q + i * static_cast<int64_t>(ldq);
+        T* Qi1 = Qi + ldq;
+        if(tid == 0)
+        {
+            T f = conj(Qi[j]);
+            qrupd_rotg(f, conj(Qi1[j]), sc, ss);
+        }
+        __syncthreads();
+
+        qrupd_rot_cols(m, Qi, Qi1, sc, ss);
+        qrupd_rot_rows(i, n, R + i, R + i + 1, ldr, sc, ss);
+        __syncthreads();
+    }
+
+    // drop the first row of R, and row j and the first column of Q
+    qrupd_move(m - 1, n, R + 1, R, ldr);
+    qrupd_move(m - 1 - j, m - 1, Q + j + 1 + ldq, Q + j + ldq, ldq);
+    qrupd_move(m - 1, m - 1, Q + ldq, Q, ldq);
+}
+
+/** QRINC_KERNEL updates the QR factorization A = Q * R of an m-by-n matrix when column x is
+    inserted before column j (0-based) of A. R is updated in place to m-by-(n+1); Q is
+    updated in place. **/
+template <typename T, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) qrinc_kernel(const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          U QQ,
+                                                          const rocblas_stride shiftQ,
+                                                          const rocblas_int ldq,
+                                                          const rocblas_stride strideQ,
+                                                          U RR,
+                                                          const rocblas_stride shiftR,
+                                                          const rocblas_int ldr,
+                                                          const rocblas_stride strideR,
+                                                          const rocblas_int j,
+                                                          V xx,
+                                                          const rocblas_stride shiftx,
+                                                          const rocblas_int incx,
+                                                          const rocblas_stride stridex)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* Q = load_ptr_batch<T>(QQ, bid, shiftQ, strideQ);
+    T* R = load_ptr_batch<T>(RR, bid, shiftR, strideR);
+    T* x = load_ptr_batch<T>(xx, bid, shiftx, stridex);
+
+    __shared__ S sc;
+    __shared__ T ss;
+
+    // move columns j to n-1 of R one position to the right
+    T* Rj = R + j * static_cast<int64_t>(ldr);
+    qrupd_move(m, n - j, Rj, Rj + ldr, ldr);
+
+    // the new column of R is Q' * x
+    for(rocblas_int i = tid; i < m; i += BS1)
+    {
+        const T* Qi = Q + i * static_cast<int64_t>(ldq);
+        T t = 0;
+        for(rocblas_int k = 0; k < m; ++k)
+            t += conj(Qi[k]) * x[k * static_cast<int64_t>(incx)];
+        Rj[i] = t;
+    }
+    __syncthreads();
+
+    // annihilate the new column below the diagonal, from the bottom up
+    for(rocblas_int i = m - 1; i > j; --i)
+    {
+        if(tid == 0)
+        {
+            qrupd_rotg(Rj[i - 1], Rj[i], sc, ss);
+            Rj[i] = 0;
+        }
+        __syncthreads();
+
+        qrupd_rot_rows(std::max(j + 1, i), n + 1, R + i - 1, R + i, ldr, sc, ss);
+        T* Qi = Q + i * static_cast<int64_t>(ldq);
+        qrupd_rot_cols(m, Qi - ldq, Qi, sc, ss);
+        __syncthreads();
+    }
+}
+
+/** QRDEC_KERNEL updates the QR factorization A = Q * R of an m-by-n matrix when column j
+    (0-based) of A is deleted. R is updated in place to m-by-(n-1) and, if provided, Q is
+    updated in place. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) qrdec_kernel(const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          U QQ,
+                                                          const rocblas_stride shiftQ,
+                                                          const rocblas_int ldq,
+                                                          const rocblas_stride strideQ,
+                                                          U RR,
+                                                          const rocblas_stride shiftR,
+                                                          const rocblas_int ldr,
+                                                          const rocblas_stride strideR,
+                                                          const rocblas_int j)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* Q = QQ ? load_ptr_batch<T>(QQ, bid, shiftQ, strideQ) : nullptr;
+    T* R = load_ptr_batch<T>(RR, bid, shiftR, strideR);
+
+    __shared__ S sc;
+    __shared__ T ss;
+
+    // move columns j+1 to n-1 of R one position to the left; R becomes upper Hessenberg
+    // from column j on
+    T* Rj = R + j * static_cast<int64_t>(ldr);
+    qrupd_move(m, n - 1 - j, Rj + ldr, Rj, ldr);
+
+    // annihilate the subdiagonal
+    const rocblas_int dim = std::min(m - 1, n - 1);
+    for(rocblas_int i = j; i < dim; ++i)
+    {
+        T* Ri = R + i + i * static_cast<int64_t>(ldr);
+        if(tid == 0)
+        {
+            qrupd_rotg(Ri[0], Ri[1], sc, ss);
+            Ri[1] = 0;
+        }
+        __syncthreads();
+
+        qrupd_rot_rows(i + 1, n - 1, R + i, R + i + 1, ldr, sc, ss);
+        if(Q)
+        {
+            T* Qi = Q + i * static_cast<int64_t>(ldq);
+            qrupd_rot_cols(m, Qi, Qi + ldq, sc, ss);
+        }
+        __syncthreads();
+    }
+}
+
+/*
+ * ===========================================================================
+ *    Argument checking
+ * ===========================================================================
+ */
+
+template <typename U, typename V>
+rocblas_status rocsolver_qrinr_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_int ldq,
+                                        U R,
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        V x,
+                                        const rocblas_int incx,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || ldq < m + 1 || ldr < m + 1 || j < 1 || j > m + 1 || incx < 1
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !R) || (n && !x))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename U>
+rocblas_status rocsolver_qrder_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_int ldq,
+                                        U R,
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 1 || n < 0 || ldq < m || ldr < m || j < 1 || j > m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!Q || (n && !R))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename U, typename V>
+rocblas_status rocsolver_qrinc_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_int ldq,
+                                        U R,
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        V x,
+                                        const rocblas_int incx,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || ldq < m || ldr < m || j < 1 || j > n + 1 || incx < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && !Q) || (m && !R) || (m && !x))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename U>
+rocblas_status rocsolver_qrdec_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_int ldq,
+                                        U R,
+                                        const rocblas_int ldr,
+                                        const rocblas_int j,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 1 || ldq < m || ldr < m || j < 1 || j > n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(m && !R)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/*
+ * ===========================================================================
+ *    Templates
+ * ===========================================================================
+ */
+
+template <typename T, typename U, typename V>
+rocblas_status rocsolver_qrinr_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_stride shiftQ,
+                                        const rocblas_int ldq,
+                                        const rocblas_stride strideQ,
+                                        U R,
+                                        const rocblas_stride shiftR,
+                                        const rocblas_int ldr,
+                                        const rocblas_stride strideR,
+                                        const rocblas_int j,
+                                        V x,
+                                        const rocblas_stride shiftx,
+                                        const rocblas_int incx,
+                                        const rocblas_stride stridex,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qrinr", "m:", m, "n:", n, "shiftQ:", shiftQ, "ldq:", ldq, "shiftR:", shiftR,
+                    "ldr:", ldr, "j:", j, "shiftx:", shiftx, "incx:", incx, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0 || (n == 0 && !Q))
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((qrinr_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                            m, n, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, j - 1, x,
+                            shiftx, incx, stridex);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_qrder_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_stride shiftQ,
+                                        const rocblas_int ldq,
+                                        const rocblas_stride strideQ,
+                                        U R,
+                                        const rocblas_stride shiftR,
+                                        const rocblas_int ldr,
+                                        const rocblas_stride strideR,
+                                        const rocblas_int j,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qrder", "m:", m, "n:", n, "shiftQ:", shiftQ, "ldq:", ldq, "shiftR:", shiftR,
+                    "ldr:", ldr, "j:", j, "bc:", batch_count);
+
+    // quick return
+    if(m == 1 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((qrder_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                            m, n, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, j - 1);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U, typename V>
+rocblas_status rocsolver_qrinc_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_stride shiftQ,
+                                        const rocblas_int ldq,
+                                        const rocblas_stride strideQ,
+                                        U R,
+                                        const rocblas_stride shiftR,
+                                        const rocblas_int ldr,
+                                        const rocblas_stride strideR,
+                                        const rocblas_int j,
+                                        V x,
+                                        const rocblas_stride shiftx,
+                                        const rocblas_int incx,
+                                        const rocblas_stride stridex,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qrinc", "m:", m, "n:", n, "shiftQ:", shiftQ, "ldq:", ldq, "shiftR:", shiftR,
+                    "ldr:", ldr, "j:", j, "shiftx:", shiftx, "incx:", incx, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((qrinc_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                            m, n, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, j - 1, x,
+                            shiftx, incx, stridex);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_qrdec_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U Q,
+                                        const rocblas_stride shiftQ,
+                                        const rocblas_int ldq,
+                                        const rocblas_stride strideQ,
+                                        U R,
+                                        const rocblas_stride shiftR,
+                                        const rocblas_int ldr,
+                                        const rocblas_stride strideR,
+                                        const rocblas_int j,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qrdec", "m:", m, "n:", n, "shiftQ:", shiftQ, "ldq:", ldq, "shiftR:", shiftR,
+                    "ldr:", ldr, "j:", j, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((qrdec_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0, stream,
+                            m, n, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, j - 1);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
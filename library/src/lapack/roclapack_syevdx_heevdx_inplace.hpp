@@ -331,6 +331,8 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
     }
 
     // copy nev from device to host
+    // (the in-place routines return nev in host memory and must synchronize the stream;
+    // they cannot be captured into a hipGraph and are excluded from the graph cache)
     if(h_nev)
     {
         HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
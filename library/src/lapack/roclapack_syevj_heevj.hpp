@@ -1518,15 +1518,25 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
                                 half_blocks, n, A, shiftA, lda, strideA, atol, residual, Acpy,
                                 norms, top, bottom, completed);
 
+        // the early exit requires reading from the device, which is not possible while the
+        // stream is being captured; in that case, all the sweeps are enqueued (the kernels
+        // skip the instances that have already converged)
+        hipStreamCaptureStatus capture_status;
+        HIP_CHECK(hipStreamIsCapturing(stream, &capture_status));
+        bool capturing = (capture_status != hipStreamCaptureStatusNone);
+
         while(h_sweeps < max_sweeps)
         {
             // if all instances in the batch have finished, exit the loop
-            HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
-                                     hipMemcpyDeviceToHost, stream));
-            HIP_CHECK(hipStreamSynchronize(stream));
+            if(!capturing)
+            {
+                HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
+                                         hipMemcpyDeviceToHost, stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
 
-            if(h_completed == batch_count)
-                break;
+                if(h_completed == batch_count)
+                    break;
+            }
 
             // decompose diagonal blocks
             ROCSOLVER_LAUNCH_KERNEL(syevj_diag_kernel<T>, gridDK, threadsDK, lmemsizeDK, stream, n,
@@ -603,11 +603,9 @@ rocblas_status rocsolver_csrrf_splitlu_template(rocblas_handle handle,
         // set Lp[0] = 0, Up[0] = 0
         // ------------------------
         {
-            const rocblas_int ival = static_cast<rocblas_int>(0);
+            HIP_CHECK(hipMemsetAsync(Lp, 0, sizeof(rocblas_int), stream));
 
-            HIP_CHECK(hipMemcpyAsync(Lp, &ival, sizeof(rocblas_int), hipMemcpyHostToDevice, stream));
-
-            HIP_CHECK(hipMemcpyAsync(Up, &ival, sizeof(rocblas_int), hipMemcpyHostToDevice, stream));
+            HIP_CHECK(hipMemsetAsync(Up, 0, sizeof(rocblas_int), stream));
         }
 
         // -----------------
@@ -535,6 +535,186 @@ ROCSOLVER_KERNEL void getf2_scale_update_kernel(const I m,
     }
 }
 
+/** getf2_reg_factor computes the LU factorization of a tiny square matrix of compile-time
+    size DIM held in registers by the calling thread. All loops are fully unrolled; row
+    interchanges are done with predicated swaps on compile-time indices to avoid spilling
+    the local array to scratch memory. The (0-based) pivot rows are returned in piv. **/
+template <int DIM, bool PIVOT, typename T, typename INFO>
+__device__ void getf2_reg_factor(T (&rA)[DIM][DIM], int (&piv)[DIM], INFO& myinfo)
+{
+    using S = decltype(std::real(T{}));
+
+    T pivot_value;
+
+    // for each pivot (main loop)
+#pragma unroll
+    for(int k = 0; k < DIM; ++k)
+    {
+        int pivot_index = k;
+
+        if constexpr(PIVOT)
+        {
+            // search pivot index
+            S pivot_abs = aabs<S>(rA[k][k]);
+#pragma unroll
+            for(int i = k + 1; i < DIM; ++i)
+            {
+                S test_abs = aabs<S>(rA[i][k]);
+                if(pivot_abs < test_abs)
+                {
+                    pivot_abs = test_abs;
+                    pivot_index = i;
+                }
+            }
+
+            // swap rows
+#pragma unroll
+            for(int i = k + 1; i < DIM; ++i)
+            {
+                if(i == pivot_index)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                        swap(rA[k][j], rA[i][j]);
+                }
+            }
+        }
+        piv[k] = pivot_index;
+
+        // check singularity and scale value for current column
+        pivot_value = rA[k][k];
+        if(pivot_value != T(0))
+            pivot_value = S(1) / pivot_value;
+        else if(myinfo == 0)
+            myinfo = k + 1;
+
+        // scale current column and update trailing matrix
+#pragma unroll
+        for(int i = k + 1; i < DIM; ++i)
+        {
+            rA[i][k] *= pivot_value;
+#pragma unroll
+            for(int j = k + 1; j < DIM; ++j)
+                rA[i][j] -= rA[i][k] * rA[k][j];
+        }
+    }
+}
+
+/** getf2_reg_kernel factorizes tiny square matrices of compile-time size DIM.
+    Each thread keeps a whole matrix in registers, so no shared memory or
+    synchronization is required. **/
+template <int DIM, bool PIVOT, typename T, typename I, typename INFO, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) getf2_reg_kernel(U AA,
+                                                              const rocblas_stride shiftA,
+                                                              const I lda,
+                                                              const rocblas_stride strideA,
+                                                              I* ipivA,
+                                                              const rocblas_stride shiftP,
+                                                              const rocblas_stride strideP,
+                                                              INFO* infoA,
+                                                              const I batch_count,
+                                                              const I offset,
+                                                              I* permut_idx,
+                                                              const rocblas_stride stridePI)
+{
+    const I id = hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + hipThreadIdx_x;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    INFO* info = infoA + id;
+
+    // local variables
+    T rA[DIM][DIM];
+    int piv[DIM];
+    INFO myinfo = 0; // to build info
+
+    // read matrix from global memory into registers
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+#pragma unroll
+        for(int i = 0; i < DIM; ++i)
+            rA[i][j] = A[i + j * lda];
+
+    getf2_reg_factor<DIM, PIVOT>(rA, piv, myinfo);
+
+    // write results to global memory
+    if constexpr(PIVOT)
+    {
+        I* ipiv = load_ptr_batch<I>(ipivA, id, shiftP, strideP);
+        I* permut = (permut_idx != nullptr ? permut_idx + id * stridePI : nullptr);
+#pragma unroll
+        for(int k = 0; k < DIM; ++k)
+        {
+            ipiv[k] = piv[k] + 1 + offset;
+            if(permut && piv[k] != k)
+                swap(permut[k], permut[piv[k]]);
+        }
+    }
+    if(*info == 0 && myinfo > 0)
+        *info = myinfo + offset;
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+#pragma unroll
+        for(int i = 0; i < DIM; ++i)
+            A[i + j * lda] = rA[i][j];
+}
+
+/** getrf_logdet_reg_kernel factorizes tiny square matrices of compile-time size DIM
+    in registers and reduces the factorization to log|det(A)| and the sign (phase in the
+    complex case) of det(A). The factors are never written back to global memory. **/
+template <int DIM, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) getrf_logdet_reg_kernel(U AA,
+                                                                     const rocblas_int shiftA,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideA,
+                                                                     S* logdetA,
+                                                                     T* signA,
+                                                                     rocblas_int* infoA,
+                                                                     const rocblas_int batch_count)
+{
+    const rocblas_int id = hipBlockIdx_x * static_cast<rocblas_int>(hipBlockDim_x) + hipThreadIdx_x;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+
+    // local variables
+    T rA[DIM][DIM];
+    int piv[DIM];
+    rocblas_int myinfo = 0;
+
+    // read matrix from global memory into registers
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+#pragma unroll
+        for(int i = 0; i < DIM; ++i)
+            rA[i][j] = A[i + j * static_cast<int64_t>(lda)];
+
+    getf2_reg_factor<DIM, true>(rA, piv, myinfo);
+
+    // reduce the diagonal of U and the row interchanges
+    S logdet = 0;
+    T sign = 1;
+#pragma unroll
+    for(int k = 0; k < DIM; ++k)
+    {
+        S d = std::abs(rA[k][k]);
+        logdet += std::log(d);
+        sign = (d == 0) ? T(0) : sign * (rA[k][k] / d);
+        if(piv[k] != k)
+            sign = -sign;
+    }
+
+    logdetA[id] = logdet;
+    signA[id] = sign;
+    infoA[id] = myinfo;
+}
+
 /*************************************************************
     Launchers of specilized  kernels
 *************************************************************/
@@ -567,6 +747,53 @@ rocblas_status getf2_run_small(rocblas_handle handle,
         ROCSOLVER_LAUNCH_KERNEL((getf2_npvt_small_kernel<DIM, T>), grid, block, lmemsize, stream,  \
                                 m, A, shiftA, lda, strideA, info, batch_count, offset)
 
+#define RUN_LUFACT_REG(DIM)                                                                        \
+    if constexpr(DIM <= GETF2_REG_MAX_SIZE(T))                                                     \
+    {                                                                                              \
+        if(pivot)                                                                                  \
+            ROCSOLVER_LAUNCH_KERNEL((getf2_reg_kernel<DIM, true, T>), grid, block, 0, stream, A,   \
+                                    shiftA, lda, strideA, ipiv, shiftP, strideP, info,             \
+                                    batch_count, offset, permut_idx, stride);                      \
+        else                                                                                       \
+            ROCSOLVER_LAUNCH_KERNEL((getf2_reg_kernel<DIM, false, T>), grid, block, 0, stream, A,  \
+                                    shiftA, lda, strideA, ipiv, shiftP, strideP, info,             \
+                                    batch_count, offset, permut_idx, stride);                      \
+    }
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // tiny square matrices are factorized entirely in registers,
+    // one matrix per thread
+    if(m == n && n <= GETF2_REG_MAX_SIZE(T))
+    {
+        dim3 grid((batch_count - 1) / BS1 + 1, 1, 1);
+        dim3 block(BS1, 1, 1);
+
+        switch(n)
+        {
+        case 1: RUN_LUFACT_REG(1); break;
+        case 2: RUN_LUFACT_REG(2); break;
+        case 3: RUN_LUFACT_REG(3); break;
+        case 4: RUN_LUFACT_REG(4); break;
+        case 5: RUN_LUFACT_REG(5); break;
+        case 6: RUN_LUFACT_REG(6); break;
+        case 7: RUN_LUFACT_REG(7); break;
+        case 8: RUN_LUFACT_REG(8); break;
+        case 9: RUN_LUFACT_REG(9); break;
+        case 10: RUN_LUFACT_REG(10); break;
+        case 11: RUN_LUFACT_REG(11); break;
+        case 12: RUN_LUFACT_REG(12); break;
+        case 13: RUN_LUFACT_REG(13); break;
+        case 14: RUN_LUFACT_REG(14); break;
+        case 15: RUN_LUFACT_REG(15); break;
+        case 16: RUN_LUFACT_REG(16); break;
+        default: ROCSOLVER_UNREACHABLE();
+        }
+
+        return rocblas_status_success;
+    }
+
     // determine sizes
     I opval[] = {GETF2_OPTIM_NGRP};
     I ngrp = (batch_count < 2 || m > 32) ? 1 : opval[m - 1];
@@ -582,8 +809,6 @@ rocblas_status getf2_run_small(rocblas_handle handle,
     dim3 grid(1, blocks, 1);
     dim3 block(nthds, ngrp, 1);
     size_t lmemsize = msize * ngrp * sizeof(T);
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
 
     // instantiate cases to make number of columns n known at compile time
     // this should allow loop unrolling.
@@ -660,6 +885,54 @@ rocblas_status getf2_run_small(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/** launcher of getrf_logdet_reg_kernel **/
+template <typename T, typename S, typename U>
+rocblas_status getrf_logdet_run_reg(rocblas_handle handle,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    S* logdet,
+                                    T* sign,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count)
+{
+#define RUN_LOGDET_REG(DIM)                                                                        \
+    if constexpr(DIM <= GETF2_REG_MAX_SIZE(T))                                                     \
+        ROCSOLVER_LAUNCH_KERNEL((getrf_logdet_reg_kernel<DIM, T>), grid, block, 0, stream, A,      \
+                                shiftA, lda, strideA, logdet, sign, info, batch_count)
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 grid((batch_count - 1) / BS1 + 1, 1, 1);
+    dim3 block(BS1, 1, 1);
+
+    switch(n)
+    {
+    case 1: RUN_LOGDET_REG(1); break;
+    case 2: RUN_LOGDET_REG(2); break;
+    case 3: RUN_LOGDET_REG(3); break;
+    case 4: RUN_LOGDET_REG(4); break;
+    case 5: RUN_LOGDET_REG(5); break;
+    case 6: RUN_LOGDET_REG(6); break;
+    case 7: RUN_LOGDET_REG(7); break;
+    case 8: RUN_LOGDET_REG(8); break;
+    case 9: RUN_LOGDET_REG(9); break;
+    case 10: RUN_LOGDET_REG(10); break;
+    case 11: RUN_LOGDET_REG(11); break;
+    case 12: RUN_LOGDET_REG(12); break;
+    case 13: RUN_LOGDET_REG(13); break;
+    case 14: RUN_LOGDET_REG(14); break;
+    case 15: RUN_LOGDET_REG(15); break;
+    case 16: RUN_LOGDET_REG(16); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
 /** launcher of getf2_panel_kernel **/
 template <typename T, typename I, typename INFO, typename U>
 rocblas_status getf2_run_panel(rocblas_handle handle,
@@ -760,6 +1033,11 @@ void getf2_run_scale_update(rocblas_handle handle,
         const I lda, const rocblas_stride strideA, I* ipiv, const rocblas_stride shiftP, \
         const rocblas_stride strideP, INFO* info, const I batch_count, const bool pivot, \
         const I offset, I* permut_idx, const rocblas_stride stride)
+#define INSTANTIATE_GETRF_LOGDET_REG(T, S, U)                                      \
+    template rocblas_status getrf_logdet_run_reg<T, S, U>(                         \
+        rocblas_handle handle, const rocblas_int n, U A, const rocblas_int shiftA, \
+        const rocblas_int lda, const rocblas_stride strideA, S* logdet, T* sign,   \
+        rocblas_int* info, const rocblas_int batch_count)
 #define INSTANTIATE_GETF2_PANEL(T, I, INFO, U)                                           \
     template rocblas_status getf2_run_panel<T, I, INFO, U>(                              \
         rocblas_handle handle, const I m, const I n, U A, const rocblas_stride shiftA,   \
@@ -39,6 +39,9 @@ INSTANTIATE_GETF2_PANEL(rocblas_float_complex, rocblas_int, rocblas_int, rocblas
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_int, rocblas_float_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_int, rocblas_float_complex* const*);
 
+INSTANTIATE_GETRF_LOGDET_REG(rocblas_float_complex, float, rocblas_float_complex*);
+INSTANTIATE_GETRF_LOGDET_REG(rocblas_float_complex, float, rocblas_float_complex* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, int64_t, int64_t, rocblas_float_complex*);
@@ -39,6 +39,9 @@ INSTANTIATE_GETF2_PANEL(double, rocblas_int, rocblas_int, double* const*);
 INSTANTIATE_GETF2_SCALE_UPDATE(double, rocblas_int, double*);
 INSTANTIATE_GETF2_SCALE_UPDATE(double, rocblas_int, double* const*);
 
+INSTANTIATE_GETRF_LOGDET_REG(double, double, double*);
+INSTANTIATE_GETRF_LOGDET_REG(double, double, double* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GETF2_PANEL(double, int64_t, int64_t, double*);
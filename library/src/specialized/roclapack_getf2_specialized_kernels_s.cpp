@@ -39,6 +39,9 @@ INSTANTIATE_GETF2_PANEL(float, rocblas_int, rocblas_int, float* const*);
 INSTANTIATE_GETF2_SCALE_UPDATE(float, rocblas_int, float*);
 INSTANTIATE_GETF2_SCALE_UPDATE(float, rocblas_int, float* const*);
 
+INSTANTIATE_GETRF_LOGDET_REG(float, float, float*);
+INSTANTIATE_GETRF_LOGDET_REG(float, float, float* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GETF2_PANEL(float, int64_t, int64_t, float*);
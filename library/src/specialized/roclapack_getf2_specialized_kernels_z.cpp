@@ -42,6 +42,9 @@ INSTANTIATE_GETF2_PANEL(rocblas_double_complex,
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_int, rocblas_double_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_int, rocblas_double_complex* const*);
 
+INSTANTIATE_GETRF_LOGDET_REG(rocblas_double_complex, double, rocblas_double_complex*);
+INSTANTIATE_GETRF_LOGDET_REG(rocblas_double_complex, double, rocblas_double_complex* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GETF2_PANEL(rocblas_double_complex, int64_t, int64_t, rocblas_double_complex*);
@@ -389,6 +389,140 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     __syncthreads();
 }
 
+/** potf2_reg_factor computes the Cholesky factorization of a tiny matrix of compile-time
+    size DIM whose lower triangle is held in registers by the calling thread. All loops
+    are fully unrolled. On exit, myinfo is the first column where the matrix was found
+    not to be positive definite, if any. **/
+template <int DIM, typename T>
+__device__ void potf2_reg_factor(T (&rA)[DIM][DIM], rocblas_int& myinfo)
+{
+    using S = decltype(std::real(T{}));
+
+    // for each column (main loop)
+#pragma unroll
+    for(int k = 0; k < DIM; ++k)
+    {
+        S const akk = std::real(rA[k][k]);
+        if(!((akk > 0) && std::isfinite(akk)))
+        {
+            rA[k][k] = akk;
+            // Fortran 1-based index
+            myinfo = k + 1;
+            break;
+        }
+
+        S const lkk = std::sqrt(akk);
+        S const ilkk = S(1) / lkk;
+        rA[k][k] = lkk;
+
+        // scale current column and update trailing matrix
+#pragma unroll
+        for(int i = k + 1; i < DIM; ++i)
+            rA[i][k] *= ilkk;
+#pragma unroll
+        for(int j = k + 1; j < DIM; ++j)
+        {
+#pragma unroll
+            for(int i = j; i < DIM; ++i)
+                rA[i][j] -= rA[i][k] * conj(rA[j][k]);
+        }
+    }
+}
+
+/** potf2_reg_load reads the triangular part of a tiny matrix into the lower
+    triangle of the local array rA (the upper case is stored as the conjugate transpose) **/
+template <int DIM, typename T>
+__device__ void potf2_reg_load(const bool is_upper, T* A, const rocblas_int lda, T (&rA)[DIM][DIM])
+{
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+    {
+#pragma unroll
+        for(int i = j; i < DIM; ++i)
+            rA[i][j] = is_upper ? conj(A[j + i * static_cast<int64_t>(lda)])
+                                : A[i + j * static_cast<int64_t>(lda)];
+    }
+}
+
+/** potf2_reg_kernel factorizes tiny matrices of compile-time size DIM.
+    Each thread keeps the lower triangle of a whole matrix in registers
+    (the upper case is handled as the conjugate transpose). No shared memory
+    or synchronization is required. **/
+template <int DIM, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) potf2_reg_kernel(const bool is_upper,
+                                                              U AA,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_int* const info,
+                                                              const rocblas_int batch_count)
+{
+    auto const bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
+
+    // local variables
+    T rA[DIM][DIM];
+    rocblas_int myinfo = 0;
+
+    potf2_reg_load(is_upper, A, lda, rA);
+    potf2_reg_factor(rA, myinfo);
+
+    // write results to global memory
+    if(myinfo > 0 && info[bid] == 0)
+        info[bid] = myinfo;
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+    {
+#pragma unroll
+        for(int i = j; i < DIM; ++i)
+        {
+            if(is_upper)
+                A[j + i * static_cast<int64_t>(lda)] = conj(rA[i][j]);
+            else
+                A[i + j * static_cast<int64_t>(lda)] = rA[i][j];
+        }
+    }
+}
+
+/** potrf_logdet_reg_kernel factorizes tiny matrices of compile-time size DIM in
+    registers and reduces the factorization to log(det(A)). The factor is never
+    written back to global memory. **/
+template <int DIM, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) potrf_logdet_reg_kernel(const bool is_upper,
+                                                                     U AA,
+                                                                     const rocblas_int shiftA,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideA,
+                                                                     S* logdet,
+                                                                     rocblas_int* const info,
+                                                                     const rocblas_int batch_count)
+{
+    auto const bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
+
+    // local variables
+    T rA[DIM][DIM];
+    rocblas_int myinfo = 0;
+
+    potf2_reg_load(is_upper, A, lda, rA);
+    potf2_reg_factor(rA, myinfo);
+
+    // det(A) is the squared product of the diagonal of the factor
+    S val = 0;
+#pragma unroll
+    for(int k = 0; k < DIM; ++k)
+        val += std::log(std::real(rA[k][k]));
+
+    logdet[bid] = 2 * val;
+    info[bid] = myinfo;
+}
+
 /*************************************************************
     Launchers of specilized kernels
 *************************************************************/
@@ -410,15 +544,99 @@ rocblas_status potf2_run_small(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    size_t lmemsize = sizeof(T) * (n * (n + 1)) / 2;
-
     bool const is_upper = (uplo == rocblas_fill_upper);
+
+    // tiny matrices are factorized entirely in registers, one matrix per thread
+    if(n <= POTF2_REG_MAX_SIZE(T))
+    {
+#define RUN_CHOLFACT_REG(DIM)                                                                      \
+    if constexpr(DIM <= POTF2_REG_MAX_SIZE(T))                                                     \
+        ROCSOLVER_LAUNCH_KERNEL((potf2_reg_kernel<DIM, T, U>), grid, block, 0, stream, is_upper,   \
+                                A, shiftA, lda, strideA, info, batch_count)
+
+        dim3 grid((batch_count - 1) / BS1 + 1, 1, 1);
+        dim3 block(BS1, 1, 1);
+
+        switch(n)
+        {
+        case 1: RUN_CHOLFACT_REG(1); break;
+        case 2: RUN_CHOLFACT_REG(2); break;
+        case 3: RUN_CHOLFACT_REG(3); break;
+        case 4: RUN_CHOLFACT_REG(4); break;
+        case 5: RUN_CHOLFACT_REG(5); break;
+        case 6: RUN_CHOLFACT_REG(6); break;
+        case 7: RUN_CHOLFACT_REG(7); break;
+        case 8: RUN_CHOLFACT_REG(8); break;
+        case 9: RUN_CHOLFACT_REG(9); break;
+        case 10: RUN_CHOLFACT_REG(10); break;
+        case 11: RUN_CHOLFACT_REG(11); break;
+        case 12: RUN_CHOLFACT_REG(12); break;
+        case 13: RUN_CHOLFACT_REG(13); break;
+        case 14: RUN_CHOLFACT_REG(14); break;
+        case 15: RUN_CHOLFACT_REG(15); break;
+        case 16: RUN_CHOLFACT_REG(16); break;
+        default: ROCSOLVER_UNREACHABLE();
+        }
+
+        return rocblas_status_success;
+    }
+
+    size_t lmemsize = sizeof(T) * (n * (n + 1)) / 2;
     ROCSOLVER_LAUNCH_KERNEL((potf2_kernel_small<T, U>), dim3(1, 1, batch_count), dim3(BS2, BS2, 1),
                             lmemsize, stream, is_upper, n, A, shiftA, lda, strideA, info);
 
     return rocblas_status_success;
 }
 
+/** launcher of potrf_logdet_reg_kernel **/
+template <typename T, typename S, typename U>
+rocblas_status potrf_logdet_run_reg(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    S* logdet,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count)
+{
+#define RUN_CHOLLOGDET_REG(DIM)                                                                    \
+    if constexpr(DIM <= POTF2_REG_MAX_SIZE(T))                                                     \
+        ROCSOLVER_LAUNCH_KERNEL((potrf_logdet_reg_kernel<DIM, T>), grid, block, 0, stream,         \
+                                is_upper, A, shiftA, lda, strideA, logdet, info, batch_count)
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    bool const is_upper = (uplo == rocblas_fill_upper);
+    dim3 grid((batch_count - 1) / BS1 + 1, 1, 1);
+    dim3 block(BS1, 1, 1);
+
+    switch(n)
+    {
+    case 1: RUN_CHOLLOGDET_REG(1); break;
+    case 2: RUN_CHOLLOGDET_REG(2); break;
+    case 3: RUN_CHOLLOGDET_REG(3); break;
+    case 4: RUN_CHOLLOGDET_REG(4); break;
+    case 5: RUN_CHOLLOGDET_REG(5); break;
+    case 6: RUN_CHOLLOGDET_REG(6); break;
+    case 7: RUN_CHOLLOGDET_REG(7); break;
+    case 8: RUN_CHOLLOGDET_REG(8); break;
+    case 9: RUN_CHOLLOGDET_REG(9); break;
+    case 10: RUN_CHOLLOGDET_REG(10); break;
+    case 11: RUN_CHOLLOGDET_REG(11); break;
+    case 12: RUN_CHOLLOGDET_REG(12); break;
+    case 13: RUN_CHOLLOGDET_REG(13); break;
+    case 14: RUN_CHOLLOGDET_REG(14); break;
+    case 15: RUN_CHOLLOGDET_REG(15); break;
+    case 16: RUN_CHOLLOGDET_REG(16); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
 /*************************************************************
     Instantiation macros
 *************************************************************/
@@ -429,4 +647,10 @@ rocblas_status potf2_run_small(rocblas_handle handle,
         const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, \
         rocblas_int* info, const rocblas_int batch_count)
 
+#define INSTANTIATE_POTRF_LOGDET_REG(T, S, U)                                          \
+    template rocblas_status potrf_logdet_run_reg<T, S, U>(                             \
+        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, U A,      \
+        const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, \
+        S* logdet, rocblas_int* info, const rocblas_int batch_count)
+
 ROCSOLVER_END_NAMESPACE
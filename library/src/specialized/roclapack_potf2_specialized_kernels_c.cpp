@@ -36,4 +36,7 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_POTF2_SMALL(rocblas_float_complex, rocblas_float_complex*);
 INSTANTIATE_POTF2_SMALL(rocblas_float_complex, rocblas_float_complex* const*);
 
+INSTANTIATE_POTRF_LOGDET_REG(rocblas_float_complex, float, rocblas_float_complex*);
+INSTANTIATE_POTRF_LOGDET_REG(rocblas_float_complex, float, rocblas_float_complex* const*);
+
 ROCSOLVER_END_NAMESPACE
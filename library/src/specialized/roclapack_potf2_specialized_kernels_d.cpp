@@ -36,4 +36,7 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_POTF2_SMALL(double, double*);
 INSTANTIATE_POTF2_SMALL(double, double* const*);
 
+INSTANTIATE_POTRF_LOGDET_REG(double, double, double*);
+INSTANTIATE_POTRF_LOGDET_REG(double, double, double* const*);
+
 ROCSOLVER_END_NAMESPACE
@@ -36,4 +36,7 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_POTF2_SMALL(float, float*);
 INSTANTIATE_POTF2_SMALL(float, float* const*);
 
+INSTANTIATE_POTRF_LOGDET_REG(float, float, float*);
+INSTANTIATE_POTRF_LOGDET_REG(float, float, float* const*);
+
 ROCSOLVER_END_NAMESPACE
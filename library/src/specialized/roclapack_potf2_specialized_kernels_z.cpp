@@ -36,4 +36,7 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_double_complex*);
 INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
 
+INSTANTIATE_POTRF_LOGDET_REG(rocblas_double_complex, double, rocblas_double_complex*);
+INSTANTIATE_POTRF_LOGDET_REG(rocblas_double_complex, double, rocblas_double_complex* const*);
+
 ROCSOLVER_END_NAMESPACE
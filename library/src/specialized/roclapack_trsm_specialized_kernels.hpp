@@ -781,6 +781,32 @@ rocblas_status rocsolver_trsm_mem(const rocblas_side side,
                                             size_work2, size_work3, size_work4);
 }
 
+/** Some architectures require synchronization between the substitution kernels and the
+    rocBLAS gemm that consumes their results (more investigation needed).
+    rocsolver_trsm_need_sync returns true on those architectures (gfx940 and gfx941). Host
+    synchronization is not allowed while the stream is being captured in a HIP graph; in that
+    case, no synchronization is added and the kernels are ordered by the graph dependencies. **/
+inline rocblas_status rocsolver_trsm_need_sync(hipStream_t stream, bool* do_sync)
+{
+    int device;
+    HIP_CHECK(hipGetDevice(&device));
+    hipDeviceProp_t deviceProperties;
+    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
+    std::string deviceFullString(deviceProperties.gcnArchName);
+    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
+    *do_sync = (deviceString.find("gfx940") != std::string::npos
+                || deviceString.find("gfx941") != std::string::npos);
+
+    if(*do_sync)
+    {
+        hipStreamCaptureStatus capture_status;
+        HIP_CHECK(hipStreamIsCapturing(stream, &capture_status));
+        *do_sync = (capture_status == hipStreamCaptureStatusNone);
+    }
+
+    return rocblas_status_success;
+}
+
 /** Internal TRSM (lower case):
     Optimized function that solves systems
     B <- LX = B,
@@ -851,15 +877,8 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                                 optim_mem, work1, work2, work3, work4);
     }
 
-    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels; more investigation needed
-    int device;
-    HIP_CHECK(hipGetDevice(&device));
-    hipDeviceProp_t deviceProperties;
-    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
-    std::string deviceFullString(deviceProperties.gcnArchName);
-    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
-    bool do_sync = (deviceString.find("gfx940") != std::string::npos
-                    || deviceString.find("gfx941") != std::string::npos);
+    bool do_sync;
+    ROCBLAS_CHECK(rocsolver_trsm_need_sync(stream, &do_sync));
 
     // ****** MAIN LOOP ***********
     if(isleft)
@@ -1134,15 +1153,8 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                                 optim_mem, work1, work2, work3, work4);
     }
 
-    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels; more investigation needed
-    int device;
-    HIP_CHECK(hipGetDevice(&device));
-    hipDeviceProp_t deviceProperties;
-    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
-    std::string deviceFullString(deviceProperties.gcnArchName);
-    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
-    bool do_sync = (deviceString.find("gfx940") != std::string::npos
-                    || deviceString.find("gfx941") != std::string::npos);
+    bool do_sync;
+    ROCBLAS_CHECK(rocsolver_trsm_need_sync(stream, &do_sync));
 
     // ****** MAIN LOOP ***********
     if(isleft)